@@ -124,6 +124,10 @@ int main()
         auto invoker_ptr    = op_ptr->MakeInvokerPointer();
         std::string op_name = op_ptr->GetTypeString();
 
+        // the explicit GEMM instances need a workspace to be supported
+        SimpleDeviceMem workspace(op_ptr->GetWorkSpaceSize(argument_ptr.get()));
+        op_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace.GetDeviceBuffer());
+
         if(op_ptr->IsSupportedArgument(argument_ptr.get()))
         {
             float avg_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, true});
@@ -190,6 +194,9 @@ int main()
 
         auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
+        SimpleDeviceMem workspace(op_ptr->GetWorkSpaceSize(argument_ptr.get()));
+        op_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace.GetDeviceBuffer());
+
         if(op_ptr->IsSupportedArgument(argument_ptr.get()))
         {
             invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false});
@@ -0,0 +1,132 @@
+# Manifest of the instances to build, CK_INSTANCE_MANIFEST. One entry per line, # for comments:
+#
+#   targets gfx90a gfx942
+#   gemm f16 bf16 mk_nk_mn
+#   grouped_conv2d_fwd f16 nhwgc_gkyxc_nhwgk
+#
+# targets sets GPU_TARGETS. The other lines name an op family, a directory of
+# library/src/tensor_operation_instance/gpu, followed by the data types and layouts to build for
+# it; a source of the family is built if its file name contains one of the data types, when some
+# are listed, and one of the layouts, when some are listed. The families not in the manifest are
+# not built.
+
+# data types as they appear in the file names of the instances
+set(CK_INSTANCE_DATA_TYPES f8 bf8 f16 bf16 f32 f64 i4 i8 i32)
+
+function(ck_normalize_data_type VAR TOKEN)
+    if(TOKEN STREQUAL "fp8")
+        set(${VAR} f8 PARENT_SCOPE)
+    elseif(TOKEN STREQUAL "b16")
+        set(${VAR} bf16 PARENT_SCOPE)
+    elseif(TOKEN STREQUAL "int8")
+        set(${VAR} i8 PARENT_SCOPE)
+    else()
+        set(${VAR} ${TOKEN} PARENT_SCOPE)
+    endif()
+endfunction()
+
+# sets CK_MANIFEST_TARGETS, CK_MANIFEST_OPS and CK_MANIFEST_<op>_DATA_TYPES / _LAYOUTS
+function(ck_read_instance_manifest MANIFEST)
+    if(NOT EXISTS ${MANIFEST})
+        message(FATAL_ERROR "wrong! instance manifest ${MANIFEST} not found")
+    endif()
+
+    set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS ${MANIFEST})
+
+    file(STRINGS ${MANIFEST} lines)
+    set(ops)
+    foreach(line ${lines})
+        string(REGEX REPLACE "#.*" "" line "${line}")
+        string(STRIP "${line}" line)
+        if(line STREQUAL "")
+            continue()
+        endif()
+        string(REGEX REPLACE "[ \t]+" ";" tokens "${line}")
+        list(GET tokens 0 op)
+        list(REMOVE_AT tokens 0)
+
+        if(op STREQUAL "targets")
+            set(CK_MANIFEST_TARGETS ${tokens} PARENT_SCOPE)
+            continue()
+        endif()
+
+        if(NOT IS_DIRECTORY ${PROJECT_SOURCE_DIR}/library/src/tensor_operation_instance/gpu/${op})
+            message(FATAL_ERROR "wrong! unknown op family ${op} in ${MANIFEST}")
+        endif()
+
+        set(data_types)
+        set(layouts)
+        foreach(token ${tokens})
+            ck_normalize_data_type(token ${token})
+            if(token IN_LIST CK_INSTANCE_DATA_TYPES)
+                list(APPEND data_types ${token})
+            else()
+                list(APPEND layouts ${token})
+            endif()
+        endforeach()
+
+        list(APPEND ops ${op})
+        set(CK_MANIFEST_${op}_DATA_TYPES ${data_types} PARENT_SCOPE)
+        set(CK_MANIFEST_${op}_LAYOUTS ${layouts} PARENT_SCOPE)
+    endforeach()
+    set(CK_MANIFEST_OPS ${ops} PARENT_SCOPE)
+endfunction()
+
+# splits the sources of the instance library of op into the ones the manifest selects and the
+# others. The reduce instances are explicit instantiations of templates declared extern by the
+# headers, they cannot be replaced by the registry and are always built.
+function(ck_filter_instance_sources SELECTED EXCLUDED OP)
+    set(selected)
+    set(excluded)
+    foreach(source ${ARGN})
+        get_filename_component(path ${source} ABSOLUTE)
+        get_filename_component(name ${source} NAME_WE)
+
+        set(keep OFF)
+        if(OP IN_LIST CK_MANIFEST_OPS)
+            set(keep ON)
+
+            if(CK_MANIFEST_${OP}_DATA_TYPES)
+                set(found OFF)
+                string(REPLACE "_" ";" tokens ${name})
+                foreach(token ${tokens})
+                    ck_normalize_data_type(token ${token})
+                    if(token IN_LIST CK_MANIFEST_${OP}_DATA_TYPES)
+                        set(found ON)
+                    endif()
+                endforeach()
+                if(NOT found)
+                    set(keep OFF)
+                endif()
+            endif()
+
+            if(CK_MANIFEST_${OP}_LAYOUTS)
+                set(found OFF)
+                foreach(layout ${CK_MANIFEST_${OP}_LAYOUTS})
+                    string(FIND "_${name}_" "_${layout}_" pos)
+                    if(NOT pos EQUAL -1)
+                        set(found ON)
+                    endif()
+                endforeach()
+                if(NOT found)
+                    set(keep OFF)
+                endif()
+            endif()
+        endif()
+
+        if(NOT keep)
+            file(STRINGS ${path} explicit_instantiations REGEX "^template void add_")
+            if(explicit_instantiations)
+                set(keep ON)
+            endif()
+        endif()
+
+        if(keep)
+            list(APPEND selected ${source})
+        else()
+            list(APPEND excluded ${path})
+        endif()
+    endforeach()
+    set(${SELECTED} ${selected} PARENT_SCOPE)
+    set(${EXCLUDED} ${excluded} PARENT_SCOPE)
+endfunction()
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <cstdlib>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_weight_only_quant_impl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/weight_only_quant.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_weight_only_quant.hpp"
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using AElementOp  = PassThrough;
+using CElementOp  = PassThrough;
+
+using ADataType     = F16;
+using ScaleDataType = F16;
+using AccDataType   = F32;
+using EDataType     = F16;
+
+static constexpr ck::index_t WeightBits = 4;
+
+// clang-format off
+using DeviceOpInstance = ck::tensor_operation::device::DeviceGemmWeightOnlyQuantImpl
+//######| AData| ScaleData|  Acc| EData|     Weight|           A|           C| Block|  MPer|  NPer|   KPer|
+//######|  Type|      Type| Type|  Type|       Bits| Elementwise| Elementwise|  Size| Block| Block| Thread|
+//######|      |          |     |      |           |   Operation|   Operation|      |      |      |       |
+        <   F16,       F16,  F32,   F16, WeightBits,  AElementOp,  CElementOp,   256,     1,     8,     32>;
+// clang-format on
+
+using ReferenceGemmInstance =
+    ck::tensor_operation::host::ReferenceGemmWeightOnlyQuant<ADataType,
+                                                             ScaleDataType,
+                                                             EDataType,
+                                                             AccDataType,
+                                                             WeightBits,
+                                                             AElementOp,
+                                                             CElementOp>;
+
+#include "run_gemm_weight_only_quant_example.inc"
+
+int main(int argc, char* argv[]) { return !run_gemm_weight_only_quant_example(argc, argv); }
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_segmented_softmax_impl.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_segmented_softmax.hpp"
+
+using InDataType  = ck::half_t;
+using OutDataType = ck::half_t;
+using AccDataType = float;
+
+using DeviceInstance =
+    ck::tensor_operation::device::DeviceSegmentedSoftmaxImpl<InDataType,
+                                                             AccDataType,
+                                                             OutDataType,
+                                                             256, // BlockSize
+                                                             32,  // MThreadClusterSize
+                                                             8,   // KThreadClusterSize
+                                                             4,   // MThreadSliceSize
+                                                             4,   // KThreadSliceSize
+                                                             4,   // InSrcVectorSize
+                                                             4>;  // OutDstVectorSize
+
+using ReferenceInstance =
+    ck::tensor_operation::host::ReferenceSegmentedSoftmax<InDataType, OutDataType, AccDataType>;
+
+int main()
+{
+    bool do_verification = true;
+    bool time_kernel     = false;
+
+    // softmax over the nodes of each graph of a batch, e.g. the attention of a graph readout
+    int num_segments = 64;
+    int inner_length = 256;
+
+    std::mt19937 gen(11939);
+    std::uniform_int_distribution<int> length_dist(0, 1000);
+
+    std::vector<ck::index_t> offsets(num_segments + 1, 0);
+    for(int i = 0; i < num_segments; ++i)
+        offsets[i + 1] = offsets[i] + (i % 16 == 0 ? 0 : length_dist(gen));
+
+    const int total_length = offsets.back();
+
+    double alpha = 2.0;
+    double beta  = 2.0;
+
+    Tensor<InDataType> in(HostTensorDescriptor{total_length, inner_length});
+    Tensor<OutDataType> out_ref(HostTensorDescriptor{total_length, inner_length});
+    Tensor<OutDataType> out(HostTensorDescriptor{total_length, inner_length});
+
+    in.GenerateTensorValue(GeneratorTensor_3<InDataType>{-5.0, 5.0});
+    out_ref.GenerateTensorValue(GeneratorTensor_3<OutDataType>{-1.0, 1.0});
+    out = out_ref;
+
+    DeviceMem in_dev(sizeof(InDataType) * in.mDesc.GetElementSpaceSize());
+    DeviceMem offsets_dev(sizeof(ck::index_t) * offsets.size());
+    DeviceMem out_dev(sizeof(OutDataType) * out.mDesc.GetElementSpaceSize());
+
+    in_dev.ToDevice(in.mData.data());
+    offsets_dev.ToDevice(offsets.data());
+    out_dev.ToDevice(out.mData.data());
+
+    const auto* p_offsets = static_cast<const ck::index_t*>(offsets_dev.GetDeviceBuffer());
+
+    auto device_instance = DeviceInstance{};
+    auto argument_ptr    = device_instance.MakeArgumentPointer(num_segments,
+                                                            inner_length,
+                                                            p_offsets,
+                                                            alpha,
+                                                            beta,
+                                                            in_dev.GetDeviceBuffer(),
+                                                            out_dev.GetDeviceBuffer());
+
+    if(!device_instance.IsSupportedArgument(argument_ptr.get()))
+    {
+        std::cout << "The runtime parameters seems not supported by the DeviceSegmentedSoftmax "
+                     "instance, exiting!"
+                  << std::endl;
+        return 1;
+    };
+
+    auto invoker_ptr = device_instance.MakeInvokerPointer();
+
+    bool pass = true;
+
+    if(do_verification)
+    {
+        invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        auto ref_argument = ReferenceInstance::MakeArgument(in, offsets, out_ref, alpha, beta);
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        out_dev.FromDevice(out.mData.data());
+        pass = ck::utils::check_err(out, out_ref);
+    };
+
+    if(time_kernel)
+    {
+        // beta is not zero, so the output is only verified on the first run
+        float avg_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        std::size_t num_bytes = in.mDesc.GetElementSize() * sizeof(InDataType) +
+                                2 * out.mDesc.GetElementSize() * sizeof(OutDataType);
+
+        float gb_per_sec = num_bytes / 1.E6 / avg_time;
+
+        std::cout << "Perf: " << avg_time << " ms, " << gb_per_sec << " GB/s, "
+                  << device_instance.GetTypeString() << std::endl;
+    }
+
+    return (pass ? 0 : 1);
+}
@@ -0,0 +1,297 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+
+#include "common.hpp"
+
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_fwd_multiple_d_winograd_xdl_cshuffle.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_winograd.hpp"
+
+using InDataType       = FP16;
+using WeiDataType      = FP16;
+using AccDataType      = FP32;
+using CShuffleDataType = FP16;
+using OutDataType      = FP16;
+
+using InElementOp  = PassThrough;
+using WeiElementOp = PassThrough;
+using OutElementOp = PassThrough;
+
+static constexpr auto WinogradConvSpec =
+    ck::tensor_operation::device::ConvolutionForwardSpecialization::Filter3x3Stride1;
+
+// the transformed operands are stored as fp16, the GEMM result as fp32
+template <ck::index_t OutputTileSize>
+using DeviceConvFwdInstance =
+    ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD_Winograd_Xdl_CShuffle<
+        2,
+        InputLayout<2>,
+        WeightLayout<2>,
+        ck::Tuple<>,
+        OutputLayout<2>,
+        InDataType,
+        WeiDataType,
+        AccDataType,
+        CShuffleDataType,
+        ck::Tuple<>,
+        OutDataType,
+        InElementOp,
+        WeiElementOp,
+        OutElementOp,
+        WinogradConvSpec, // ConvForwardSpecialization
+        OutputTileSize,   // OutputTileSize
+        GemmSpec,         // GemmSpecialization
+        1,                //
+        256,              // BlockSize
+        128,              // MPerBlock
+        256,              // NPerBlock
+        16,               // KPerBlock
+        4,                // AK1
+        4,                // BK1
+        32,               // MPerXdl
+        32,               // NPerXdl
+        2,                // MXdlPerWave
+        4,                // NXdlPerWave
+        S<4, 64, 1>,      // ABlockTransferThreadClusterLengths_AK0_M_AK1
+        S<1, 0, 2>,       // ABlockTransferThreadClusterArrangeOrder
+        S<1, 0, 2>,       // ABlockTransferSrcAccessOrder
+        2,                // ABlockTransferSrcVectorDim
+        4,                // ABlockTransferSrcScalarPerVector
+        4,                // ABlockTransferDstScalarPerVector_AK1
+        1,                // ABlockLdsExtraM
+        S<4, 64, 1>,      // BBlockTransferThreadClusterLengths_BK0_N_BK1
+        S<1, 0, 2>,       // BBlockTransferThreadClusterArrangeOrder
+        S<1, 0, 2>,       // BBlockTransferSrcAccessOrder
+        2,                // BBlockTransferSrcVectorDim
+        4,                // BBlockTransferSrcScalarPerVector
+        4,                // BBlockTransferDstScalarPerVector_BK1
+        1,                // BBlockLdsExtraN
+        1,
+        1,
+        S<1, 16, 1, 16>,
+        4>;
+
+using HostConvFwdInstance = ck::tensor_operation::host::ReferenceConvFwd<2,
+                                                                         InDataType,
+                                                                         WeiDataType,
+                                                                         OutDataType,
+                                                                         InElementOp,
+                                                                         WeiElementOp,
+                                                                         OutElementOp>;
+
+template <ck::index_t OutputTileSize>
+using HostConvFwdWinogradInstance =
+    ck::tensor_operation::host::ReferenceConvFwdWinograd<InDataType,
+                                                         WeiDataType,
+                                                         OutDataType,
+                                                         InDataType,
+                                                         InElementOp,
+                                                         WeiElementOp,
+                                                         OutElementOp,
+                                                         OutputTileSize>;
+
+// Error of the Winograd convolution relative to the largest output value. The fp16 rounding of the
+// transformed filter and input is amplified by the output transform, whose coefficients grow with
+// the tile size (up to 8 for F(4x4, 3x3)), so the bound is looser for larger tiles.
+template <ck::index_t OutputTileSize>
+double get_winograd_relative_error_bound()
+{
+    const double eps = std::pow(2.0, -10);
+
+    return OutputTileSize == 2 ? 8 * eps : 64 * eps;
+}
+
+template <ck::index_t OutputTileSize>
+bool run_grouped_conv_fwd_winograd(const ExecutionConfig& config,
+                                   const ck::utils::conv::ConvParam& conv_param)
+{
+    const auto in_g_n_c_wis_desc  = make_input_descriptor(conv_param);
+    const auto wei_g_k_c_xs_desc  = make_weight_descriptor(conv_param);
+    const auto out_g_n_k_wos_desc = make_output_descriptor(conv_param);
+
+    Tensor<InDataType> in(in_g_n_c_wis_desc);
+    Tensor<WeiDataType> wei(wei_g_k_c_xs_desc);
+    Tensor<OutDataType> out_host(out_g_n_k_wos_desc);
+    Tensor<OutDataType> out_host_winograd(out_g_n_k_wos_desc);
+    Tensor<OutDataType> out_device(out_g_n_k_wos_desc);
+
+    std::cout << "in: " << in.mDesc << std::endl;
+    std::cout << "wei: " << wei.mDesc << std::endl;
+    std::cout << "out: " << out_host.mDesc << std::endl;
+
+    switch(config.init_method)
+    {
+    case 0: break;
+    case 1:
+        in.GenerateTensorValue(GeneratorTensor_2<InDataType>{-5, 5});
+        wei.GenerateTensorValue(GeneratorTensor_2<WeiDataType>{-5, 5});
+        break;
+    default:
+        in.GenerateTensorValue(GeneratorTensor_3<InDataType>{0.0, 1.0});
+        wei.GenerateTensorValue(GeneratorTensor_3<WeiDataType>{-0.5, 0.5});
+    }
+
+    DeviceMem in_device_buf(sizeof(InDataType) * in.mDesc.GetElementSpaceSize());
+    DeviceMem wei_device_buf(sizeof(WeiDataType) * wei.mDesc.GetElementSpaceSize());
+    DeviceMem out_device_buf(sizeof(OutDataType) * out_device.mDesc.GetElementSpaceSize());
+
+    in_device_buf.ToDevice(in.mData.data());
+    wei_device_buf.ToDevice(wei.mData.data());
+
+    std::array<ck::index_t, 5> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, 5> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, 5> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, 5> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, 5> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, 5> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, 2> conv_filter_strides{};
+    std::array<ck::index_t, 2> conv_filter_dilations{};
+    std::array<ck::index_t, 2> input_left_pads{};
+    std::array<ck::index_t, 2> input_right_pads{};
+
+    auto copy = [](auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    // do Conv
+    auto conv     = DeviceConvFwdInstance<OutputTileSize>{};
+    auto invoker  = conv.MakeInvoker();
+    auto argument = conv.MakeArgument(in_device_buf.GetDeviceBuffer(),
+                                      wei_device_buf.GetDeviceBuffer(),
+                                      std::array<const void*, 0>{},
+                                      out_device_buf.GetDeviceBuffer(),
+                                      a_g_n_c_wis_lengths,
+                                      a_g_n_c_wis_strides,
+                                      b_g_k_c_xs_lengths,
+                                      b_g_k_c_xs_strides,
+                                      std::array<std::array<ck::index_t, 5>, 0>{},
+                                      std::array<std::array<ck::index_t, 5>, 0>{},
+                                      e_g_n_k_wos_lengths,
+                                      e_g_n_k_wos_strides,
+                                      conv_filter_strides,
+                                      conv_filter_dilations,
+                                      input_left_pads,
+                                      input_right_pads,
+                                      InElementOp{},
+                                      WeiElementOp{},
+                                      OutElementOp{});
+
+    DeviceMem workspace_device_buf(conv.GetWorkSpaceSize(&argument));
+
+    conv.SetWorkSpacePointer(&argument, workspace_device_buf.GetDeviceBuffer());
+
+    if(!conv.IsSupportedArgument(argument))
+    {
+        std::cerr << conv.GetTypeString() << " does not support this problem" << std::endl;
+
+        return true;
+    }
+
+    float avg_time = invoker.Run(argument, StreamConfig{nullptr, config.time_kernel});
+
+    // the flops of the direct convolution, so that the numbers compare with the implicit GEMM
+    std::size_t flop      = conv_param.GetFlops();
+    std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>();
+
+    float tflops     = static_cast<float>(flop) / 1.E9 / avg_time;
+    float gb_per_sec = num_btype / 1.E6 / avg_time;
+    std::cout << "Perf: " << avg_time << " ms, " << tflops << " TFlops (effective), "
+              << gb_per_sec << " GB/s, " << conv.GetTypeString() << std::endl;
+
+    if(config.do_verification)
+    {
+        out_device_buf.FromDevice(out_device.mData.data());
+
+        auto ref_winograd          = HostConvFwdWinogradInstance<OutputTileSize>{};
+        auto ref_winograd_invoker  = ref_winograd.MakeInvoker();
+        auto ref_winograd_argument = ref_winograd.MakeArgument(in,
+                                                               wei,
+                                                               out_host_winograd,
+                                                               conv_param.conv_filter_strides_,
+                                                               conv_param.conv_filter_dilations_,
+                                                               conv_param.input_left_pads_,
+                                                               conv_param.input_right_pads_,
+                                                               InElementOp{},
+                                                               WeiElementOp{},
+                                                               OutElementOp{});
+
+        ref_winograd_invoker.Run(ref_winograd_argument);
+
+        auto ref_conv     = HostConvFwdInstance{};
+        auto ref_invoker  = ref_conv.MakeInvoker();
+        auto ref_argument = ref_conv.MakeArgument(in,
+                                                  wei,
+                                                  out_host,
+                                                  conv_param.conv_filter_strides_,
+                                                  conv_param.conv_filter_dilations_,
+                                                  conv_param.input_left_pads_,
+                                                  conv_param.input_right_pads_,
+                                                  InElementOp{},
+                                                  WeiElementOp{},
+                                                  OutElementOp{});
+
+        ref_invoker.Run(ref_argument);
+
+        double max_abs_out = 0;
+
+        for(const auto& v : out_host.mData)
+            max_abs_out = std::max(max_abs_out, std::abs(ck::type_convert<double>(v)));
+
+        // the Winograd reference rounds where the kernels do, only the order of the accumulation
+        // over C and the final fp16 rounding differ
+        const bool pass_winograd = ck::utils::check_err(out_device.mData,
+                                                        out_host_winograd.mData,
+                                                        "Error: incorrect results (winograd)!",
+                                                        1e-3,
+                                                        1e-3 * max_abs_out);
+
+        // the direct convolution is only matched up to the error of the transforms
+        const double bound = get_winograd_relative_error_bound<OutputTileSize>();
+
+        const bool pass_direct = ck::utils::check_err(out_device.mData,
+                                                      out_host.mData,
+                                                      "Error: incorrect results (direct)!",
+                                                      bound,
+                                                      bound * max_abs_out);
+
+        return pass_winograd && pass_direct;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    ExecutionConfig config;
+    ck::utils::conv::ConvParam conv_param{
+        2, 32, 2, 256, 192, {3, 3}, {71, 71}, {1, 1}, {1, 1}, {1, 1}, {1, 1}};
+
+    if(!parse_cmd_args(argc, argv, config, conv_param))
+    {
+        return 1;
+    }
+
+    if(conv_param.num_dim_spatial_ != 2)
+    {
+        std::cerr << "Winograd is only implemented for 2D convolution" << std::endl;
+
+        return 1;
+    }
+
+    bool pass = true;
+
+    pass = pass && run_grouped_conv_fwd_winograd<2>(config, conv_param);
+    pass = pass && run_grouped_conv_fwd_winograd<4>(config, conv_param);
+
+    return pass ? 0 : 1;
+}
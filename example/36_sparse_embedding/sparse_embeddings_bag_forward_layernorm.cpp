@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+#include <getopt.h>
+#include <ctime>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_sparse_embeddings_bag_forward_layernorm.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_common_util.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_sparse_embeddings_bag_forward_layernorm.hpp"
+
+constexpr ck::index_t NumEmbeddings = 4;
+
+// clang-format off
+using EmbType        = ck::half_t;
+using IndexType      = int64_t;
+using WeightDataType = float;
+using GammaDataType  = ck::half_t;
+using BetaDataType   = ck::half_t;
+using AccDataType    = float;
+using OutType        = ck::half_t;
+using EmbElementwiseOperation = ck::tensor_operation::element_wise::AddN;
+
+using DeviceInstance_fp16_e256   = ck::tensor_operation::device::DeviceSparseEmbeddingsBagForwardLayernorm<EmbType, IndexType, WeightDataType, GammaDataType, BetaDataType, AccDataType, OutType, EmbElementwiseOperation, 256,  1,  256, 1,  256,   1, 1, NumEmbeddings>;
+using DeviceInstance_fp16_e512   = ck::tensor_operation::device::DeviceSparseEmbeddingsBagForwardLayernorm<EmbType, IndexType, WeightDataType, GammaDataType, BetaDataType, AccDataType, OutType, EmbElementwiseOperation, 256,  1,  256, 1,  512,   1, 2, NumEmbeddings>;
+using DeviceInstance_fp16_e1024  = ck::tensor_operation::device::DeviceSparseEmbeddingsBagForwardLayernorm<EmbType, IndexType, WeightDataType, GammaDataType, BetaDataType, AccDataType, OutType, EmbElementwiseOperation, 256,  1,  256, 1,  1024,  1, 2, NumEmbeddings>;
+using DeviceInstance_fp16_e2048  = ck::tensor_operation::device::DeviceSparseEmbeddingsBagForwardLayernorm<EmbType, IndexType, WeightDataType, GammaDataType, BetaDataType, AccDataType, OutType, EmbElementwiseOperation, 256,  1,  256, 1,  2048,  1, 2, NumEmbeddings>;
+using DeviceInstance_fp16_e4096  = ck::tensor_operation::device::DeviceSparseEmbeddingsBagForwardLayernorm<EmbType, IndexType, WeightDataType, GammaDataType, BetaDataType, AccDataType, OutType, EmbElementwiseOperation, 256,  1,  256, 1,  4096,  1, 8, NumEmbeddings>;
+
+template<typename emb_type, ck::index_t dim> struct emb_kernel{};
+
+template<> struct emb_kernel<ck::half_t, 256>  { using kernel_type = DeviceInstance_fp16_e256; };
+template<> struct emb_kernel<ck::half_t, 512>  { using kernel_type = DeviceInstance_fp16_e512; };
+template<> struct emb_kernel<ck::half_t, 1024> { using kernel_type = DeviceInstance_fp16_e1024; };
+template<> struct emb_kernel<ck::half_t, 2048> { using kernel_type = DeviceInstance_fp16_e2048; };
+template<> struct emb_kernel<ck::half_t, 4096> { using kernel_type = DeviceInstance_fp16_e4096; };
+
+// clang-format on
+
+int main()
+{
+    using ck::tensor_operation::device::EmbeddingBagPoolingMode;
+
+    bool time_kernel = true;
+
+    constexpr auto num_rows       = 65536;
+    constexpr auto dims           = ck::Sequence<256, 512, 1024, 2048, 4096>{};
+    constexpr auto num_bags       = 2048;
+    constexpr auto max_bag_length = 8;
+    constexpr AccDataType epsilon = 1e-4;
+
+    auto f_host_tensor_desc_1d = [](std::size_t len_) { return HostTensorDescriptor({len_}); };
+
+    auto f_host_tensor_desc_2d = [](std::size_t rows_, std::size_t cols_) {
+        return HostTensorDescriptor({rows_, cols_});
+    };
+
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceSparseEmbeddingsBagForwardLayernorm<
+            EmbType,
+            IndexType,
+            WeightDataType,
+            GammaDataType,
+            BetaDataType,
+            AccDataType,
+            OutType,
+            EmbElementwiseOperation,
+            NumEmbeddings>;
+
+    // weighted sum pooling on every other table, unweighted mean pooling on all tables
+    for(auto pooling_mode : {EmbeddingBagPoolingMode::Sum, EmbeddingBagPoolingMode::Mean})
+    {
+        ck::static_for<0, dims.Size(), 1>{}([&](auto I) {
+            std::srand(std::time(nullptr));
+            constexpr auto current_dim = dims.At(I);
+
+            // bags have random lengths in [0, max_bag_length], so some of them are empty
+            std::vector<Tensor<EmbType>> embs;
+            std::vector<Tensor<IndexType>> indexes;
+            std::vector<Tensor<IndexType>> offsets;
+            std::vector<Tensor<WeightDataType>> weights;
+
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+            {
+                Tensor<IndexType> offset(f_host_tensor_desc_1d(num_bags + 1));
+
+                offset(0) = 0;
+                for(std::size_t b = 0; b < num_bags; ++b)
+                    offset(b + 1) = offset(b) + std::rand() % (max_bag_length + 1);
+
+                const std::size_t index_length = offset(num_bags);
+
+                embs.emplace_back(f_host_tensor_desc_2d(num_rows, current_dim));
+                indexes.emplace_back(f_host_tensor_desc_1d(index_length));
+                offsets.push_back(offset);
+                weights.emplace_back(f_host_tensor_desc_1d(index_length));
+
+                embs[i].GenerateTensorValue(GeneratorTensor_3<EmbType>{0.0, 1.0});
+                indexes[i].GenerateTensorValue(GeneratorTensor_2<IndexType>{0, num_rows});
+                weights[i].GenerateTensorValue(GeneratorTensor_3<WeightDataType>{0.0, 1.0});
+            }
+
+            Tensor<GammaDataType> gamma(f_host_tensor_desc_1d(current_dim));
+            Tensor<BetaDataType> beta(f_host_tensor_desc_1d(current_dim));
+
+            Tensor<OutType> out(f_host_tensor_desc_2d(num_bags, current_dim));
+
+            gamma.GenerateTensorValue(GeneratorTensor_3<GammaDataType>{0.0, 1.0});
+            beta.GenerateTensorValue(GeneratorTensor_3<BetaDataType>{0.0, 1.0});
+
+            std::vector<std::unique_ptr<DeviceMem>> embs_dev;
+            std::vector<std::unique_ptr<DeviceMem>> indexes_dev;
+            std::vector<std::unique_ptr<DeviceMem>> offsets_dev;
+            std::vector<std::unique_ptr<DeviceMem>> weights_dev;
+
+            ck::Array<EmbType*, NumEmbeddings> p_embs;
+            ck::Array<IndexType*, NumEmbeddings> p_indexes;
+            ck::Array<IndexType*, NumEmbeddings> p_offsets;
+            ck::Array<WeightDataType*, NumEmbeddings> p_weights;
+
+            std::array<const Tensor<EmbType>*, NumEmbeddings> ref_embs;
+            std::array<const Tensor<IndexType>*, NumEmbeddings> ref_indexes;
+            std::array<const Tensor<IndexType>*, NumEmbeddings> ref_offsets;
+            std::array<const Tensor<WeightDataType>*, NumEmbeddings> ref_weights;
+
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+            {
+                embs_dev.emplace_back(std::make_unique<DeviceMem>(
+                    sizeof(EmbType) * embs[i].mDesc.GetElementSpaceSize()));
+                indexes_dev.emplace_back(std::make_unique<DeviceMem>(
+                    sizeof(IndexType) * indexes[i].mDesc.GetElementSpaceSize()));
+                offsets_dev.emplace_back(std::make_unique<DeviceMem>(
+                    sizeof(IndexType) * offsets[i].mDesc.GetElementSpaceSize()));
+                weights_dev.emplace_back(std::make_unique<DeviceMem>(
+                    sizeof(WeightDataType) * weights[i].mDesc.GetElementSpaceSize()));
+
+                embs_dev[i]->ToDevice(embs[i].mData.data());
+                indexes_dev[i]->ToDevice(indexes[i].mData.data());
+                offsets_dev[i]->ToDevice(offsets[i].mData.data());
+                weights_dev[i]->ToDevice(weights[i].mData.data());
+
+                const bool weighted = pooling_mode == EmbeddingBagPoolingMode::Sum && i % 2 == 0;
+
+                p_embs(i)    = ck::type_convert<EmbType*>(embs_dev[i]->GetDeviceBuffer());
+                p_indexes(i) = ck::type_convert<IndexType*>(indexes_dev[i]->GetDeviceBuffer());
+                p_offsets(i) = ck::type_convert<IndexType*>(offsets_dev[i]->GetDeviceBuffer());
+                p_weights(i) =
+                    weighted ? ck::type_convert<WeightDataType*>(weights_dev[i]->GetDeviceBuffer())
+                             : nullptr;
+
+                ref_embs[i]    = &embs[i];
+                ref_indexes[i] = &indexes[i];
+                ref_offsets[i] = &offsets[i];
+                ref_weights[i] = weighted ? &weights[i] : nullptr;
+            }
+
+            DeviceMem gamma_dev(sizeof(GammaDataType) * gamma.mDesc.GetElementSpaceSize());
+            DeviceMem beta_dev(sizeof(BetaDataType) * beta.mDesc.GetElementSpaceSize());
+
+            DeviceMem out_dev(sizeof(OutType) * out.mDesc.GetElementSpaceSize());
+
+            gamma_dev.ToDevice(gamma.mData.data());
+            beta_dev.ToDevice(beta.mData.data());
+
+            auto device_instance = typename emb_kernel<EmbType, current_dim>::kernel_type{};
+            auto argument_ptr    = device_instance.MakeArgumentPointer(out_dev.GetDeviceBuffer(),
+                                                                    p_embs,
+                                                                    p_indexes,
+                                                                    p_offsets,
+                                                                    p_weights,
+                                                                    gamma_dev.GetDeviceBuffer(),
+                                                                    beta_dev.GetDeviceBuffer(),
+                                                                    current_dim,
+                                                                    num_bags,
+                                                                    pooling_mode,
+                                                                    epsilon,
+                                                                    EmbElementwiseOperation{});
+            std::cout << "Dim:" << current_dim << ", pooling:"
+                      << ck::tensor_operation::device::getEmbeddingBagPoolingModeString(
+                             pooling_mode)
+                      << ", kernel:" << device_instance.GetTypeString() << std::endl
+                      << std::flush;
+
+            bool is_supported = device_instance.IsSupportedArgument(argument_ptr.get());
+
+            if(!is_supported)
+            {
+                std::cout << "Runtime parameters are not supported" << std::endl;
+                return;
+            }
+
+            auto invoker_ptr = device_instance.MakeInvokerPointer();
+            float time_ms =
+                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+            bool pass = true;
+            {
+                Tensor<OutType> out_from_dev(f_host_tensor_desc_2d(num_bags, current_dim));
+                ReferenceInstance ref;
+                auto ref_argument = ref.MakeArgument(out,
+                                                     ref_embs,
+                                                     ref_indexes,
+                                                     ref_offsets,
+                                                     ref_weights,
+                                                     gamma,
+                                                     beta,
+                                                     pooling_mode,
+                                                     epsilon,
+                                                     EmbElementwiseOperation{});
+                auto ref_invoker  = ref.MakeInvoker();
+                ref_invoker.Run(ref_argument);
+
+                out_dev.FromDevice(out_from_dev.mData.data());
+                pass &=
+                    ck::utils::check_err(out_from_dev, out, "Error: Incorrect results", 1e-3, 1e-3);
+            }
+
+            double total_read = current_dim * sizeof(GammaDataType) +
+                                current_dim * sizeof(BetaDataType);
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                total_read += indexes[i].mDesc.GetElementSize() *
+                                  (current_dim * sizeof(EmbType) + sizeof(IndexType)) +
+                              offsets[i].mDesc.GetElementSize() * sizeof(IndexType);
+            double total_write = current_dim * num_bags * sizeof(OutType);
+            double gbps        = (total_read + total_write) / time_ms / 1e6;
+
+            std::cout << ", total bytes:" << (total_read + total_write) << ", time:" << time_ms
+                      << ", gbps:" << gbps << ", valid:" << (pass ? "y" : "n") << std::endl
+                      << std::flush;
+        });
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_put_element_impl.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_sorted_put_element_impl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_put_element.hpp"
+
+using XDataType     = float;
+using YDataType     = float;
+using IndexDataType = int32_t;
+
+using YElementwiseOp = ck::tensor_operation::element_wise::PassThrough;
+
+static constexpr auto MemOp = ck::InMemoryDataOperationEnum::AtomicAdd;
+
+using DeviceInstance = ck::tensor_operation::device::
+    DevicePutElementImpl<XDataType, IndexDataType, YDataType, YElementwiseOp, MemOp, 1>;
+
+using DeviceSortedInstance =
+    ck::tensor_operation::device::DeviceSortedPutElementImpl<XDataType,
+                                                             IndexDataType,
+                                                             YDataType,
+                                                             YElementwiseOp,
+                                                             MemOp,
+                                                             256,    // BlockSize
+                                                             8,      // ThreadTileSize
+                                                             false>; // IndicesSorted
+
+using ReferenceInstance = ck::tensor_operation::host::
+    ReferencePutElement<XDataType, IndexDataType, YDataType, YElementwiseOp, MemOp>;
+
+template <typename DeviceOp>
+bool run_put_element(const Tensor<XDataType>& x,
+                     const Tensor<IndexDataType>& indices,
+                     const Tensor<YDataType>& y_host,
+                     int N,
+                     int M,
+                     bool do_verification,
+                     bool time_kernel)
+{
+    Tensor<YDataType> y(HostTensorDescriptor{M, 1});
+
+    DeviceMem x_device_buf(sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
+    DeviceMem y_device_buf(sizeof(YDataType) * y.mDesc.GetElementSpaceSize());
+    DeviceMem indices_device_buf(sizeof(IndexDataType) * indices.mDesc.GetElementSpaceSize());
+
+    x_device_buf.ToDevice(x.mData.data());
+    indices_device_buf.ToDevice(indices.mData.data());
+    y_device_buf.SetZero();
+
+    auto put_instance     = DeviceOp{};
+    auto put_invoker_ptr  = put_instance.MakeInvokerPointer();
+    auto put_argument_ptr = put_instance.MakeArgumentPointer(
+        static_cast<XDataType*>(x_device_buf.GetDeviceBuffer()),
+        static_cast<IndexDataType*>(indices_device_buf.GetDeviceBuffer()),
+        static_cast<YDataType*>(y_device_buf.GetDeviceBuffer()),
+        N,
+        M,
+        YElementwiseOp{});
+
+    if(!put_instance.IsSupportedArgument(put_argument_ptr.get()))
+    {
+        throw std::runtime_error("argument is not supported!");
+    }
+
+    // atomics accumulate into the output, so the output is verified on a single run. The order
+    // of the float additions differs from the host, hence the absolute tolerance
+    bool pass = true;
+    if(do_verification)
+    {
+        put_invoker_ptr->Run(put_argument_ptr.get(), StreamConfig{nullptr, false});
+
+        y_device_buf.FromDevice(y.mData.data());
+        pass = ck::utils::check_err(y, y_host, "Error: Incorrect results!", 1e-3, 5e-2);
+    }
+
+    if(time_kernel)
+    {
+        float ave_time =
+            put_invoker_ptr->Run(put_argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+        std::size_t num_bytes =
+            (sizeof(XDataType) + sizeof(IndexDataType) + sizeof(YDataType)) * N;
+        float gb_per_sec = num_bytes / 1.E6 / ave_time;
+
+        std::cout << "Perf: " << ave_time << " ms, " << gb_per_sec << " GB/s, "
+                  << put_instance.GetTypeString() << std::endl;
+    }
+
+    return pass;
+}
+
+int main()
+{
+    bool do_verification = true;
+    bool time_kernel     = false;
+
+    int N = 1 << 22;
+    int M = 1 << 16;
+
+    // gradient scatter of an embedding table: the indices follow a Zipfian distribution, so a
+    // few rows receive most of the updates
+    std::vector<double> weights(M);
+    for(int i = 0; i < M; ++i)
+        weights[i] = 1.0 / std::pow(i + 1, 1.1);
+
+    std::mt19937 gen(11939);
+    std::discrete_distribution<IndexDataType> zipf(weights.begin(), weights.end());
+
+    Tensor<XDataType> x(HostTensorDescriptor{N, 1});
+    Tensor<IndexDataType> indices(HostTensorDescriptor{N, 1});
+    Tensor<YDataType> y_host(HostTensorDescriptor{M, 1});
+
+    x.GenerateTensorValue(GeneratorTensor_3<XDataType>{-1.0, 1.0});
+    for(int i = 0; i < N; ++i)
+        indices(i) = zipf(gen);
+
+    if(do_verification)
+    {
+        y_host.SetZero();
+
+        auto ref_argument =
+            ReferenceInstance::MakeArgument(x, indices, y_host, YElementwiseOp{});
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+    }
+
+    bool pass = true;
+
+    pass &= run_put_element<DeviceInstance>(x, indices, y_host, N, M, do_verification, time_kernel);
+    pass &= run_put_element<DeviceSortedInstance>(
+        x, indices, y_host, N, M, do_verification, time_kernel);
+
+    return (pass ? 0 : 1);
+}
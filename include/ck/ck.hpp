@@ -184,6 +184,34 @@
 #define CK_WORKAROUND_DENORM_FIX = CK_WORKAROUND_DENORM_FIX && defined(__gfx90a__)
 #endif // CK_WORKAROUND_DENORM_FIX
 
+// host emulation of the device side, see ck/utility/host_emulation.hpp
+#ifndef CK_HOST_EMULATION
+#define CK_HOST_EMULATION 0
+#endif
+
+#if CK_HOST_EMULATION
+// plain loads, stores and atomics instead of the buffer instructions, and no inline asm
+#undef CK_CONSTANT_ADDRESS_SPACE
+#define CK_CONSTANT_ADDRESS_SPACE
+#undef CK_USE_AMD_BUFFER_LOAD
+#define CK_USE_AMD_BUFFER_LOAD 0
+#undef CK_USE_AMD_BUFFER_STORE
+#define CK_USE_AMD_BUFFER_STORE 0
+#undef CK_USE_AMD_BUFFER_ATOMIC_ADD_INTEGER
+#define CK_USE_AMD_BUFFER_ATOMIC_ADD_INTEGER 0
+#undef CK_USE_AMD_BUFFER_ATOMIC_ADD_FLOAT
+#define CK_USE_AMD_BUFFER_ATOMIC_ADD_FLOAT 0
+#undef CK_USE_AMD_BUFFER_ATOMIC_MAX_FLOAT64
+#define CK_USE_AMD_BUFFER_ATOMIC_MAX_FLOAT64 0
+#undef CK_USE_AMD_INLINE_ASM
+#define CK_USE_AMD_INLINE_ASM 0
+#undef CK_USE_AMD_INNER_PRODUCT_INLINE_ASM
+#define CK_USE_AMD_INNER_PRODUCT_INLINE_ASM 0
+#undef CK_EXPERIMENTAL_BLOCK_SYNC_LDS_WITHOUT_SYNC_VMEM
+#define CK_EXPERIMENTAL_BLOCK_SYNC_LDS_WITHOUT_SYNC_VMEM 0
+#undef CK_USE_AMD_WMMA
+#endif
+
 namespace ck {
 
 enum struct InMemoryDataOperationEnum
@@ -213,3 +241,7 @@ using index_t      = int32_t;
 using long_index_t = int64_t;
 
 } // namespace ck
+
+#if CK_HOST_EMULATION
+#include "ck/utility/host_emulation.hpp"
+#endif
@@ -51,4 +51,23 @@ inline std::string get_device_name()
     return name;
 }
 
+inline int get_device_cu_count()
+{
+    hipDeviceProp_t props{};
+    int device;
+    auto status = hipGetDevice(&device);
+    if(status != hipSuccess)
+    {
+        return 0;
+    }
+
+    status = hipGetDeviceProperties(&props, device);
+    if(status != hipSuccess)
+    {
+        return 0;
+    }
+
+    return props.multiProcessorCount;
+}
+
 } // namespace ck
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "ck/ck.hpp"
+
+#if !CK_HOST_EMULATION
+#error "the memory access trace needs CK_HOST_EMULATION=1"
+#endif
+
+namespace ck {
+namespace host_emulation {
+
+// Accesses of a memory space grouped by wave-wide request: same workgroup, wave and sequence
+// number, i.e. the lanes of a wave executing the same load or store
+inline std::vector<std::vector<MemoryAccess>>
+GroupWaveRequests(const std::vector<MemoryAccess>& accesses, MemorySpace space)
+{
+    std::map<std::tuple<int, int, uint32_t>, std::vector<MemoryAccess>> requests;
+
+    for(const auto& access : accesses)
+    {
+        if(access.space_ == space)
+        {
+            const auto key =
+                std::make_tuple(access.block_id_, access.thread_id_ / warpSize, access.sequence_);
+
+            requests[key].push_back(access);
+        }
+    }
+
+    std::vector<std::vector<MemoryAccess>> result;
+
+    result.reserve(requests.size());
+
+    for(auto& request : requests)
+    {
+        result.push_back(std::move(request.second));
+    }
+
+    return result;
+}
+
+struct GlobalMemoryCoalescing
+{
+    std::size_t num_requests_ = 0;
+    // memory segments touched by the requests
+    std::size_t num_transactions_ = 0;
+    // segments needed if the bytes of each request were contiguous and aligned
+    std::size_t num_min_transactions_ = 0;
+};
+
+// Coalescing of the global memory requests, segment_bytes being the size of a memory transaction
+inline GlobalMemoryCoalescing
+AnalyzeGlobalMemoryCoalescing(const std::vector<MemoryAccess>& accesses,
+                              std::size_t segment_bytes = 64)
+{
+    GlobalMemoryCoalescing result;
+
+    for(const auto& request : GroupWaveRequests(accesses, MemorySpace::Global))
+    {
+        std::set<uintptr_t> segments;
+        std::set<uintptr_t> bytes;
+
+        for(const auto& access : request)
+        {
+            for(uintptr_t b = access.address_; b < access.address_ + access.num_bytes_; ++b)
+            {
+                segments.insert(b / segment_bytes);
+                bytes.insert(b);
+            }
+        }
+
+        result.num_requests_ += 1;
+        result.num_transactions_ += segments.size();
+        result.num_min_transactions_ += (bytes.size() + segment_bytes - 1) / segment_bytes;
+    }
+
+    return result;
+}
+
+struct LdsBankConflicts
+{
+    std::size_t num_requests_ = 0;
+    // cycles of the requests, the largest number of distinct words in a bank
+    std::size_t num_cycles_ = 0;
+    // cycles if the words of each request were spread evenly over the banks
+    std::size_t num_min_cycles_ = 0;
+};
+
+// Bank conflicts of the LDS requests: a request takes as many cycles as the largest number of
+// distinct bank_bytes words it accesses in a bank, several lanes reading the same word being a
+// broadcast. A model for comparing access patterns, ignoring how the hardware splits wide
+// requests into passes.
+inline LdsBankConflicts AnalyzeLdsBankConflicts(const std::vector<MemoryAccess>& accesses,
+                                                std::size_t num_banks  = 32,
+                                                std::size_t bank_bytes = 4)
+{
+    LdsBankConflicts result;
+
+    for(const auto& request : GroupWaveRequests(accesses, MemorySpace::Lds))
+    {
+        std::set<uintptr_t> words;
+
+        // an unaligned access touches the words of its first and last bytes and the ones between
+        for(const auto& access : request)
+        {
+            if(access.num_bytes_ == 0)
+            {
+                continue;
+            }
+
+            const uintptr_t first_word = access.address_ / bank_bytes;
+            const uintptr_t last_word  = (access.address_ + access.num_bytes_ - 1) / bank_bytes;
+
+            for(uintptr_t word = first_word; word <= last_word; ++word)
+            {
+                words.insert(word);
+            }
+        }
+
+        std::vector<std::size_t> words_per_bank(num_banks, 0);
+
+        for(const auto word : words)
+        {
+            ++words_per_bank[word % num_banks];
+        }
+
+        result.num_requests_ += 1;
+        result.num_cycles_ += *std::max_element(words_per_bank.begin(), words_per_bank.end());
+        result.num_min_cycles_ += (words.size() + num_banks - 1) / num_banks;
+    }
+
+    return result;
+}
+
+} // namespace host_emulation
+} // namespace ck
@@ -7,6 +7,7 @@
 
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
+#include "ck/utility/ignore.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
 
 template <typename... Args, typename F>
@@ -17,7 +18,22 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
                              std::size_t lds_byte,
                              Args... args)
 {
-#if CK_TIME_KERNEL
+#if CK_HOST_EMULATION
+    // not timed, the kernel runs on the CPU
+    ck::ignore = stream_config;
+    ck::ignore = lds_byte;
+
+    ck::host_emulation::launch_kernel(grid_dim.x,
+                                      grid_dim.y,
+                                      grid_dim.z,
+                                      block_dim.x,
+                                      block_dim.y,
+                                      block_dim.z,
+                                      kernel,
+                                      args...);
+
+    return 0;
+#elif CK_TIME_KERNEL
     if(stream_config.time_kernel_)
     {
 #if DEBUG_LOG
@@ -0,0 +1,386 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <stdexcept>
+#include <vector>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/utility/magic_division.hpp"
+
+namespace ck {
+
+/*
+ * Tensor descriptor whose number of dimensions, lengths and transforms are all run-time values,
+ * for the grid-level transforms of a kernel: its type only depends on the capacities, so that
+ * one kernel instance serves e.g. 1D, 2D and 3D convolutions.
+ *
+ * As in TensorDescriptor, the transforms map hidden dimensions: the visible dimensions are the
+ * upper ones of the last transforms, and the hidden dimension 0 is the offset in the element
+ * space. The supported transforms are Embed (UnMerge being the packed case), Pad and Merge, the
+ * latter dividing by its lower lengths with precomputed magic numbers.
+ *
+ * The descriptor is built on host and passed to the kernel. Calculating an offset indexes its
+ * arrays at run time, which is fine once per block but not in the inner loops: the block and
+ * thread level descriptors should stay compile-time ones.
+ */
+template <index_t MaxNumHiddenDim_ = 24, index_t MaxNumTransform_ = 16>
+struct RuntimeTensorDescriptor
+{
+    static constexpr index_t MaxNumHiddenDim  = MaxNumHiddenDim_;
+    static constexpr index_t MaxNumTransform  = MaxNumTransform_;
+    static constexpr index_t MaxNumVisibleDim = 8;
+    static constexpr index_t MaxNumLowerDim   = 6;
+
+    static_assert(MaxNumHiddenDim <= 256, "wrong! hidden dimension ids are stored as uint8_t");
+
+    enum struct TransformKind : uint8_t
+    {
+        Embed,
+        Pad,
+        Merge
+    };
+
+    // the upper dimensions of a transform are contiguous hidden dimensions
+    struct Transform
+    {
+        TransformKind kind_;
+        uint8_t num_low_;
+        uint8_t num_up_;
+        uint8_t up_begin_;
+        uint8_t low_ids_[MaxNumLowerDim];
+    };
+
+    // lengths of the hidden dimensions
+    index_t lengths_[MaxNumHiddenDim];
+    // Embed: coefficient of the upper dimension, Pad: left pad of the upper dimension
+    index_t params_[MaxNumHiddenDim];
+    // Merge: magic numbers dividing by the length of the lower dimension
+    uint32_t magic_multipliers_[MaxNumHiddenDim];
+    uint32_t magic_shifts_[MaxNumHiddenDim];
+
+    Transform transforms_[MaxNumTransform];
+    uint8_t visible_ids_[MaxNumVisibleDim];
+
+    index_t num_hidden_dim_;
+    index_t num_transform_;
+    index_t num_visible_dim_;
+
+    // tensor with the given lengths and strides
+    __host__ static RuntimeTensorDescriptor MakeNaive(const std::vector<index_t>& lengths,
+                                                      const std::vector<index_t>& strides)
+    {
+        if(lengths.size() != strides.size())
+        {
+            throw std::runtime_error("wrong! inconsistent # of dimension");
+        }
+
+        index_t element_space_size = 1;
+
+        for(std::size_t i = 0; i < lengths.size(); ++i)
+        {
+            element_space_size += (lengths[i] - 1) * strides[i];
+        }
+
+        RuntimeTensorDescriptor desc{};
+
+        desc.visible_ids_[0]  = static_cast<uint8_t>(desc.AddHiddenDim(element_space_size));
+        desc.num_visible_dim_ = 1;
+
+        desc.Embed(0, lengths, strides);
+
+        return desc;
+    }
+
+    __host__ static RuntimeTensorDescriptor MakePacked(const std::vector<index_t>& lengths)
+    {
+        std::vector<index_t> strides(lengths.size());
+
+        index_t stride = 1;
+
+        for(std::size_t i = lengths.size(); i > 0; --i)
+        {
+            strides[i - 1] = stride;
+            stride *= lengths[i - 1];
+        }
+
+        return MakeNaive(lengths, strides);
+    }
+
+    // replaces the visible dimension dim by dimensions whose coordinates are combined with the
+    // coefficients
+    __host__ void Embed(index_t dim,
+                        const std::vector<index_t>& up_lengths,
+                        const std::vector<index_t>& coefficients)
+    {
+        if(up_lengths.size() != coefficients.size())
+        {
+            throw std::runtime_error("wrong! inconsistent # of dimension");
+        }
+
+        const index_t up_begin = num_hidden_dim_;
+
+        for(std::size_t i = 0; i < up_lengths.size(); ++i)
+        {
+            params_[AddHiddenDim(up_lengths[i])] = coefficients[i];
+        }
+
+        AddTransform(
+            TransformKind::Embed, {dim}, up_begin, static_cast<index_t>(up_lengths.size()));
+    }
+
+    // replaces the visible dimension dim by the packed dimensions of lengths up_lengths
+    __host__ void UnMerge(index_t dim, const std::vector<index_t>& up_lengths)
+    {
+        std::vector<index_t> coefficients(up_lengths.size());
+
+        index_t coefficient = 1;
+
+        for(std::size_t i = up_lengths.size(); i > 0; --i)
+        {
+            coefficients[i - 1] = coefficient;
+            coefficient *= up_lengths[i - 1];
+        }
+
+        Embed(dim, up_lengths, coefficients);
+    }
+
+    // pads the visible dimension dim
+    __host__ void Pad(index_t dim, index_t left_pad, index_t right_pad)
+    {
+        const index_t up_begin = num_hidden_dim_;
+
+        params_[AddHiddenDim(GetLength(dim) + left_pad + right_pad)] = left_pad;
+
+        AddTransform(TransformKind::Pad, {dim}, up_begin, 1);
+    }
+
+    // merges the visible dimensions dims, the first being the slowest, into one dimension at the
+    // position of the first of them
+    __host__ void Merge(const std::vector<index_t>& dims)
+    {
+        index_t up_length = 1;
+
+        for(const auto dim : dims)
+        {
+            const index_t low_id = visible_ids_[CheckVisibleDim(dim)];
+
+            const auto divisor = static_cast<uint32_t>(lengths_[low_id]);
+
+            magic_multipliers_[low_id] = MagicDivision::CalculateMagicMultiplier(divisor);
+            magic_shifts_[low_id]      = MagicDivision::CalculateMagicShift(divisor);
+
+            up_length *= lengths_[low_id];
+        }
+
+        const index_t up_begin = num_hidden_dim_;
+
+        AddHiddenDim(up_length);
+
+        AddTransform(TransformKind::Merge, dims, up_begin, 1);
+    }
+
+    __host__ __device__ constexpr index_t GetNumOfDimension() const { return num_visible_dim_; }
+
+    __host__ __device__ constexpr index_t GetLength(index_t dim) const
+    {
+        return lengths_[visible_ids_[dim]];
+    }
+
+    __host__ __device__ constexpr index_t GetElementSize() const
+    {
+        index_t size = 1;
+
+        for(index_t i = 0; i < num_visible_dim_; ++i)
+        {
+            size *= GetLength(i);
+        }
+
+        return size;
+    }
+
+    __host__ __device__ constexpr index_t GetElementSpaceSize() const { return lengths_[0]; }
+
+    // Idx is indexed with operator[], e.g. MultiIndex
+    template <typename Idx>
+    __host__ __device__ constexpr index_t CalculateOffset(const Idx& idx) const
+    {
+        bool is_valid = true;
+
+        return CalculateOffsetAndValidity(idx, is_valid);
+    }
+
+    // whether idx is inside the visible lengths and maps to an element, not to padding
+    template <typename Idx>
+    __host__ __device__ constexpr bool IsValidIndex(const Idx& idx) const
+    {
+        bool is_valid = true;
+
+        CalculateOffsetAndValidity(idx, is_valid);
+
+        return is_valid;
+    }
+
+    template <typename Idx>
+    __host__ __device__ constexpr index_t CalculateOffsetAndValidity(const Idx& idx,
+                                                                     bool& is_valid) const
+    {
+        index_t hidden_idx[MaxNumHiddenDim] = {};
+
+        for(index_t i = 0; i < num_visible_dim_; ++i)
+        {
+            const index_t id = visible_ids_[i];
+
+            hidden_idx[id] = idx[i];
+            is_valid       = is_valid && idx[i] >= 0 && idx[i] < lengths_[id];
+        }
+
+        for(index_t t = num_transform_ - 1; t >= 0; --t)
+        {
+            const Transform& transform = transforms_[t];
+
+            if(transform.kind_ == TransformKind::Embed)
+            {
+                index_t idx_low = 0;
+
+                for(index_t i = 0; i < transform.num_up_; ++i)
+                {
+                    const index_t up_id = transform.up_begin_ + i;
+
+                    idx_low += hidden_idx[up_id] * params_[up_id];
+                }
+
+                hidden_idx[transform.low_ids_[0]] = idx_low;
+            }
+            else if(transform.kind_ == TransformKind::Pad)
+            {
+                const index_t up_id  = transform.up_begin_;
+                const index_t low_id = transform.low_ids_[0];
+
+                const index_t idx_low = hidden_idx[up_id] - params_[up_id];
+
+                hidden_idx[low_id] = idx_low;
+                is_valid           = is_valid && idx_low >= 0 && idx_low < lengths_[low_id];
+            }
+            else
+            {
+                index_t tmp = hidden_idx[transform.up_begin_];
+
+                for(index_t i = transform.num_low_ - 1; i > 0; --i)
+                {
+                    const index_t low_id = transform.low_ids_[i];
+
+                    const index_t tmp2 = MagicDivision::DoMagicDivision(
+                        tmp, magic_multipliers_[low_id], magic_shifts_[low_id]);
+
+                    hidden_idx[low_id] = tmp - tmp2 * lengths_[low_id];
+                    tmp                = tmp2;
+                }
+
+                hidden_idx[transform.low_ids_[0]] = tmp;
+            }
+        }
+
+        return hidden_idx[0];
+    }
+
+    private:
+    __host__ index_t AddHiddenDim(index_t length)
+    {
+        if(num_hidden_dim_ >= MaxNumHiddenDim)
+        {
+            throw std::runtime_error("wrong! too many hidden dimensions");
+        }
+
+        lengths_[num_hidden_dim_] = length;
+
+        return num_hidden_dim_++;
+    }
+
+    __host__ index_t CheckVisibleDim(index_t dim) const
+    {
+        if(dim < 0 || dim >= num_visible_dim_)
+        {
+            throw std::runtime_error("wrong! invalid dimension");
+        }
+
+        return dim;
+    }
+
+    // the lower dimensions, visible ones, are replaced by the upper dimensions at the position of
+    // the first of them
+    __host__ void AddTransform(TransformKind kind,
+                               const std::vector<index_t>& low_dims,
+                               index_t up_begin,
+                               index_t num_up)
+    {
+        if(num_transform_ >= MaxNumTransform)
+        {
+            throw std::runtime_error("wrong! too many transforms");
+        }
+
+        if(low_dims.empty() || low_dims.size() > MaxNumLowerDim)
+        {
+            throw std::runtime_error("wrong! invalid # of lower dimensions");
+        }
+
+        Transform& transform = transforms_[num_transform_++];
+
+        transform.kind_     = kind;
+        transform.num_low_  = static_cast<uint8_t>(low_dims.size());
+        transform.num_up_   = static_cast<uint8_t>(num_up);
+        transform.up_begin_ = static_cast<uint8_t>(up_begin);
+
+        bool is_low[MaxNumVisibleDim] = {};
+
+        for(std::size_t i = 0; i < low_dims.size(); ++i)
+        {
+            const index_t dim = CheckVisibleDim(low_dims[i]);
+
+            if(is_low[dim])
+            {
+                throw std::runtime_error("wrong! repeated dimension");
+            }
+
+            is_low[dim]           = true;
+            transform.low_ids_[i] = visible_ids_[dim];
+        }
+
+        uint8_t visible_ids[MaxNumVisibleDim];
+        index_t num_visible_dim = 0;
+
+        const auto push_visible_id = [&](index_t id) {
+            if(num_visible_dim >= MaxNumVisibleDim)
+            {
+                throw std::runtime_error("wrong! too many visible dimensions");
+            }
+
+            visible_ids[num_visible_dim++] = static_cast<uint8_t>(id);
+        };
+
+        for(index_t dim = 0; dim < num_visible_dim_; ++dim)
+        {
+            if(dim == low_dims[0])
+            {
+                for(index_t i = 0; i < num_up; ++i)
+                {
+                    push_visible_id(up_begin + i);
+                }
+            }
+            else if(!is_low[dim])
+            {
+                push_visible_id(visible_ids_[dim]);
+            }
+        }
+
+        num_visible_dim_ = num_visible_dim;
+
+        for(index_t i = 0; i < num_visible_dim; ++i)
+        {
+            visible_ids_[i] = visible_ids[i];
+        }
+    }
+};
+
+} // namespace ck
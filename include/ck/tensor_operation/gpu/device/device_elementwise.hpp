@@ -31,6 +31,10 @@ struct DeviceElementwise : public BaseOperator
                         ElementwiseOperation elementwise_op) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // number of consecutive elements of the fastest dimension handled per thread access, used to
+    // prefer the widest vectorized instance
+    virtual index_t GetMPerThread() const { return 1; }
 }; // namespace device
 
 template <typename InDataTypeTuple,
@@ -0,0 +1,322 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_elementwise.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Lengths of the numpy-style broadcast of all the shapes: shapes are right-aligned, and every
+// dimension must either match or be 1
+inline std::vector<index_t>
+BroadcastElementwiseLengths(const std::vector<std::vector<index_t>>& shapes)
+{
+    std::size_t rank = 0;
+
+    for(const auto& shape : shapes)
+    {
+        rank = std::max(rank, shape.size());
+    }
+
+    std::vector<index_t> lengths(rank, 1);
+
+    for(const auto& shape : shapes)
+    {
+        const std::size_t offset = rank - shape.size();
+
+        for(std::size_t i = 0; i < shape.size(); ++i)
+        {
+            index_t& length = lengths[offset + i];
+
+            if(length == 1)
+            {
+                length = shape[i];
+            }
+            else if(shape[i] != 1 && shape[i] != length)
+            {
+                throw std::runtime_error("wrong! shapes can not be broadcast together");
+            }
+        }
+    }
+
+    return lengths;
+}
+
+// Strides of a packed tensor of the given shape, read as a tensor of the broadcast lengths:
+// missing leading dimensions and broadcast dimensions of length 1 get a stride of 0
+inline std::vector<index_t> MakeElementwiseBroadcastStrides(const std::vector<index_t>& shape,
+                                                            const std::vector<index_t>& lengths)
+{
+    if(shape.size() > lengths.size())
+    {
+        throw std::runtime_error("wrong! shape has a higher rank than the broadcast lengths");
+    }
+
+    const std::size_t offset = lengths.size() - shape.size();
+
+    std::vector<index_t> strides(lengths.size(), 0);
+
+    index_t stride = 1;
+
+    for(std::size_t i = shape.size(); i > 0; --i)
+    {
+        const std::size_t dim = offset + i - 1;
+
+        if(shape[i - 1] == lengths[dim] && lengths[dim] != 1)
+        {
+            strides[dim] = stride;
+        }
+        else if(shape[i - 1] != 1)
+        {
+            throw std::runtime_error("wrong! shape can not be broadcast to the lengths");
+        }
+
+        stride *= shape[i - 1];
+    }
+
+    return strides;
+}
+
+// Lengths and per-tensor strides of an elementwise problem
+struct ElementwiseProblemDesc
+{
+    std::vector<index_t> lengths_;
+    std::vector<std::vector<index_t>> strides_;
+};
+
+// Fold the problem to the smallest rank which addresses the same elements of every tensor:
+//  @li dimensions of length 1 are dropped
+//  @li dimension i is merged into its outer neighbour i - 1 if, for every tensor,
+//      stride[i - 1] == stride[i] * length[i], which covers contiguous dimensions as well as
+//      dimensions broadcast together (both strides 0)
+// The result has at least one dimension, so that it can always be handed to a device op
+inline ElementwiseProblemDesc CoalesceElementwiseProblem(const ElementwiseProblemDesc& problem)
+{
+    const std::size_t rank        = problem.lengths_.size();
+    const std::size_t num_tensors = problem.strides_.size();
+
+    for(const auto& strides : problem.strides_)
+    {
+        if(strides.size() != rank)
+        {
+            throw std::runtime_error("wrong! strides and lengths have different ranks");
+        }
+    }
+
+    ElementwiseProblemDesc coalesced{{}, std::vector<std::vector<index_t>>(num_tensors)};
+
+    for(std::size_t i = 0; i < rank; ++i)
+    {
+        const index_t length = problem.lengths_[i];
+
+        if(length == 1)
+        {
+            continue;
+        }
+
+        bool mergeable = !coalesced.lengths_.empty();
+
+        for(std::size_t t = 0; t < num_tensors && mergeable; ++t)
+        {
+            mergeable = coalesced.strides_[t].back() == problem.strides_[t][i] * length;
+        }
+
+        if(mergeable)
+        {
+            coalesced.lengths_.back() *= length;
+
+            for(std::size_t t = 0; t < num_tensors; ++t)
+            {
+                coalesced.strides_[t].back() = problem.strides_[t][i];
+            }
+        }
+        else
+        {
+            coalesced.lengths_.push_back(length);
+
+            for(std::size_t t = 0; t < num_tensors; ++t)
+            {
+                coalesced.strides_[t].push_back(problem.strides_[t][i]);
+            }
+        }
+    }
+
+    // a single element
+    if(coalesced.lengths_.empty())
+    {
+        coalesced.lengths_.push_back(1);
+
+        for(auto& strides : coalesced.strides_)
+        {
+            strides.push_back(1);
+        }
+    }
+
+    return coalesced;
+}
+
+//
+// @brief      Front end of DeviceElementwise for inputs of arbitrary ranks with numpy-style
+//             broadcasting.
+//
+// The inputs are packed tensors of their own shapes, the outputs packed tensors of the broadcast
+// shape. The problem is coalesced on the host, padded with leading dimensions of length 1 to
+// NumDim and dispatched to the instance with the widest vector access that supports it, so one
+// NumDim instance list serves every rank whose coalesced form fits.
+//
+template <typename InDataTypeTuple,
+          typename OutDataTypeTuple,
+          typename ElementwiseOperation,
+          index_t NumDim>
+struct DeviceElementwiseBroadcast
+{
+    static constexpr int NumInput  = InDataTypeTuple::Size();
+    static constexpr int NumOutput = OutDataTypeTuple::Size();
+
+    using DeviceOp =
+        DeviceElementwise<InDataTypeTuple, OutDataTypeTuple, ElementwiseOperation, NumDim>;
+    using DeviceOpPtr = std::unique_ptr<DeviceOp>;
+
+    struct Argument
+    {
+        // selected instance, nullptr if no instance supports the problem
+        DeviceOp* p_op_ = nullptr;
+
+        std::unique_ptr<BaseArgument> p_arg_;
+        std::unique_ptr<BaseInvoker> p_invoker_;
+
+        ElementwiseProblemDesc problem_;
+    };
+
+    explicit DeviceElementwiseBroadcast(std::vector<DeviceOpPtr> instances)
+        : instances_{std::move(instances)}
+    {
+        // widest vector access first, keeping the given order otherwise
+        std::stable_sort(instances_.begin(),
+                         instances_.end(),
+                         [](const DeviceOpPtr& lhs, const DeviceOpPtr& rhs) {
+                             return lhs->GetMPerThread() > rhs->GetMPerThread();
+                         });
+    }
+
+    // coalesced problem, with the strides of the inputs followed by the ones of the outputs
+    static ElementwiseProblemDesc
+    MakeProblemDesc(const std::array<std::vector<index_t>, NumInput>& in_shapes)
+    {
+        const auto lengths =
+            BroadcastElementwiseLengths(std::vector<std::vector<index_t>>(in_shapes.begin(),
+                                                                          in_shapes.end()));
+
+        ElementwiseProblemDesc problem{lengths, {}};
+
+        for(const auto& shape : in_shapes)
+        {
+            problem.strides_.push_back(MakeElementwiseBroadcastStrides(shape, lengths));
+        }
+
+        for(int i = 0; i < NumOutput; ++i)
+        {
+            problem.strides_.push_back(MakeElementwiseBroadcastStrides(lengths, lengths));
+        }
+
+        return CoalesceElementwiseProblem(problem);
+    }
+
+    Argument MakeArgument(const std::array<std::vector<index_t>, NumInput>& in_shapes,
+                          const std::array<const void*, NumInput> in_dev_buffers,
+                          const std::array<void*, NumOutput> out_dev_buffers,
+                          ElementwiseOperation elementwise_op) const
+    {
+        Argument arg;
+
+        arg.problem_ = MakeProblemDesc(in_shapes);
+
+        const std::size_t rank = arg.problem_.lengths_.size();
+
+        if(rank > static_cast<std::size_t>(NumDim))
+        {
+            return arg;
+        }
+
+        // pad to NumDim with outer dimensions of length 1
+        const std::size_t offset = NumDim - rank;
+
+        std::array<index_t, NumDim> lengths;
+        std::array<std::array<index_t, NumDim>, NumInput> in_strides;
+        std::array<std::array<index_t, NumDim>, NumOutput> out_strides;
+
+        lengths.fill(1);
+
+        for(auto& strides : in_strides)
+        {
+            strides.fill(0);
+        }
+
+        for(auto& strides : out_strides)
+        {
+            strides.fill(0);
+        }
+
+        for(std::size_t i = 0; i < rank; ++i)
+        {
+            lengths[offset + i] = arg.problem_.lengths_[i];
+
+            for(int t = 0; t < NumInput; ++t)
+            {
+                in_strides[t][offset + i] = arg.problem_.strides_[t][i];
+            }
+
+            for(int t = 0; t < NumOutput; ++t)
+            {
+                out_strides[t][offset + i] = arg.problem_.strides_[NumInput + t][i];
+            }
+        }
+
+        for(const auto& p_op : instances_)
+        {
+            auto p_arg = p_op->MakeArgumentPointer(
+                lengths, in_strides, out_strides, in_dev_buffers, out_dev_buffers, elementwise_op);
+
+            if(p_op->IsSupportedArgument(p_arg.get()))
+            {
+                arg.p_op_      = p_op.get();
+                arg.p_arg_     = std::move(p_arg);
+                arg.p_invoker_ = p_op->MakeInvokerPointer();
+
+                break;
+            }
+        }
+
+        return arg;
+    }
+
+    static bool IsSupportedArgument(const Argument& arg) { return arg.p_op_ != nullptr; }
+
+    static float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+    {
+        if(!IsSupportedArgument(arg))
+        {
+            throw std::runtime_error("wrong! no elementwise instance supports this problem");
+        }
+
+        return arg.p_invoker_->Run(arg.p_arg_.get(), stream_config);
+    }
+
+    private:
+    std::vector<DeviceOpPtr> instances_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// GEMM with the layout transform of D and E folded into the epilogue:
+//   input : A[M, K], B[N, K]
+//   input : D0[M0, M1, ..., N0, N1, ...], D1[M0, M1, ..., N0, N1, ...], ...
+//   output : E[M0, M1, ..., N0, N1, ...]
+//   C = a_op(A) * b_op(B)
+//   E = cde_op(C, D0, D1, ...)
+// Assume:
+//   M = M0 * M1 * ..., N = N0 * N1 * ...
+//   D0, D1, ... and E are described by arbitrary lengths and strides, so any permutation (or
+//   broadcast, for Ds) of [M0, M1, ..., N0, N1, ...] can be written without an extra pass
+template <index_t NumDimM,
+          index_t NumDimN,
+          typename ALayout,
+          typename BLayout,
+          typename ADataType,
+          typename BDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation>
+struct DeviceGemmMultipleDPermute : public BaseOperator
+{
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* p_a,
+                        const void* p_b,
+                        std::array<const void*, NumDTensor> p_ds,
+                        void* p_e,
+                        ck::index_t K,
+                        ck::index_t StrideA,
+                        ck::index_t StrideB,
+                        const std::array<std::vector<ck::index_t>, NumDTensor>& ds_ms_ns_lengths,
+                        const std::array<std::vector<ck::index_t>, NumDTensor>& ds_ms_ns_strides,
+                        const std::vector<ck::index_t>& e_ms_ns_lengths,
+                        const std::vector<ck::index_t>& e_ms_ns_strides,
+                        AElementwiseOperation a_element_op,
+                        BElementwiseOperation b_element_op,
+                        CDEElementwiseOperation cde_element_op) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
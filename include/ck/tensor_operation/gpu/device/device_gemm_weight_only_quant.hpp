@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Weight-only quantized GEMM (e.g. W4A16, W8A16):
+//   input : A[M, K]
+//   input : B[N, K], WeightBits-bit unsigned codes packed along K
+//   input : Scale[N, K / GroupSize], Zero[N, K / GroupSize]
+//   output : E[M, N]
+//   B'[n, k] = (B[n, k] - Zero[n, k / GroupSize]) * Scale[n, k / GroupSize]
+//   E = c_op(a_op(A) * B'^T)
+// Assume:
+//   A and E are row-major, B is packed row by row with StrideB bytes per row, Scale and Zero are
+//   packed. With WeightBits = 4 two codes share a byte, the even k in the low nibble, see
+//   ck::utils::pack_weight_only_quant
+template <typename ADataType,
+          typename ScaleDataType,
+          typename EDataType,
+          index_t WeightBits,
+          typename AElementwiseOperation,
+          typename CElementwiseOperation>
+struct DeviceGemmWeightOnlyQuant : public BaseOperator
+{
+    static_assert(WeightBits == 4 || WeightBits == 8, "wrong! only 4-bit and 8-bit weights");
+
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* p_a,
+                        const void* p_b,
+                        const void* p_scale,
+                        const void* p_zero,
+                        void* p_e,
+                        ck::index_t M,
+                        ck::index_t N,
+                        ck::index_t K,
+                        ck::index_t StrideA,
+                        ck::index_t StrideB,
+                        ck::index_t StrideE,
+                        ck::index_t GroupSize,
+                        AElementwiseOperation a_element_op,
+                        CElementwiseOperation c_element_op) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
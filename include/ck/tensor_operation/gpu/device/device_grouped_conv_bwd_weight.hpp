@@ -23,6 +23,7 @@ template <ck::index_t NDimSpatial,
           typename OutElementwiseOperation>
 struct DeviceGroupedConvBwdWeight : public BaseOperator
 {
+    // split_k <= 0 lets the op pick the split of GEMM K = N * Ho * Wo from the problem size
     virtual std::unique_ptr<BaseArgument>
     MakeArgumentPointer(const void* p_in,
                         void* p_wei,
@@ -44,6 +45,11 @@ struct DeviceGroupedConvBwdWeight : public BaseOperator
                         ck::index_t split_k) = 0;
 
     virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+
+    // Sums the splits of GEMM K in a fixed order through the workspace instead of with atomics,
+    // so that runs with the same split give the same weight bit for bit. Ops which do not
+    // accumulate the splits with atomics are deterministic already and ignore it.
+    virtual void SetDeterministic(BaseArgument*, bool) const {}
 };
 
 } // namespace device
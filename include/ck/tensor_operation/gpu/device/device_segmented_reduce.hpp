@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <memory>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Reduction over the rows of a ragged tensor. The input is a packed [TotalLength, InnerLength]
+// tensor whose rows are grouped into segments by CSR-style offsets: segment i is made of the rows
+// [offsets[i], offsets[i + 1]), so offsets holds NumSegments + 1 entries and a segment may be
+// empty. Each column of each segment is reduced, giving a packed [NumSegments, InnerLength]
+// output, i.e. out = alpha * AccElementwiseOp(reduce(InElementwiseOp(in))) + beta * out
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan>
+struct DeviceSegmentedReduce : public BaseOperator
+{
+    //
+    // @brief      Makes a pointer to Argument class.
+    //
+    // @param[in]  numSegments         Number of segments
+    // @param[in]  innerLength         Length of every row, the rows of a segment are reduced
+    // @param[in]  offsets_dev         Pointer in device memory to the numSegments + 1 offsets
+    // @param[in]  alpha               double type value
+    // @param[in]  beta                double type value
+    // @param[in]  in_dev              Typeless const pointer in device memory storing the input
+    //                                 tensor
+    // @param      out_dev             Typeless pointer in device memory storing the output tensor
+    // @param[in]  in_elementwise_op   The input elementwise operation.
+    // @param[in]  acc_elementwise_op  The accumulation elementwise operation. A UnaryDivide
+    //                                 divides by the length of each segment (e.g. for AVG)
+    //
+    // @return     Unique pointer to the Argument class.
+    //
+    virtual std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(index_t numSegments,
+                        index_t innerLength,
+                        const index_t* offsets_dev,
+                        double alpha,
+                        double beta,
+                        const void* in_dev,
+                        void* out_dev,
+                        const InElementwiseOperation in_elementwise_op,
+                        const AccElementwiseOperation acc_elementwise_op) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan>
+using DeviceSegmentedReducePtr = std::unique_ptr<DeviceSegmentedReduce<InDataType,
+                                                                       AccDataType,
+                                                                       OutDataType,
+                                                                       ReduceOperation,
+                                                                       InElementwiseOperation,
+                                                                       AccElementwiseOperation,
+                                                                       PropagateNan>>;
+
+// The divider of the mean depends on the segment, so a UnaryDivide accumulation elementwise
+// operation is rebuilt from the length of each segment. An empty segment keeps the identity value
+template <typename AccElementwiseOperation>
+__host__ __device__ constexpr auto
+GetSegmentAccElementwiseOperation(const AccElementwiseOperation& acc_elementwise_op,
+                                  index_t segment_length)
+{
+    if constexpr(is_same_v<AccElementwiseOperation, element_wise::UnaryDivide>)
+    {
+        ignore = acc_elementwise_op;
+
+        return element_wise::UnaryDivide{segment_length > 0 ? segment_length : 1};
+    }
+    else
+    {
+        ignore = segment_length;
+
+        return acc_elementwise_op;
+    }
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <memory>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Softmax over the segments of a ragged tensor, laid out as for DeviceSegmentedReduce: the input
+// and output are packed [TotalLength, InnerLength] tensors, and the softmax of each column is
+// taken over the rows [offsets[i], offsets[i + 1]) of every segment i, so variable-length
+// sequences do not need to be padded
+template <typename InDataType, typename AccDataType, typename OutDataType>
+struct DeviceSegmentedSoftmax : public BaseOperator
+{
+    //
+    // @brief      Makes a pointer to Argument class.
+    //
+    // @param[in]  numSegments         Number of segments
+    // @param[in]  innerLength         Length of every row
+    // @param[in]  offsets_dev         Pointer in device memory to the numSegments + 1 offsets
+    // @param[in]  alpha               double type value
+    // @param[in]  beta                double type value
+    // @param[in]  in_dev              Typeless const pointer in device memory storing the input
+    //                                 tensor
+    // @param      out_dev             Typeless pointer in device memory storing the output tensor
+    //
+    // @return     Unique pointer to the Argument class.
+    //
+    virtual std::unique_ptr<BaseArgument> MakeArgumentPointer(index_t numSegments,
+                                                              index_t innerLength,
+                                                              const index_t* offsets_dev,
+                                                              double alpha,
+                                                              double beta,
+                                                              const void* in_dev,
+                                                              void* out_dev) = 0;
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer() = 0;
+};
+
+template <typename InDataType, typename AccDataType, typename OutDataType>
+using DeviceSegmentedSoftmaxPtr =
+    std::unique_ptr<DeviceSegmentedSoftmax<InDataType, AccDataType, OutDataType>>;
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
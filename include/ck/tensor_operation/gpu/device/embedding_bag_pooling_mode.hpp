@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <string>
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// How the embedding rows gathered for one bag are pooled into a single row
+enum struct EmbeddingBagPoolingMode
+{
+    Sum,
+    Mean
+};
+
+inline std::string getEmbeddingBagPoolingModeString(const EmbeddingBagPoolingMode& s)
+{
+    switch(s)
+    {
+    case EmbeddingBagPoolingMode::Sum: return "Sum";
+    case EmbeddingBagPoolingMode::Mean: return "Mean";
+    default: return "Unrecognized pooling mode!";
+    }
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
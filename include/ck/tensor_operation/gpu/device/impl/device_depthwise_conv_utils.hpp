@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// The image tensors of a depthwise convolution are accessed with vectors of GPerThread groups,
+// which must be contiguous and aligned
+template <index_t NDimSpatial, index_t GPerThread>
+bool IsDepthwiseConvImageAccessSupported(const std::array<index_t, NDimSpatial + 3>& lengths,
+                                         const std::array<index_t, NDimSpatial + 3>& strides)
+{
+    if constexpr(GPerThread == 1)
+    {
+        ignore = lengths;
+        ignore = strides;
+
+        return true;
+    }
+    else
+    {
+        if(!(lengths[0] % GPerThread == 0 && strides[0] == 1))
+        {
+            return false;
+        }
+
+        for(index_t i = 1; i < NDimSpatial + 3; ++i)
+        {
+            if(lengths[i] > 1 && strides[i] % GPerThread != 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+}
+
+// Strides in [G, N, C, H, W] order of a packed 2D image tensor, the layouts being given for the
+// input (GNHWC, NHWGC) but also holding for the output (GNHWK, NHWGK) with C = K
+template <typename Layout>
+std::array<index_t, 5>
+MakeDepthwiseConvImageStrides(index_t G, index_t N, index_t C, index_t H, index_t W)
+{
+    namespace ctc = tensor_layout::convolution;
+
+    if constexpr(is_same_v<Layout, ctc::GNHWC> || is_same_v<Layout, ctc::GNHWK>)
+    {
+        ignore = G;
+
+        return {N * H * W * C, H * W * C, 1, W * C, C};
+    }
+    else if constexpr(is_same_v<Layout, ctc::NHWGC> || is_same_v<Layout, ctc::NHWGK>)
+    {
+        ignore = N;
+
+        return {C, H * W * G * C, 1, W * G * C, G * C};
+    }
+    else
+    {
+        static_assert(is_same_v<Layout, ctc::GNHWC>, "wrong! unsupported image layout");
+
+        return {};
+    }
+}
+
+// Strides in [G, K, C, Y, X] order of a packed GKYXC filter
+template <typename Layout>
+std::array<index_t, 5> MakeDepthwiseConvFilterStrides(index_t K, index_t C, index_t Y, index_t X)
+{
+    static_assert(is_same_v<Layout, tensor_layout::convolution::GKYXC>,
+                  "wrong! unsupported filter layout");
+
+    return {K * Y * X * C, Y * X * C, 1, X * C, C};
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
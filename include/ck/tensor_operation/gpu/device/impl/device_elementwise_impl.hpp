@@ -296,6 +296,8 @@ struct DeviceElementwiseImpl
     {
         return std::make_unique<Invoker>();
     };
+
+    index_t GetMPerThread() const override { return MPerThread; }
 }; // namespace device
 
 } // namespace device
@@ -498,6 +498,16 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
             return false;
         }
 
+        // fp8 MFMAs are only available on gfx94x
+        if constexpr(is_same_v<ADataType, f8_t> || is_same_v<BDataType, f8_t>)
+        {
+            if(!(ck::get_device_name() == "gfx940" || ck::get_device_name() == "gfx941" ||
+                 ck::get_device_name() == "gfx942"))
+            {
+                return false;
+            }
+        }
+
         // check vector load/store
         {
             using Row = ck::tensor_layout::gemm::RowMajor;
@@ -546,13 +556,16 @@ struct DeviceGemmMultipleD_Xdl_CShuffle : public DeviceGemmMultipleD<ALayout,
             }
 
             // check vector load of Ds
-            // only support RowMajor for now
+            // Ds are read along N: RowMajor, or ColumnMajor with scalar access, e.g. a per-row
+            // scale broadcast along N with StrideD = 0
             bool all_valid = true;
 
             static_for<0, NumDTensor, 1>{}([&](auto i) {
                 using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
 
-                if constexpr(!is_same_v<DLayout, Row>)
+                if constexpr(!(is_same_v<DLayout, Row> ||
+                               (is_same_v<DLayout, Col> &&
+                                CDEBlockTransferScalarPerVector_NPerBlock == 1)))
                 {
                     all_valid = false;
                 }
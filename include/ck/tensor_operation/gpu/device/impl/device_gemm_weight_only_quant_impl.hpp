@@ -0,0 +1,248 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_weight_only_quant.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_gemm_weight_only_quant.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+//
+// @brief      Device weight-only quantized GEMM, f16 (bf16) activations times 4-bit or 8-bit
+//             weights with a scale and a zero point per group of GroupSize k.
+//
+// The weights are dequantized in registers after being read, so the op reads
+// WeightBits / 16 of the bytes of the f16 weights, which bounds the GEMV and small-M GEMMs of
+// decoding. See GridwiseGemmWeightOnlyQuant; larger M are better served by dequantizing B once
+// and running a regular GEMM.
+//
+template <typename ADataType,
+          typename ScaleDataType,
+          typename AccDataType,
+          typename EDataType,
+          index_t WeightBits,
+          typename AElementwiseOperation,
+          typename CElementwiseOperation,
+          index_t BlockSize,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t KPerThread>
+struct DeviceGemmWeightOnlyQuantImpl : public DeviceGemmWeightOnlyQuant<ADataType,
+                                                                        ScaleDataType,
+                                                                        EDataType,
+                                                                        WeightBits,
+                                                                        AElementwiseOperation,
+                                                                        CElementwiseOperation>
+{
+    using DeviceOp = DeviceGemmWeightOnlyQuantImpl;
+
+    using GridwiseGemm = GridwiseGemmWeightOnlyQuant<ADataType,
+                                                     ScaleDataType,
+                                                     AccDataType,
+                                                     EDataType,
+                                                     WeightBits,
+                                                     BlockSize,
+                                                     MPerBlock,
+                                                     NPerBlock,
+                                                     KPerThread>;
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const void* p_a,
+                 const void* p_b,
+                 const void* p_scale,
+                 const void* p_zero,
+                 void* p_e,
+                 index_t M,
+                 index_t N,
+                 index_t K,
+                 index_t StrideA,
+                 index_t StrideB,
+                 index_t StrideE,
+                 index_t GroupSize,
+                 AElementwiseOperation a_element_op,
+                 CElementwiseOperation c_element_op)
+            : p_a_grid_{static_cast<const ADataType*>(p_a)},
+              p_b_grid_{static_cast<const uint8_t*>(p_b)},
+              p_scale_grid_{static_cast<const ScaleDataType*>(p_scale)},
+              p_zero_grid_{static_cast<const ScaleDataType*>(p_zero)},
+              p_e_grid_{static_cast<EDataType*>(p_e)},
+              problem_{M, N, K, StrideA, StrideB, StrideE, GroupSize},
+              a_element_op_{a_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        void Print() const
+        {
+            std::cout << "M " << problem_.M_ << ", N " << problem_.N_ << ", K " << problem_.K_
+                      << ", GroupSize " << problem_.GroupSize_ << std::endl;
+        }
+
+        const ADataType* p_a_grid_;
+        const uint8_t* p_b_grid_;
+        const ScaleDataType* p_scale_grid_;
+        const ScaleDataType* p_zero_grid_;
+        EDataType* p_e_grid_;
+
+        GemmWeightOnlyQuantProblem problem_;
+
+        AElementwiseOperation a_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        using Argument = DeviceOp::Argument;
+
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(stream_config.log_level_ > 0)
+            {
+                arg.Print();
+            }
+
+            const auto kernel = kernel_gemm_weight_only_quant<GridwiseGemm,
+                                                              ADataType,
+                                                              ScaleDataType,
+                                                              EDataType,
+                                                              AElementwiseOperation,
+                                                              CElementwiseOperation>;
+
+            const index_t grid_size =
+                GridwiseGemm::CalculateGridSize(arg.problem_.M_, arg.problem_.N_);
+
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(grid_size),
+                                          dim3(BlockSize),
+                                          0,
+                                          arg.p_a_grid_,
+                                          arg.p_b_grid_,
+                                          arg.p_scale_grid_,
+                                          arg.p_zero_grid_,
+                                          arg.p_e_grid_,
+                                          arg.problem_,
+                                          arg.a_element_op_,
+                                          arg.c_element_op_);
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        return GridwiseGemm::CheckValidity(arg.problem_);
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    static auto MakeArgument(const void* p_a,
+                             const void* p_b,
+                             const void* p_scale,
+                             const void* p_zero,
+                             void* p_e,
+                             index_t M,
+                             index_t N,
+                             index_t K,
+                             index_t StrideA,
+                             index_t StrideB,
+                             index_t StrideE,
+                             index_t GroupSize,
+                             AElementwiseOperation a_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{p_a,
+                        p_b,
+                        p_scale,
+                        p_zero,
+                        p_e,
+                        M,
+                        N,
+                        K,
+                        StrideA,
+                        StrideB,
+                        StrideE,
+                        GroupSize,
+                        a_element_op,
+                        c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(const void* p_a,
+                                                      const void* p_b,
+                                                      const void* p_scale,
+                                                      const void* p_zero,
+                                                      void* p_e,
+                                                      index_t M,
+                                                      index_t N,
+                                                      index_t K,
+                                                      index_t StrideA,
+                                                      index_t StrideB,
+                                                      index_t StrideE,
+                                                      index_t GroupSize,
+                                                      AElementwiseOperation a_element_op,
+                                                      CElementwiseOperation c_element_op) override
+    {
+        return std::make_unique<Argument>(p_a,
+                                          p_b,
+                                          p_scale,
+                                          p_zero,
+                                          p_e,
+                                          M,
+                                          N,
+                                          K,
+                                          StrideA,
+                                          StrideB,
+                                          StrideE,
+                                          GroupSize,
+                                          a_element_op,
+                                          c_element_op);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGemmWeightOnlyQuantImpl"
+            << "<"
+            << "W" << WeightBits << ", "
+            << BlockSize << ", "
+            << MPerBlock << ", "
+            << NPerBlock << ", "
+            << KPerThread
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,383 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_bwd_data_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_depthwise_conv_utils.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_depthwise_conv.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+//
+// @brief      Device backward data depthwise convolution, i.e. grouped convolution with C = 1 per
+//             group and K (the channel multiplier) outputs per group.
+//
+// Supports:
+//  @li         2D convolution with any filter size, strides, dilations and pads
+//  @li         Image tensors in any layout. GPerThread > 1 additionally needs the groups to be
+//              contiguous, e.g. NHWGK/NHWGC with K = 1, and G to be a multiple of GPerThread
+//
+// A is the output gradient, B the filter and E the input gradient. Every input pixel gathers the
+// output pixels it contributed to, so there are no atomics nor a zeroing pass, see
+// GridwiseDepthwiseConv_2d.
+//
+template <index_t NDimSpatial,
+          typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          index_t BlockSize,
+          index_t GPerThread>
+struct DeviceGroupedConvBwdDataMultipleD_Depthwise
+    : public DeviceGroupedConvBwdDataMultipleD<NDimSpatial,
+                                               ALayout,
+                                               BLayout,
+                                               DsLayout,
+                                               ELayout,
+                                               ADataType,
+                                               BDataType,
+                                               DsDataType,
+                                               EDataType,
+                                               AElementwiseOperation,
+                                               BElementwiseOperation,
+                                               CDEElementwiseOperation>
+{
+    using DeviceOp = DeviceGroupedConvBwdDataMultipleD_Depthwise;
+
+    static_assert(NDimSpatial == 2, "the depthwise convolution is only implemented for 2D");
+
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    // the input image is the destination
+    using GridwiseConv = GridwiseDepthwiseConv_2d<EDataType,
+                                                  BDataType,
+                                                  AccDataType,
+                                                  DsDataType,
+                                                  ADataType,
+                                                  BlockSize,
+                                                  GPerThread, // GPerBlock, unused
+                                                  GPerThread>;
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const void* p_a,
+                 const void* p_b,
+                 const std::array<const void*, NumDTensor>& p_ds,
+                 void* p_e,
+                 const std::array<index_t, NDimSpatial + 3>& a_g_n_k_wos_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& a_g_n_k_wos_strides,
+                 const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+                 const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>&
+                     ds_g_n_c_wis_lengths,
+                 const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>&
+                     ds_g_n_c_wis_strides,
+                 const std::array<index_t, NDimSpatial + 3>& e_g_n_c_wis_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& e_g_n_c_wis_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                 const std::array<index_t, NDimSpatial>& input_left_pads,
+                 const std::array<index_t, NDimSpatial>& input_right_pads,
+                 const AElementwiseOperation& a_element_op,
+                 const BElementwiseOperation& b_element_op,
+                 const CDEElementwiseOperation& cde_element_op)
+            : p_a_grid_{static_cast<const ADataType*>(p_a)},
+              p_b_grid_{static_cast<const BDataType*>(p_b)},
+              p_ds_grid_{},
+              p_e_grid_{static_cast<EDataType*>(p_e)},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              cde_element_op_{cde_element_op},
+              a_g_n_k_wos_lengths_{a_g_n_k_wos_lengths},
+              a_g_n_k_wos_strides_{a_g_n_k_wos_strides},
+              b_g_k_c_xs_lengths_{b_g_k_c_xs_lengths},
+              e_g_n_c_wis_lengths_{e_g_n_c_wis_lengths},
+              e_g_n_c_wis_strides_{e_g_n_c_wis_strides}
+        {
+            problem_.G_             = e_g_n_c_wis_lengths[0];
+            problem_.N_             = e_g_n_c_wis_lengths[1];
+            problem_.K_             = b_g_k_c_xs_lengths[1];
+            problem_.Hi_            = e_g_n_c_wis_lengths[3];
+            problem_.Wi_            = e_g_n_c_wis_lengths[4];
+            problem_.Y_             = b_g_k_c_xs_lengths[3];
+            problem_.X_             = b_g_k_c_xs_lengths[4];
+            problem_.Ho_            = a_g_n_k_wos_lengths[3];
+            problem_.Wo_            = a_g_n_k_wos_lengths[4];
+            problem_.ConvStrideH_   = conv_filter_strides[0];
+            problem_.ConvStrideW_   = conv_filter_strides[1];
+            problem_.ConvDilationH_ = conv_filter_dilations[0];
+            problem_.ConvDilationW_ = conv_filter_dilations[1];
+            problem_.LeftPadH_      = input_left_pads[0];
+            problem_.LeftPadW_      = input_left_pads[1];
+
+            for(index_t i = 0; i < NDimSpatial + 3; ++i)
+            {
+                a_strides_(i) = a_g_n_k_wos_strides[i];
+                b_strides_(i) = b_g_k_c_xs_strides[i];
+                e_strides_(i) = e_g_n_c_wis_strides[i];
+            }
+
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+
+                for(index_t j = 0; j < NDimSpatial + 3; ++j)
+                    ds_strides_(i)(j) = ds_g_n_c_wis_strides[i][j];
+            });
+
+            ignore = ds_g_n_c_wis_lengths;
+            ignore = input_right_pads;
+        }
+
+        long_index_t GetNumThread() const
+        {
+            return static_cast<long_index_t>(problem_.G_ / GPerThread) * problem_.N_ *
+                   problem_.Hi_ * problem_.Wi_;
+        }
+
+        void Print() const
+        {
+            std::cout << "G " << problem_.G_ << ", N " << problem_.N_ << ", K " << problem_.K_
+                      << ", Hi " << problem_.Hi_ << ", Wi " << problem_.Wi_ << ", Y " << problem_.Y_
+                      << ", X " << problem_.X_ << ", Ho " << problem_.Ho_ << ", Wo "
+                      << problem_.Wo_ << std::endl;
+        }
+
+        //  private:
+        // pointers
+        const ADataType* p_a_grid_;
+        const BDataType* p_b_grid_;
+        typename GridwiseConv::DsGridPointer p_ds_grid_;
+        EDataType* p_e_grid_;
+
+        DepthwiseConvProblem_2d problem_;
+
+        Array<index_t, NDimSpatial + 3> a_strides_;
+        Array<index_t, NDimSpatial + 3> b_strides_;
+        Array<Array<index_t, NDimSpatial + 3>, NumDTensor> ds_strides_;
+        Array<index_t, NDimSpatial + 3> e_strides_;
+
+        // element-wise op
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+
+        // for checking IsSupportedArgument()
+        std::array<index_t, NDimSpatial + 3> a_g_n_k_wos_lengths_;
+        std::array<index_t, NDimSpatial + 3> a_g_n_k_wos_strides_;
+        std::array<index_t, NDimSpatial + 3> b_g_k_c_xs_lengths_;
+        std::array<index_t, NDimSpatial + 3> e_g_n_c_wis_lengths_;
+        std::array<index_t, NDimSpatial + 3> e_g_n_c_wis_strides_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        using Argument = DeviceOp::Argument;
+
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(stream_config.log_level_ > 0)
+            {
+                arg.Print();
+            }
+
+            const auto kernel = kernel_depthwise_conv_bwd_data<GridwiseConv,
+                                                          ADataType,
+                                                          BDataType,
+                                                          typename GridwiseConv::DsGridPointer,
+                                                          EDataType,
+                                                          AElementwiseOperation,
+                                                          BElementwiseOperation,
+                                                          CDEElementwiseOperation,
+                                                          NumDTensor>;
+
+            const index_t grid_size = static_cast<index_t>(math::integer_divide_ceil(
+                arg.GetNumThread(), static_cast<long_index_t>(BlockSize)));
+
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(grid_size),
+                                          dim3(BlockSize),
+                                          0,
+                                          arg.p_a_grid_,
+                                          arg.p_b_grid_,
+                                          arg.p_ds_grid_,
+                                          arg.p_e_grid_,
+                                          arg.problem_,
+                                          arg.a_strides_,
+                                          arg.b_strides_,
+                                          arg.ds_strides_,
+                                          arg.e_strides_,
+                                          arg.a_element_op_,
+                                          arg.b_element_op_,
+                                          arg.cde_element_op_);
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        // depthwise: one input channel per group
+        if(!(arg.e_g_n_c_wis_lengths_[2] == 1 && arg.b_g_k_c_xs_lengths_[2] == 1))
+        {
+            return false;
+        }
+
+        if(!(IsDepthwiseConvImageAccessSupported<NDimSpatial, GPerThread>(
+                 arg.a_g_n_k_wos_lengths_, arg.a_g_n_k_wos_strides_) &&
+             IsDepthwiseConvImageAccessSupported<NDimSpatial, GPerThread>(
+                 arg.e_g_n_c_wis_lengths_, arg.e_g_n_c_wis_strides_)))
+        {
+            return false;
+        }
+
+        // the threads are indexed with index_t
+        if(arg.GetNumThread() + BlockSize > NumericLimits<index_t>::Max())
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    static auto MakeArgument(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, NumDTensor>& p_ds,
+        void* p_e,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_c_wis_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op)
+    {
+        return Argument{p_a,
+                        p_b,
+                        p_ds,
+                        p_e,
+                        a_g_n_k_wos_lengths,
+                        a_g_n_k_wos_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        ds_g_n_c_wis_lengths,
+                        ds_g_n_c_wis_strides,
+                        e_g_n_c_wis_lengths,
+                        e_g_n_c_wis_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        a_element_op,
+                        b_element_op,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, NumDTensor>& p_ds,
+        void* p_e,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_c_wis_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op) override
+    {
+        return std::make_unique<Argument>(p_a,
+                                          p_b,
+                                          p_ds,
+                                          p_e,
+                                          a_g_n_k_wos_lengths,
+                                          a_g_n_k_wos_strides,
+                                          b_g_k_c_xs_lengths,
+                                          b_g_k_c_xs_strides,
+                                          ds_g_n_c_wis_lengths,
+                                          ds_g_n_c_wis_strides,
+                                          e_g_n_c_wis_lengths,
+                                          e_g_n_c_wis_strides,
+                                          conv_filter_strides,
+                                          conv_filter_dilations,
+                                          input_left_pads,
+                                          input_right_pads,
+                                          a_element_op,
+                                          b_element_op,
+                                          cde_element_op);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGroupedConvBwdDataMultipleD_Depthwise"
+            << "<"
+            << BlockSize << ", "
+            << GPerThread
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -12,6 +12,7 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_grouped_conv_bwd_data_multiple_d.hpp"
 #include "ck/tensor_operation/gpu/device/convolution_backward_data_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_bwd_data_utils.hpp"
 #include "ck/tensor_operation/operator_transform/transform_conv_bwd_data_to_gemm_v1.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_multiple_d_xdl_cshuffle.hpp"
 #include "ck/host_utility/device_prop.hpp"
@@ -187,6 +188,101 @@ __global__ void
 #endif
 }
 
+// Runs all the sub-GEMMs of a strided backward data convolution in one grid. The sub-GEMM of a
+// block is found in the kernel arguments sub_gemm_args_const, which give the range of blocks of
+// each sub-GEMM for all the groups, then the block is handled as in the kernel above.
+template <typename GridwiseGemm,
+          typename ABDataType,
+          typename DsPointer,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          typename SubGemmKernelArg,
+          typename ComputePtrOffsetOfBatch,
+          bool HasMainKBlockLoop>
+__global__ void
+#if CK_USE_LAUNCH_BOUNDS
+    __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+        kernel_grouped_conv_bwd_data_multiple_d_xdl_cshuffle_single_launch(
+            const ABDataType* __restrict__ p_a_grid,
+            const ABDataType* __restrict__ p_b_grid,
+            DsPointer p_ds_grid,
+            EDataType* __restrict__ p_e_grid,
+            const AElementwiseOperation a_element_op,
+            const BElementwiseOperation b_element_op,
+            const CDEElementwiseOperation cde_element_op,
+            const index_t batch_count,
+            const void CK_CONSTANT_ADDRESS_SPACE* sub_gemm_args_const,
+            const index_t num_sub_gemm,
+            const ComputePtrOffsetOfBatch compute_ptr_offset_of_batch)
+{
+#if(!defined(__HIP_DEVICE_COMPILE__) || defined(__gfx908__) || defined(__gfx90a__) || \
+    defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__))
+    const index_t block_id = get_block_1d_id();
+
+    const auto p_sub_gemm_args = reinterpret_cast<const SubGemmKernelArg*>(
+        cast_pointer_to_generic_address_space(sub_gemm_args_const));
+
+    const index_t gemm_idx = __builtin_amdgcn_readfirstlane(
+        FindGroupedGridGemmIndex(p_sub_gemm_args, num_sub_gemm, block_id));
+
+    const auto& sub_gemm_arg = p_sub_gemm_args[gemm_idx];
+
+    // offset base pointer for each work-group
+    const index_t num_blocks_per_batch = __builtin_amdgcn_readfirstlane(
+        (sub_gemm_arg.BlockEnd_ - sub_gemm_arg.BlockStart_) / batch_count);
+    const index_t g_idx = __builtin_amdgcn_readfirstlane((block_id - sub_gemm_arg.BlockStart_) /
+                                                         num_blocks_per_batch);
+
+    const long_index_t a_batch_offset = __builtin_amdgcn_readfirstlane(
+        static_cast<long_index_t>(compute_ptr_offset_of_batch.GetAPtrOffset(g_idx)));
+    const long_index_t b_batch_offset = __builtin_amdgcn_readfirstlane(
+        static_cast<long_index_t>(compute_ptr_offset_of_batch.GetBPtrOffset(g_idx)));
+    const long_index_t e_batch_offset = __builtin_amdgcn_readfirstlane(
+        static_cast<long_index_t>(compute_ptr_offset_of_batch.GetEPtrOffset(g_idx)));
+
+    const auto ds_batch_offset = compute_ptr_offset_of_batch.GetDsPtrOffset(g_idx);
+
+    __shared__ char p_shared[GridwiseGemm::GetSharedMemoryNumberOfByte()];
+
+    DsPointer p_ds_grid_grp;
+
+    static constexpr index_t NumDTensor = DsPointer::Size();
+
+    static_for<0, NumDTensor, 1>{}(
+        [&](auto i) { p_ds_grid_grp(i) = p_ds_grid[i] + ds_batch_offset[i]; });
+
+    GridwiseGemm::template Run<HasMainKBlockLoop>(
+        p_a_grid + a_batch_offset,
+        p_b_grid + b_batch_offset,
+        p_ds_grid_grp,
+        p_e_grid + e_batch_offset,
+        p_shared,
+        a_element_op,
+        b_element_op,
+        cde_element_op,
+        sub_gemm_arg.a_grid_desc_ak0_m_ak1_,
+        sub_gemm_arg.b_grid_desc_bk0_n_bk1_,
+        sub_gemm_arg.ds_grid_desc_mblock_mperblock_nblock_nperblock_,
+        sub_gemm_arg.e_grid_desc_mblock_mperblock_nblock_nperblock_,
+        sub_gemm_arg.block_2_etile_map_);
+#else
+    ignore = p_a_grid;
+    ignore = p_b_grid;
+    ignore = p_ds_grid;
+    ignore = p_e_grid;
+    ignore = a_element_op;
+    ignore = b_element_op;
+    ignore = cde_element_op;
+    ignore = batch_count;
+    ignore = sub_gemm_args_const;
+    ignore = num_sub_gemm;
+    ignore = compute_ptr_offset_of_batch;
+#endif
+}
+
 } // namespace
 
 // Conv backward data multiple D:
@@ -196,6 +292,8 @@ __global__ void
 //   output : input image E: [G, N, C, Hi, Wi]
 //   C = a_op(A) * b_op(B)
 //   E = cde_op(C, D0, D1, ...)
+// A strided convolution is computed as one GEMM per sub-pixel slice of the filter. With a
+// workspace of GetWorkSpaceSize() bytes, they all run in one launch, else in one launch each.
 template <index_t NDimSpatial,
           typename ALayout,   // output image
           typename BLayout,   // weight
@@ -430,6 +528,22 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
     using Block2ETileMap =
         remove_cvref_t<decltype(GridwiseGemm::MakeDefaultBlock2ETileMap(EGridDesc_M_N{}))>;
 
+    // sub-GEMM of the single-launch grid, owning the blocks [BlockStart_, BlockEnd_) for all the
+    // groups
+    struct SubGemmKernelArg
+    {
+        // tensor descriptors for block/thread-wise copy
+        AGridDesc_AK0_M_AK1 a_grid_desc_ak0_m_ak1_;
+        BGridDesc_BK0_N_BK1 b_grid_desc_bk0_n_bk1_;
+        DsGridDesc_MBlock_MPerBlock_NBlock_NPerBlock
+            ds_grid_desc_mblock_mperblock_nblock_nperblock_;
+        EGridDesc_MBlock_MPerBlock_NBlock_NPerBlock e_grid_desc_mblock_mperblock_nblock_nperblock_;
+
+        // block-to-e-tile map
+        OffsettedBlockToCTileMap<Block2ETileMap> block_2_etile_map_;
+        index_t BlockStart_, BlockEnd_;
+    };
+
     // Argument
     struct Argument : public BaseArgument
     {
@@ -460,6 +574,7 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
               p_e_grid_{static_cast<EDataType*>(p_e)},
               num_group_{a_g_n_k_wos_lengths[0]},
               num_gemm_{},
+              grid_size_{0},
               a_element_op_{a_element_op},
               b_element_op_{b_element_op},
               cde_element_op_{cde_element_op},
@@ -492,134 +607,133 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
                 compute_ptr_offset_of_batch_.BatchStrideDs_(i) = ds_g_n_c_wis_strides[i][0];
             });
 
-            // problem definition
-            const index_t Y = b_g_k_c_xs_lengths[3];
-            const index_t X = b_g_k_c_xs_lengths[4];
-
-            const index_t ConvStrideH = conv_filter_strides_[0];
-            const index_t ConvStrideW = conv_filter_strides_[1];
+            // one GEMM per sub-pixel slice with filter taps
+            const auto tilde_slices = GetConvBwdDataTildeSlices<NDimSpatial>(
+                b_g_k_c_xs_lengths, conv_filter_strides, conv_filter_dilations);
 
-            const index_t ConvDilationH = conv_filter_dilations_[0];
-            const index_t ConvDilationW = conv_filter_dilations_[1];
+            num_gemm_ = static_cast<index_t>(tilde_slices.size());
 
-            const auto GcdStrideDilationH = math::gcd(ConvStrideH, ConvDilationH);
-            const auto GcdStrideDilationW = math::gcd(ConvStrideW, ConvDilationW);
-
-            const auto YTilde = ConvStrideH / GcdStrideDilationH;
-            const auto XTilde = ConvStrideW / GcdStrideDilationW;
+            for(const auto& tildes : tilde_slices)
+            {
+                const auto a_grid_desc_ak0_m_ak1 =
+                    transform_conv_to_gemm.template MakeADescriptor_AK0_M_AK1<ALayout>(
+                        a_g_n_k_wos_lengths,
+                        a_g_n_k_wos_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        e_g_n_c_wis_lengths,
+                        e_g_n_c_wis_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        tildes);
 
-            // number of GEMM
-            num_gemm_ = YTilde * XTilde;
+                const auto b_grid_desc_bk0_n_bk1 =
+                    transform_conv_to_gemm.template MakeBDescriptor_BK0_N_BK1<BLayout>(
+                        a_g_n_k_wos_lengths,
+                        a_g_n_k_wos_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        e_g_n_c_wis_lengths,
+                        e_g_n_c_wis_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        tildes);
 
-            for(index_t i_ytilde = 0; i_ytilde < YTilde; ++i_ytilde)
-            {
-                for(index_t i_xtilde = 0; i_xtilde < XTilde; ++i_xtilde)
-                {
-                    // check slice is valid
-                    const auto YDotSlice = math::integer_divide_ceil(Y - i_ytilde, YTilde);
-                    const auto XDotSlice = math::integer_divide_ceil(X - i_xtilde, XTilde);
+                DsGridDesc_M_N ds_grid_desc_m_n;
 
-                    if(YDotSlice * XDotSlice <= 0)
-                    {
-                        continue;
-                    }
+                // populate Ds desc
+                static_for<0, NumDTensor, 1>{}([&](auto i) {
+                    using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
 
-                    const auto a_grid_desc_ak0_m_ak1 =
-                        transform_conv_to_gemm.template MakeADescriptor_AK0_M_AK1<ALayout>(
+                    ds_grid_desc_m_n(i) =
+                        transform_conv_to_gemm.template MakeCDescriptor_M_N<DLayout>(
                             a_g_n_k_wos_lengths,
                             a_g_n_k_wos_strides,
                             b_g_k_c_xs_lengths,
                             b_g_k_c_xs_strides,
-                            e_g_n_c_wis_lengths,
-                            e_g_n_c_wis_strides,
+                            ds_g_n_c_wis_lengths[i],
+                            ds_g_n_c_wis_strides[i],
                             conv_filter_strides,
                             conv_filter_dilations,
                             input_left_pads,
                             input_right_pads,
-                            {i_ytilde, i_xtilde});
+                            tildes);
+                });
 
-                    const auto b_grid_desc_bk0_n_bk1 =
-                        transform_conv_to_gemm.template MakeBDescriptor_BK0_N_BK1<BLayout>(
-                            a_g_n_k_wos_lengths,
-                            a_g_n_k_wos_strides,
-                            b_g_k_c_xs_lengths,
-                            b_g_k_c_xs_strides,
-                            e_g_n_c_wis_lengths,
-                            e_g_n_c_wis_strides,
-                            conv_filter_strides,
-                            conv_filter_dilations,
-                            input_left_pads,
-                            input_right_pads,
-                            {i_ytilde, i_xtilde});
-
-                    DsGridDesc_M_N ds_grid_desc_m_n;
-
-                    // populate Ds desc
-                    static_for<0, NumDTensor, 1>{}([&](auto i) {
-                        using DLayout = remove_cvref_t<tuple_element_t<i.value, DsLayout>>;
-
-                        ds_grid_desc_m_n(i) =
-                            transform_conv_to_gemm.template MakeCDescriptor_M_N<DLayout>(
-                                a_g_n_k_wos_lengths,
-                                a_g_n_k_wos_strides,
-                                b_g_k_c_xs_lengths,
-                                b_g_k_c_xs_strides,
-                                ds_g_n_c_wis_lengths[i],
-                                ds_g_n_c_wis_strides[i],
-                                conv_filter_strides,
-                                conv_filter_dilations,
-                                input_left_pads,
-                                input_right_pads,
-                                {i_ytilde, i_xtilde});
-                    });
-
-                    const auto e_grid_desc_m_n =
-                        transform_conv_to_gemm.template MakeCDescriptor_M_N<ELayout>(
-                            a_g_n_k_wos_lengths,
-                            a_g_n_k_wos_strides,
-                            b_g_k_c_xs_lengths,
-                            b_g_k_c_xs_strides,
-                            e_g_n_c_wis_lengths,
-                            e_g_n_c_wis_strides,
-                            conv_filter_strides,
-                            conv_filter_dilations,
-                            input_left_pads,
-                            input_right_pads,
-                            {i_ytilde, i_xtilde});
-
-                    // desc for problem definition
-                    const auto a_grid_desc_m_k = transform_k0_m_k1_to_m_k(a_grid_desc_ak0_m_ak1);
-                    const auto b_grid_desc_n_k = transform_k0_m_k1_to_m_k(b_grid_desc_bk0_n_bk1);
-
-                    a_grid_desc_m_k_container_.push_back(a_grid_desc_m_k);
-                    b_grid_desc_n_k_container_.push_back(b_grid_desc_n_k);
-                    ds_grid_desc_m_n_container_.push_back(ds_grid_desc_m_n);
-                    e_grid_desc_m_n_container_.push_back(e_grid_desc_m_n);
-
-                    // desc for blockwise copy
-                    a_grid_desc_ak0_m_ak1_container_.push_back(a_grid_desc_ak0_m_ak1);
-                    b_grid_desc_bk0_n_bk1_container_.push_back(b_grid_desc_bk0_n_bk1);
-
-                    // block-to-e-tile-map
-                    auto block_2_etile_map =
-                        GridwiseGemm::MakeDefaultBlock2ETileMap(e_grid_desc_m_n);
-
-                    block_2_etile_map_container_.push_back(block_2_etile_map);
-
-                    if(GridwiseGemm::CheckValidity(a_grid_desc_m_k,
-                                                   b_grid_desc_n_k,
-                                                   ds_grid_desc_m_n,
-                                                   e_grid_desc_m_n,
-                                                   block_2_etile_map))
-                    {
-                        ds_grid_desc_mblock_mperblock_nblock_nperblock_container_.push_back(
-                            GridwiseGemm::MakeDsGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
-                                ds_grid_desc_m_n));
-
-                        e_grid_desc_mblock_mperblock_nblock_nperblock_container_.push_back(
-                            GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
-                                e_grid_desc_m_n));
-                    }
+                const auto e_grid_desc_m_n =
+                    transform_conv_to_gemm.template MakeCDescriptor_M_N<ELayout>(
+                        a_g_n_k_wos_lengths,
+                        a_g_n_k_wos_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        e_g_n_c_wis_lengths,
+                        e_g_n_c_wis_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        tildes);
+
+                // desc for problem definition
+                const auto a_grid_desc_m_k = transform_k0_m_k1_to_m_k(a_grid_desc_ak0_m_ak1);
+                const auto b_grid_desc_n_k = transform_k0_m_k1_to_m_k(b_grid_desc_bk0_n_bk1);
+
+                a_grid_desc_m_k_container_.push_back(a_grid_desc_m_k);
+                b_grid_desc_n_k_container_.push_back(b_grid_desc_n_k);
+                ds_grid_desc_m_n_container_.push_back(ds_grid_desc_m_n);
+                e_grid_desc_m_n_container_.push_back(e_grid_desc_m_n);
+
+                // desc for blockwise copy
+                a_grid_desc_ak0_m_ak1_container_.push_back(a_grid_desc_ak0_m_ak1);
+                b_grid_desc_bk0_n_bk1_container_.push_back(b_grid_desc_bk0_n_bk1);
+
+                // block-to-e-tile-map
+                auto block_2_etile_map = GridwiseGemm::MakeDefaultBlock2ETileMap(e_grid_desc_m_n);
+
+                block_2_etile_map_container_.push_back(block_2_etile_map);
+
+                if(GridwiseGemm::CheckValidity(a_grid_desc_m_k,
+                                               b_grid_desc_n_k,
+                                               ds_grid_desc_m_n,
+                                               e_grid_desc_m_n,
+                                               block_2_etile_map))
+                {
+                    ds_grid_desc_mblock_mperblock_nblock_nperblock_container_.push_back(
+                        GridwiseGemm::MakeDsGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
+                            ds_grid_desc_m_n));
+
+                    e_grid_desc_mblock_mperblock_nblock_nperblock_container_.push_back(
+                        GridwiseGemm::MakeEGridDescriptor_MBlock_MPerBlock_NBlock_NPerBlock(
+                            e_grid_desc_m_n));
+                }
+            }
+
+            // single-launch grid, where the sub-GEMMs take their blocks one after the other
+            if(e_grid_desc_mblock_mperblock_nblock_nperblock_container_.size() ==
+               static_cast<std::size_t>(num_gemm_))
+            {
+                for(index_t i = 0; i < num_gemm_; i++)
+                {
+                    const index_t grid_size_gemm =
+                        block_2_etile_map_container_[i].CalculateGridSize(
+                            e_grid_desc_m_n_container_[i]) *
+                        num_group_;
+
+                    sub_gemm_kernel_args_.push_back(SubGemmKernelArg{
+                        a_grid_desc_ak0_m_ak1_container_[i],
+                        b_grid_desc_bk0_n_bk1_container_[i],
+                        ds_grid_desc_mblock_mperblock_nblock_nperblock_container_[i],
+                        e_grid_desc_mblock_mperblock_nblock_nperblock_container_[i],
+                        OffsettedBlockToCTileMap<Block2ETileMap>(block_2_etile_map_container_[i],
+                                                                 grid_size_),
+                        grid_size_,
+                        grid_size_ + grid_size_gemm});
+
+                    grid_size_ += grid_size_gemm;
                 }
             }
         }
@@ -671,6 +785,10 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
         // block-to-e-tile map
         std::vector<Block2ETileMap> block_2_etile_map_container_;
 
+        // kernel arguments of the single-launch grid, copied to the workspace
+        std::vector<SubGemmKernelArg> sub_gemm_kernel_args_;
+        index_t grid_size_;
+
         // for computing batch offset
         ComputePtrOffsetOfStridedBatch<NumDTensor> compute_ptr_offset_of_batch_;
 
@@ -699,6 +817,84 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
     {
         using Argument = DeviceOp::Argument;
 
+        // all the sub-GEMMs in one launch, which needs them to agree on the main K loop
+        static bool IsSingleLaunchSupported(const Argument& arg)
+        {
+            if(arg.p_workspace_ == nullptr || arg.sub_gemm_kernel_args_.empty())
+            {
+                return false;
+            }
+
+            const bool has_main_k_block_loop = GridwiseGemm::CalculateHasMainKBlockLoop(
+                arg.a_grid_desc_m_k_container_[0].GetLength(I1));
+
+            for(index_t i = 1; i < arg.num_gemm_; i++)
+            {
+                if(GridwiseGemm::CalculateHasMainKBlockLoop(
+                       arg.a_grid_desc_m_k_container_[i].GetLength(I1)) != has_main_k_block_loop)
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        float RunSingleLaunch(const Argument& arg, const StreamConfig& stream_config)
+        {
+            hipGetErrorString(hipMemcpyWithStream(arg.p_workspace_,
+                                                  arg.sub_gemm_kernel_args_.data(),
+                                                  arg.sub_gemm_kernel_args_.size() *
+                                                      sizeof(SubGemmKernelArg),
+                                                  hipMemcpyHostToDevice,
+                                                  stream_config.stream_id_));
+
+            auto launch_kernel = [&](auto has_main_k_block_loop) {
+                constexpr bool has_main_loop = has_main_k_block_loop.value;
+
+                const auto kernel =
+                    kernel_grouped_conv_bwd_data_multiple_d_xdl_cshuffle_single_launch<
+                        GridwiseGemm,
+                        ADataType, // TODO: distiguish A/B datatype
+                        typename GridwiseGemm::DsGridPointer,
+                        EDataType,
+                        AElementwiseOp,
+                        BElementwiseOp,
+                        CDEElementwiseOp,
+                        SubGemmKernelArg,
+                        ComputePtrOffsetOfStridedBatch<NumDTensor>,
+                        has_main_loop>;
+
+                return launch_and_time_kernel(
+                    stream_config,
+                    kernel,
+                    dim3(arg.grid_size_),
+                    dim3(BlockSize),
+                    0,
+                    arg.p_a_grid_,
+                    arg.p_b_grid_,
+                    arg.p_ds_grid_,
+                    arg.p_e_grid_,
+                    arg.a_element_op_,
+                    arg.b_element_op_,
+                    arg.cde_element_op_,
+                    arg.a_g_n_k_wos_lengths_[0], // Group count
+                    cast_pointer_to_constant_address_space(arg.p_workspace_),
+                    arg.num_gemm_,
+                    arg.compute_ptr_offset_of_batch_);
+            };
+
+            if(GridwiseGemm::CalculateHasMainKBlockLoop(
+                   arg.a_grid_desc_m_k_container_[0].GetLength(I1)))
+            {
+                return launch_kernel(integral_constant<bool, true>{});
+            }
+            else
+            {
+                return launch_kernel(integral_constant<bool, false>{});
+            }
+        }
+
         float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
         {
             if(stream_config.log_level_ > 0)
@@ -706,6 +902,12 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
                 arg.Print();
             }
 
+            if(IsSingleLaunchSupported(arg))
+            {
+                return RunSingleLaunch(arg, stream_config);
+            }
+
+            // one launch per sub-GEMM
             float ave_time = 0;
 
             for(index_t i = 0; i < arg.num_gemm_; i++)
@@ -991,6 +1193,14 @@ struct DeviceGroupedConvBwdDataMultipleD_Xdl_CShuffle_v1
         return std::make_unique<Invoker>(Invoker{});
     }
 
+    // kernel arguments of the single-launch grid; without a workspace, the sub-GEMMs are launched
+    // one after the other
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return dynamic_cast<const Argument*>(p_arg)->sub_gemm_kernel_args_.size() *
+               sizeof(SubGemmKernelArg);
+    }
+
     std::string GetTypeString() const override
     {
         auto str = std::stringstream();
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Sub-pixel slices [i_ytilde, i_xtilde, ...] of a backward data convolution. Along a dimension
+// with stride S and dilation D, the input pixels are split into STilde = S / gcd(S, D) phases,
+// the pixels of phase i_tilde only seeing the filter taps i_tilde, i_tilde + STilde, ...
+// Each slice with at least one tap along every dimension is one GEMM; the others are skipped, and
+// the input pixels of their phases, which get no gradient, are not written.
+// The slices are ordered with the last dimension being the fastest.
+template <index_t NDimSpatial>
+std::vector<std::array<index_t, NDimSpatial>>
+GetConvBwdDataTildeSlices(const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                          const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                          const std::array<index_t, NDimSpatial>& conv_filter_dilations)
+{
+    std::array<index_t, NDimSpatial> tilde_lengths;
+
+    index_t num_slice = 1;
+
+    for(index_t i = 0; i < NDimSpatial; ++i)
+    {
+        tilde_lengths[i] =
+            conv_filter_strides[i] / math::gcd(conv_filter_strides[i], conv_filter_dilations[i]);
+
+        num_slice *= tilde_lengths[i];
+    }
+
+    std::vector<std::array<index_t, NDimSpatial>> slices;
+
+    for(index_t s = 0; s < num_slice; ++s)
+    {
+        std::array<index_t, NDimSpatial> tildes;
+
+        index_t tmp   = s;
+        bool is_valid = true;
+
+        for(index_t i = NDimSpatial - 1; i >= 0; --i)
+        {
+            tildes[i] = tmp % tilde_lengths[i];
+            tmp /= tilde_lengths[i];
+
+            is_valid = is_valid && tildes[i] < b_g_k_c_xs_lengths[3 + i];
+        }
+
+        if(is_valid)
+        {
+            slices.push_back(tildes);
+        }
+    }
+
+    return slices;
+}
+
+// Index of the GEMM of a grid shared by num_gemm GEMMs that owns block_id, the GEMM i owning the
+// blocks [p_gemm_args[i].BlockStart_, p_gemm_args[i].BlockEnd_), which follow each other from 0
+template <typename GemmArg>
+__host__ __device__ index_t FindGroupedGridGemmIndex(const GemmArg* p_gemm_args,
+                                                     index_t num_gemm,
+                                                     index_t block_id)
+{
+    index_t left  = 0;
+    index_t right = num_gemm - 1;
+
+    while(left < right)
+    {
+        const index_t mid = (left + right) / 2;
+
+        if(block_id < p_gemm_args[mid].BlockEnd_)
+        {
+            right = mid;
+        }
+        else
+        {
+            left = mid + 1;
+        }
+    }
+
+    return left;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
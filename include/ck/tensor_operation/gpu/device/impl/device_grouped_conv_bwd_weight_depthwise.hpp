@@ -0,0 +1,354 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_bwd_weight.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_depthwise_conv_utils.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_depthwise_conv.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+//
+// @brief      Device backward weight depthwise convolution, i.e. grouped convolution with C = 1
+//             per group and K (the channel multiplier) outputs per group.
+//
+// Supports:
+//  @li         2D convolution with any filter size, strides, dilations and pads
+//  @li         Packed GNHWC/GKYXC/GNHWK and NHWGC/GKYXC/NHWGK layouts. GPerThread > 1 needs the
+//              groups to be contiguous, i.e. NHWGC/NHWGK with K = 1, and G to be a multiple of
+//              GPerThread
+//
+// Every workgroup reduces N * Ho * Wo for GPerBlock groups of one filter element, so the filter
+// gradient is written once, without atomics and independently of the order of the launch. Only
+// split_k = 1 is supported, which is also the split picked for split_k <= 0.
+//
+template <index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename AccDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation,
+          index_t BlockSize,
+          index_t GPerBlock,
+          index_t GPerThread>
+struct DeviceGroupedConvBwdWeight_Depthwise
+    : public DeviceGroupedConvBwdWeight<NDimSpatial,
+                                        InLayout,
+                                        WeiLayout,
+                                        OutLayout,
+                                        InDataType,
+                                        WeiDataType,
+                                        OutDataType,
+                                        InElementwiseOperation,
+                                        WeiElementwiseOperation,
+                                        OutElementwiseOperation>
+{
+    using DeviceOp = DeviceGroupedConvBwdWeight_Depthwise;
+
+    static_assert(NDimSpatial == 2, "the depthwise convolution is only implemented for 2D");
+
+    using GridwiseConv = GridwiseDepthwiseConv_2d<InDataType,
+                                                  WeiDataType,
+                                                  AccDataType,
+                                                  Tuple<>,
+                                                  OutDataType,
+                                                  BlockSize,
+                                                  GPerBlock,
+                                                  GPerThread>;
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const InDataType* p_in_grid,
+                 WeiDataType* p_wei_grid,
+                 const OutDataType* p_out_grid,
+                 ck::index_t G,
+                 ck::index_t N,
+                 ck::index_t K,
+                 ck::index_t C,
+                 std::array<ck::index_t, NDimSpatial> input_spatial_lengths,
+                 std::array<ck::index_t, NDimSpatial> filter_spatial_lengths,
+                 std::array<ck::index_t, NDimSpatial> output_spatial_lengths,
+                 std::array<ck::index_t, NDimSpatial> conv_filter_strides,
+                 std::array<ck::index_t, NDimSpatial> conv_filter_dilations,
+                 std::array<ck::index_t, NDimSpatial> input_left_pads,
+                 std::array<ck::index_t, NDimSpatial> input_right_pads,
+                 InElementwiseOperation in_element_op,
+                 WeiElementwiseOperation wei_element_op,
+                 OutElementwiseOperation out_element_op,
+                 ck::index_t split_k)
+            : p_in_grid_{p_in_grid},
+              p_wei_grid_{p_wei_grid},
+              p_out_grid_{p_out_grid},
+              in_element_op_{in_element_op},
+              wei_element_op_{wei_element_op},
+              out_element_op_{out_element_op},
+              Conv_C_{C},
+              k_batch_{split_k > 0 ? split_k : 1}
+        {
+            problem_.G_             = G;
+            problem_.N_             = N;
+            problem_.K_             = K;
+            problem_.Hi_            = input_spatial_lengths[0];
+            problem_.Wi_            = input_spatial_lengths[1];
+            problem_.Y_             = filter_spatial_lengths[0];
+            problem_.X_             = filter_spatial_lengths[1];
+            problem_.Ho_            = output_spatial_lengths[0];
+            problem_.Wo_            = output_spatial_lengths[1];
+            problem_.ConvStrideH_   = conv_filter_strides[0];
+            problem_.ConvStrideW_   = conv_filter_strides[1];
+            problem_.ConvDilationH_ = conv_filter_dilations[0];
+            problem_.ConvDilationW_ = conv_filter_dilations[1];
+            problem_.LeftPadH_      = input_left_pads[0];
+            problem_.LeftPadW_      = input_left_pads[1];
+
+            ignore = input_right_pads;
+
+            in_g_n_c_wis_lengths_ = {G, N, C, problem_.Hi_, problem_.Wi_};
+            out_g_n_k_wos_lengths_ = {G, N, K, problem_.Ho_, problem_.Wo_};
+
+            in_g_n_c_wis_strides_ =
+                MakeDepthwiseConvImageStrides<InLayout>(G, N, C, problem_.Hi_, problem_.Wi_);
+            out_g_n_k_wos_strides_ =
+                MakeDepthwiseConvImageStrides<OutLayout>(G, N, K, problem_.Ho_, problem_.Wo_);
+
+            const auto wei_g_k_c_xs_strides =
+                MakeDepthwiseConvFilterStrides<WeiLayout>(K, C, problem_.Y_, problem_.X_);
+
+            for(index_t i = 0; i < NDimSpatial + 3; ++i)
+            {
+                in_strides_(i)  = in_g_n_c_wis_strides_[i];
+                wei_strides_(i) = wei_g_k_c_xs_strides[i];
+                out_strides_(i) = out_g_n_k_wos_strides_[i];
+            }
+        }
+
+        index_t GetGridSize() const
+        {
+            return math::integer_divide_ceil(problem_.G_, GPerBlock) * problem_.K_ * problem_.Y_ *
+                   problem_.X_;
+        }
+
+        void Print() const
+        {
+            std::cout << "G " << problem_.G_ << ", N " << problem_.N_ << ", K " << problem_.K_
+                      << ", Hi " << problem_.Hi_ << ", Wi " << problem_.Wi_ << ", Y " << problem_.Y_
+                      << ", X " << problem_.X_ << ", Ho " << problem_.Ho_ << ", Wo "
+                      << problem_.Wo_ << std::endl;
+        }
+
+        //  private:
+        // pointers
+        const InDataType* p_in_grid_;
+        WeiDataType* p_wei_grid_;
+        const OutDataType* p_out_grid_;
+
+        DepthwiseConvProblem_2d problem_;
+
+        Array<index_t, NDimSpatial + 3> in_strides_;
+        Array<index_t, NDimSpatial + 3> wei_strides_;
+        Array<index_t, NDimSpatial + 3> out_strides_;
+
+        // element-wise op
+        InElementwiseOperation in_element_op_;
+        WeiElementwiseOperation wei_element_op_;
+        OutElementwiseOperation out_element_op_;
+
+        // for checking IsSupportedArgument()
+        index_t Conv_C_;
+        index_t k_batch_;
+        std::array<index_t, NDimSpatial + 3> in_g_n_c_wis_lengths_;
+        std::array<index_t, NDimSpatial + 3> in_g_n_c_wis_strides_;
+        std::array<index_t, NDimSpatial + 3> out_g_n_k_wos_lengths_;
+        std::array<index_t, NDimSpatial + 3> out_g_n_k_wos_strides_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        using Argument = DeviceOp::Argument;
+
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(stream_config.log_level_ > 0)
+            {
+                arg.Print();
+            }
+
+            const auto kernel = kernel_depthwise_conv_bwd_weight<GridwiseConv,
+                                                                 InDataType,
+                                                                 WeiDataType,
+                                                                 OutDataType,
+                                                                 InElementwiseOperation,
+                                                                 WeiElementwiseOperation,
+                                                                 OutElementwiseOperation>;
+
+            return launch_and_time_kernel(stream_config,
+                                          kernel,
+                                          dim3(arg.GetGridSize()),
+                                          dim3(BlockSize),
+                                          0,
+                                          arg.p_in_grid_,
+                                          arg.p_wei_grid_,
+                                          arg.p_out_grid_,
+                                          arg.problem_,
+                                          arg.in_strides_,
+                                          arg.wei_strides_,
+                                          arg.out_strides_,
+                                          arg.in_element_op_,
+                                          arg.wei_element_op_,
+                                          arg.out_element_op_);
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        // depthwise: one input channel per group
+        if(!(arg.Conv_C_ == 1 && arg.k_batch_ == 1))
+        {
+            return false;
+        }
+
+        if(!(IsDepthwiseConvImageAccessSupported<NDimSpatial, GPerThread>(
+                 arg.in_g_n_c_wis_lengths_, arg.in_g_n_c_wis_strides_) &&
+             IsDepthwiseConvImageAccessSupported<NDimSpatial, GPerThread>(
+                 arg.out_g_n_k_wos_lengths_, arg.out_g_n_k_wos_strides_)))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    static auto MakeArgument(const InDataType* p_in_grid,
+                             WeiDataType* p_wei_grid,
+                             const OutDataType* p_out_grid,
+                             ck::index_t G,
+                             ck::index_t N,
+                             ck::index_t K,
+                             ck::index_t C,
+                             std::array<ck::index_t, NDimSpatial> input_spatial_lengths,
+                             std::array<ck::index_t, NDimSpatial> filter_spatial_lengths,
+                             std::array<ck::index_t, NDimSpatial> output_spatial_lengths,
+                             std::array<ck::index_t, NDimSpatial> conv_filter_strides,
+                             std::array<ck::index_t, NDimSpatial> conv_filter_dilations,
+                             std::array<ck::index_t, NDimSpatial> input_left_pads,
+                             std::array<ck::index_t, NDimSpatial> input_right_pads,
+                             InElementwiseOperation in_element_op,
+                             WeiElementwiseOperation wei_element_op,
+                             OutElementwiseOperation out_element_op,
+                             ck::index_t split_k)
+    {
+        return Argument{p_in_grid,
+                        p_wei_grid,
+                        p_out_grid,
+                        G,
+                        N,
+                        K,
+                        C,
+                        input_spatial_lengths,
+                        filter_spatial_lengths,
+                        output_spatial_lengths,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        in_element_op,
+                        wei_element_op,
+                        out_element_op,
+                        split_k};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(const void* p_in_grid,
+                        void* p_wei_grid,
+                        const void* p_out_grid,
+                        ck::index_t G,
+                        ck::index_t N,
+                        ck::index_t K,
+                        ck::index_t C,
+                        std::array<ck::index_t, NDimSpatial> input_spatial_lengths,
+                        std::array<ck::index_t, NDimSpatial> filter_spatial_lengths,
+                        std::array<ck::index_t, NDimSpatial> output_spatial_lengths,
+                        std::array<ck::index_t, NDimSpatial> conv_filter_strides,
+                        std::array<ck::index_t, NDimSpatial> conv_filter_dilations,
+                        std::array<ck::index_t, NDimSpatial> input_left_pads,
+                        std::array<ck::index_t, NDimSpatial> input_right_pads,
+                        InElementwiseOperation in_element_op,
+                        WeiElementwiseOperation wei_element_op,
+                        OutElementwiseOperation out_element_op,
+                        ck::index_t split_k) override
+    {
+        return std::make_unique<Argument>(static_cast<const InDataType*>(p_in_grid),
+                                          static_cast<WeiDataType*>(p_wei_grid),
+                                          static_cast<const OutDataType*>(p_out_grid),
+                                          G,
+                                          N,
+                                          K,
+                                          C,
+                                          input_spatial_lengths,
+                                          filter_spatial_lengths,
+                                          output_spatial_lengths,
+                                          conv_filter_strides,
+                                          conv_filter_dilations,
+                                          input_left_pads,
+                                          input_right_pads,
+                                          in_element_op,
+                                          wei_element_op,
+                                          out_element_op,
+                                          split_k);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGroupedConvBwdWeight_Depthwise"
+            << "<"
+            << BlockSize << ", "
+            << GPerBlock << ", "
+            << GPerThread
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -821,7 +821,7 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Dl
               conv_filter_dilations_{conv_filter_dilations},
               input_left_pads_{input_left_pads},
               input_right_pads_{input_right_pads},
-              k_batch_{split_k}
+              k_batch_{split_k > 0 ? split_k : 1}
         {
             const auto descs =
                 DeviceOp::MakeABCGridDescriptor_A_K0_M_K1_B_K0_N_K1_C_M_N<NDimSpatial>(
@@ -1034,6 +1034,13 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Dl
             return false;
         }
 
+        // the splits of GEMM K would overwrite each other, the C matrix being stored without
+        // atomics
+        if(arg.k_batch_ != 1)
+        {
+            return false;
+        }
+
         if constexpr(ConvBackwardWeightSpecialization ==
                      ConvolutionBackwardWeightSpecialization::Filter1x1Stride1Pad0)
         {
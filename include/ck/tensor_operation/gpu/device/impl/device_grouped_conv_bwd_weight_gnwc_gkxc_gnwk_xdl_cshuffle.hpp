@@ -13,7 +13,10 @@
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_grouped_conv_bwd_weight.hpp"
 #include "ck/tensor_operation/gpu/device/convolution_backward_weight_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_bwd_weight_utils.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdlops_bwd_weight.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_reduce_split_k.hpp"
 #include "ck/host_utility/device_prop.hpp"
 #include "ck/host_utility/kernel_launch.hpp"
 
@@ -40,9 +43,16 @@ struct ComputePtrOffsetOfStridedBatch
         return g_idx * static_cast<long_index_t>(BatchStrideC_);
     }
 
+    // 0 when the splits of GEMM K are accumulated in place
+    __host__ __device__ constexpr long_index_t GetCKBatchPtrOffset(index_t k_batch_idx) const
+    {
+        return k_batch_idx * KBatchStrideC_;
+    }
+
     index_t BatchStrideA_;
     index_t BatchStrideB_;
     index_t BatchStrideC_;
+    long_index_t KBatchStrideC_ = 0;
 };
 
 } // namespace
@@ -88,8 +98,12 @@ __global__ void
         static_cast<long_index_t>(compute_ptr_offset_of_batch.GetAPtrOffset(g_idx)));
     const long_index_t b_batch_offset = __builtin_amdgcn_readfirstlane(
         static_cast<long_index_t>(compute_ptr_offset_of_batch.GetBPtrOffset(g_idx)));
+    const index_t k_batch_idx = __builtin_amdgcn_readfirstlane(
+        block_2_ctile_map.CalculateBottomIndex(make_multi_index(get_block_1d_id()))[Number<0>{}]);
+
     const long_index_t c_batch_offset = __builtin_amdgcn_readfirstlane(
-        static_cast<long_index_t>(compute_ptr_offset_of_batch.GetCPtrOffset(g_idx)));
+        static_cast<long_index_t>(compute_ptr_offset_of_batch.GetCPtrOffset(g_idx) +
+                                  compute_ptr_offset_of_batch.GetCKBatchPtrOffset(k_batch_idx)));
 
     __shared__ FloatAB p_shared[GridwiseGemm::GetSharedMemoryNumberOfByte() / sizeof(FloatAB)];
 
@@ -121,6 +135,7 @@ __global__ void
     compute_ptr_offset_of_batch.GetAPtrOffset(0);
     compute_ptr_offset_of_batch.GetBPtrOffset(0);
     compute_ptr_offset_of_batch.GetCPtrOffset(0);
+    compute_ptr_offset_of_batch.GetCKBatchPtrOffset(0);
 #endif // end of if (defined(__gfx908__) || defined(__gfx90a__))
 }
 
@@ -802,18 +817,21 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
     using BGridDesc_K0_N_K1 = remove_cvref_t<decltype(ABCGridDescs{}[I1])>;
     using CGridDesc_M_N     = remove_cvref_t<decltype(ABCGridDescs{}[I2])>;
 
-    using GridwiseGemm = GridwiseGemm_bk0mk1_bk0nk1_mn_xdlops_bwd_weight<
+    template <typename FloatC,
+              InMemoryDataOperationEnum CGlobalMemoryDataOperation,
+              typename CElementwiseOp>
+    using GridwiseGemmBase = GridwiseGemm_bk0mk1_bk0nk1_mn_xdlops_bwd_weight<
         BlockSize,
         ADataType, // TODO: distinguish A/B datatype
         AccDataType,
-        CDataType,
-        InMemoryDataOperationEnum::AtomicAdd,
+        FloatC,
+        CGlobalMemoryDataOperation,
         AGridDesc_K0_M_K1,
         BGridDesc_K0_N_K1,
         CGridDesc_M_N,
         AElementwiseOperation,
         BElementwiseOperation,
-        CElementwiseOperation,
+        CElementwiseOp,
         MPerBlock,
         NPerBlock,
         K0PerBlock,
@@ -851,6 +869,40 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
         true,
         true>;
 
+    // accumulates the splits of GEMM K in the weight with atomics
+    using GridwiseGemm =
+        GridwiseGemmBase<CDataType, InMemoryDataOperationEnum::AtomicAdd, CElementwiseOperation>;
+
+    // writes the split k_batch_idx of GEMM K to the slice k_batch_idx of the workspace, the
+    // weight element op being applied by GridwiseReduce to their sum
+    using GridwiseGemmWorkspace = GridwiseGemmBase<AccDataType,
+                                                   InMemoryDataOperationEnum::Set,
+                                                   ck::tensor_operation::element_wise::PassThrough>;
+
+    using GridwiseReduce =
+        GridwiseReduceSplitK<AccDataType, CDataType, CElementwiseOperation, BlockSize>;
+
+    // split of GEMM K = N * Wo... when the caller leaves it to the op
+    static index_t GetSplitK(index_t G,
+                             index_t N,
+                             index_t K,
+                             index_t C,
+                             const std::array<index_t, NDimSpatial>& filter_spatial_lengths,
+                             const std::array<index_t, NDimSpatial>& output_spatial_lengths)
+    {
+        const index_t gemm_k = N * std::accumulate(begin(output_spatial_lengths),
+                                                   end(output_spatial_lengths),
+                                                   index_t{1},
+                                                   std::multiplies<>{});
+        const index_t gemm_n = C * std::accumulate(begin(filter_spatial_lengths),
+                                                   end(filter_spatial_lengths),
+                                                   index_t{1},
+                                                   std::multiplies<>{});
+
+        return ConvBwdWeightSplitKHeuristic::GetSplitK(
+            G, K, gemm_n, gemm_k, MPerBlock, NPerBlock, K0PerBlock * K1, get_device_cu_count());
+    }
+
     // Argument
     using CGridDesc_MBlock_MPerBlock_NBlock_NPerBlock =
         decltype(GridwiseGemm::MakeCGridDesc_MBlock_MPerBlock_NBlock_NPerBlock(CGridDesc_M_N{}));
@@ -903,7 +955,10 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
               conv_filter_strides_{conv_filter_strides},
               input_left_pads_{input_left_pads},
               input_right_pads_{input_right_pads},
-              k_batch_{split_k}
+              k_batch_{split_k > 0
+                           ? split_k
+                           : GetSplitK(G, N, K, C, filter_spatial_lengths, output_spatial_lengths)},
+              deterministic_{false}
         {
             const auto descs =
                 DeviceOp::MakeABCGridDescriptor_A_K0_M_K1_B_K0_N_K1_C_M_N<NDimSpatial>(
@@ -987,6 +1042,9 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
         std::array<ck::index_t, NDimSpatial> input_left_pads_;
         std::array<ck::index_t, NDimSpatial> input_right_pads_;
         index_t k_batch_;
+
+        // sums the splits of GEMM K through the workspace rather than with atomics
+        bool deterministic_;
     };
 
     // Invoker
@@ -1012,7 +1070,12 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
                       << arg.c_grid_desc_m_n_.GetLength(I1) << "}" << std::endl;
         }
 
-        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        template <typename GridwiseGemmType, typename FloatC, typename CElementwiseOp>
+        float RunGemm(const Argument& arg,
+                      FloatC* p_c_grid,
+                      const CElementwiseOp& c_element_op,
+                      const ComputePtrOffsetOfStridedBatch& compute_ptr_offset_of_batch,
+                      const StreamConfig& stream_config)
         {
             if(!GridwiseGemm::CheckValidity(arg.a_grid_desc_kbatch_k0_m_k1_,
                                             arg.b_grid_desc_kbatch_k0_n_k1_,
@@ -1034,12 +1097,12 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
                 constexpr bool has_main_loop = has_main_k_block_loop.value;
 
                 const auto kernel = kernel_batched_gemm_xdlops_bwd_weight<
-                    GridwiseGemm,
+                    GridwiseGemmType,
                     ADataType, // TODO: distiguish A/B datatype
-                    CDataType,
+                    FloatC,
                     OutElementwiseOperation,
                     InElementwiseOperation,
-                    WeiElementwiseOperation,
+                    CElementwiseOp,
                     remove_reference_t<DeviceOp::AGridDesc_K0_M_K1>,
                     remove_reference_t<DeviceOp::BGridDesc_K0_N_K1>,
                     remove_reference_t<DeviceOp::CGridDesc_MBlock_MPerBlock_NBlock_NPerBlock>,
@@ -1054,16 +1117,16 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
                                               0,
                                               arg.p_a_grid_,
                                               arg.p_b_grid_,
-                                              arg.p_c_grid_,
+                                              p_c_grid,
                                               arg.a_element_op_,
                                               arg.b_element_op_,
-                                              arg.c_element_op_,
+                                              c_element_op,
                                               arg.Conv_G_,
                                               arg.a_grid_desc_kbatch_k0_m_k1_,
                                               arg.b_grid_desc_kbatch_k0_n_k1_,
                                               arg.c_grid_desc_mblock_mperblock_nblock_nperblock_,
                                               arg.block_2_ctile_map_,
-                                              arg.compute_ptr_offset_of_batch_);
+                                              compute_ptr_offset_of_batch);
             };
 
             if(has_main_k0_block_loop)
@@ -1076,6 +1139,59 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
             }
         }
 
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(!arg.deterministic_ || arg.k_batch_ == 1)
+            {
+                return RunGemm<GridwiseGemm>(arg,
+                                             arg.p_c_grid_,
+                                             arg.c_element_op_,
+                                             arg.compute_ptr_offset_of_batch_,
+                                             stream_config);
+            }
+
+            if(arg.p_workspace_ == nullptr)
+            {
+                throw std::runtime_error("wrong! workspace is not set");
+            }
+
+            // the splits of GEMM K to the workspace [k_batch, G, K, X..., C], then their sum
+            auto compute_ptr_offset_of_batch = arg.compute_ptr_offset_of_batch_;
+
+            const long_index_t num_element =
+                static_cast<long_index_t>(arg.Conv_G_) * compute_ptr_offset_of_batch.BatchStrideC_;
+
+            compute_ptr_offset_of_batch.KBatchStrideC_ = num_element;
+
+            AccDataType* p_workspace = static_cast<AccDataType*>(arg.p_workspace_);
+
+            float ave_time =
+                RunGemm<GridwiseGemmWorkspace>(arg,
+                                               p_workspace,
+                                               ck::tensor_operation::element_wise::PassThrough{},
+                                               compute_ptr_offset_of_batch,
+                                               stream_config);
+
+            const auto kernel = kernel_reduce_split_k<GridwiseReduce,
+                                                      AccDataType,
+                                                      CDataType,
+                                                      WeiElementwiseOperation>;
+
+            ave_time += launch_and_time_kernel(
+                stream_config,
+                kernel,
+                dim3(math::integer_divide_ceil(num_element, static_cast<long_index_t>(BlockSize))),
+                dim3(BlockSize),
+                0,
+                p_workspace,
+                arg.p_c_grid_,
+                num_element,
+                arg.k_batch_,
+                arg.c_element_op_);
+
+            return ave_time;
+        }
+
         float Run(const BaseArgument* p_arg,
                   const StreamConfig& stream_config = StreamConfig{}) override
         {
@@ -1131,6 +1247,24 @@ struct DeviceGroupedConvBwdWeightGnwcGkxcGnwk_Xdl_CShuffle
         return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
     }
 
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        const Argument& arg = *dynamic_cast<const Argument*>(p_arg);
+
+        if(!arg.deterministic_ || arg.k_batch_ == 1)
+        {
+            return 0;
+        }
+
+        return sizeof(AccDataType) * arg.k_batch_ * arg.Conv_G_ *
+               static_cast<std::size_t>(arg.compute_ptr_offset_of_batch_.BatchStrideC_);
+    }
+
+    void SetDeterministic(BaseArgument* p_arg, bool deterministic) const override
+    {
+        dynamic_cast<Argument*>(p_arg)->deterministic_ = deterministic;
+    }
+
     static auto MakeArgument(const InDataType* p_in_grid,
                              WeiDataType* p_wei_grid,
                              const OutDataType* p_out_grid,
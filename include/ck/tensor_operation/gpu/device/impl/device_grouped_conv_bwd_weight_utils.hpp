@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Split of GEMM K = N * Ho * Wo of a backward weight convolution, whose output, the
+// [G, K, C * Y * X] weight, often has too few tiles to fill the device while GEMM K is large.
+// The split gives at least BlockPerCU blocks per CU, but keeps MinKBlockPerSplit blocks of
+// GEMM K per split and at most MaxSplitK splits, since each split adds a pass over the weight.
+// Returns 1 when the weight alone fills the device.
+struct ConvBwdWeightSplitKHeuristic
+{
+    static constexpr index_t BlockPerCU        = 2;
+    static constexpr index_t MinKBlockPerSplit = 4;
+    static constexpr index_t MaxSplitK         = 32;
+
+    static index_t GetSplitK(index_t G,
+                             index_t gemm_m,
+                             index_t gemm_n,
+                             index_t gemm_k,
+                             index_t m_per_block,
+                             index_t n_per_block,
+                             index_t k_per_block,
+                             index_t num_cu)
+    {
+        const long_index_t num_tile = static_cast<long_index_t>(G) *
+                                      math::integer_divide_ceil(gemm_m, m_per_block) *
+                                      math::integer_divide_ceil(gemm_n, n_per_block);
+
+        const long_index_t num_block = static_cast<long_index_t>(math::max(num_cu, 1)) * BlockPerCU;
+
+        if(num_tile >= num_block)
+        {
+            return 1;
+        }
+
+        const index_t num_k_block = math::integer_divide_ceil(gemm_k, k_per_block);
+
+        const index_t max_split_k = math::min(num_k_block / MinKBlockPerSplit, MaxSplitK);
+
+        const index_t split_k = static_cast<index_t>((num_block + num_tile - 1) / num_tile);
+
+        return math::max(math::min(split_k, max_split_k), 1);
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
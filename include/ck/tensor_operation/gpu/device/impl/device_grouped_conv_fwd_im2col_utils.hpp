@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <limits>
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Split of the GemmM = N * Ho * Wo rows of an explicit GEMM convolution into chunks, whose im2col
+// matrices [G, MPerChunk, GemmK] are materialized one after the other in the same workspace.
+// Every chunk but the last one has MPerChunk_ rows.
+struct ConvFwdIm2ColChunkPlan
+{
+    index_t G_;
+    index_t GemmM_;
+    index_t GemmK_;
+    index_t MPerChunk_;
+    index_t NumChunk_;
+
+    index_t GetChunkBegin(index_t chunk) const { return chunk * MPerChunk_; }
+
+    index_t GetChunkSize(index_t chunk) const
+    {
+        return math::min(MPerChunk_, GemmM_ - GetChunkBegin(chunk));
+    }
+
+    // elements of the im2col matrix of a full chunk
+    std::size_t GetChunkElementSize() const
+    {
+        return static_cast<std::size_t>(G_) * MPerChunk_ * GemmK_;
+    }
+};
+
+// Chunks of a multiple of m_per_chunk_align rows whose im2col matrices fit in workspace_budget
+// bytes, or of m_per_chunk_align rows if the budget is smaller than that. The rows are spread as
+// evenly as possible over the chunks, so that the last one is not much smaller than the others.
+inline ConvFwdIm2ColChunkPlan MakeConvFwdIm2ColChunkPlan(index_t G,
+                                                         index_t gemm_m,
+                                                         index_t gemm_k,
+                                                         std::size_t element_size,
+                                                         std::size_t workspace_budget,
+                                                         index_t m_per_chunk_align)
+{
+    const std::size_t row_element_size = static_cast<std::size_t>(G) * gemm_k;
+
+    // rows that fit in the budget, with index_t offsets in the im2col matrix
+    const std::size_t max_num_row =
+        std::min(workspace_budget / (row_element_size * element_size),
+                 static_cast<std::size_t>(std::numeric_limits<index_t>::max()) / row_element_size);
+
+    ConvFwdIm2ColChunkPlan plan{G, gemm_m, gemm_k, gemm_m, 1};
+
+    if(max_num_row >= static_cast<std::size_t>(gemm_m))
+    {
+        return plan;
+    }
+
+    const index_t m_per_chunk = math::max(
+        static_cast<index_t>(max_num_row / m_per_chunk_align) * m_per_chunk_align,
+        m_per_chunk_align);
+
+    const index_t num_chunk = math::integer_divide_ceil(gemm_m, m_per_chunk);
+
+    plan.MPerChunk_ = math::integer_least_multiple(
+        math::integer_divide_ceil(gemm_m, num_chunk), m_per_chunk_align);
+    plan.NumChunk_ = math::integer_divide_ceil(gemm_m, plan.MPerChunk_);
+
+    return plan;
+}
+
+// Stride of the dimensions dims of a tensor, ordered from the slowest to the fastest, once merged
+// into one dimension, or -1 if their strides do not allow it. Dimensions of length 1 are skipped,
+// and if they all are, the stride of the fastest one is returned.
+template <std::size_t NDim, std::size_t NMergedDim>
+index_t GetMergedDimensionStride(const std::array<index_t, NDim>& lengths,
+                                 const std::array<index_t, NDim>& strides,
+                                 const std::array<index_t, NMergedDim>& dims)
+{
+    index_t stride      = -1;
+    index_t next_stride = 0;
+
+    for(std::size_t i = NMergedDim; i > 0; --i)
+    {
+        const index_t dim = dims[i - 1];
+
+        if(lengths[dim] == 1)
+        {
+            continue;
+        }
+
+        if(stride < 0)
+        {
+            stride = strides[dim];
+        }
+        else if(strides[dim] != next_stride)
+        {
+            return -1;
+        }
+
+        next_stride = strides[dim] * lengths[dim];
+    }
+
+    return stride < 0 ? strides[dims[NMergedDim - 1]] : stride;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
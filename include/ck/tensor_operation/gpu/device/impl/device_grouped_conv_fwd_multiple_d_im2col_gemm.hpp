@@ -0,0 +1,563 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <type_traits>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_batched_gemm_multi_d.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_fwd_im2col_utils.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_conv_fwd_im2col.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+//
+// @brief      Device grouped convolution forward as an explicit GEMM on the im2col matrix.
+//
+// Supports:
+//  @li         Any filter, stride, dilation and padding
+//  @li         Any input layout; weight and output layouts in which (X..., C) and (N, Ho, Wo...)
+//              can be merged, e.g. GKYXC and NHWGK
+//
+// The GemmM = N * Ho * Wo rows are split into chunks (see MakeConvFwdIm2ColChunkPlan()) and, for
+// every chunk,
+//  1) its im2col matrix [G, MPerChunk, Z * Y * X * C] is unfolded into the workspace,
+//  2) E = cde_op(im2col * weightT, Ds) is computed by DeviceGemm, with one batch per group.
+// The workspace (see GetWorkSpaceSize()) holds one chunk, its size is bounded by the workspace
+// budget of the operation unless a single chunk of MPerChunkAlign rows does not fit in it. An
+// argument is only supported once its workspace is set (see SetWorkSpacePointer()).
+//
+// This is a fallback for the convolutions that no implicit GEMM instance supports or runs well:
+// it reads and writes the im2col matrix on top of the GEMM, but any convolution runs at the speed
+// of DeviceGemm on the [GemmM, K, GemmK] GEMM.
+//
+template <index_t NDimSpatial,
+          typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          typename DeviceGemm,
+          index_t Im2ColBlockSize,
+          index_t Im2ColCPerThread,
+          index_t MPerChunkAlign>
+struct DeviceGroupedConvFwdMultipleD_Im2Col_Gemm
+    : public DeviceGroupedConvFwdMultipleD<NDimSpatial,
+                                           ALayout,
+                                           BLayout,
+                                           DsLayout,
+                                           ELayout,
+                                           ADataType,
+                                           BDataType,
+                                           DsDataType,
+                                           EDataType,
+                                           AElementwiseOperation,
+                                           BElementwiseOperation,
+                                           CDEElementwiseOperation>
+{
+    using DeviceOp = DeviceGroupedConvFwdMultipleD_Im2Col_Gemm;
+
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    static constexpr std::size_t DefaultWorkSpaceBudget = 64 * 1024 * 1024;
+
+    using PassThrough = element_wise::PassThrough;
+
+    static constexpr auto MakeDsGemmLayout()
+    {
+        return generate_tuple([&](auto) { return tensor_layout::gemm::RowMajor{}; },
+                              Number<NumDTensor>{});
+    }
+
+    // [GemmM, GemmK] im2col matrix times the [K, GemmK] weight, i.e. a column-major [GemmK, K]
+    // matrix, the A element-wise op being applied by the im2col kernel
+    using DeviceGemmBase = DeviceBatchedGemmMultiD<tensor_layout::gemm::RowMajor,
+                                                   tensor_layout::gemm::ColumnMajor,
+                                                   decltype(MakeDsGemmLayout()),
+                                                   tensor_layout::gemm::RowMajor,
+                                                   ADataType,
+                                                   BDataType,
+                                                   DsDataType,
+                                                   EDataType,
+                                                   PassThrough,
+                                                   BElementwiseOperation,
+                                                   CDEElementwiseOperation>;
+
+    static_assert(std::is_base_of<DeviceGemmBase, DeviceGemm>::value,
+                  "wrong! DeviceGemm must be a DeviceBatchedGemmMultiD on the im2col matrix");
+
+    using GridwiseIm2Col = GridwiseConvFwdIm2Col<NDimSpatial,
+                                                 ADataType,
+                                                 AElementwiseOperation,
+                                                 Im2ColBlockSize,
+                                                 Im2ColCPerThread>;
+
+    // dimensions merged into GemmM and into the GemmK of the weight, in [G, N, C, spatial] and
+    // [G, K, C, spatial] order
+    static constexpr auto MakeGemmMDims()
+    {
+        std::array<index_t, NDimSpatial + 1> dims{1};
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            dims[i + 1] = i + 3;
+        }
+
+        return dims;
+    }
+
+    static constexpr auto MakeGemmKDims()
+    {
+        std::array<index_t, NDimSpatial + 1> dims{};
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            dims[i] = i + 3;
+        }
+
+        dims[NDimSpatial] = 2;
+
+        return dims;
+    }
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const void* p_a,
+                 const void* p_b,
+                 const std::array<const void*, NumDTensor>& p_ds,
+                 void* p_e,
+                 const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+                 const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+                 const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>&
+                     ds_g_n_k_wos_lengths,
+                 const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>&
+                     ds_g_n_k_wos_strides,
+                 const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                 const std::array<index_t, NDimSpatial>& input_left_pads,
+                 const std::array<index_t, NDimSpatial>& input_right_pads,
+                 const AElementwiseOperation& a_element_op,
+                 const BElementwiseOperation& b_element_op,
+                 const CDEElementwiseOperation& cde_element_op,
+                 std::size_t workspace_budget)
+            : p_a_grid_{static_cast<const ADataType*>(p_a)},
+              p_b_grid_{static_cast<const BDataType*>(p_b)},
+              p_ds_grid_{p_ds},
+              p_e_grid_{static_cast<EDataType*>(p_e)},
+              p_im2col_grid_{nullptr},
+              K_{b_g_k_c_xs_lengths[1]},
+              b_gemm_k_stride_{GetMergedDimensionStride(
+                  b_g_k_c_xs_lengths, b_g_k_c_xs_strides, MakeGemmKDims())},
+              b_g_stride_{b_g_k_c_xs_strides[0]},
+              b_k_stride_{b_g_k_c_xs_strides[1]},
+              e_m_stride_{GetMergedDimensionStride(
+                  e_g_n_k_wos_lengths, e_g_n_k_wos_strides, MakeGemmMDims())},
+              e_g_stride_{e_g_n_k_wos_strides[0]},
+              e_k_stride_{e_g_n_k_wos_strides[2]},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              cde_element_op_{cde_element_op}
+        {
+            // the output lengths are enough to place the rows
+            ignore = input_right_pads;
+
+            problem_.G_                 = a_g_n_c_wis_lengths[0];
+            problem_.C_                 = a_g_n_c_wis_lengths[2];
+            problem_.NumFilterPosition_ = 1;
+
+            index_t gemm_m = a_g_n_c_wis_lengths[1];
+
+            for(index_t i = 0; i < NDimSpatial; ++i)
+            {
+                problem_.InputLengths_[i]  = a_g_n_c_wis_lengths[i + 3];
+                problem_.OutputLengths_[i] = e_g_n_k_wos_lengths[i + 3];
+                problem_.FilterLengths_[i] = b_g_k_c_xs_lengths[i + 3];
+                problem_.ConvStrides_[i]   = conv_filter_strides[i];
+                problem_.ConvDilations_[i] = conv_filter_dilations[i];
+                problem_.LeftPads_[i]      = input_left_pads[i];
+
+                problem_.NumFilterPosition_ *= b_g_k_c_xs_lengths[i + 3];
+                gemm_m *= e_g_n_k_wos_lengths[i + 3];
+            }
+
+            problem_.GemmK_ = problem_.NumFilterPosition_ * problem_.C_;
+
+            plan_ = MakeConvFwdIm2ColChunkPlan(problem_.G_,
+                                               gemm_m,
+                                               problem_.GemmK_,
+                                               sizeof(ADataType),
+                                               workspace_budget,
+                                               MPerChunkAlign);
+
+            for(index_t i = 0; i < NDimSpatial + 3; ++i)
+            {
+                a_g_n_c_wis_strides_(i) = a_g_n_c_wis_strides[i];
+            }
+
+            for(index_t i = 0; i < NumDTensor; ++i)
+            {
+                ds_m_strides_[i] = GetMergedDimensionStride(
+                    ds_g_n_k_wos_lengths[i], ds_g_n_k_wos_strides[i], MakeGemmMDims());
+                ds_g_strides_[i] = ds_g_n_k_wos_strides[i][0];
+                ds_k_strides_[i] = ds_g_n_k_wos_strides[i][2];
+            }
+        }
+
+        // GEMM of a chunk, the pointers are only valid once the workspace is set
+        std::unique_ptr<BaseArgument> MakeGemmArgumentPointer(index_t chunk) const
+        {
+            const index_t m_begin = plan_.GetChunkBegin(chunk);
+            const index_t m_size  = plan_.GetChunkSize(chunk);
+
+            std::array<const void*, NumDTensor> p_ds;
+
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                p_ds[i] = static_cast<const DDataType*>(p_ds_grid_[i]) +
+                          static_cast<long_index_t>(m_begin) * ds_m_strides_[i];
+            });
+
+            // M = m_size, N = K, K = GemmK, one batch per group
+            return DeviceGemm{}.MakeArgumentPointer(
+                p_im2col_grid_,
+                p_b_grid_,
+                p_ds,
+                p_e_grid_ + static_cast<long_index_t>(m_begin) * e_m_stride_,
+                m_size,
+                K_,
+                problem_.GemmK_,
+                problem_.G_,
+                problem_.GemmK_,
+                b_k_stride_,
+                ds_m_strides_,
+                e_m_stride_,
+                m_size * problem_.GemmK_,
+                b_g_stride_,
+                ds_g_strides_,
+                e_g_stride_,
+                PassThrough{},
+                b_element_op_,
+                cde_element_op_);
+        }
+
+        void Print() const
+        {
+            std::cout << "G " << problem_.G_ << ", GemmM " << plan_.GemmM_ << ", K " << K_
+                      << ", GemmK " << problem_.GemmK_ << ", chunks " << plan_.NumChunk_ << "x"
+                      << plan_.MPerChunk_ << std::endl;
+        }
+
+        //  private:
+        // pointers
+        const ADataType* p_a_grid_;
+        const BDataType* p_b_grid_;
+        std::array<const void*, NumDTensor> p_ds_grid_;
+        EDataType* p_e_grid_;
+
+        // workspace
+        ADataType* p_im2col_grid_;
+
+        ConvFwdIm2ColProblem<NDimSpatial> problem_;
+        ConvFwdIm2ColChunkPlan plan_;
+
+        Array<index_t, NDimSpatial + 3> a_g_n_c_wis_strides_;
+
+        // GEMM strides, a merged stride is -1 if the dimensions cannot be merged
+        index_t K_;
+        index_t b_gemm_k_stride_;
+        index_t b_g_stride_;
+        index_t b_k_stride_;
+        std::array<index_t, NumDTensor> ds_m_strides_;
+        std::array<index_t, NumDTensor> ds_g_strides_;
+        std::array<index_t, NumDTensor> ds_k_strides_;
+        index_t e_m_stride_;
+        index_t e_g_stride_;
+        index_t e_k_stride_;
+
+        // element-wise op
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        using Argument = DeviceOp::Argument;
+
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(stream_config.log_level_ > 0)
+            {
+                arg.Print();
+            }
+
+            if(arg.p_im2col_grid_ == nullptr)
+                throw std::runtime_error("wrong! WorkSpace pointer has not been set");
+
+            const auto& problem = arg.problem_;
+            const auto& plan    = arg.plan_;
+
+            const auto kernel = kernel_conv_fwd_im2col<GridwiseIm2Col,
+                                                       NDimSpatial,
+                                                       ADataType,
+                                                       AElementwiseOperation>;
+
+            auto gemm_invoker_ptr = DeviceGemm{}.MakeInvokerPointer();
+
+            float ave_time = 0;
+
+            // the chunks share the workspace, so the im2col of a chunk waits for the GEMM of the
+            // previous one in the stream
+            for(index_t chunk = 0; chunk < plan.NumChunk_; ++chunk)
+            {
+                const index_t m_begin = plan.GetChunkBegin(chunk);
+                const index_t m_size  = plan.GetChunkSize(chunk);
+
+                const index_t grid_size = math::integer_divide_ceil(
+                    problem.G_ * m_size * problem.NumFilterPosition_ *
+                        (problem.C_ / Im2ColCPerThread),
+                    Im2ColBlockSize);
+
+                ave_time += launch_and_time_kernel(stream_config,
+                                                   kernel,
+                                                   dim3(grid_size),
+                                                   dim3(Im2ColBlockSize),
+                                                   0,
+                                                   arg.p_a_grid_,
+                                                   arg.p_im2col_grid_,
+                                                   problem,
+                                                   arg.a_g_n_c_wis_strides_,
+                                                   m_begin,
+                                                   m_size,
+                                                   arg.a_element_op_);
+
+                const auto gemm_arg_ptr = arg.MakeGemmArgumentPointer(chunk);
+
+                ave_time += gemm_invoker_ptr->Run(gemm_arg_ptr.get(), stream_config);
+            }
+
+            return ave_time;
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    explicit DeviceGroupedConvFwdMultipleD_Im2Col_Gemm(
+        std::size_t workspace_budget = DefaultWorkSpaceBudget)
+        : workspace_budget_{workspace_budget}
+    {
+    }
+
+    // bytes of workspace the arguments made from now on aim at
+    void SetWorkSpaceBudget(std::size_t workspace_budget) { workspace_budget_ = workspace_budget; }
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        const auto& problem = arg.problem_;
+        const auto& plan    = arg.plan_;
+
+        // the im2col matrix lives in the workspace, it must be set before the check
+        if(arg.p_im2col_grid_ == nullptr)
+        {
+            return false;
+        }
+
+        if(problem.C_ % Im2ColCPerThread != 0)
+        {
+            return false;
+        }
+
+        // the im2col kernel indexes a chunk with index_t
+        if(plan.GetChunkElementSize() > static_cast<std::size_t>(NumericLimits<index_t>::Max()))
+        {
+            return false;
+        }
+
+        // the weight must be a [K, GemmK] matrix and the output tensors [GemmM, K] matrices
+        if(!(arg.b_gemm_k_stride_ == 1 && arg.e_m_stride_ >= 0 &&
+             (arg.e_k_stride_ == 1 || arg.K_ == 1)))
+        {
+            return false;
+        }
+
+        for(index_t i = 0; i < NumDTensor; ++i)
+        {
+            if(!(arg.ds_m_strides_[i] >= 0 && (arg.ds_k_strides_[i] == 1 || arg.K_ == 1)))
+            {
+                return false;
+            }
+        }
+
+        // check the GEMM of a full chunk and of the last one
+        DeviceGemm gemm;
+
+        return gemm.IsSupportedArgument(arg.MakeGemmArgumentPointer(0).get()) &&
+               gemm.IsSupportedArgument(arg.MakeGemmArgumentPointer(plan.NumChunk_ - 1).get());
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    size_t GetWorkSpaceSize(const BaseArgument* pArg) const override
+    {
+        const Argument* pArg_ = dynamic_cast<const Argument*>(pArg);
+
+        return pArg_->plan_.GetChunkElementSize() * sizeof(ADataType);
+    };
+
+    void SetWorkSpacePointer(BaseArgument* pArg, void* p_workspace) const override
+    {
+        Argument* pArg_ = dynamic_cast<Argument*>(pArg);
+
+        pArg_->p_workspace_   = p_workspace;
+        pArg_->p_im2col_grid_ = static_cast<ADataType*>(p_workspace);
+    };
+
+    static auto MakeArgument(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, NumDTensor>& p_ds,
+        void* p_e,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op,
+        std::size_t workspace_budget = DefaultWorkSpaceBudget)
+    {
+        return Argument{p_a,
+                        p_b,
+                        p_ds,
+                        p_e,
+                        a_g_n_c_wis_lengths,
+                        a_g_n_c_wis_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        ds_g_n_k_wos_lengths,
+                        ds_g_n_k_wos_strides,
+                        e_g_n_k_wos_lengths,
+                        e_g_n_k_wos_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        a_element_op,
+                        b_element_op,
+                        cde_element_op,
+                        workspace_budget};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, NumDTensor>& p_ds,
+        void* p_e,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op) override
+    {
+        return std::make_unique<Argument>(p_a,
+                                          p_b,
+                                          p_ds,
+                                          p_e,
+                                          a_g_n_c_wis_lengths,
+                                          a_g_n_c_wis_strides,
+                                          b_g_k_c_xs_lengths,
+                                          b_g_k_c_xs_strides,
+                                          ds_g_n_k_wos_lengths,
+                                          ds_g_n_k_wos_strides,
+                                          e_g_n_k_wos_lengths,
+                                          e_g_n_k_wos_strides,
+                                          conv_filter_strides,
+                                          conv_filter_dilations,
+                                          input_left_pads,
+                                          input_right_pads,
+                                          a_element_op,
+                                          b_element_op,
+                                          cde_element_op,
+                                          workspace_budget_);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGroupedConvFwdMultipleD_Im2Col_Gemm"
+            << "<"
+            << Im2ColBlockSize << ", "
+            << Im2ColCPerThread << ", "
+            << MPerChunkAlign << ", "
+            << workspace_budget_ << ", "
+            << DeviceGemm{}.GetTypeString()
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    private:
+    std::size_t workspace_budget_;
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,649 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_batched_gemm_multi_d_xdl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_conv_fwd_winograd_transform.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+//
+// @brief      Device grouped convolution forward with the Winograd algorithm F(m x m, 3 x 3).
+//
+// Supports:
+//  @li         2D forward convolution with a 3x3 filter, stride 1 and dilation 1, any padding
+//  @li         Input/weight/output in any packed layout, e.g. NHWGC/GKYXC/NHWGK
+//
+// The convolution is computed as
+//  1) U = G * g * GT for every filter
+//  2) V = BT * d * B for every (m + 2) x (m + 2) input tile
+//  3) M = V * UT, a batched GEMM with one [NumTile, C] x [C, K] GEMM per group and element of the
+//     transformed tile
+//  4) E = cde_op(AT * M * A, Ds) for every m x m output tile
+// The GEMM runs on ADataType with the tuning parameters of DeviceBatchedGemmMultiD_Xdl, and the
+// workspace (see GetWorkSpaceSize()) holds U, V and M.
+//
+// The transforms do not preserve the rounding of the direct convolution: V and U are rounded to
+// ADataType, and with m = 4 the entries of the transform matrices range from 1/24 to 8, so the
+// results must be compared with a tolerance, see ReferenceConvFwdWinograd.
+//
+template <index_t NDimSpatial,
+          typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CShuffleDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          ConvolutionForwardSpecialization ConvForwardSpecialization,
+          index_t OutputTileSize,
+          GemmSpecialization GemmSpec,
+          index_t NumGemmKPrefetchStage,
+          index_t BlockSize,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t KPerBlock,
+          index_t AK1,
+          index_t BK1,
+          index_t MPerXDL,
+          index_t NPerXDL,
+          index_t MXdlPerWave,
+          index_t NXdlPerWave,
+          typename ABlockTransferThreadClusterLengths_AK0_M_AK1,
+          typename ABlockTransferThreadClusterArrangeOrder,
+          typename ABlockTransferSrcAccessOrder,
+          index_t ABlockTransferSrcVectorDim,
+          index_t ABlockTransferSrcScalarPerVector,
+          index_t ABlockTransferDstScalarPerVector_AK1,
+          index_t ABlockLdsExtraM,
+          typename BBlockTransferThreadClusterLengths_BK0_N_BK1,
+          typename BBlockTransferThreadClusterArrangeOrder,
+          typename BBlockTransferSrcAccessOrder,
+          index_t BBlockTransferSrcVectorDim,
+          index_t BBlockTransferSrcScalarPerVector,
+          index_t BBlockTransferDstScalarPerVector_BK1,
+          index_t BBlockLdsExtraN,
+          index_t CShuffleMXdlPerWavePerShuffle,
+          index_t CShuffleNXdlPerWavePerShuffle,
+          typename CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock,
+          index_t CDEBlockTransferScalarPerVector_NPerBlock,
+          LoopScheduler LoopSched = make_default_loop_scheduler()>
+struct DeviceGroupedConvFwdMultipleD_Winograd_Xdl_CShuffle
+    : public DeviceGroupedConvFwdMultipleD<NDimSpatial,
+                                           ALayout,
+                                           BLayout,
+                                           DsLayout,
+                                           ELayout,
+                                           ADataType,
+                                           BDataType,
+                                           DsDataType,
+                                           EDataType,
+                                           AElementwiseOperation,
+                                           BElementwiseOperation,
+                                           CDEElementwiseOperation>
+{
+    using DeviceOp = DeviceGroupedConvFwdMultipleD_Winograd_Xdl_CShuffle;
+
+    static_assert(NDimSpatial == 2, "Winograd is only implemented for 2D convolution");
+    static_assert(ConvForwardSpecialization == ConvolutionForwardSpecialization::Filter3x3Stride1,
+                  "Winograd requires a 3x3, stride 1 convolution");
+    static_assert(OutputTileSize == 2 || OutputTileSize == 4,
+                  "only F(2x2, 3x3) and F(4x4, 3x3) are supported");
+    static_assert(is_same_v<ADataType, BDataType>, "the GEMM needs the same A and B data types");
+
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    static constexpr index_t FilterSize     = 3;
+    static constexpr index_t TileSize       = OutputTileSize + FilterSize - 1;
+    static constexpr index_t NumTileElement = TileSize * TileSize;
+
+    using PassThrough = element_wise::PassThrough;
+
+    using GridwiseTransform = GridwiseConvFwdWinogradTransform_2d<OutputTileSize,
+                                                                  ADataType,
+                                                                  BDataType,
+                                                                  AccDataType,
+                                                                  CShuffleDataType,
+                                                                  DsDataType,
+                                                                  EDataType,
+                                                                  AElementwiseOperation,
+                                                                  BElementwiseOperation,
+                                                                  CDEElementwiseOperation,
+                                                                  BlockSize>;
+
+    // M[g, xi] = V[g, xi] * U[g, xi]T, V being [NumTile, C] row-major and U [K, C], i.e. a
+    // column-major [C, K] matrix
+    using DeviceBatchedGemm = DeviceBatchedGemmMultiD_Xdl<
+        tensor_layout::gemm::RowMajor,
+        tensor_layout::gemm::ColumnMajor,
+        Tuple<>,
+        tensor_layout::gemm::RowMajor,
+        ADataType,
+        BDataType,
+        AccDataType,
+        AccDataType,
+        Tuple<>,
+        AccDataType,
+        PassThrough,
+        PassThrough,
+        PassThrough,
+        GemmSpec,
+        NumGemmKPrefetchStage,
+        BlockSize,
+        MPerBlock,
+        NPerBlock,
+        KPerBlock,
+        AK1,
+        BK1,
+        MPerXDL,
+        NPerXDL,
+        MXdlPerWave,
+        NXdlPerWave,
+        ABlockTransferThreadClusterLengths_AK0_M_AK1,
+        ABlockTransferThreadClusterArrangeOrder,
+        ABlockTransferSrcAccessOrder,
+        ABlockTransferSrcVectorDim,
+        ABlockTransferSrcScalarPerVector,
+        ABlockTransferDstScalarPerVector_AK1,
+        static_cast<bool>(ABlockLdsExtraM),
+        BBlockTransferThreadClusterLengths_BK0_N_BK1,
+        BBlockTransferThreadClusterArrangeOrder,
+        BBlockTransferSrcAccessOrder,
+        BBlockTransferSrcVectorDim,
+        BBlockTransferSrcScalarPerVector,
+        BBlockTransferDstScalarPerVector_BK1,
+        static_cast<bool>(BBlockLdsExtraN),
+        CShuffleMXdlPerWavePerShuffle,
+        CShuffleNXdlPerWavePerShuffle,
+        CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock,
+        CDEBlockTransferScalarPerVector_NPerBlock,
+        LoopSched>;
+
+    // Argument
+    struct Argument : public BaseArgument
+    {
+        Argument(const void* p_a,
+                 const void* p_b,
+                 const std::array<const void*, NumDTensor>& p_ds,
+                 void* p_e,
+                 const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+                 const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+                 const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>&
+                     ds_g_n_k_wos_lengths,
+                 const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>&
+                     ds_g_n_k_wos_strides,
+                 const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+                 const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                 const std::array<index_t, NDimSpatial>& input_left_pads,
+                 const std::array<index_t, NDimSpatial>& input_right_pads,
+                 const AElementwiseOperation& a_element_op,
+                 const BElementwiseOperation& b_element_op,
+                 const CDEElementwiseOperation& cde_element_op)
+            : p_a_grid_{static_cast<const ADataType*>(p_a)},
+              p_b_grid_{static_cast<const BDataType*>(p_b)},
+              p_ds_grid_{},
+              p_e_grid_{static_cast<EDataType*>(p_e)},
+              p_u_grid_{nullptr},
+              p_v_grid_{nullptr},
+              p_m_grid_{nullptr},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              cde_element_op_{cde_element_op},
+              a_g_n_c_wis_lengths_{a_g_n_c_wis_lengths},
+              b_g_k_c_xs_lengths_{b_g_k_c_xs_lengths},
+              ds_g_n_k_wos_lengths_{ds_g_n_k_wos_lengths},
+              e_g_n_k_wos_lengths_{e_g_n_k_wos_lengths},
+              conv_filter_strides_{conv_filter_strides},
+              conv_filter_dilations_{conv_filter_dilations},
+              input_left_pads_{input_left_pads},
+              input_right_pads_{input_right_pads}
+        {
+            problem_.G_        = a_g_n_c_wis_lengths[0];
+            problem_.N_        = a_g_n_c_wis_lengths[1];
+            problem_.C_        = a_g_n_c_wis_lengths[2];
+            problem_.K_        = b_g_k_c_xs_lengths[1];
+            problem_.Hi_       = a_g_n_c_wis_lengths[3];
+            problem_.Wi_       = a_g_n_c_wis_lengths[4];
+            problem_.Ho_       = e_g_n_k_wos_lengths[3];
+            problem_.Wo_       = e_g_n_k_wos_lengths[4];
+            problem_.LeftPadH_ = input_left_pads[0];
+            problem_.LeftPadW_ = input_left_pads[1];
+            problem_.NumTileH_ = math::integer_divide_ceil(problem_.Ho_, OutputTileSize);
+            problem_.NumTileW_ = math::integer_divide_ceil(problem_.Wo_, OutputTileSize);
+
+            for(index_t i = 0; i < NDimSpatial + 3; ++i)
+            {
+                a_g_n_c_wis_strides_(i) = a_g_n_c_wis_strides[i];
+                b_g_k_c_xs_strides_(i)  = b_g_k_c_xs_strides[i];
+                e_g_n_k_wos_strides_(i) = e_g_n_k_wos_strides[i];
+            }
+
+            static_for<0, NumDTensor, 1>{}([&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                p_ds_grid_(i) = static_cast<const DDataType*>(p_ds[i]);
+
+                for(index_t j = 0; j < NDimSpatial + 3; ++j)
+                    ds_g_n_k_wos_strides_(i)(j) = ds_g_n_k_wos_strides[i][j];
+            });
+        }
+
+        // sizes of the transformed filter, transformed input and GEMM result
+        std::size_t GetUSpaceSize() const
+        {
+            return static_cast<std::size_t>(problem_.G_) * NumTileElement * problem_.K_ *
+                   problem_.C_;
+        }
+
+        std::size_t GetVSpaceSize() const
+        {
+            return static_cast<std::size_t>(problem_.G_) * NumTileElement * problem_.GetNumTile() *
+                   problem_.C_;
+        }
+
+        std::size_t GetMSpaceSize() const
+        {
+            return static_cast<std::size_t>(problem_.G_) * NumTileElement * problem_.GetNumTile() *
+                   problem_.K_;
+        }
+
+        // batched GEMM on the workspace, the pointers are only valid once the workspace is set
+        auto MakeBatchedGemmArgument() const
+        {
+            const index_t num_tile = problem_.GetNumTile();
+
+            // M = NumTile, N = K, K = C, one batch per group and element of the transformed tile
+            return DeviceBatchedGemm::MakeArgument(p_v_grid_,
+                                                   p_u_grid_,
+                                                   {},
+                                                   p_m_grid_,
+                                                   num_tile,
+                                                   problem_.K_,
+                                                   problem_.C_,
+                                                   problem_.G_ * NumTileElement,
+                                                   problem_.C_,
+                                                   problem_.C_,
+                                                   {},
+                                                   problem_.K_,
+                                                   num_tile * problem_.C_,
+                                                   problem_.K_ * problem_.C_,
+                                                   {},
+                                                   num_tile * problem_.K_,
+                                                   PassThrough{},
+                                                   PassThrough{},
+                                                   PassThrough{});
+        }
+
+        void Print() const
+        {
+            std::cout << "G " << problem_.G_ << ", N " << problem_.N_ << ", C " << problem_.C_
+                      << ", K " << problem_.K_ << ", Ho " << problem_.Ho_ << ", Wo "
+                      << problem_.Wo_ << ", tiles " << problem_.NumTileH_ << "x"
+                      << problem_.NumTileW_ << std::endl;
+        }
+
+        //  private:
+        // pointers
+        const ADataType* p_a_grid_;
+        const BDataType* p_b_grid_;
+        typename GridwiseTransform::DsGridPointer p_ds_grid_;
+        EDataType* p_e_grid_;
+
+        // workspace
+        ADataType* p_u_grid_;
+        ADataType* p_v_grid_;
+        AccDataType* p_m_grid_;
+
+        ConvFwdWinogradProblem_2d problem_;
+
+        Array<index_t, NDimSpatial + 3> a_g_n_c_wis_strides_;
+        Array<index_t, NDimSpatial + 3> b_g_k_c_xs_strides_;
+        Array<Array<index_t, NDimSpatial + 3>, NumDTensor> ds_g_n_k_wos_strides_;
+        Array<index_t, NDimSpatial + 3> e_g_n_k_wos_strides_;
+
+        // element-wise op
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+
+        // for checking IsSupportedArgument()
+        std::array<index_t, NDimSpatial + 3> a_g_n_c_wis_lengths_;
+        std::array<index_t, NDimSpatial + 3> b_g_k_c_xs_lengths_;
+        std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor> ds_g_n_k_wos_lengths_;
+        std::array<index_t, NDimSpatial + 3> e_g_n_k_wos_lengths_;
+        std::array<index_t, NDimSpatial> conv_filter_strides_;
+        std::array<index_t, NDimSpatial> conv_filter_dilations_;
+        std::array<index_t, NDimSpatial> input_left_pads_;
+        std::array<index_t, NDimSpatial> input_right_pads_;
+    };
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        using Argument = DeviceOp::Argument;
+
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            if(stream_config.log_level_ > 0)
+            {
+                arg.Print();
+            }
+
+            if(arg.p_u_grid_ == nullptr || arg.p_v_grid_ == nullptr || arg.p_m_grid_ == nullptr)
+                throw std::runtime_error("wrong! WorkSpace pointer has not been set");
+
+            const auto& problem = arg.problem_;
+
+            const index_t num_tile = problem.GetNumTile();
+
+            float ave_time = 0;
+
+            // the filter transform could be cached by the caller for inference, it is redone here
+            // so that the operation has the same interface as the implicit GEMM ones
+            {
+                const auto kernel =
+                    kernel_conv_fwd_winograd_filter_transform<GridwiseTransform,
+                                                              BDataType,
+                                                              ADataType,
+                                                              BElementwiseOperation>;
+
+                const index_t grid_size =
+                    math::integer_divide_ceil(problem.G_ * problem.K_ * problem.C_, BlockSize);
+
+                ave_time += launch_and_time_kernel(stream_config,
+                                                   kernel,
+                                                   dim3(grid_size),
+                                                   dim3(BlockSize),
+                                                   0,
+                                                   arg.p_b_grid_,
+                                                   arg.p_u_grid_,
+                                                   problem,
+                                                   arg.b_g_k_c_xs_strides_,
+                                                   arg.b_element_op_);
+            }
+
+            {
+                const auto kernel = kernel_conv_fwd_winograd_input_transform<GridwiseTransform,
+                                                                             ADataType,
+                                                                             AElementwiseOperation>;
+
+                const index_t grid_size =
+                    math::integer_divide_ceil(problem.G_ * num_tile * problem.C_, BlockSize);
+
+                ave_time += launch_and_time_kernel(stream_config,
+                                                   kernel,
+                                                   dim3(grid_size),
+                                                   dim3(BlockSize),
+                                                   0,
+                                                   arg.p_a_grid_,
+                                                   arg.p_v_grid_,
+                                                   problem,
+                                                   arg.a_g_n_c_wis_strides_,
+                                                   arg.a_element_op_);
+            }
+
+            ave_time += typename DeviceBatchedGemm::Invoker{}.Run(arg.MakeBatchedGemmArgument(),
+                                                                  stream_config);
+
+            {
+                const auto kernel = kernel_conv_fwd_winograd_output_transform<
+                    GridwiseTransform,
+                    AccDataType,
+                    typename GridwiseTransform::DsGridPointer,
+                    EDataType,
+                    CDEElementwiseOperation,
+                    NumDTensor>;
+
+                const index_t grid_size =
+                    math::integer_divide_ceil(problem.G_ * num_tile * problem.K_, BlockSize);
+
+                ave_time += launch_and_time_kernel(stream_config,
+                                                   kernel,
+                                                   dim3(grid_size),
+                                                   dim3(BlockSize),
+                                                   0,
+                                                   arg.p_m_grid_,
+                                                   arg.p_ds_grid_,
+                                                   arg.p_e_grid_,
+                                                   problem,
+                                                   arg.ds_g_n_k_wos_strides_,
+                                                   arg.e_g_n_k_wos_strides_,
+                                                   arg.cde_element_op_);
+            }
+
+            return ave_time;
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        // check ConvolutionForwardSpecialization: 3x3, stride=1, dilation=1 conv
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            const index_t X            = arg.b_g_k_c_xs_lengths_[i + 3];
+            const index_t ConvStride   = arg.conv_filter_strides_[i];
+            const index_t ConvDilation = arg.conv_filter_dilations_[i];
+
+            if(!(X == FilterSize && ConvStride == 1 && ConvDilation == 1))
+            {
+                return false;
+            }
+        }
+
+        const auto& problem = arg.problem_;
+
+        // the transforms index the tensors with index_t, the workspace with long_index_t
+        const auto max_index = static_cast<std::size_t>(NumericLimits<index_t>::Max());
+
+        if(arg.GetUSpaceSize() > max_index || arg.GetVSpaceSize() > max_index ||
+           arg.GetMSpaceSize() > max_index)
+        {
+            return false;
+        }
+
+        // check vector access of the GEMM operands, which are packed on the workspace
+        if(!(ABlockTransferSrcVectorDim == 2 &&
+             problem.C_ % ABlockTransferSrcScalarPerVector == 0 &&
+             BBlockTransferSrcVectorDim == 2 &&
+             problem.C_ % BBlockTransferSrcScalarPerVector == 0 &&
+             problem.K_ % CDEBlockTransferScalarPerVector_NPerBlock == 0))
+        {
+            return false;
+        }
+
+        // check Gridwise GEMM
+        return DeviceBatchedGemm::IsSupportedArgument(arg.MakeBatchedGemmArgument());
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    size_t GetWorkSpaceSize(const BaseArgument* pArg) const override
+    {
+        const Argument* pArg_ = dynamic_cast<const Argument*>(pArg);
+
+        size_t workspace_size = 0;
+
+        // workspace for the transformed filter and input
+        workspace_size += pArg_->GetUSpaceSize() * sizeof(ADataType) + 64;
+        workspace_size += pArg_->GetVSpaceSize() * sizeof(ADataType) + 64;
+
+        // workspace for the output of the batched GEMM
+        workspace_size += pArg_->GetMSpaceSize() * sizeof(AccDataType);
+
+        return (workspace_size);
+    };
+
+    void SetWorkSpacePointer(BaseArgument* pArg, void* p_workspace) const override
+    {
+        Argument* pArg_ = dynamic_cast<Argument*>(pArg);
+
+        pArg_->p_workspace_ = p_workspace;
+
+        const size_t u_space_sz =
+            math::integer_least_multiple(pArg_->GetUSpaceSize() * sizeof(ADataType), 64);
+        const size_t v_space_sz =
+            math::integer_least_multiple(pArg_->GetVSpaceSize() * sizeof(ADataType), 64);
+
+        char* p_workspace_char = static_cast<char*>(p_workspace);
+
+        pArg_->p_u_grid_ = reinterpret_cast<ADataType*>(p_workspace_char);
+        pArg_->p_v_grid_ = reinterpret_cast<ADataType*>(p_workspace_char + u_space_sz);
+        pArg_->p_m_grid_ =
+            reinterpret_cast<AccDataType*>(p_workspace_char + u_space_sz + v_space_sz);
+    };
+
+    static auto MakeArgument(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, NumDTensor>& p_ds,
+        void* p_e,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op)
+    {
+        return Argument{p_a,
+                        p_b,
+                        p_ds,
+                        p_e,
+                        a_g_n_c_wis_lengths,
+                        a_g_n_c_wis_strides,
+                        b_g_k_c_xs_lengths,
+                        b_g_k_c_xs_strides,
+                        ds_g_n_k_wos_lengths,
+                        ds_g_n_k_wos_strides,
+                        e_g_n_k_wos_lengths,
+                        e_g_n_k_wos_strides,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        a_element_op,
+                        b_element_op,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(
+        const void* p_a,
+        const void* p_b,
+        const std::array<const void*, NumDTensor>& p_ds,
+        void* p_e,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_lengths,
+        const std::array<std::array<index_t, NDimSpatial + 3>, NumDTensor>& ds_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_lengths,
+        const std::array<index_t, NDimSpatial + 3>& e_g_n_k_wos_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+        const std::array<index_t, NDimSpatial>& input_left_pads,
+        const std::array<index_t, NDimSpatial>& input_right_pads,
+        const AElementwiseOperation& a_element_op,
+        const BElementwiseOperation& b_element_op,
+        const CDEElementwiseOperation& cde_element_op) override
+    {
+        return std::make_unique<Argument>(p_a,
+                                          p_b,
+                                          p_ds,
+                                          p_e,
+                                          a_g_n_c_wis_lengths,
+                                          a_g_n_c_wis_strides,
+                                          b_g_k_c_xs_lengths,
+                                          b_g_k_c_xs_strides,
+                                          ds_g_n_k_wos_lengths,
+                                          ds_g_n_k_wos_strides,
+                                          e_g_n_k_wos_lengths,
+                                          e_g_n_k_wos_strides,
+                                          conv_filter_strides,
+                                          conv_filter_dilations,
+                                          input_left_pads,
+                                          input_right_pads,
+                                          a_element_op,
+                                          b_element_op,
+                                          cde_element_op);
+    }
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGroupedConvFwdMultipleD_Winograd_Xdl_CShuffle"
+            << "<"
+            << "F(" << OutputTileSize << "x" << OutputTileSize << ", 3x3), "
+            << BlockSize << ", "
+            << MPerBlock << ", "
+            << NPerBlock << ", "
+            << KPerBlock << ", "
+            << getConvForwardSpecializationString(ConvForwardSpecialization) << ", "
+            << MPerXDL << ", "
+            << NPerXDL << ", "
+            << MXdlPerWave << ", "
+            << NXdlPerWave << ", "
+            << ABlockTransferSrcScalarPerVector << ", "
+            << BBlockTransferSrcScalarPerVector << ", "
+            << CShuffleMXdlPerWavePerShuffle << ", "
+            << CShuffleNXdlPerWavePerShuffle
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -733,6 +733,22 @@ struct DeviceGroupedConvFwdMultipleD_Xdl_CShuffle
                 }
             }
         }
+        else if constexpr(ConvForwardSpecialization ==
+                          ConvolutionForwardSpecialization::Filter3x3Stride1)
+        {
+            // check if it's 3x3, stride=1, dilation=1 conv
+            for(index_t i = 0; i < NDimSpatial; ++i)
+            {
+                const index_t X            = arg.b_g_k_c_xs_lengths_[i + 3];
+                const index_t ConvStride   = arg.conv_filter_strides_[i];
+                const index_t ConvDilation = arg.conv_filter_dilations_[i];
+
+                if(!(X == 3 && ConvStride == 1 && ConvDilation == 1))
+                {
+                    return false;
+                }
+            }
+        }
 
         // check vector access of A
         // FIXME: layout
@@ -0,0 +1,453 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_gemm_xdl.hpp"
+#include "ck/tensor_operation/gpu/grid/grouped_gemm_work_queue.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+template <typename GridwiseGemm,
+          typename GemmDesc,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          bool HasMainKBlockLoop>
+__global__ void
+#if CK_USE_LAUNCH_BOUNDS
+    __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+        kernel_grouped_gemm_xdl_persistent(const void CK_CONSTANT_ADDRESS_SPACE* gemm_descs_const,
+                                           const index_t group_count,
+                                           const index_t tile_count,
+                                           uint32_t* __restrict__ p_work_queue_counters,
+                                           const AElementwiseOperation a_element_op,
+                                           const BElementwiseOperation b_element_op,
+                                           const CDEElementwiseOperation c_element_op)
+{
+#if(!defined(__HIP_DEVICE_COMPILE__) || defined(__gfx908__) || defined(__gfx90a__) || \
+    defined(__gfx940__) || defined(__gfx941__) || defined(__gfx942__))
+    __shared__ char p_shared[GridwiseGemm::GetSharedMemoryNumberOfByte()];
+
+    const auto gemm_desc_ptr =
+        reinterpret_cast<const GemmDesc*>(cast_pointer_to_generic_address_space(gemm_descs_const));
+
+    const auto work_queue = PersistentWorkQueue{p_work_queue_counters};
+
+    const auto get_item_end = [&](index_t g) { return gemm_desc_ptr[g].BlockEnd_; };
+
+    index_t group_id = 0;
+
+    for(index_t item = work_queue.Pop(); item < tile_count; item = work_queue.Pop())
+    {
+        group_id = FindWorkItemGroup(get_item_end, group_count, item, group_id);
+
+        const auto& gemm_desc = gemm_desc_ptr[group_id];
+
+        GridwiseGemm::template Run<HasMainKBlockLoop>(
+            gemm_desc.a_ptr_,
+            gemm_desc.b_ptr_,
+            gemm_desc.ds_ptr_,
+            gemm_desc.e_ptr_,
+            p_shared,
+            a_element_op,
+            b_element_op,
+            c_element_op,
+            gemm_desc.a_grid_desc_ak0_m_ak1_,
+            gemm_desc.b_grid_desc_bk0_n_bk1_,
+            gemm_desc.ds_grid_desc_mblock_mperblock_nblock_nperblock_,
+            gemm_desc.e_grid_desc_mblock_mperblock_nblock_nperblock_,
+            WorkItemToETileMap<decltype(gemm_desc.block_2_etile_map_)>{
+                gemm_desc.block_2_etile_map_, item});
+    }
+
+    work_queue.Finish();
+#else
+    ignore = gemm_descs_const;
+    ignore = group_count;
+    ignore = tile_count;
+    ignore = p_work_queue_counters;
+    ignore = a_element_op;
+    ignore = b_element_op;
+    ignore = c_element_op;
+#endif
+}
+
+//
+// @brief      Persistent variant of DeviceGroupedGemm_Xdl.
+//
+// Instead of one workgroup per tile of every group, about one workgroup per CU is launched and
+// the workgroups pull the tiles of all the groups from a device-side queue, the groups being
+// queued largest first (number of tiles times K). Groups of very different sizes then do not
+// leave a tail of stragglers, and a workgroup finds the group of its tiles with a forward scan
+// instead of a search over all the groups per tile. See grouped_gemm_work_queue.hpp.
+//
+// The argument and the problem validation are the ones of DeviceGroupedGemm_Xdl. The workspace
+// holds the kernel arguments of the groups in queue order followed by the counters of the queue.
+//
+template <typename ALayout,
+          typename BLayout,
+          typename DsLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CShuffleDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          GemmSpecialization GemmSpec,
+          ck::index_t NumPrefetch,
+          ck::index_t BlockSize,
+          ck::index_t MPerBlock,
+          ck::index_t NPerBlock,
+          ck::index_t KPerBlock,
+          ck::index_t AK1,
+          ck::index_t BK1,
+          ck::index_t MPerXDL,
+          ck::index_t NPerXDL,
+          ck::index_t MXdlPerWave,
+          ck::index_t NXdlPerWave,
+          typename ABlockTransferThreadClusterLengths_K0_M_K1,
+          typename ABlockTransferThreadClusterArrangeOrder,
+          typename ABlockTransferSrcAccessOrder,
+          ck::index_t ABlockTransferSrcVectorDim,
+          ck::index_t ABlockTransferSrcScalarPerVector,
+          ck::index_t ABlockTransferDstScalarPerVector_K1,
+          bool ABlockLdsExtraM,
+          typename BBlockTransferThreadClusterLengths_K0_N_K1,
+          typename BBlockTransferThreadClusterArrangeOrder,
+          typename BBlockTransferSrcAccessOrder,
+          ck::index_t BBlockTransferSrcVectorDim,
+          ck::index_t BBlockTransferSrcScalarPerVector,
+          ck::index_t BBlockTransferDstScalarPerVector_K1,
+          bool BBlockLdsExtraN,
+          index_t CShuffleMXdlPerWavePerShuffle,
+          index_t CShuffleNXdlPerWavePerShuffle,
+          typename CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock,
+          index_t CDEBlockTransferScalarPerVector_NPerBlock,
+          LoopScheduler LoopSched = make_default_loop_scheduler()>
+struct DeviceGroupedGemm_Xdl_Persistent
+    : public DeviceGroupedGemm_Xdl<ALayout,
+                                   BLayout,
+                                   DsLayout,
+                                   ELayout,
+                                   ADataType,
+                                   BDataType,
+                                   AccDataType,
+                                   CShuffleDataType,
+                                   DsDataType,
+                                   EDataType,
+                                   AElementwiseOperation,
+                                   BElementwiseOperation,
+                                   CDEElementwiseOperation,
+                                   GemmSpec,
+                                   NumPrefetch,
+                                   BlockSize,
+                                   MPerBlock,
+                                   NPerBlock,
+                                   KPerBlock,
+                                   AK1,
+                                   BK1,
+                                   MPerXDL,
+                                   NPerXDL,
+                                   MXdlPerWave,
+                                   NXdlPerWave,
+                                   ABlockTransferThreadClusterLengths_K0_M_K1,
+                                   ABlockTransferThreadClusterArrangeOrder,
+                                   ABlockTransferSrcAccessOrder,
+                                   ABlockTransferSrcVectorDim,
+                                   ABlockTransferSrcScalarPerVector,
+                                   ABlockTransferDstScalarPerVector_K1,
+                                   ABlockLdsExtraM,
+                                   BBlockTransferThreadClusterLengths_K0_N_K1,
+                                   BBlockTransferThreadClusterArrangeOrder,
+                                   BBlockTransferSrcAccessOrder,
+                                   BBlockTransferSrcVectorDim,
+                                   BBlockTransferSrcScalarPerVector,
+                                   BBlockTransferDstScalarPerVector_K1,
+                                   BBlockLdsExtraN,
+                                   CShuffleMXdlPerWavePerShuffle,
+                                   CShuffleNXdlPerWavePerShuffle,
+                                   CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock,
+                                   CDEBlockTransferScalarPerVector_NPerBlock,
+                                   LoopSched>
+{
+    using Base =
+        DeviceGroupedGemm_Xdl<ALayout,
+                              BLayout,
+                              DsLayout,
+                              ELayout,
+                              ADataType,
+                              BDataType,
+                              AccDataType,
+                              CShuffleDataType,
+                              DsDataType,
+                              EDataType,
+                              AElementwiseOperation,
+                              BElementwiseOperation,
+                              CDEElementwiseOperation,
+                              GemmSpec,
+                              NumPrefetch,
+                              BlockSize,
+                              MPerBlock,
+                              NPerBlock,
+                              KPerBlock,
+                              AK1,
+                              BK1,
+                              MPerXDL,
+                              NPerXDL,
+                              MXdlPerWave,
+                              NXdlPerWave,
+                              ABlockTransferThreadClusterLengths_K0_M_K1,
+                              ABlockTransferThreadClusterArrangeOrder,
+                              ABlockTransferSrcAccessOrder,
+                              ABlockTransferSrcVectorDim,
+                              ABlockTransferSrcScalarPerVector,
+                              ABlockTransferDstScalarPerVector_K1,
+                              ABlockLdsExtraM,
+                              BBlockTransferThreadClusterLengths_K0_N_K1,
+                              BBlockTransferThreadClusterArrangeOrder,
+                              BBlockTransferSrcAccessOrder,
+                              BBlockTransferSrcVectorDim,
+                              BBlockTransferSrcScalarPerVector,
+                              BBlockTransferDstScalarPerVector_K1,
+                              BBlockLdsExtraN,
+                              CShuffleMXdlPerWavePerShuffle,
+                              CShuffleNXdlPerWavePerShuffle,
+                              CDEBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock,
+                              CDEBlockTransferScalarPerVector_NPerBlock,
+                              LoopSched>;
+
+    using DeviceOp = DeviceGroupedGemm_Xdl_Persistent;
+
+    using GridwiseGemm = typename Base::GridwiseGemm;
+    using Argument     = typename Base::Argument;
+    using KernelArg    = typename Base::GemmBiasTransKernelArg;
+
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I2 = Number<2>{};
+
+    // the counters of the queue follow the kernel arguments
+    static std::size_t GetWorkQueueOffset(index_t group_count)
+    {
+        return math::integer_least_multiple(group_count * sizeof(KernelArg), sizeof(uint64_t));
+    }
+
+    // the groups skipped by the argument have no kernel arguments
+    static uint32_t* GetWorkQueueCounters(const Argument& arg)
+    {
+        return reinterpret_cast<uint32_t*>(static_cast<char*>(arg.p_workspace_) +
+                                           GetWorkQueueOffset(arg.gemm_desc_kernel_arg_.size()));
+    }
+
+    // Kernel arguments of the groups in queue order, the work items [BlockStart_, BlockEnd_) of
+    // a group being its tiles
+    static std::vector<KernelArg> MakeQueueOrderedKernelArgs(const Argument& arg)
+    {
+        const auto& kernel_args = arg.gemm_desc_kernel_arg_;
+
+        std::vector<long_index_t> group_costs;
+
+        for(const auto& kernel_arg : kernel_args)
+        {
+            const long_index_t K = kernel_arg.a_grid_desc_ak0_m_ak1_.GetLength(I0) *
+                                   kernel_arg.a_grid_desc_ak0_m_ak1_.GetLength(I2);
+
+            group_costs.push_back((kernel_arg.BlockEnd_ - kernel_arg.BlockStart_) * K);
+        }
+
+        std::vector<KernelArg> ordered_kernel_args;
+
+        ordered_kernel_args.reserve(kernel_args.size());
+
+        index_t item_begin = 0;
+
+        for(const index_t g : MakeLargestFirstGroupOrder(group_costs))
+        {
+            auto kernel_arg = kernel_args[g];
+
+            const index_t tile_count = kernel_arg.BlockEnd_ - kernel_arg.BlockStart_;
+
+            kernel_arg.BlockStart_                    = item_begin;
+            kernel_arg.BlockEnd_                      = item_begin + tile_count;
+            kernel_arg.block_2_etile_map_.BlockStart_ = item_begin;
+
+            item_begin += tile_count;
+
+            ordered_kernel_args.push_back(kernel_arg);
+        }
+
+        return ordered_kernel_args;
+    }
+
+    // Invoker
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            bool has_main_k_block_loop = true;
+
+            for(const auto& kernel_arg : arg.gemm_desc_kernel_arg_)
+            {
+                if(!GridwiseGemm::CheckValidity(kernel_arg.a_grid_desc_m_k_,
+                                                kernel_arg.b_grid_desc_n_k_,
+                                                kernel_arg.ds_grid_desc_m_n_,
+                                                kernel_arg.e_grid_desc_m_n_,
+                                                kernel_arg.block_2_etile_map_))
+                {
+                    throw std::runtime_error(
+                        "wrong! GridwiseGemmMultipleD_xdl_cshuffle has invalid setting");
+                }
+
+                const auto K = kernel_arg.a_grid_desc_ak0_m_ak1_.GetLength(I0) *
+                               kernel_arg.a_grid_desc_ak0_m_ak1_.GetLength(I2);
+
+                if(GridwiseGemm::CalculateHasMainKBlockLoop(K) != has_main_k_block_loop)
+                {
+                    throw std::runtime_error("wrong! not all gemm has_main_k_block_loop");
+                }
+            }
+
+            const auto ordered_kernel_args = MakeQueueOrderedKernelArgs(arg);
+
+            // the tiles of the groups skipped by the argument are not queued
+            const index_t group_count = ordered_kernel_args.size();
+            const index_t tile_count =
+                ordered_kernel_args.empty() ? 0 : ordered_kernel_args.back().BlockEnd_;
+
+            if(tile_count == 0)
+            {
+                return 0;
+            }
+
+            if(arg.p_workspace_ == nullptr)
+                throw std::runtime_error("wrong! WorkSpace pointer has not been set");
+
+            uint32_t* p_work_queue_counters = GetWorkQueueCounters(arg);
+
+            hip_check_error(hipMemcpyWithStream(arg.p_workspace_,
+                                                ordered_kernel_args.data(),
+                                                ordered_kernel_args.size() * sizeof(KernelArg),
+                                                hipMemcpyHostToDevice,
+                                                stream_config.stream_id_));
+
+            // zeroed on the stream of the launch, the workspace may have been used by another
+            // argument or by an aborted launch since. The repeated launches of the timing loop
+            // find them zeroed by the kernel itself, see PersistentWorkQueue::Finish
+            hip_check_error(hipMemsetAsync(p_work_queue_counters,
+                                           0,
+                                           PersistentWorkQueue::GetCounterSize(),
+                                           stream_config.stream_id_));
+
+            auto launch_kernel = [&](auto has_main_k_block_loop_) {
+                const auto kernel = kernel_grouped_gemm_xdl_persistent<GridwiseGemm,
+                                                                       KernelArg,
+                                                                       AElementwiseOperation,
+                                                                       BElementwiseOperation,
+                                                                       CDEElementwiseOperation,
+                                                                       has_main_k_block_loop_>;
+
+                // about as many workgroups as can be resident at once
+                int occupancy = 1;
+
+                hip_check_error(
+                    hipOccupancyMaxActiveBlocksPerMultiprocessor(&occupancy, kernel, BlockSize, 0));
+
+                const index_t max_grid_size = get_device_cu_count() * math::max(occupancy, 1);
+
+                const index_t grid_size =
+                    max_grid_size > 0 ? math::min(max_grid_size, tile_count) : tile_count;
+
+                return launch_and_time_kernel(
+                    stream_config,
+                    kernel,
+                    dim3(grid_size),
+                    dim3(BlockSize),
+                    0,
+                    cast_pointer_to_constant_address_space(arg.p_workspace_),
+                    group_count,
+                    tile_count,
+                    p_work_queue_counters,
+                    arg.a_element_op_,
+                    arg.b_element_op_,
+                    arg.c_element_op_);
+            };
+
+            if(has_main_k_block_loop)
+            {
+                return launch_kernel(integral_constant<bool, true>{});
+            }
+            else
+            {
+                return launch_kernel(integral_constant<bool, false>{});
+            }
+        }
+
+        // polymorphic
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        }
+    };
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    // polymorphic
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    // polymorphic
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceGroupedGemm_Xdl_Persistent"
+            << "<"
+            << BlockSize << ", "
+            << MPerBlock << ", "
+            << NPerBlock << ", "
+            << KPerBlock << ", "
+            << AK1 << ", "
+            << BK1 << ", "
+            << MPerXDL << ", "
+            << NPerXDL << ", "
+            << MXdlPerWave << ", "
+            << NXdlPerWave << ", "
+            << ABlockTransferSrcScalarPerVector << ", "
+            << BBlockTransferSrcScalarPerVector << ", "
+            << CShuffleMXdlPerWavePerShuffle << ", "
+            << CShuffleNXdlPerWavePerShuffle << ", "
+            << getGemmSpecializationString(GemmSpec)
+            << ">";
+        // clang-format on
+
+        return str.str();
+    }
+
+    size_t GetWorkSpaceSize(const BaseArgument* p_arg) const override
+    {
+        return GetWorkQueueOffset(dynamic_cast<const Argument*>(p_arg)->group_count_) +
+               PersistentWorkQueue::GetCounterSize();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_segmented_reduce.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_segmented_reduction.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorSize,
+          index_t OutDstVectorSize>
+struct DeviceSegmentedReduceImpl : public DeviceSegmentedReduce<InDataType,
+                                                                AccDataType,
+                                                                OutDataType,
+                                                                ReduceOperation,
+                                                                InElementwiseOperation,
+                                                                AccElementwiseOperation,
+                                                                PropagateNan>
+{
+    static_assert(BlockSize == MThreadClusterSize * KThreadClusterSize,
+                  "Invalid thread cluster size assignments!");
+
+    static constexpr index_t M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr index_t K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    using GridwiseReduce = GridwiseSegmentedReduction_mk_to_m<InDataType,
+                                                              OutDataType,
+                                                              AccDataType,
+                                                              ReduceOperation,
+                                                              InElementwiseOperation,
+                                                              AccElementwiseOperation,
+                                                              PropagateNan,
+                                                              BlockSize,
+                                                              MThreadClusterSize,
+                                                              KThreadClusterSize,
+                                                              MThreadSliceSize,
+                                                              KThreadSliceSize,
+                                                              InSrcVectorSize,
+                                                              OutDstVectorSize>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(index_t numSegments,
+                 index_t innerLength,
+                 const index_t* offsets_dev,
+                 double alpha,
+                 double beta,
+                 const InDataType* in_dev,
+                 OutDataType* out_dev,
+                 const InElementwiseOperation in_elementwise_op,
+                 const AccElementwiseOperation acc_elementwise_op)
+            : numSegments_{numSegments},
+              innerLength_{innerLength},
+              offsets_dev_{offsets_dev},
+              in_dev_{in_dev},
+              out_dev_{out_dev},
+              in_elementwise_op_{in_elementwise_op},
+              acc_elementwise_op_{acc_elementwise_op}
+        {
+            alpha_ = type_convert<AccDataType>(alpha);
+            beta_  = type_convert<AccDataType>(beta);
+
+            numMBlockTiles = math::integer_divide_ceil(innerLength, M_BlockTileSize);
+
+            gridSize = static_cast<size_t>(numSegments) * numMBlockTiles;
+        }
+
+        index_t numSegments_;
+        index_t innerLength_;
+        const index_t* offsets_dev_;
+
+        AccDataType alpha_;
+        AccDataType beta_;
+
+        const InDataType* in_dev_;
+        OutDataType* out_dev_;
+
+        InElementwiseOperation in_elementwise_op_;
+        AccElementwiseOperation acc_elementwise_op_;
+
+        index_t numMBlockTiles;
+        size_t gridSize;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto kernel_main = kernel_segmented_reduce<GridwiseReduce,
+                                                             InDataType,
+                                                             OutDataType,
+                                                             AccDataType,
+                                                             InElementwiseOperation,
+                                                             AccElementwiseOperation>;
+
+            float avg_time = 0;
+
+            avg_time += launch_and_time_kernel(stream_config,
+                                               kernel_main,
+                                               dim3(arg.gridSize),
+                                               dim3(BlockSize),
+                                               0,
+                                               arg.numMBlockTiles,
+                                               arg.innerLength_,
+                                               arg.offsets_dev_,
+                                               arg.in_elementwise_op_,
+                                               arg.acc_elementwise_op_,
+                                               arg.alpha_,
+                                               arg.in_dev_,
+                                               arg.beta_,
+                                               arg.out_dev_);
+
+            return (avg_time);
+        };
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        };
+    };
+
+    static bool IsSupportedArgument(const Argument* pArg)
+    {
+        if(pArg->numSegments_ <= 0 || pArg->innerLength_ <= 0)
+            return (false);
+
+        // every segment starts at a multiple of innerLength, so the vector accesses of a row are
+        // aligned as long as innerLength is a multiple of the vector size
+        if(pArg->innerLength_ % InSrcVectorSize != 0)
+            return (false);
+
+        if(pArg->innerLength_ % OutDstVectorSize != 0)
+            return (false);
+
+        return (true);
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(dynamic_cast<const Argument*>(p_arg));
+    };
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(index_t numSegments,
+                        index_t innerLength,
+                        const index_t* offsets_dev,
+                        double alpha,
+                        double beta,
+                        const void* in_dev,
+                        void* out_dev,
+                        const InElementwiseOperation in_elementwise_op,
+                        const AccElementwiseOperation acc_elementwise_op) override
+    {
+        return std::make_unique<Argument>(numSegments,
+                                          innerLength,
+                                          offsets_dev,
+                                          alpha,
+                                          beta,
+                                          static_cast<const InDataType*>(in_dev),
+                                          static_cast<OutDataType*>(out_dev),
+                                          in_elementwise_op,
+                                          acc_elementwise_op);
+    };
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    };
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceSegmentedReduce<" << BlockSize << ",";
+        str << "M_C" << MThreadClusterSize << "_S" << MThreadSliceSize << ",";
+        str << "K_C" << KThreadClusterSize << "_S" << KThreadSliceSize << ",";
+        str << "InSrcVectorSize_" << InSrcVectorSize << "_OutDstVectorSize_" << OutDstVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
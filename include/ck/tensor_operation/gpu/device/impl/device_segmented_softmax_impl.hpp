@@ -0,0 +1,185 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_segmented_softmax.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_segmented_softmax.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// The rows are read along M (their contiguous dimension) and every segment is swept three times,
+// as the segment lengths are only known on the device
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          index_t BlockSize,
+          index_t MThreadClusterSize,
+          index_t KThreadClusterSize,
+          index_t MThreadSliceSize,
+          index_t KThreadSliceSize,
+          index_t InSrcVectorSize,
+          index_t OutDstVectorSize>
+struct DeviceSegmentedSoftmaxImpl
+    : public DeviceSegmentedSoftmax<InDataType, AccDataType, OutDataType>
+{
+    static_assert(BlockSize == MThreadClusterSize * KThreadClusterSize,
+                  "Invalid thread cluster size assignments!");
+
+    static constexpr index_t M_BlockTileSize = MThreadClusterSize * MThreadSliceSize;
+    static constexpr index_t K_BlockTileSize = KThreadClusterSize * KThreadSliceSize;
+
+    using GridDesc_M_K =
+        decltype(MakeSegmentDescriptor_M_K<M_BlockTileSize, K_BlockTileSize>(1, 1));
+
+    using GridwiseSoftmax = GridwiseSoftmax_mk_to_mk<InDataType,
+                                                     OutDataType,
+                                                     AccDataType,
+                                                     GridDesc_M_K,
+                                                     BlockSize,
+                                                     MThreadClusterSize,
+                                                     KThreadClusterSize,
+                                                     MThreadSliceSize,
+                                                     KThreadSliceSize,
+                                                     0, // InSrcVectorDim
+                                                     InSrcVectorSize,
+                                                     OutDstVectorSize,
+                                                     false>;
+
+    struct Argument : public BaseArgument
+    {
+        Argument(index_t numSegments,
+                 index_t innerLength,
+                 const index_t* offsets_dev,
+                 double alpha,
+                 double beta,
+                 const InDataType* in_dev,
+                 OutDataType* out_dev)
+            : numSegments_{numSegments},
+              innerLength_{innerLength},
+              offsets_dev_{offsets_dev},
+              in_dev_{in_dev},
+              out_dev_{out_dev}
+        {
+            alpha_ = type_convert<AccDataType>(alpha);
+            beta_  = type_convert<AccDataType>(beta);
+
+            numMBlockTiles = math::integer_divide_ceil(innerLength, M_BlockTileSize);
+
+            gridSize = static_cast<size_t>(numSegments) * numMBlockTiles;
+        }
+
+        index_t numSegments_;
+        index_t innerLength_;
+        const index_t* offsets_dev_;
+
+        AccDataType alpha_;
+        AccDataType beta_;
+
+        const InDataType* in_dev_;
+        OutDataType* out_dev_;
+
+        index_t numMBlockTiles;
+        size_t gridSize;
+    };
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto kernel_main =
+                kernel_segmented_softmax<GridwiseSoftmax, InDataType, OutDataType, AccDataType>;
+
+            float avg_time = 0;
+
+            avg_time += launch_and_time_kernel(stream_config,
+                                               kernel_main,
+                                               dim3(arg.gridSize),
+                                               dim3(BlockSize),
+                                               0,
+                                               arg.numMBlockTiles,
+                                               arg.innerLength_,
+                                               arg.offsets_dev_,
+                                               arg.alpha_,
+                                               arg.in_dev_,
+                                               arg.beta_,
+                                               arg.out_dev_);
+
+            return (avg_time);
+        };
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        };
+    };
+
+    static bool IsSupportedArgument(const Argument& arg)
+    {
+        if(arg.numSegments_ <= 0 || arg.innerLength_ <= 0)
+            return false;
+
+        if(arg.innerLength_ % InSrcVectorSize != 0)
+            return false;
+
+        if(arg.innerLength_ % OutDstVectorSize != 0)
+            return false;
+
+        return true;
+    };
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(*dynamic_cast<const Argument*>(p_arg));
+    }
+
+    std::unique_ptr<BaseArgument> MakeArgumentPointer(index_t numSegments,
+                                                      index_t innerLength,
+                                                      const index_t* offsets_dev,
+                                                      double alpha,
+                                                      double beta,
+                                                      const void* in_dev,
+                                                      void* out_dev) override
+    {
+        return std::make_unique<Argument>(numSegments,
+                                          innerLength,
+                                          offsets_dev,
+                                          alpha,
+                                          beta,
+                                          static_cast<const InDataType*>(in_dev),
+                                          static_cast<OutDataType*>(out_dev));
+    };
+
+    std::unique_ptr<BaseInvoker> MakeInvokerPointer() override
+    {
+        return std::make_unique<Invoker>();
+    };
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceSegmentedSoftmax<" << BlockSize << ",";
+        str << "M_C" << MThreadClusterSize << "_S" << MThreadSliceSize << ",";
+        str << "K_C" << KThreadClusterSize << "_S" << KThreadSliceSize << ",";
+        str << "InSrcVectorSize_" << InSrcVectorSize << "_OutDstVectorSize_" << OutDstVectorSize << ">";
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
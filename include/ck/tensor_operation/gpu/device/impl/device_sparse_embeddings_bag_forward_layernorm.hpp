@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/host_utility/kernel_launch.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/embedding_bag_pooling_mode.hpp"
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_sparse_embeddings_bag_forward_layernorm.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// EmbeddingBag-style lookup over NumEmbeddings tables fused with layernorm:
+//   pooled_i[b] = pool_{j in [offsets_i[b], offsets_i[b + 1])} w_i[j] * emb_i[indexes_i[j]]
+//   out[b]      = layernorm(EmbElementwiseOperation(pooled_0[b], ..., pooled_{n-1}[b]))
+// where pool is either sum or mean. offsets_i holds NumBags + 1 entries, a bag may be empty, and
+// the per-sample weights w_i of a table are optional (nullptr means unweighted)
+template <typename EmbType,
+          typename IndexType,
+          typename WeightDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          typename EmbElementwiseOperation,
+          ck::index_t BlockSize,
+          ck::index_t DimClusterSize,
+          ck::index_t RowClusterSize,
+          ck::index_t DimPerBlock,
+          ck::index_t RowPerBlock,
+          ck::index_t DimThreadSize,
+          ck::index_t RowVectorSize,
+          ck::index_t NumEmbeddings>
+struct DeviceSparseEmbeddingsBagForwardLayernorm : public BaseOperator
+{
+    struct Argument : public BaseArgument
+    {
+        Argument(OutType* p_out,
+                 const ck::Array<EmbType*, NumEmbeddings>& p_embs,
+                 const ck::Array<IndexType*, NumEmbeddings>& p_indexs,
+                 const ck::Array<IndexType*, NumEmbeddings>& p_offsets,
+                 const ck::Array<WeightDataType*, NumEmbeddings>& p_per_sample_weights,
+                 const GammaDataType* p_gamma,
+                 const BetaDataType* p_beta,
+                 const ck::index_t EmbeddingDim,
+                 const ck::index_t NumBags,
+                 const EmbeddingBagPoolingMode pooling_mode,
+                 const AccDataType epsilon,
+                 const EmbElementwiseOperation emb_elementwise_op)
+            : p_out_(p_out),
+              p_embs_(p_embs),
+              p_indexs_(p_indexs),
+              p_offsets_(p_offsets),
+              p_per_sample_weights_(p_per_sample_weights),
+              p_gamma_(p_gamma),
+              p_beta_(p_beta),
+              EmbeddingDim_(EmbeddingDim),
+              NumBags_(NumBags),
+              pooling_mode_(pooling_mode),
+              epsilon_(epsilon),
+              emb_elementwise_op_(emb_elementwise_op)
+        {
+            grid_size_ = (NumBags + DimPerBlock - 1) / DimPerBlock;
+        }
+
+        OutType* p_out_;
+        ck::Array<EmbType*, NumEmbeddings> p_embs_;
+        ck::Array<IndexType*, NumEmbeddings> p_indexs_;
+        ck::Array<IndexType*, NumEmbeddings> p_offsets_;
+        ck::Array<WeightDataType*, NumEmbeddings> p_per_sample_weights_;
+        const GammaDataType* p_gamma_;
+        const BetaDataType* p_beta_;
+        ck::index_t EmbeddingDim_;
+        ck::index_t NumBags_;
+        EmbeddingBagPoolingMode pooling_mode_;
+        AccDataType epsilon_;
+        EmbElementwiseOperation emb_elementwise_op_;
+
+        size_t grid_size_;
+    };
+
+    std::unique_ptr<BaseArgument>
+    MakeArgumentPointer(void* p_out,
+                        const ck::Array<EmbType*, NumEmbeddings>& p_embs,
+                        const ck::Array<IndexType*, NumEmbeddings>& p_indexs,
+                        const ck::Array<IndexType*, NumEmbeddings>& p_offsets,
+                        const ck::Array<WeightDataType*, NumEmbeddings>& p_per_sample_weights,
+                        const void* p_gamma,
+                        const void* p_beta,
+                        ck::index_t EmbeddingDim,
+                        ck::index_t NumBags,
+                        const EmbeddingBagPoolingMode pooling_mode,
+                        const AccDataType epsilon,
+                        const EmbElementwiseOperation emb_elementwise_op)
+    {
+        return std::make_unique<Argument>(reinterpret_cast<OutType*>(p_out),
+                                          p_embs,
+                                          p_indexs,
+                                          p_offsets,
+                                          p_per_sample_weights,
+                                          reinterpret_cast<const GammaDataType*>(p_gamma),
+                                          reinterpret_cast<const BetaDataType*>(p_beta),
+                                          EmbeddingDim,
+                                          NumBags,
+                                          pooling_mode,
+                                          epsilon,
+                                          emb_elementwise_op);
+    }
+
+    using GridwiseSparseEmbeddingsBag =
+        GridwiseSparseEmbeddingsBagForwardLayernorm<EmbType,
+                                                    IndexType,
+                                                    WeightDataType,
+                                                    GammaDataType,
+                                                    BetaDataType,
+                                                    AccDataType,
+                                                    OutType,
+                                                    EmbElementwiseOperation,
+                                                    BlockSize,
+                                                    DimClusterSize,
+                                                    RowClusterSize,
+                                                    DimPerBlock,
+                                                    RowPerBlock,
+                                                    DimThreadSize,
+                                                    RowVectorSize,
+                                                    NumEmbeddings>;
+
+    struct Invoker : public BaseInvoker
+    {
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            const auto kernel_main =
+                kernel_sparse_embeddings_bag_forward_layernorm<GridwiseSparseEmbeddingsBag,
+                                                               EmbType,
+                                                               IndexType,
+                                                               WeightDataType,
+                                                               GammaDataType,
+                                                               BetaDataType,
+                                                               AccDataType,
+                                                               OutType,
+                                                               EmbElementwiseOperation,
+                                                               NumEmbeddings>;
+            float avg_time = 0;
+            avg_time += launch_and_time_kernel(stream_config,
+                                               kernel_main,
+                                               dim3(arg.grid_size_),
+                                               dim3(BlockSize),
+                                               0,
+                                               arg.p_out_,
+                                               arg.p_embs_,
+                                               arg.p_indexs_,
+                                               arg.p_offsets_,
+                                               arg.p_per_sample_weights_,
+                                               arg.p_gamma_,
+                                               arg.p_beta_,
+                                               arg.NumBags_,
+                                               arg.pooling_mode_,
+                                               arg.epsilon_,
+                                               arg.emb_elementwise_op_);
+
+            return (avg_time);
+        }
+
+        float Run(const BaseArgument* p_arg,
+                  const StreamConfig& stream_config = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg), stream_config);
+        };
+    };
+
+    static bool IsSupportedArgument(const Argument* p_arg)
+    {
+        if(RowPerBlock != p_arg->EmbeddingDim_)
+            return false;
+
+        // same as torch.nn.EmbeddingBag, per-sample weights only make sense for sum pooling
+        if(p_arg->pooling_mode_ != EmbeddingBagPoolingMode::Sum)
+        {
+            for(index_t i = 0; i < NumEmbeddings; ++i)
+                if(p_arg->p_per_sample_weights_[i] != nullptr)
+                    return false;
+        }
+
+        return true;
+    }
+
+    bool IsSupportedArgument(const BaseArgument* p_arg) override
+    {
+        return IsSupportedArgument(dynamic_cast<const Argument*>(p_arg));
+    }
+
+    virtual std::unique_ptr<BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>();
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "DeviceSparseEmbeddingsBagForwardLayernorm_"<< BlockSize << "_" <<
+            DimClusterSize << "x" << RowClusterSize << "_" <<
+            DimPerBlock << "x" << RowPerBlock << "_" <<
+            DimThreadSize << "x" << RowVectorSize << "_" <<
+            NumEmbeddings;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/functional2.hpp"
+#include "ck/utility/math.hpp"
+#include "ck/utility/tuple.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace element_wise {
+
+// Stages of a Compose<> epilogue. Every stage updates the running value in float, and declares
+// with NumDTensor how many of the D operands it consumes (0 or 1), in order
+namespace stage {
+
+// y = x + d
+struct Add
+{
+    static constexpr index_t NumDTensor = 1;
+
+    __host__ __device__ constexpr float operator()(float x, float d) const { return x + d; }
+};
+
+// y = x - d
+struct Sub
+{
+    static constexpr index_t NumDTensor = 1;
+
+    __host__ __device__ constexpr float operator()(float x, float d) const { return x - d; }
+};
+
+// y = x * d
+struct Mul
+{
+    static constexpr index_t NumDTensor = 1;
+
+    __host__ __device__ constexpr float operator()(float x, float d) const { return x * d; }
+};
+
+// y = scale * x
+struct Scale
+{
+    static constexpr index_t NumDTensor = 0;
+
+    __host__ __device__ constexpr Scale(float scale = 1.f) : scale_(scale) {}
+
+    __host__ __device__ constexpr float operator()(float x) const { return scale_ * x; }
+
+    float scale_;
+};
+
+// y = max(x, 0)
+struct Relu
+{
+    static constexpr index_t NumDTensor = 0;
+
+    __host__ __device__ constexpr float operator()(float x) const { return x > 0 ? x : 0; }
+};
+
+// y = min(max(x, lowerbound), upperbound), defaults to the int8 range for requantization
+struct Clamp
+{
+    static constexpr index_t NumDTensor = 0;
+
+    __host__ __device__ constexpr Clamp(float lowerbound = -128.f, float upperbound = 127.f)
+        : lowerbound_(lowerbound), upperbound_(upperbound)
+    {
+    }
+
+    __host__ __device__ constexpr float operator()(float x) const
+    {
+        return math::clamp(x, lowerbound_, upperbound_);
+    }
+
+    float lowerbound_;
+    float upperbound_;
+};
+
+// any unary element-wise op with a float -> float overload, e.g. FastGelu, Sigmoid, Swish
+template <typename UnaryOp>
+struct Unary
+{
+    static constexpr index_t NumDTensor = 0;
+
+    __host__ __device__ constexpr Unary(UnaryOp op = UnaryOp{}) : op_(op) {}
+
+    __host__ __device__ float operator()(float x) const
+    {
+        float y;
+
+        op_(y, x);
+
+        return y;
+    }
+
+    UnaryOp op_;
+};
+
+// any binary element-wise op with a float, float -> float overload, e.g. Bilinear
+template <typename BinaryOp>
+struct Binary
+{
+    static constexpr index_t NumDTensor = 1;
+
+    __host__ __device__ constexpr Binary(BinaryOp op = BinaryOp{}) : op_(op) {}
+
+    __host__ __device__ float operator()(float x, float d) const
+    {
+        float y;
+
+        op_(y, x, d);
+
+        return y;
+    }
+
+    BinaryOp op_;
+};
+
+} // namespace stage
+
+// Element-wise op built from a chain of stages, applied left to right:
+//   E = StageN(...Stage1(Stage0(C, [D0]), [D1])...)
+// where each binary stage consumes the next D operand. Values are converted to float on entry
+// and converted to E once at the end, so
+//   Compose<stage::Add, stage::Add, stage::Unary<FastGelu>> == AddAddFastGelu
+//   Compose<stage::Add, stage::Relu, stage::Mul, stage::Clamp>
+// can be used as the CDE op of DeviceGemmMultipleD, or as the op of DeviceElementwise with the
+// first input in place of C. The same functor runs on host, so the reference of every
+// composition comes for free, see ReferenceGemmMultipleD
+template <typename... Stages>
+struct Compose
+{
+    static_assert(sizeof...(Stages) > 0, "wrong! no stage");
+
+    static_assert(((Stages::NumDTensor == 0 || Stages::NumDTensor == 1) && ...),
+                  "wrong! a stage consumes at most one D operand");
+
+    static constexpr index_t NumStage   = sizeof...(Stages);
+    static constexpr index_t NumDTensor = (Stages::NumDTensor + ...);
+
+    __host__ __device__ constexpr Compose() = default;
+
+    __host__ __device__ constexpr Compose(Stages... stages) : stages_(stages...) {}
+
+    // index of the first D operand consumed by the I-th stage
+    template <index_t I>
+    __host__ __device__ static constexpr index_t GetDOffset()
+    {
+        constexpr index_t num_d[NumStage] = {Stages::NumDTensor...};
+
+        index_t offset = 0;
+
+        for(index_t i = 0; i < I; ++i)
+        {
+            offset += num_d[i];
+        }
+
+        return offset;
+    }
+
+    template <typename E, typename C, typename... Ds>
+    __host__ __device__ void operator()(E& e, const C& c, const Ds&... ds) const
+    {
+        static_assert(sizeof...(Ds) == NumDTensor,
+                      "wrong! number of D operands does not match the stages");
+
+        const auto d = make_tuple(type_convert<float>(ds)...);
+
+        float x = type_convert<float>(c);
+
+        static_for<0, NumStage, 1>{}([&](auto i) {
+            const auto& op = stages_.At(i);
+
+            using Stage = remove_cvref_t<decltype(op)>;
+
+            if constexpr(Stage::NumDTensor == 0)
+            {
+                x = op(x);
+            }
+            else
+            {
+                x = op(x, d.At(Number<GetDOffset<decltype(i)::value>()>{}));
+            }
+        });
+
+        e = type_convert<E>(x);
+    }
+
+    Tuple<Stages...> stages_;
+};
+
+// Epilogues of scaled (e.g. FP8) GEMMs, the result is converted to E with type_convert
+//   ScaleTensor: E = scale * C, with scale = scale_a * scale_b
+//   ScaleRowCol: E = C * D0 * D1, with D0[m] the per-row scale of A and D1[n] the per-column
+//                scale of B, both broadcast with a stride of 0
+using ScaleTensor = Compose<stage::Scale>;
+using ScaleRowCol = Compose<stage::Mul, stage::Mul>;
+
+} // namespace element_wise
+} // namespace tensor_operation
+} // namespace ck
@@ -8,6 +8,7 @@
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/element/binary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/element/quantization_operation.hpp"
+#include "ck/tensor_operation/gpu/element/compose_element_wise_operation.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -159,6 +160,31 @@ struct AddAdd
     }
 };
 
+// E = C + D0 + ... + Dn, for an arbitrary number of Ds
+struct AddN
+{
+    template <typename E, typename C, typename... Ds>
+    __host__ __device__ void operator()(E& e, const C& c, const Ds&... ds) const
+    {
+        // Only support floating so far
+        static_assert(is_same<E, half_t>::value || is_same<E, float>::value ||
+                          is_same<E, double>::value,
+                      "Data type is not supported by this operation!");
+
+        static_assert(is_same<C, half_t>::value || is_same<C, float>::value ||
+                          is_same<C, double>::value,
+                      "Data type is not supported by this operation!");
+
+        static_assert(((is_same<Ds, half_t>::value || is_same<Ds, float>::value ||
+                        is_same<Ds, double>::value) &&
+                       ...),
+                      "Data type is not supported by this operation!");
+
+        const C y = (c + ... + type_convert<C>(ds));
+        e         = type_convert<E>(y);
+    }
+};
+
 // C = A * B
 // E = (C + D0) x D1
 struct AddMultiply
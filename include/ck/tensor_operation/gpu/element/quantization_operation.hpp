@@ -281,6 +281,52 @@ struct Add_Mul2_Activation_Mul_Clamp
     Activation activationOp_;
 };
 
+// Conv Perchannel quantization + residual add + Activation function which is piecewise linear
+// function, such as relu, leaky relu ...etc, e.g. the last conv of a ResNet block
+// Z = Activation(W @ X + B + R)
+// Where R = Sr * Qr is the residual, quantized with its own scale Sr
+// Sz * Qz = Activation(Sacc * (Qw @ Qx + Qb) + Sr * Qr)
+// Qz = Activation(requantScale * (Qw @ Qx + Qb) + residualScale * Qr)
+// Where requantScale = Sacc / Sz (per channel), residualScale = Sr / Sz
+// Qz and Qr are either int8 or fp8, fp8 is clamped to its largest finite value
+template <typename Activation>
+struct Add_Mul2_Add_Activation_Clamp
+{
+    Add_Mul2_Add_Activation_Clamp(float residualScale, Activation activationOp)
+        : residualScale_(residualScale), activationOp_(activationOp)
+    {
+    }
+
+    __host__ __device__ constexpr void operator()(int8_t& y,
+                                                  const int32_t& x,
+                                                  const int32_t& bias,
+                                                  const float& requantScale,
+                                                  const int8_t& residual) const
+    {
+        float y_fp32 = ck::type_convert<float>(x + bias);
+        y_fp32       = requantScale * y_fp32 + residualScale_ * ck::type_convert<float>(residual);
+        activationOp_(y_fp32, y_fp32);
+        y_fp32 = math::clamp(y_fp32, -128.f, 127.f);
+        y      = ck::type_convert<int8_t>(y_fp32);
+    }
+
+    __host__ __device__ constexpr void operator()(f8_t& y,
+                                                  const int32_t& x,
+                                                  const int32_t& bias,
+                                                  const float& requantScale,
+                                                  const f8_t& residual) const
+    {
+        float y_fp32 = ck::type_convert<float>(x + bias);
+        y_fp32       = requantScale * y_fp32 + residualScale_ * ck::type_convert<float>(residual);
+        activationOp_(y_fp32, y_fp32);
+        y_fp32 = math::clamp(y_fp32, -240.f, 240.f);
+        y      = ck::type_convert<f8_t>(y_fp32);
+    }
+
+    float residualScale_;
+    Activation activationOp_;
+};
+
 } // namespace element_wise
 } // namespace tensor_operation
 } // namespace ck
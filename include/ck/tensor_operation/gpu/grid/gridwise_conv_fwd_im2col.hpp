@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+
+// Sizes of a forward convolution whose input is unfolded into the im2col matrix
+// [G, N * Ho * Wo, Z * Y * X * C], the filter position being slower than C in GemmK
+template <index_t NDimSpatial>
+struct ConvFwdIm2ColProblem
+{
+    index_t G_;
+    index_t C_;
+    index_t GemmK_;
+    index_t NumFilterPosition_;
+    index_t InputLengths_[NDimSpatial];
+    index_t OutputLengths_[NDimSpatial];
+    index_t FilterLengths_[NDimSpatial];
+    index_t ConvStrides_[NDimSpatial];
+    index_t ConvDilations_[NDimSpatial];
+    index_t LeftPads_[NDimSpatial];
+};
+
+template <typename GridwiseIm2Col,
+          index_t NDimSpatial,
+          typename ADataType,
+          typename AElementwiseOperation>
+__global__ void
+kernel_conv_fwd_im2col(const ADataType* __restrict__ p_a_grid,
+                       ADataType* __restrict__ p_im2col_grid,
+                       const ConvFwdIm2ColProblem<NDimSpatial> problem,
+                       const Array<index_t, NDimSpatial + 3> a_g_n_c_wis_strides,
+                       const index_t m_begin,
+                       const index_t m_size,
+                       const AElementwiseOperation a_element_op)
+{
+    GridwiseIm2Col::Run(
+        p_a_grid, p_im2col_grid, problem, a_g_n_c_wis_strides, m_begin, m_size, a_element_op);
+}
+
+// Unfolds the rows [m_begin, m_begin + m_size) of the im2col matrix into the packed matrix
+// [G, m_size, GemmK], with one thread per CPerThread consecutive channels of a group, row and
+// filter position. The padding is written as zeros. The strides of the input are in
+// [G, N, C, spatial] order.
+template <index_t NDimSpatial,
+          typename ADataType,
+          typename AElementwiseOperation,
+          index_t BlockSize,
+          index_t CPerThread>
+struct GridwiseConvFwdIm2Col
+{
+    __device__ static void Run(const ADataType* __restrict__ p_a_grid,
+                               ADataType* __restrict__ p_im2col_grid,
+                               const ConvFwdIm2ColProblem<NDimSpatial>& problem,
+                               const Array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+                               index_t m_begin,
+                               index_t m_size,
+                               const AElementwiseOperation& a_element_op)
+    {
+        const index_t num_c_thread = problem.C_ / CPerThread;
+
+        const index_t id = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        if(id >= problem.G_ * m_size * problem.NumFilterPosition_ * num_c_thread)
+            return;
+
+        const index_t c0 = (id % num_c_thread) * CPerThread;
+
+        index_t tmp = id / num_c_thread;
+
+        const index_t filter_position = tmp % problem.NumFilterPosition_;
+
+        tmp /= problem.NumFilterPosition_;
+
+        const index_t m = tmp % m_size;
+        const index_t g = tmp / m_size;
+
+        // N, Wo... from the row, X... from the filter position, the last ones being the fastest
+        index_t mo = m_begin + m;
+        index_t fx = filter_position;
+
+        long_index_t a_offset = g * static_cast<long_index_t>(a_g_n_c_wis_strides[0]) +
+                                c0 * static_cast<long_index_t>(a_g_n_c_wis_strides[2]);
+
+        bool is_valid = true;
+
+        static_for<0, NDimSpatial, 1>{}([&](auto j) {
+            constexpr index_t i = NDimSpatial - 1 - j.value;
+
+            const index_t o = mo % problem.OutputLengths_[i];
+            const index_t x = fx % problem.FilterLengths_[i];
+
+            mo /= problem.OutputLengths_[i];
+            fx /= problem.FilterLengths_[i];
+
+            const index_t wi = o * problem.ConvStrides_[i] + x * problem.ConvDilations_[i] -
+                               problem.LeftPads_[i];
+
+            is_valid = is_valid && wi >= 0 && wi < problem.InputLengths_[i];
+
+            a_offset += wi * static_cast<long_index_t>(a_g_n_c_wis_strides[i + 3]);
+        });
+
+        a_offset += mo * static_cast<long_index_t>(a_g_n_c_wis_strides[1]);
+
+        const long_index_t im2col_offset =
+            (static_cast<long_index_t>(g) * m_size + m) * problem.GemmK_ +
+            filter_position * problem.C_ + c0;
+
+        static_for<0, CPerThread, 1>{}([&](auto c) {
+            ADataType a = 0;
+
+            if(is_valid)
+            {
+                a_element_op(a, p_a_grid[a_offset + c * a_g_n_c_wis_strides[2]]);
+            }
+
+            p_im2col_grid[im2col_offset + c] = a;
+        });
+    }
+};
+
+} // namespace ck
@@ -0,0 +1,323 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/thread/threadwise_winograd_transform.hpp"
+
+namespace ck {
+
+// Sizes of a 2D stride-1 3x3 forward convolution computed with F(m x m, 3 x 3), the output being
+// split into NumTileH_ x NumTileW_ tiles of m x m pixels per image
+struct ConvFwdWinogradProblem_2d
+{
+    index_t G_;
+    index_t N_;
+    index_t C_;
+    index_t K_;
+    index_t Hi_;
+    index_t Wi_;
+    index_t Ho_;
+    index_t Wo_;
+    index_t LeftPadH_;
+    index_t LeftPadW_;
+    index_t NumTileH_;
+    index_t NumTileW_;
+
+    __host__ __device__ constexpr index_t GetNumTile() const { return N_ * NumTileH_ * NumTileW_; }
+};
+
+template <typename GridwiseTransform,
+          typename BDataType,
+          typename ADataType,
+          typename BElementwiseOperation>
+__global__ void
+kernel_conv_fwd_winograd_filter_transform(const BDataType* __restrict__ p_b_grid,
+                                          ADataType* __restrict__ p_u_grid,
+                                          const ConvFwdWinogradProblem_2d problem,
+                                          const Array<index_t, 5> b_g_k_c_xs_strides,
+                                          const BElementwiseOperation b_element_op)
+{
+    GridwiseTransform::RunFilterTransform(
+        p_b_grid, p_u_grid, problem, b_g_k_c_xs_strides, b_element_op);
+}
+
+template <typename GridwiseTransform, typename ADataType, typename AElementwiseOperation>
+__global__ void
+kernel_conv_fwd_winograd_input_transform(const ADataType* __restrict__ p_a_grid,
+                                         ADataType* __restrict__ p_v_grid,
+                                         const ConvFwdWinogradProblem_2d problem,
+                                         const Array<index_t, 5> a_g_n_c_wis_strides,
+                                         const AElementwiseOperation a_element_op)
+{
+    GridwiseTransform::RunInputTransform(
+        p_a_grid, p_v_grid, problem, a_g_n_c_wis_strides, a_element_op);
+}
+
+template <typename GridwiseTransform,
+          typename AccDataType,
+          typename DsPointer,
+          typename EDataType,
+          typename CDEElementwiseOperation,
+          index_t NumDTensor>
+__global__ void
+kernel_conv_fwd_winograd_output_transform(const AccDataType* __restrict__ p_m_grid,
+                                          DsPointer p_ds_grid,
+                                          EDataType* __restrict__ p_e_grid,
+                                          const ConvFwdWinogradProblem_2d problem,
+                                          const Array<Array<index_t, 5>, NumDTensor>
+                                              ds_g_n_k_wos_strides,
+                                          const Array<index_t, 5> e_g_n_k_wos_strides,
+                                          const CDEElementwiseOperation cde_element_op)
+{
+    GridwiseTransform::RunOutputTransform(p_m_grid,
+                                          p_ds_grid,
+                                          p_e_grid,
+                                          problem,
+                                          ds_g_n_k_wos_strides,
+                                          e_g_n_k_wos_strides,
+                                          cde_element_op);
+}
+
+// Tile transforms of the Winograd forward convolution, with one thread per tile and channel. The
+// transformed tensors are packed with the channels innermost, so that both the transforms and the
+// batched GEMM between them access them contiguously:
+//   U[G, TileSize * TileSize, K, C]       transformed filter
+//   V[G, TileSize * TileSize, NumTile, C] transformed input
+//   M[G, TileSize * TileSize, NumTile, K] M = V * UT, one GEMM per group and tile element
+// The strides of the input/weight/output tensors are in [G, N, C, H, W] / [G, K, C, Y, X] /
+// [G, N, K, H, W] order. The tiles are transformed in AccDataType, the transformed input and filter
+// are stored in ADataType for the GEMM and M is kept in AccDataType
+template <index_t OutputTileSize,
+          typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CShuffleDataType,
+          typename DsDataType,
+          typename EDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CDEElementwiseOperation,
+          index_t BlockSize>
+struct GridwiseConvFwdWinogradTransform_2d
+{
+    using Transform = ThreadwiseWinogradTransform_3x3<OutputTileSize>;
+
+    static constexpr index_t FilterSize     = Transform::FilterSize;
+    static constexpr index_t TileSize       = Transform::TileSize;
+    static constexpr index_t NumTileElement = TileSize * TileSize;
+
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    static constexpr auto MakeDsGridPointer()
+    {
+        return generate_tuple(
+            [&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                return static_cast<const DDataType*>(nullptr);
+            },
+            Number<NumDTensor>{});
+    }
+
+    using DsGridPointer = decltype(MakeDsGridPointer());
+
+    __device__ static void RunFilterTransform(const BDataType* __restrict__ p_b_grid,
+                                              ADataType* __restrict__ p_u_grid,
+                                              const ConvFwdWinogradProblem_2d& problem,
+                                              const Array<index_t, 5>& b_g_k_c_xs_strides,
+                                              const BElementwiseOperation& b_element_op)
+    {
+        const index_t K = problem.K_;
+        const index_t C = problem.C_;
+
+        const index_t gkc = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        if(gkc >= problem.G_ * K * C)
+            return;
+
+        const index_t c = gkc % C;
+        const index_t k = (gkc / C) % K;
+        const index_t g = gkc / (C * K);
+
+        const long_index_t b_offset =
+            g * static_cast<long_index_t>(b_g_k_c_xs_strides[0]) +
+            k * static_cast<long_index_t>(b_g_k_c_xs_strides[1]) + c * b_g_k_c_xs_strides[2];
+
+        AccDataType wei[FilterSize][FilterSize];
+
+        static_for<0, FilterSize, 1>{}([&](auto y) {
+            static_for<0, FilterSize, 1>{}([&](auto x) {
+                BDataType b =
+                    p_b_grid[b_offset + y * b_g_k_c_xs_strides[3] + x * b_g_k_c_xs_strides[4]];
+
+                b_element_op(b, b);
+
+                wei[y][x] = type_convert<AccDataType>(b);
+            });
+        });
+
+        AccDataType u[TileSize][TileSize];
+
+        Transform::FilterTransform(wei, u);
+
+        const long_index_t u_offset =
+            (static_cast<long_index_t>(g) * NumTileElement * K + k) * C + c;
+        const long_index_t u_stride = static_cast<long_index_t>(K) * C;
+
+        static_for<0, TileSize, 1>{}([&](auto i) {
+            static_for<0, TileSize, 1>{}([&](auto j) {
+                p_u_grid[u_offset + (i * TileSize + j) * u_stride] =
+                    type_convert<ADataType>(u[i][j]);
+            });
+        });
+    }
+
+    __device__ static void RunInputTransform(const ADataType* __restrict__ p_a_grid,
+                                             ADataType* __restrict__ p_v_grid,
+                                             const ConvFwdWinogradProblem_2d& problem,
+                                             const Array<index_t, 5>& a_g_n_c_wis_strides,
+                                             const AElementwiseOperation& a_element_op)
+    {
+        const index_t C        = problem.C_;
+        const index_t num_tile = problem.GetNumTile();
+
+        const index_t gpc = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        if(gpc >= problem.G_ * num_tile * C)
+            return;
+
+        const index_t c = gpc % C;
+        const index_t p = (gpc / C) % num_tile;
+        const index_t g = gpc / (C * num_tile);
+
+        const index_t tw = p % problem.NumTileW_;
+        const index_t th = (p / problem.NumTileW_) % problem.NumTileH_;
+        const index_t n  = p / (problem.NumTileW_ * problem.NumTileH_);
+
+        const index_t hi_begin = th * OutputTileSize - problem.LeftPadH_;
+        const index_t wi_begin = tw * OutputTileSize - problem.LeftPadW_;
+
+        const long_index_t a_offset =
+            g * static_cast<long_index_t>(a_g_n_c_wis_strides[0]) +
+            n * static_cast<long_index_t>(a_g_n_c_wis_strides[1]) + c * a_g_n_c_wis_strides[2];
+
+        AccDataType in[TileSize][TileSize];
+
+        static_for<0, TileSize, 1>{}([&](auto i) {
+            static_for<0, TileSize, 1>{}([&](auto j) {
+                const index_t hi = hi_begin + i;
+                const index_t wi = wi_begin + j;
+
+                if(hi >= 0 && hi < problem.Hi_ && wi >= 0 && wi < problem.Wi_)
+                {
+                    ADataType a =
+                        p_a_grid[a_offset + static_cast<long_index_t>(hi) * a_g_n_c_wis_strides[3] +
+                                 static_cast<long_index_t>(wi) * a_g_n_c_wis_strides[4]];
+
+                    a_element_op(a, a);
+
+                    in[i][j] = type_convert<AccDataType>(a);
+                }
+                else
+                {
+                    in[i][j] = 0;
+                }
+            });
+        });
+
+        AccDataType v[TileSize][TileSize];
+
+        Transform::InputTransform(in, v);
+
+        const long_index_t v_offset =
+            (static_cast<long_index_t>(g) * NumTileElement * num_tile + p) * C + c;
+        const long_index_t v_stride = static_cast<long_index_t>(num_tile) * C;
+
+        static_for<0, TileSize, 1>{}([&](auto i) {
+            static_for<0, TileSize, 1>{}([&](auto j) {
+                p_v_grid[v_offset + (i * TileSize + j) * v_stride] =
+                    type_convert<ADataType>(v[i][j]);
+            });
+        });
+    }
+
+    template <typename DsPointer>
+    __device__ static void
+    RunOutputTransform(const AccDataType* __restrict__ p_m_grid,
+                       const DsPointer& p_ds_grid,
+                       EDataType* __restrict__ p_e_grid,
+                       const ConvFwdWinogradProblem_2d& problem,
+                       const Array<Array<index_t, 5>, NumDTensor>& ds_g_n_k_wos_strides,
+                       const Array<index_t, 5>& e_g_n_k_wos_strides,
+                       const CDEElementwiseOperation& cde_element_op)
+    {
+        const index_t K        = problem.K_;
+        const index_t num_tile = problem.GetNumTile();
+
+        const index_t gpk = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        if(gpk >= problem.G_ * num_tile * K)
+            return;
+
+        const index_t k = gpk % K;
+        const index_t p = (gpk / K) % num_tile;
+        const index_t g = gpk / (K * num_tile);
+
+        const index_t tw = p % problem.NumTileW_;
+        const index_t th = (p / problem.NumTileW_) % problem.NumTileH_;
+        const index_t n  = p / (problem.NumTileW_ * problem.NumTileH_);
+
+        const long_index_t m_offset =
+            (static_cast<long_index_t>(g) * NumTileElement * num_tile + p) * K + k;
+        const long_index_t m_stride = static_cast<long_index_t>(num_tile) * K;
+
+        AccDataType m[TileSize][TileSize];
+
+        static_for<0, TileSize, 1>{}([&](auto i) {
+            static_for<0, TileSize, 1>{}([&](auto j) {
+                m[i][j] = p_m_grid[m_offset + (i * TileSize + j) * m_stride];
+            });
+        });
+
+        AccDataType out[OutputTileSize][OutputTileSize];
+
+        Transform::OutputTransform(m, out);
+
+        auto get_offset = [&](const Array<index_t, 5>& strides, index_t ho, index_t wo) {
+            return g * static_cast<long_index_t>(strides[0]) +
+                   n * static_cast<long_index_t>(strides[1]) +
+                   k * static_cast<long_index_t>(strides[2]) +
+                   ho * static_cast<long_index_t>(strides[3]) +
+                   wo * static_cast<long_index_t>(strides[4]);
+        };
+
+        static_for<0, OutputTileSize, 1>{}([&](auto i) {
+            static_for<0, OutputTileSize, 1>{}([&](auto j) {
+                const index_t ho = th * OutputTileSize + i;
+                const index_t wo = tw * OutputTileSize + j;
+
+                // the last tiles may stick out of the output image
+                if(ho < problem.Ho_ && wo < problem.Wo_)
+                {
+                    const auto c = type_convert<CShuffleDataType>(out[i][j]);
+
+                    const auto ds = generate_tuple(
+                        [&](auto id) {
+                            return p_ds_grid[id][get_offset(ds_g_n_k_wos_strides[id], ho, wo)];
+                        },
+                        Number<NumDTensor>{});
+
+                    EDataType e;
+
+                    unpack([&](const auto&... d) { cde_element_op(e, c, d...); }, ds);
+
+                    p_e_grid[get_offset(e_g_n_k_wos_strides, ho, wo)] = e;
+                }
+            });
+        });
+    }
+};
+
+} // namespace ck
@@ -0,0 +1,524 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/block/reduction_functions_blockwise.hpp"
+
+namespace ck {
+
+// Depthwise (C = 1 per group) 2D convolution with a channel multiplier of K outputs per group. The
+// strides of all tensors are in [G, N, C/K, H, W] order, C being 1 and thus never indexed
+struct DepthwiseConvProblem_2d
+{
+    index_t G_;
+    index_t N_;
+    index_t K_;
+    index_t Hi_;
+    index_t Wi_;
+    index_t Y_;
+    index_t X_;
+    index_t Ho_;
+    index_t Wo_;
+    index_t ConvStrideH_;
+    index_t ConvStrideW_;
+    index_t ConvDilationH_;
+    index_t ConvDilationW_;
+    index_t LeftPadH_;
+    index_t LeftPadW_;
+};
+
+template <typename GridwiseConv,
+          typename InDataType,
+          typename WeiDataType,
+          typename DsPointer,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation,
+          index_t NumDTensor>
+__global__ void
+#if CK_USE_LAUNCH_BOUNDS
+    __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+        kernel_depthwise_conv_fwd(const InDataType* __restrict__ p_in_grid,
+                                  const WeiDataType* __restrict__ p_wei_grid,
+                                  const DsPointer p_ds_grid,
+                                  OutDataType* __restrict__ p_out_grid,
+                                  const DepthwiseConvProblem_2d problem,
+                                  const Array<index_t, 5> in_strides,
+                                  const Array<index_t, 5> wei_strides,
+                                  const Array<Array<index_t, 5>, NumDTensor> ds_strides,
+                                  const Array<index_t, 5> out_strides,
+                                  const InElementwiseOperation in_element_op,
+                                  const WeiElementwiseOperation wei_element_op,
+                                  const OutElementwiseOperation out_element_op)
+{
+    GridwiseConv::RunForward(p_in_grid,
+                             p_wei_grid,
+                             p_ds_grid,
+                             p_out_grid,
+                             problem,
+                             in_strides,
+                             wei_strides,
+                             ds_strides,
+                             out_strides,
+                             in_element_op,
+                             wei_element_op,
+                             out_element_op);
+}
+
+template <typename GridwiseConv,
+          typename OutDataType,
+          typename WeiDataType,
+          typename DsPointer,
+          typename InDataType,
+          typename OutElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename InElementwiseOperation,
+          index_t NumDTensor>
+__global__ void
+#if CK_USE_LAUNCH_BOUNDS
+    __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+        kernel_depthwise_conv_bwd_data(const OutDataType* __restrict__ p_out_grid,
+                                       const WeiDataType* __restrict__ p_wei_grid,
+                                       const DsPointer p_ds_grid,
+                                       InDataType* __restrict__ p_in_grid,
+                                       const DepthwiseConvProblem_2d problem,
+                                       const Array<index_t, 5> out_strides,
+                                       const Array<index_t, 5> wei_strides,
+                                       const Array<Array<index_t, 5>, NumDTensor> ds_strides,
+                                       const Array<index_t, 5> in_strides,
+                                       const OutElementwiseOperation out_element_op,
+                                       const WeiElementwiseOperation wei_element_op,
+                                       const InElementwiseOperation in_element_op)
+{
+    GridwiseConv::RunBackwardData(p_out_grid,
+                                  p_wei_grid,
+                                  p_ds_grid,
+                                  p_in_grid,
+                                  problem,
+                                  out_strides,
+                                  wei_strides,
+                                  ds_strides,
+                                  in_strides,
+                                  out_element_op,
+                                  wei_element_op,
+                                  in_element_op);
+}
+
+template <typename GridwiseConv,
+          typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation>
+__global__ void
+#if CK_USE_LAUNCH_BOUNDS
+    __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+        kernel_depthwise_conv_bwd_weight(const InDataType* __restrict__ p_in_grid,
+                                         WeiDataType* __restrict__ p_wei_grid,
+                                         const OutDataType* __restrict__ p_out_grid,
+                                         const DepthwiseConvProblem_2d problem,
+                                         const Array<index_t, 5> in_strides,
+                                         const Array<index_t, 5> wei_strides,
+                                         const Array<index_t, 5> out_strides,
+                                         const InElementwiseOperation in_element_op,
+                                         const WeiElementwiseOperation wei_element_op,
+                                         const OutElementwiseOperation out_element_op)
+{
+    GridwiseConv::RunBackwardWeight(p_in_grid,
+                                    p_wei_grid,
+                                    p_out_grid,
+                                    problem,
+                                    in_strides,
+                                    wei_strides,
+                                    out_strides,
+                                    in_element_op,
+                                    wei_element_op,
+                                    out_element_op);
+}
+
+// Direct depthwise convolution, without the G degenerate GEMMs (N = K = 1 per group) of the
+// implicit GEMM kernels. Each thread computes GPerThread consecutive groups, which are contiguous
+// in the NHWGC/NHWGK layouts with K = 1, so the image tensors are read and written with vector
+// accesses along G while the filter, a few KB for the usual 3x3 or 5x5 layers, is read per group
+// and stays in cache. The kernels are therefore bound by the bandwidth of the image tensors.
+//
+//  - forward:         one thread per (n, ho, wo, k, GPerThread groups)
+//  - backward data:   one thread per (n, hi, wi, GPerThread groups), summing over k, y, x
+//  - backward weight: one workgroup per (GPerBlock groups, k, y, x), its threads being split in
+//                     GPerBlock / GPerThread along G and the rest along N * Ho * Wo, which is
+//                     reduced in the workgroup without atomics
+template <typename InDataType,
+          typename WeiDataType,
+          typename AccDataType,
+          typename DsDataType,
+          typename OutDataType,
+          index_t BlockSize,
+          index_t GPerBlock,
+          index_t GPerThread>
+struct GridwiseDepthwiseConv_2d
+{
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t NumDTensor = DsDataType::Size();
+
+    // backward weight
+    static constexpr index_t GThreadClusterSize       = GPerBlock / GPerThread;
+    static constexpr index_t SpatialThreadClusterSize = BlockSize / GThreadClusterSize;
+
+    static_assert(GPerBlock % GPerThread == 0 && BlockSize % GThreadClusterSize == 0,
+                  "wrong! GPerBlock must be a multiple of GPerThread and divide BlockSize");
+
+    using ThreadClusterLengths_G_Spatial = Sequence<GThreadClusterSize, SpatialThreadClusterSize>;
+
+    using BlockwiseReduce = PartitionedBlockwiseReduction<AccDataType,
+                                                          BlockSize,
+                                                          ThreadClusterLengths_G_Spatial,
+                                                          Sequence<1, 0>,
+                                                          reduce::Add,
+                                                          false>;
+
+    static constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths_G_Spatial{}, Sequence<1, 0>{});
+
+    static constexpr auto MakeDsGridPointer()
+    {
+        return generate_tuple(
+            [&](auto i) {
+                using DDataType = remove_cvref_t<tuple_element_t<i.value, DsDataType>>;
+
+                return static_cast<const DDataType*>(nullptr);
+            },
+            Number<NumDTensor>{});
+    }
+
+    using DsGridPointer = decltype(MakeDsGridPointer());
+
+    template <typename DataType>
+    using VectorType = vector_type_maker_t<DataType, GPerThread>;
+
+    // GPerThread consecutive groups, zero if the position is in the padding
+    template <typename DataType>
+    __device__ static auto
+    LoadVector(const DataType* __restrict__ p_grid, long_index_t offset, bool is_valid)
+    {
+        using vector_t = typename VectorType<DataType>::type;
+
+        VectorType<DataType> v;
+
+        if(is_valid)
+        {
+            v.template AsType<vector_t>()(I0) =
+                *c_style_pointer_cast<const vector_t*>(p_grid + offset);
+        }
+
+        return v;
+    }
+
+    template <typename DataType>
+    __device__ static void
+    StoreVector(DataType* __restrict__ p_grid, long_index_t offset, const VectorType<DataType>& v)
+    {
+        using vector_t = typename VectorType<DataType>::type;
+
+        *c_style_pointer_cast<vector_t*>(p_grid + offset) = v.template AsType<vector_t>()[I0];
+    }
+
+    __device__ static long_index_t GetOffset(const Array<index_t, 5>& strides,
+                                             index_t g,
+                                             index_t n,
+                                             index_t k,
+                                             index_t h,
+                                             index_t w)
+    {
+        return g * static_cast<long_index_t>(strides[0]) +
+               n * static_cast<long_index_t>(strides[1]) +
+               k * static_cast<long_index_t>(strides[2]) +
+               h * static_cast<long_index_t>(strides[3]) +
+               w * static_cast<long_index_t>(strides[4]);
+    }
+
+    // e = cde_op(c, d...) for the GPerThread groups, c being the accumulator converted to
+    // EDataType. The D tensors are read per group
+    template <typename EDataType, typename CDEElementwiseOperation>
+    __device__ static void
+    RunEpilogue(const StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, GPerThread, true>& acc,
+                const DsGridPointer& p_ds_grid,
+                EDataType* __restrict__ p_e_grid,
+                const Array<Array<index_t, 5>, NumDTensor>& ds_strides,
+                const Array<index_t, 5>& e_strides,
+                index_t g,
+                index_t n,
+                index_t k,
+                index_t h,
+                index_t w,
+                const CDEElementwiseOperation& cde_element_op)
+    {
+        VectorType<EDataType> e;
+
+        static_for<0, GPerThread, 1>{}([&](auto i) {
+            const auto c = type_convert<EDataType>(acc[i]);
+
+            const auto ds = generate_tuple(
+                [&](auto id) {
+                    return p_ds_grid[id][GetOffset(ds_strides[id], g + i, n, k, h, w)];
+                },
+                Number<NumDTensor>{});
+
+            unpack(
+                [&](const auto&... d) {
+                    cde_element_op(e.template AsType<EDataType>()(i), c, d...);
+                },
+                ds);
+        });
+
+        StoreVector(p_e_grid, GetOffset(e_strides, g, n, k, h, w), e);
+    }
+
+    template <typename InElementwiseOperation,
+              typename WeiElementwiseOperation,
+              typename OutElementwiseOperation>
+    __device__ static void RunForward(const InDataType* __restrict__ p_in_grid,
+                                      const WeiDataType* __restrict__ p_wei_grid,
+                                      const DsGridPointer& p_ds_grid,
+                                      OutDataType* __restrict__ p_out_grid,
+                                      const DepthwiseConvProblem_2d& problem,
+                                      const Array<index_t, 5>& in_strides,
+                                      const Array<index_t, 5>& wei_strides,
+                                      const Array<Array<index_t, 5>, NumDTensor>& ds_strides,
+                                      const Array<index_t, 5>& out_strides,
+                                      const InElementwiseOperation& in_element_op,
+                                      const WeiElementwiseOperation& wei_element_op,
+                                      const OutElementwiseOperation& out_element_op)
+    {
+        const index_t num_g_vector = problem.G_ / GPerThread;
+
+        index_t tid = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        if(tid >= num_g_vector * problem.K_ * problem.Wo_ * problem.Ho_ * problem.N_)
+            return;
+
+        const index_t g = (tid % num_g_vector) * GPerThread;
+        tid /= num_g_vector;
+        const index_t k = tid % problem.K_;
+        tid /= problem.K_;
+        const index_t wo = tid % problem.Wo_;
+        tid /= problem.Wo_;
+        const index_t ho = tid % problem.Ho_;
+        const index_t n  = tid / problem.Ho_;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, GPerThread, true> acc;
+
+        static_for<0, GPerThread, 1>{}([&](auto i) { acc(i) = 0; });
+
+        for(index_t y = 0; y < problem.Y_; ++y)
+        {
+            const index_t hi =
+                ho * problem.ConvStrideH_ + y * problem.ConvDilationH_ - problem.LeftPadH_;
+
+            if(hi < 0 || hi >= problem.Hi_)
+                continue;
+
+            for(index_t x = 0; x < problem.X_; ++x)
+            {
+                const index_t wi =
+                    wo * problem.ConvStrideW_ + x * problem.ConvDilationW_ - problem.LeftPadW_;
+
+                if(wi < 0 || wi >= problem.Wi_)
+                    continue;
+
+                const auto in = LoadVector(p_in_grid, GetOffset(in_strides, g, n, 0, hi, wi), true);
+
+                static_for<0, GPerThread, 1>{}([&](auto i) {
+                    InDataType a  = in.template AsType<InDataType>()[i];
+                    WeiDataType b = p_wei_grid[GetOffset(wei_strides, g + i, k, 0, y, x)];
+
+                    in_element_op(a, a);
+                    wei_element_op(b, b);
+
+                    acc(i) += type_convert<AccDataType>(a) * type_convert<AccDataType>(b);
+                });
+            }
+        }
+
+        RunEpilogue(
+            acc, p_ds_grid, p_out_grid, ds_strides, out_strides, g, n, k, ho, wo, out_element_op);
+    }
+
+    template <typename OutElementwiseOperation,
+              typename WeiElementwiseOperation,
+              typename InElementwiseOperation>
+    __device__ static void RunBackwardData(const OutDataType* __restrict__ p_out_grid,
+                                           const WeiDataType* __restrict__ p_wei_grid,
+                                           const DsGridPointer& p_ds_grid,
+                                           InDataType* __restrict__ p_in_grid,
+                                           const DepthwiseConvProblem_2d& problem,
+                                           const Array<index_t, 5>& out_strides,
+                                           const Array<index_t, 5>& wei_strides,
+                                           const Array<Array<index_t, 5>, NumDTensor>& ds_strides,
+                                           const Array<index_t, 5>& in_strides,
+                                           const OutElementwiseOperation& out_element_op,
+                                           const WeiElementwiseOperation& wei_element_op,
+                                           const InElementwiseOperation& in_element_op)
+    {
+        const index_t num_g_vector = problem.G_ / GPerThread;
+
+        index_t tid = get_block_1d_id() * BlockSize + get_thread_local_1d_id();
+
+        if(tid >= num_g_vector * problem.Wi_ * problem.Hi_ * problem.N_)
+            return;
+
+        const index_t g = (tid % num_g_vector) * GPerThread;
+        tid /= num_g_vector;
+        const index_t wi = tid % problem.Wi_;
+        tid /= problem.Wi_;
+        const index_t hi = tid % problem.Hi_;
+        const index_t n  = tid / problem.Hi_;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, GPerThread, true> acc;
+
+        static_for<0, GPerThread, 1>{}([&](auto i) { acc(i) = 0; });
+
+        for(index_t y = 0; y < problem.Y_; ++y)
+        {
+            // ho * stride = hi + pad - y * dilation
+            const index_t h_tmp = hi + problem.LeftPadH_ - y * problem.ConvDilationH_;
+            const index_t ho    = h_tmp / problem.ConvStrideH_;
+
+            if(h_tmp < 0 || ho * problem.ConvStrideH_ != h_tmp || ho >= problem.Ho_)
+                continue;
+
+            for(index_t x = 0; x < problem.X_; ++x)
+            {
+                const index_t w_tmp = wi + problem.LeftPadW_ - x * problem.ConvDilationW_;
+                const index_t wo    = w_tmp / problem.ConvStrideW_;
+
+                if(w_tmp < 0 || wo * problem.ConvStrideW_ != w_tmp || wo >= problem.Wo_)
+                    continue;
+
+                for(index_t k = 0; k < problem.K_; ++k)
+                {
+                    const auto out =
+                        LoadVector(p_out_grid, GetOffset(out_strides, g, n, k, ho, wo), true);
+
+                    static_for<0, GPerThread, 1>{}([&](auto i) {
+                        OutDataType a = out.template AsType<OutDataType>()[i];
+                        WeiDataType b = p_wei_grid[GetOffset(wei_strides, g + i, k, 0, y, x)];
+
+                        out_element_op(a, a);
+                        wei_element_op(b, b);
+
+                        acc(i) += type_convert<AccDataType>(a) * type_convert<AccDataType>(b);
+                    });
+                }
+            }
+        }
+
+        RunEpilogue(
+            acc, p_ds_grid, p_in_grid, ds_strides, in_strides, g, n, 0, hi, wi, in_element_op);
+    }
+
+    template <typename InElementwiseOperation,
+              typename WeiElementwiseOperation,
+              typename OutElementwiseOperation>
+    __device__ static void RunBackwardWeight(const InDataType* __restrict__ p_in_grid,
+                                             WeiDataType* __restrict__ p_wei_grid,
+                                             const OutDataType* __restrict__ p_out_grid,
+                                             const DepthwiseConvProblem_2d& problem,
+                                             const Array<index_t, 5>& in_strides,
+                                             const Array<index_t, 5>& wei_strides,
+                                             const Array<index_t, 5>& out_strides,
+                                             const InElementwiseOperation& in_element_op,
+                                             const WeiElementwiseOperation& wei_element_op,
+                                             const OutElementwiseOperation& out_element_op)
+    {
+        // LDS
+        __shared__ AccDataType p_reduce_work_buffer[BlockSize];
+
+        auto reduce_work_buf =
+            make_dynamic_buffer<AddressSpaceEnum::Lds>(p_reduce_work_buffer, BlockSize);
+
+        const index_t num_g_block = math::integer_divide_ceil(problem.G_, GPerBlock);
+
+        index_t bid = get_block_1d_id();
+
+        const index_t g_block_id = bid % num_g_block;
+        bid /= num_g_block;
+        const index_t x = bid % problem.X_;
+        bid /= problem.X_;
+        const index_t y = bid % problem.Y_;
+        const index_t k = bid / problem.Y_;
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(get_thread_local_1d_id()));
+
+        const index_t g = g_block_id * GPerBlock + thread_cluster_idx[I0] * GPerThread;
+        const index_t spatial_thread_id = thread_cluster_idx[I1];
+
+        // G is a multiple of GPerThread, so a vector is either fully in or fully out of range
+        const bool is_g_valid = g < problem.G_;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, GPerThread, true> acc;
+
+        static_for<0, GPerThread, 1>{}([&](auto i) { acc(i) = 0; });
+
+        const index_t num_out_pixel = problem.N_ * problem.Ho_ * problem.Wo_;
+
+        for(index_t p = spatial_thread_id; p < num_out_pixel; p += SpatialThreadClusterSize)
+        {
+            const index_t wo = p % problem.Wo_;
+            const index_t ho = (p / problem.Wo_) % problem.Ho_;
+            const index_t n  = p / (problem.Wo_ * problem.Ho_);
+
+            const index_t hi =
+                ho * problem.ConvStrideH_ + y * problem.ConvDilationH_ - problem.LeftPadH_;
+            const index_t wi =
+                wo * problem.ConvStrideW_ + x * problem.ConvDilationW_ - problem.LeftPadW_;
+
+            const bool is_valid =
+                is_g_valid && hi >= 0 && hi < problem.Hi_ && wi >= 0 && wi < problem.Wi_;
+
+            const auto in =
+                LoadVector(p_in_grid, GetOffset(in_strides, g, n, 0, hi, wi), is_valid);
+            const auto out =
+                LoadVector(p_out_grid, GetOffset(out_strides, g, n, k, ho, wo), is_valid);
+
+            static_for<0, GPerThread, 1>{}([&](auto i) {
+                InDataType a  = in.template AsType<InDataType>()[i];
+                OutDataType b = out.template AsType<OutDataType>()[i];
+
+                in_element_op(a, a);
+                out_element_op(b, b);
+
+                acc(i) += type_convert<AccDataType>(a) * type_convert<AccDataType>(b);
+            });
+        }
+
+        static_for<0, GPerThread, 1>{}([&](auto i) {
+            BlockwiseReduce::Reduce(reduce_work_buf, acc(i));
+            block_sync_lds();
+        });
+
+        if(spatial_thread_id == 0 && is_g_valid)
+        {
+            static_for<0, GPerThread, 1>{}([&](auto i) {
+                AccDataType w;
+
+                wei_element_op(w, acc[i]);
+
+                p_wei_grid[GetOffset(wei_strides, g + i, k, 0, y, x)] =
+                    type_convert<WeiDataType>(w);
+            });
+        }
+    }
+};
+
+} // namespace ck
@@ -0,0 +1,366 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/block/reduction_functions_blockwise.hpp"
+
+namespace ck {
+
+// GEMM with row-major A/C and a small M
+struct GemmSkinnyProblem
+{
+    index_t M_;
+    index_t N_;
+    index_t K_;
+    index_t StrideA_;
+    index_t StrideB_;
+    index_t StrideC_;
+};
+
+template <typename GridwiseGemm,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation>
+__global__ void
+#if CK_USE_LAUNCH_BOUNDS
+    __launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+        kernel_gemm_skinny(const ADataType* __restrict__ p_a_grid,
+                           const BDataType* __restrict__ p_b_grid,
+                           CDataType* __restrict__ p_c_grid,
+                           const GemmSkinnyProblem problem,
+                           const AElementwiseOperation a_element_op,
+                           const BElementwiseOperation b_element_op,
+                           const CElementwiseOperation c_element_op)
+{
+    GridwiseGemm::Run(
+        p_a_grid, p_b_grid, p_c_grid, problem, a_element_op, b_element_op, c_element_op);
+}
+
+// Skeleton of the GEMV and GEMM with a small M (decoding, batch-1 inference), which are bound by
+// the bandwidth of B: the MFMA tiles of the regular GEMMs are at least 16 or 32 rows of M high and
+// mostly padding. How B is stored and loaded is left to the GEMMs built on it, e.g.
+// GridwiseGemmSkinny and GridwiseGemmWeightOnlyQuant.
+//
+// A workgroup computes an MPerBlock x NPerBlock tile of C. Its threads are split in
+// NPerBlock / NPerThread threads along N times KThreadClusterSize threads along K, i.e. K is split
+// across the threads and waves of the workgroup and the partial sums are reduced in LDS at the end.
+// Each thread loads NPerThread x KPerThread tiles of B, ThreadClusterArrangeOrder ordering the
+// threads so that the loads of consecutive threads are contiguous. The MPerBlock rows of A are
+// small and shared by all the columns of B, and thus read from cache.
+template <typename ADataType,
+          typename AccDataType,
+          index_t BlockSize,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t NPerThread,
+          index_t KPerThread,
+          typename ThreadClusterArrangeOrder>
+struct GridwiseGemmSkinnyBase
+{
+    static constexpr auto I0 = Number<0>{};
+    static constexpr auto I1 = Number<1>{};
+
+    static constexpr index_t NThreadClusterSize = NPerBlock / NPerThread;
+    static constexpr index_t KThreadClusterSize = BlockSize / NThreadClusterSize;
+
+    // up to 16 bytes of A per load
+    static constexpr index_t AScalarPerVector =
+        math::min(KPerThread, static_cast<index_t>(16 / sizeof(ADataType)));
+
+    static_assert(NPerBlock % NPerThread == 0 && BlockSize % NThreadClusterSize == 0 &&
+                      KThreadClusterSize > 1 &&
+                      (KThreadClusterSize & (KThreadClusterSize - 1)) == 0,
+                  "wrong! BlockSize / (NPerBlock / NPerThread) must be a power of 2 larger than 1");
+
+    static_assert(KPerThread % AScalarPerVector == 0, "wrong!");
+
+    using ThreadClusterLengths_N_K = Sequence<NThreadClusterSize, KThreadClusterSize>;
+
+    using BlockwiseReduce = PartitionedBlockwiseReduction<AccDataType,
+                                                          BlockSize,
+                                                          ThreadClusterLengths_N_K,
+                                                          ThreadClusterArrangeOrder,
+                                                          reduce::Add,
+                                                          false>;
+
+    static constexpr auto thread_cluster_desc =
+        make_cluster_descriptor(ThreadClusterLengths_N_K{}, ThreadClusterArrangeOrder{});
+
+    using AVectorType = vector_type_maker_t<ADataType, AScalarPerVector>;
+
+    // NPerThread x KPerThread tile of B, N major
+    using BThreadTile =
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, NPerThread * KPerThread, true>;
+
+    __host__ static constexpr index_t CalculateGridSize(index_t M, index_t N)
+    {
+        return math::integer_divide_ceil(M, MPerBlock) * math::integer_divide_ceil(N, NPerBlock);
+    }
+
+    // load_b_tile(n_begin, k, b_tile) loads the tile of B starting at [n_begin, k] into b_tile,
+    // N % NPerThread and K % KPerThread being 0
+    template <typename CDataType,
+              typename BTileLoader,
+              typename AElementwiseOperation,
+              typename CElementwiseOperation>
+    __device__ static void RunWithBTileLoader(const ADataType* __restrict__ p_a_grid,
+                                              CDataType* __restrict__ p_c_grid,
+                                              index_t M,
+                                              index_t N,
+                                              index_t K,
+                                              index_t StrideA,
+                                              index_t StrideC,
+                                              const BTileLoader& load_b_tile,
+                                              const AElementwiseOperation& a_element_op,
+                                              const CElementwiseOperation& c_element_op)
+    {
+        // LDS
+        __shared__ AccDataType p_reduce_work_buffer[BlockSize];
+
+        auto reduce_work_buf =
+            make_dynamic_buffer<AddressSpaceEnum::Lds>(p_reduce_work_buffer, BlockSize);
+
+        // the M blocks of a N block are adjacent, so B is read once from memory
+        const index_t num_m_block = math::integer_divide_ceil(M, MPerBlock);
+
+        const index_t m_block_id = get_block_1d_id() % num_m_block;
+        const index_t n_block_id = get_block_1d_id() / num_m_block;
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(get_thread_local_1d_id()));
+
+        const index_t m_begin = m_block_id * MPerBlock;
+        const index_t n_begin = n_block_id * NPerBlock + thread_cluster_idx[I0] * NPerThread;
+
+        const index_t k_thread_id = thread_cluster_idx[I1];
+
+        const bool is_n_valid = n_begin < N;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, MPerBlock * NPerThread, true> acc;
+
+        static_for<0, MPerBlock * NPerThread, 1>{}([&](auto i) { acc(i) = 0; });
+
+        if(is_n_valid)
+        {
+            for(index_t k = k_thread_id * KPerThread; k < K; k += KThreadClusterSize * KPerThread)
+            {
+                BThreadTile b;
+
+                load_b_tile(n_begin, k, b);
+
+                static_for<0, MPerBlock, 1>{}([&](auto m) {
+                    if(m_begin + m < M)
+                    {
+                        const ADataType* p_a =
+                            p_a_grid + (m_begin + m) * static_cast<long_index_t>(StrideA) + k;
+
+                        static_for<0, KPerThread / AScalarPerVector, 1>{}([&](auto v) {
+                            AVectorType a_vector;
+
+                            a_vector.template AsType<typename AVectorType::type>()(I0) =
+                                *c_style_pointer_cast<const typename AVectorType::type*>(
+                                    p_a + v.value * AScalarPerVector);
+
+                            static_for<0, AScalarPerVector, 1>{}([&](auto j) {
+                                constexpr auto ik = Number<v.value * AScalarPerVector + j.value>{};
+
+                                ADataType v_a;
+
+                                a_element_op(v_a, a_vector.template AsType<ADataType>()[j]);
+
+                                static_for<0, NPerThread, 1>{}([&](auto in) {
+                                    acc(Number<m.value * NPerThread + in.value>{}) +=
+                                        type_convert<AccDataType>(v_a) *
+                                        b[Number<in.value * KPerThread + ik.value>{}];
+                                });
+                            });
+                        });
+                    }
+                });
+            }
+        }
+
+        // every thread takes part in the reductions
+        static_for<0, MPerBlock * NPerThread, 1>{}([&](auto i) {
+            BlockwiseReduce::Reduce(reduce_work_buf, acc(i));
+            block_sync_lds();
+        });
+
+        if(k_thread_id == 0 && is_n_valid)
+        {
+            static_for<0, MPerBlock, 1>{}([&](auto m) {
+                if(m_begin + m < M)
+                {
+                    CDataType* p_c =
+                        p_c_grid + (m_begin + m) * static_cast<long_index_t>(StrideC) + n_begin;
+
+                    static_for<0, NPerThread, 1>{}([&](auto in) {
+                        c_element_op(p_c[in.value],
+                                     type_convert<CDataType>(
+                                         acc[Number<m.value * NPerThread + in.value>{}]));
+                    });
+                }
+            });
+        }
+    }
+};
+
+// Small M GEMM with a plain B, loaded with vectors along its contiguous dimension, K for
+// column-major B[N, K] and N for row-major B[K, N]
+template <typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename CDataType,
+          typename BLayout,
+          index_t BlockSize,
+          index_t MPerBlock,
+          index_t NPerBlock,
+          index_t NPerThread,
+          index_t KPerThread,
+          index_t BScalarPerVector>
+struct GridwiseGemmSkinny
+{
+    static constexpr auto I0 = Number<0>{};
+
+    static constexpr bool IsBKContiguous =
+        is_same_v<BLayout, tensor_layout::gemm::ColumnMajor>;
+
+    // consecutive threads along the contiguous dimension of B
+    using ThreadClusterArrangeOrder =
+        conditional_t<IsBKContiguous, Sequence<0, 1>, Sequence<1, 0>>;
+
+    using Base = GridwiseGemmSkinnyBase<ADataType,
+                                        AccDataType,
+                                        BlockSize,
+                                        MPerBlock,
+                                        NPerBlock,
+                                        NPerThread,
+                                        KPerThread,
+                                        ThreadClusterArrangeOrder>;
+
+    static constexpr index_t AScalarPerVector = Base::AScalarPerVector;
+
+    static_assert((IsBKContiguous ? KPerThread : NPerThread) % BScalarPerVector == 0,
+                  "wrong! BScalarPerVector must divide the contiguous length of a thread tile");
+
+    using BVectorType = vector_type_maker_t<BDataType, BScalarPerVector>;
+
+    __host__ static constexpr index_t CalculateGridSize(index_t M, index_t N)
+    {
+        return Base::CalculateGridSize(M, N);
+    }
+
+    __host__ static constexpr bool CheckValidity(const GemmSkinnyProblem& problem)
+    {
+        if(!(problem.M_ > 0 && problem.N_ > 0 && problem.K_ > 0))
+        {
+            return false;
+        }
+
+        // a thread tile is either fully inside or fully outside of the problem
+        if(!(problem.K_ % KPerThread == 0 && problem.N_ % NPerThread == 0))
+        {
+            return false;
+        }
+
+        // vector loads of A and B
+        if(!(problem.StrideA_ >= problem.K_ && problem.StrideA_ % AScalarPerVector == 0 &&
+             problem.StrideB_ % BScalarPerVector == 0 && problem.StrideC_ >= problem.N_))
+        {
+            return false;
+        }
+
+        if(!(problem.StrideB_ >= (IsBKContiguous ? problem.K_ : problem.N_)))
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    template <typename AElementwiseOperation,
+              typename BElementwiseOperation,
+              typename CElementwiseOperation>
+    __device__ static void Run(const ADataType* __restrict__ p_a_grid,
+                               const BDataType* __restrict__ p_b_grid,
+                               CDataType* __restrict__ p_c_grid,
+                               const GemmSkinnyProblem& problem,
+                               const AElementwiseOperation& a_element_op,
+                               const BElementwiseOperation& b_element_op,
+                               const CElementwiseOperation& c_element_op)
+    {
+        const auto load_b_tile = [&](index_t n_begin, index_t k, auto& b) {
+            if constexpr(IsBKContiguous)
+            {
+                static_for<0, NPerThread, 1>{}([&](auto in) {
+                    const BDataType* p_b =
+                        p_b_grid +
+                        (n_begin + in.value) * static_cast<long_index_t>(problem.StrideB_) + k;
+
+                    static_for<0, KPerThread / BScalarPerVector, 1>{}([&](auto v) {
+                        BVectorType b_vector;
+
+                        b_vector.template AsType<typename BVectorType::type>()(I0) =
+                            *c_style_pointer_cast<const typename BVectorType::type*>(
+                                p_b + v.value * BScalarPerVector);
+
+                        static_for<0, BScalarPerVector, 1>{}([&](auto j) {
+                            BDataType v_b;
+
+                            b_element_op(v_b, b_vector.template AsType<BDataType>()[j]);
+
+                            b(Number<in.value * KPerThread + v.value * BScalarPerVector +
+                                     j.value>{}) = type_convert<AccDataType>(v_b);
+                        });
+                    });
+                });
+            }
+            else
+            {
+                static_for<0, KPerThread, 1>{}([&](auto ik) {
+                    const BDataType* p_b =
+                        p_b_grid + (k + ik) * static_cast<long_index_t>(problem.StrideB_) +
+                        n_begin;
+
+                    static_for<0, NPerThread / BScalarPerVector, 1>{}([&](auto v) {
+                        BVectorType b_vector;
+
+                        b_vector.template AsType<typename BVectorType::type>()(I0) =
+                            *c_style_pointer_cast<const typename BVectorType::type*>(
+                                p_b + v.value * BScalarPerVector);
+
+                        static_for<0, BScalarPerVector, 1>{}([&](auto j) {
+                            BDataType v_b;
+
+                            b_element_op(v_b, b_vector.template AsType<BDataType>()[j]);
+
+                            b(Number<(v.value * BScalarPerVector + j.value) * KPerThread +
+                                     ik.value>{}) = type_convert<AccDataType>(v_b);
+                        });
+                    });
+                });
+            }
+        };
+
+        Base::RunWithBTileLoader(p_a_grid,
+                                 p_c_grid,
+                                 problem.M_,
+                                 problem.N_,
+                                 problem.K_,
+                                 problem.StrideA_,
+                                 problem.StrideC_,
+                                 load_b_tile,
+                                 a_element_op,
+                                 c_element_op);
+    }
+};
+
+} // namespace ck
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+
+template <typename GridwiseReduce,
+          typename AccDataType,
+          typename EDataType,
+          typename EElementwiseOperation>
+__global__ void kernel_reduce_split_k(const AccDataType* __restrict__ p_workspace_grid,
+                                      EDataType* __restrict__ p_e_grid,
+                                      const long_index_t num_element,
+                                      const index_t k_batch,
+                                      const EElementwiseOperation e_element_op)
+{
+    GridwiseReduce::Run(p_workspace_grid, p_e_grid, num_element, k_batch, e_element_op);
+}
+
+// Sums the k_batch partial results [k_batch, num_element] of a split-K GEMM into e, split after
+// split, so that the result does not depend on the order in which the splits were computed
+template <typename AccDataType,
+          typename EDataType,
+          typename EElementwiseOperation,
+          index_t BlockSize>
+struct GridwiseReduceSplitK
+{
+    __device__ static void Run(const AccDataType* __restrict__ p_workspace_grid,
+                               EDataType* __restrict__ p_e_grid,
+                               long_index_t num_element,
+                               index_t k_batch,
+                               const EElementwiseOperation& e_element_op)
+    {
+        const long_index_t stride = static_cast<long_index_t>(get_grid_size()) * BlockSize;
+
+        for(long_index_t i =
+                static_cast<long_index_t>(get_block_1d_id()) * BlockSize + get_thread_local_1d_id();
+            i < num_element;
+            i += stride)
+        {
+            AccDataType acc = p_workspace_grid[i];
+
+            for(index_t k = 1; k < k_batch; ++k)
+            {
+                acc += p_workspace_grid[k * num_element + i];
+            }
+
+            AccDataType e;
+
+            e_element_op(e, acc);
+
+            p_e_grid[i] = type_convert<EDataType>(e);
+        }
+    }
+};
+
+} // namespace ck
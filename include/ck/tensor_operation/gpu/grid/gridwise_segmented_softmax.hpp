@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/tensor_operation/gpu/grid/gridwise_segmented_reduction.hpp"
+#include "ck/tensor_operation/gpu/grid/gridwise_softmax.hpp"
+
+namespace ck {
+
+// Every workgroup computes the softmax of one M block tile of one segment, with GridwiseSoftmax
+// instantiated on the segment descriptor, see MakeSegmentDescriptor_M_K
+template <typename GridwiseSoftmax, typename InDataType, typename OutDataType, typename AccDataType>
+__global__ void kernel_segmented_softmax(index_t num_m_block_tiles,
+                                         index_t inner_length,
+                                         const index_t* const __restrict__ p_offsets,
+                                         AccDataType alpha,
+                                         const InDataType* const __restrict__ p_in_value_global,
+                                         AccDataType beta,
+                                         OutDataType* const __restrict__ p_out_value_global)
+{
+    constexpr index_t M_BlockTileSize = GridwiseSoftmax::M_BlockTileSize;
+    constexpr index_t K_BlockTileSize = GridwiseSoftmax::K_BlockTileSize;
+
+    const index_t block_global_id = get_block_1d_id();
+    const index_t segment_id      = block_global_id / num_m_block_tiles;
+    const index_t m_block_tile_id = block_global_id % num_m_block_tiles;
+
+    const index_t segment_begin  = p_offsets[segment_id];
+    const index_t segment_length = p_offsets[segment_id + 1] - segment_begin;
+
+    const auto grid_desc_m_k = MakeSegmentDescriptor_M_K<M_BlockTileSize, K_BlockTileSize>(
+        inner_length, segment_length);
+
+    // GridwiseSoftmax runs at least one iteration, an empty segment only has padding elements
+    // which are neither read nor written
+    const index_t num_k_block_tile_iteration =
+        math::max(math::integer_divide_ceil(segment_length, K_BlockTileSize), 1);
+
+    const long_index_t segment_offset = static_cast<long_index_t>(segment_begin) * inner_length;
+
+    GridwiseSoftmax::RunBlockTile(grid_desc_m_k,
+                                  grid_desc_m_k,
+                                  m_block_tile_id,
+                                  0,
+                                  num_k_block_tile_iteration,
+                                  alpha,
+                                  p_in_value_global + segment_offset,
+                                  beta,
+                                  p_out_value_global + segment_offset);
+};
+
+} // namespace ck
@@ -92,6 +92,30 @@ struct GridwiseSoftmax_mk_to_mk
                                const InDataType* const __restrict__ p_in_value_global,
                                AccDataType beta,
                                OutDataType* const __restrict__ p_out_value_global)
+    {
+        const index_t block_global_id = get_block_1d_id();
+
+        RunBlockTile(in_grid_desc_m_k,
+                     out_grid_desc_m_k,
+                     block_global_id / block_group_size,
+                     block_global_id % block_group_size,
+                     num_k_block_tile_iteration,
+                     alpha,
+                     p_in_value_global,
+                     beta,
+                     p_out_value_global);
+    }
+
+    // softmax of the M block tile blkgroup_id, over the block_local_id-th part of K
+    __device__ static void RunBlockTile(const GridDesc_M_K& in_grid_desc_m_k,
+                                        const GridDesc_M_K& out_grid_desc_m_k,
+                                        index_t blkgroup_id,
+                                        index_t block_local_id,
+                                        index_t num_k_block_tile_iteration,
+                                        AccDataType alpha,
+                                        const InDataType* const __restrict__ p_in_value_global,
+                                        AccDataType beta,
+                                        OutDataType* const __restrict__ p_out_value_global)
     {
         if constexpr(SweepOnce)
         {
@@ -126,9 +150,6 @@ struct GridwiseSoftmax_mk_to_mk
         });
 
         const index_t thread_local_id = get_thread_local_1d_id();
-        const index_t block_global_id = get_block_1d_id();
-        const index_t blkgroup_id     = block_global_id / block_group_size;
-        const index_t block_local_id  = block_global_id % block_group_size;
 
         const auto thread_cluster_idx =
             thread_cluster_desc.CalculateBottomIndex(make_multi_index(thread_local_id));
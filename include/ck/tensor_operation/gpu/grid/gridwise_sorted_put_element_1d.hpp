@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/utility/generic_memory_space_atomic.hpp"
+
+namespace ck {
+
+template <typename GridwiseSortedPutElementwise1dFunctor,
+          typename InDataType,
+          typename IndexDataType,
+          typename OutDataType,
+          typename ElementwiseOperation>
+__global__ void kernel_sorted_put_element_1d(const InDataType* __restrict__ p_in_global,
+                                             const IndexDataType* __restrict__ p_indices_global,
+                                             OutDataType* __restrict__ p_out_global,
+                                             const index_t input_length,
+                                             const ElementwiseOperation elementwise_op)
+{
+    GridwiseSortedPutElementwise1dFunctor::Run(
+        p_in_global, p_indices_global, p_out_global, input_length, elementwise_op);
+}
+
+// output[indices] = reduce(output[indices], input), with duplicated indices pre-reduced
+//
+// Each block takes tiles of BlockSize * ThreadTileSize (index, value) pairs, sorts every tile by
+// index in LDS (bitonic sort, skipped when IndicesSorted is true), then reduces the runs of equal
+// indices with a block-wide segmented scan, so only one atomic is issued per distinct index of a
+// tile instead of one per element. Negative indices are skipped, as in GridwisePutElement_1D
+template <typename InDataType,
+          typename IndexDataType,
+          typename OutDataType,
+          typename ElementwiseOperation,
+          InMemoryDataOperationEnum MemOp,
+          index_t BlockSize,
+          index_t ThreadTileSize,
+          bool IndicesSorted>
+struct GridwiseSortedPutElement_1D
+{
+    static_assert(MemOp == InMemoryDataOperationEnum::AtomicAdd ||
+                      MemOp == InMemoryDataOperationEnum::AtomicMax,
+                  "duplicated indices can only be pre-reduced for AtomicAdd and AtomicMax!");
+
+    static constexpr index_t TileSize = BlockSize * ThreadTileSize;
+
+    static_assert(TileSize > 0 && (TileSize & (TileSize - 1)) == 0,
+                  "bitonic sort needs the tile size to be a power of 2!");
+
+    using ReduceOperation = conditional_t<MemOp == InMemoryDataOperationEnum::AtomicAdd,
+                                          reduce::Add,
+                                          reduce::Max>;
+
+    __device__ static void SortTile(IndexDataType* p_keys, OutDataType* p_values)
+    {
+        const index_t thread_local_id = get_thread_local_1d_id();
+
+        for(index_t k = 2; k <= TileSize; k *= 2)
+        {
+            for(index_t j = k / 2; j > 0; j /= 2)
+            {
+                // every pair (p, p ^ j) is compared and swapped by exactly one thread
+                for(index_t p = thread_local_id; p < TileSize; p += BlockSize)
+                {
+                    const index_t q = p ^ j;
+
+                    if(q > p)
+                    {
+                        const bool ascending = (p & k) == 0;
+
+                        if((p_keys[p] > p_keys[q]) == ascending)
+                        {
+                            const IndexDataType key = p_keys[p];
+                            const OutDataType value = p_values[p];
+
+                            p_keys[p]   = p_keys[q];
+                            p_values[p] = p_values[q];
+                            p_keys[q]   = key;
+                            p_values[q] = value;
+                        }
+                    }
+                }
+
+                block_sync_lds();
+            }
+        }
+    }
+
+    __device__ static void Run(const InDataType* __restrict__ p_in_global,
+                               const IndexDataType* __restrict__ p_indices_global,
+                               OutDataType* __restrict__ p_out_global,
+                               const index_t input_length,
+                               const ElementwiseOperation& elementwise_op)
+    {
+        __shared__ IndexDataType p_keys[TileSize];
+        __shared__ OutDataType p_values[TileSize];
+        __shared__ bool p_scan_flags[BlockSize];
+        __shared__ OutDataType p_scan_values[BlockSize];
+
+        const auto in_global_buf =
+            make_dynamic_buffer<AddressSpaceEnum::Global>(p_in_global, input_length);
+
+        const auto indices_global_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(
+            p_indices_global, input_length, NumericLimits<IndexDataType>::Lowest());
+
+        const index_t thread_local_id = get_thread_local_1d_id();
+        const index_t num_tiles       = math::integer_divide_ceil(input_length, TileSize);
+
+        constexpr auto identity_value = ReduceOperation::template GetIdentityValue<OutDataType>();
+
+        // this thread owns the sorted elements [chunk_begin, chunk_begin + ThreadTileSize)
+        const index_t chunk_begin = thread_local_id * ThreadTileSize;
+
+        for(index_t tile = get_block_1d_id(); tile < num_tiles; tile += get_grid_size())
+        {
+            const index_t tile_begin = tile * TileSize;
+
+            // coalesced load, padding elements get a negative index and are skipped
+            for(index_t p = thread_local_id; p < TileSize; p += BlockSize)
+            {
+                const bool is_valid = tile_begin + p < input_length;
+
+                InDataType in_value =
+                    in_global_buf.template Get<InDataType>(tile_begin + p, is_valid);
+
+                elementwise_op(in_value, in_value);
+
+                p_keys[p] =
+                    indices_global_buf.template Get<IndexDataType>(tile_begin + p, is_valid);
+                p_values[p] = type_convert<OutDataType>(in_value);
+            }
+
+            block_sync_lds();
+
+            if constexpr(!IndicesSorted)
+                SortTile(p_keys, p_values);
+
+            IndexDataType keys[ThreadTileSize];
+            OutDataType values[ThreadTileSize];
+
+            for(index_t i = 0; i < ThreadTileSize; ++i)
+            {
+                keys[i]   = p_keys[chunk_begin + i];
+                values[i] = p_values[chunk_begin + i];
+            }
+
+            const bool has_prev_key = chunk_begin > 0;
+            const bool has_next_key = chunk_begin + ThreadTileSize < TileSize;
+
+            const IndexDataType prev_key =
+                has_prev_key ? p_keys[chunk_begin - 1] : IndexDataType{};
+            const IndexDataType next_key =
+                has_next_key ? p_keys[chunk_begin + ThreadTileSize] : IndexDataType{};
+
+            const auto is_run_begin = [&](index_t i) {
+                return i == 0 ? !has_prev_key || keys[0] != prev_key : keys[i] != keys[i - 1];
+            };
+
+            const auto is_run_end = [&](index_t i) {
+                return i == ThreadTileSize - 1 ? !has_next_key || keys[i] != next_key
+                                               : keys[i] != keys[i + 1];
+            };
+
+            // partial of the chunk: whether a run begins in it, and the reduction of its last run
+            bool scan_flag         = false;
+            OutDataType scan_value = identity_value;
+
+            for(index_t i = 0; i < ThreadTileSize; ++i)
+            {
+                if(is_run_begin(i))
+                {
+                    scan_flag  = true;
+                    scan_value = identity_value;
+                }
+
+                ReduceOperation{}(scan_value, values[i]);
+            }
+
+            p_scan_flags[thread_local_id]  = scan_flag;
+            p_scan_values[thread_local_id] = scan_value;
+
+            block_sync_lds();
+
+            // inclusive segmented scan of the chunk partials over the block
+            for(index_t offset = 1; offset < BlockSize; offset *= 2)
+            {
+                const bool has_prev_partial = thread_local_id >= offset;
+
+                bool prev_flag         = false;
+                OutDataType prev_value = identity_value;
+
+                if(has_prev_partial)
+                {
+                    prev_flag  = p_scan_flags[thread_local_id - offset];
+                    prev_value = p_scan_values[thread_local_id - offset];
+                }
+
+                block_sync_lds();
+
+                if(has_prev_partial)
+                {
+                    if(!scan_flag)
+                        ReduceOperation{}(scan_value, prev_value);
+
+                    scan_flag = scan_flag || prev_flag;
+
+                    p_scan_flags[thread_local_id]  = scan_flag;
+                    p_scan_values[thread_local_id] = scan_value;
+                }
+
+                block_sync_lds();
+            }
+
+            // the run the chunk starts with may have begun in the preceding chunks
+            OutDataType acc_value =
+                has_prev_key ? p_scan_values[thread_local_id - 1] : identity_value;
+
+            for(index_t i = 0; i < ThreadTileSize; ++i)
+            {
+                if(is_run_begin(i))
+                    acc_value = identity_value;
+
+                ReduceOperation{}(acc_value, values[i]);
+
+                if(is_run_end(i) && keys[i] >= 0)
+                {
+                    if constexpr(MemOp == InMemoryDataOperationEnum::AtomicAdd)
+                        atomic_add<OutDataType>(p_out_global + keys[i], acc_value);
+                    else
+                        atomic_max<OutDataType>(p_out_global + keys[i], acc_value);
+                }
+            }
+
+            // LDS is overwritten by the next tile
+            block_sync_lds();
+        }
+    }
+};
+
+} // namespace ck
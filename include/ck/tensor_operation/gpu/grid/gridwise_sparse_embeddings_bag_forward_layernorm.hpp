@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_operation/gpu/device/embedding_bag_pooling_mode.hpp"
+#include "ck/tensor_operation/gpu/thread/threadwise_welford.hpp"
+#include "ck/tensor_operation/gpu/block/blockwise_welford.hpp"
+
+namespace ck {
+
+template <typename GridwiseSparseEmbeddingsBag,
+          typename EmbType,
+          typename IndexType,
+          typename WeightDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          typename EmbElementwiseOperation,
+          ck::index_t NumEmbeddings>
+#if CK_USE_LAUNCH_BOUNDS
+__launch_bounds__(CK_MAX_THREAD_PER_BLOCK, CK_MIN_BLOCK_PER_CU)
+#endif
+    __global__ void kernel_sparse_embeddings_bag_forward_layernorm(
+        OutType* p_out,
+        const ck::Array<EmbType*, NumEmbeddings> p_embs,
+        const ck::Array<IndexType*, NumEmbeddings> p_indexes,
+        const ck::Array<IndexType*, NumEmbeddings> p_offsets,
+        const ck::Array<WeightDataType*, NumEmbeddings> p_per_sample_weights,
+        const GammaDataType* p_gamma,
+        const BetaDataType* p_beta,
+        const index_t num_bags,
+        const tensor_operation::device::EmbeddingBagPoolingMode pooling_mode,
+        const AccDataType epsilon,
+        const EmbElementwiseOperation emb_elementwise_op)
+{
+    GridwiseSparseEmbeddingsBag::Run(p_out,
+                                     p_embs,
+                                     p_indexes,
+                                     p_offsets,
+                                     p_per_sample_weights,
+                                     p_gamma,
+                                     p_beta,
+                                     num_bags,
+                                     pooling_mode,
+                                     epsilon,
+                                     emb_elementwise_op);
+}
+
+// Every table i gathers the rows p_indexes[i][p_offsets[i][bag] : p_offsets[i][bag + 1]] of bag,
+// scaled by p_per_sample_weights[i] if it is not null, and pools them by sum or mean. The pooled
+// rows of all the tables are combined by EmbElementwiseOperation, then layernorm is applied
+template <typename EmbType,
+          typename IndexType,
+          typename WeightDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          typename EmbElementwiseOperation,
+          ck::index_t BlockSize,
+          ck::index_t DimClusterSize,
+          ck::index_t RowClusterSize,
+          ck::index_t DimPerBlock,   // Bag x Row, along Bag
+          ck::index_t RowPerBlock,   // Bag x Row, along Row
+          ck::index_t DimThreadSize, // number of bags handled by each thread
+          ck::index_t RowVectorSize,
+          ck::index_t NumEmbeddings>
+struct GridwiseSparseEmbeddingsBagForwardLayernorm
+{
+    static constexpr auto I0          = Number<0>{};
+    static constexpr auto I1          = Number<1>{};
+    static constexpr index_t WaveSize = 64;
+
+    static_assert(BlockSize == RowClusterSize * DimClusterSize,
+                  "Invalid cluster distribution within block");
+
+    // all the threads of a wave work on the same bags, so bag offsets and indices are wave-uniform
+    static_assert(RowClusterSize % WaveSize == 0, "need to be wavewise");
+
+    static_assert(DimPerBlock % (DimClusterSize * DimThreadSize) == 0, "");
+    static_assert(RowPerBlock % (RowClusterSize * RowVectorSize) == 0, "");
+
+    static constexpr index_t DimSubBlocks = DimPerBlock / (DimClusterSize * DimThreadSize);
+    static constexpr index_t RowSubBlocks = RowPerBlock / (RowClusterSize * RowVectorSize);
+
+    static constexpr index_t DimPerSubBlock = DimPerBlock / DimSubBlocks;
+
+    using ThreadwiseWolfordDesc2D = decltype(make_naive_tensor_descriptor_packed(
+        make_tuple(Number<DimThreadSize>{}, Number<RowSubBlocks * RowVectorSize>{})));
+
+    using ThreadwiseWolfordDescReduce =
+        decltype(make_naive_tensor_descriptor_packed(make_tuple(Number<DimThreadSize>{})));
+
+    using ThreadwiseWelford =
+        ThreadwiseWelford<AccDataType, ThreadwiseWolfordDesc2D, ThreadwiseWolfordDescReduce>;
+
+    using ThreadClusterLength = Sequence<DimClusterSize, RowClusterSize>;
+
+    using BlockwiseWelford =
+        BlockwiseWelford<AccDataType, BlockSize, ThreadClusterLength, Sequence<0, 1>>;
+
+    __device__ static void
+    Run(OutType* p_out,
+        const ck::Array<EmbType*, NumEmbeddings> p_embs,
+        const ck::Array<IndexType*, NumEmbeddings> p_indexes,
+        const ck::Array<IndexType*, NumEmbeddings> p_offsets,
+        const ck::Array<WeightDataType*, NumEmbeddings> p_per_sample_weights,
+        const GammaDataType* p_gamma,
+        const BetaDataType* p_beta,
+        const index_t num_bags,
+        const tensor_operation::device::EmbeddingBagPoolingMode pooling_mode,
+        const AccDataType epsilon,
+        const EmbElementwiseOperation emb_elementwise_op)
+    {
+        const index_t thread_local_id = get_thread_local_1d_id();
+        const index_t block_global_id = get_block_1d_id();
+
+        constexpr auto thread_cluster_desc =
+            make_cluster_descriptor(Sequence<DimClusterSize, RowClusterSize>{}, Sequence<0, 1>{});
+
+        const auto thread_cluster_idx =
+            thread_cluster_desc.CalculateBottomIndex(make_multi_index(thread_local_id));
+
+        const auto thread_dim_cluster_id = thread_cluster_idx[I0];
+        const auto thread_row_cluster_id = thread_cluster_idx[I1];
+
+        const index_t bag_start =
+            block_global_id * DimPerBlock +
+            __builtin_amdgcn_readfirstlane(thread_dim_cluster_id * DimThreadSize);
+
+        constexpr auto thread_buf_size =
+            DimSubBlocks * DimThreadSize * RowSubBlocks * RowVectorSize;
+        constexpr auto thread_buf_desc = make_naive_tensor_descriptor_packed(
+            make_tuple(DimSubBlocks, DimThreadSize, RowSubBlocks, RowVectorSize));
+        constexpr auto mean_var_buf_size = DimSubBlocks * DimThreadSize;
+        constexpr auto mean_var_buf_desc =
+            make_naive_tensor_descriptor_packed(make_tuple(DimSubBlocks, DimThreadSize));
+        constexpr auto row_buf_size = RowSubBlocks * RowVectorSize;
+        constexpr auto row_buf_desc =
+            make_naive_tensor_descriptor_packed(make_tuple(RowSubBlocks, RowVectorSize));
+
+        ck::Array<StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, row_buf_size, true>,
+                  NumEmbeddings>
+            pooled_thread_bufs;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, thread_buf_size, true> acc_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, row_buf_size, true> gamma_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, row_buf_size, true> beta_thread_buf;
+
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, mean_var_buf_size, true> mean_thread_buf;
+        StaticBuffer<AddressSpaceEnum::Vgpr, AccDataType, mean_var_buf_size, true> var_thread_buf;
+
+        auto get_thread_row_offset = [&](auto i_row_sub_) {
+            return (thread_row_cluster_id + i_row_sub_.value * RowClusterSize) * RowVectorSize;
+        };
+
+        // gather and pool the rows of one bag from every table, then combine the pooled rows
+        auto pool_current_bag = [&](auto i_dim_sub_, auto i_dim_vec_) {
+            const index_t bag = bag_start + i_dim_sub_.value * DimPerSubBlock + i_dim_vec_.value;
+
+            static_for<0, NumEmbeddings, 1>{}([&](auto i_embedding_) {
+                auto& pooled_thread_buf = pooled_thread_bufs(i_embedding_);
+
+                static_for<0, row_buf_size, 1>{}(
+                    [&](auto I) { pooled_thread_buf(I) = type_convert<AccDataType>(0.0f); });
+
+                if(bag >= num_bags)
+                    return;
+
+                const index_t bag_begin = p_offsets[i_embedding_][bag];
+                const index_t bag_end   = p_offsets[i_embedding_][bag + 1];
+
+                const WeightDataType* p_weights = p_per_sample_weights[i_embedding_];
+
+                for(index_t i = bag_begin; i < bag_end; ++i)
+                {
+                    const IndexType index = p_indexes[i_embedding_][i];
+
+                    const AccDataType weight = p_weights == nullptr
+                                                   ? type_convert<AccDataType>(1.0f)
+                                                   : type_convert<AccDataType>(p_weights[i]);
+
+                    int32x4_t emb_res = make_wave_buffer_resource_with_default_range(
+                        p_embs[i_embedding_] + index * RowPerBlock);
+
+                    static_for<0, RowSubBlocks, 1>{}([&](auto i_row_sub_) {
+                        vector_type_maker_t<EmbType, RowVectorSize> emb_vector;
+                        using src_vector_t = typename decltype(emb_vector)::type;
+
+                        emb_vector.template AsType<src_vector_t>()(I0) =
+                            amd_buffer_load_impl<EmbType, RowVectorSize>(
+                                emb_res, get_thread_row_offset(i_row_sub_) * sizeof(EmbType), 0);
+
+                        static_for<0, RowVectorSize, 1>{}([&](auto i_row_vec_) {
+                            constexpr auto offset =
+                                row_buf_desc.CalculateOffset(make_tuple(i_row_sub_, i_row_vec_));
+
+                            pooled_thread_buf(Number<offset>{}) +=
+                                weight * type_convert<AccDataType>(
+                                             emb_vector.template AsType<EmbType>()[i_row_vec_]);
+                        });
+                    });
+                }
+
+                if(pooling_mode == tensor_operation::device::EmbeddingBagPoolingMode::Mean &&
+                   bag_end > bag_begin)
+                {
+                    const AccDataType scale =
+                        type_convert<AccDataType>(1.0f) /
+                        type_convert<AccDataType>(static_cast<float>(bag_end - bag_begin));
+
+                    static_for<0, row_buf_size, 1>{}(
+                        [&](auto I) { pooled_thread_buf(I) *= scale; });
+                }
+            });
+
+            static_for<0, RowSubBlocks, 1>{}([&](auto i_row_sub_) {
+                static_for<0, RowVectorSize, 1>{}([&](auto i_row_vec_) {
+                    constexpr auto register_offset = thread_buf_desc.CalculateOffset(
+                        make_tuple(i_dim_sub_, i_dim_vec_, i_row_sub_, i_row_vec_));
+                    constexpr auto pooled_offset =
+                        row_buf_desc.CalculateOffset(make_tuple(i_row_sub_, i_row_vec_));
+
+                    auto in_data_refs = generate_tie(
+                        [&](auto i_embedding_) -> const auto& {
+                            return pooled_thread_bufs[i_embedding_][Number<pooled_offset>{}];
+                        },
+                        Number<NumEmbeddings>{});
+                    auto out_data_refs = generate_tie(
+                        [&](auto) -> auto& { return acc_thread_buf(Number<register_offset>{}); },
+                        Number<1>{});
+                    unpack2(emb_elementwise_op, out_data_refs, in_data_refs);
+                });
+            });
+        };
+
+        auto normalize_store_current_bag = [&](auto i_dim_sub_, auto i_dim_vec_) {
+            const index_t bag = bag_start + i_dim_sub_.value * DimPerSubBlock + i_dim_vec_.value;
+
+            if(bag >= num_bags)
+                return;
+
+            int32x4_t out_res =
+                make_wave_buffer_resource_with_default_range(p_out + bag * RowPerBlock);
+
+            constexpr auto mean_var_offset =
+                mean_var_buf_desc.CalculateOffset(make_tuple(i_dim_sub_, i_dim_vec_));
+
+            const auto divisor =
+                1 / __builtin_amdgcn_sqrtf(var_thread_buf(Number<mean_var_offset>{}) + epsilon);
+
+            static_for<0, RowSubBlocks, 1>{}([&](auto i_row_sub_) {
+                vector_type_maker_t<OutType, RowVectorSize> out_vector;
+                using dst_vector_t = typename decltype(out_vector)::type;
+
+                static_for<0, RowVectorSize, 1>{}([&](auto i_row_vec_) {
+                    constexpr auto register_offset = thread_buf_desc.CalculateOffset(
+                        make_tuple(i_dim_sub_, i_dim_vec_, i_row_sub_, i_row_vec_));
+                    constexpr auto gamma_beta_offset =
+                        row_buf_desc.CalculateOffset(make_tuple(i_row_sub_, i_row_vec_));
+
+                    auto acc_val = acc_thread_buf[Number<register_offset>{}];
+                    acc_val      = (acc_val - mean_thread_buf(Number<mean_var_offset>{})) * divisor;
+                    acc_val      = acc_val * gamma_thread_buf[Number<gamma_beta_offset>{}] +
+                              beta_thread_buf[Number<gamma_beta_offset>{}];
+
+                    out_vector.template AsType<OutType>()(Number<i_row_vec_>{}) =
+                        type_convert<OutType>(acc_val);
+                });
+
+                amd_buffer_store_impl<OutType, RowVectorSize>(
+                    out_vector.template AsType<dst_vector_t>()[Number<0>{}],
+                    out_res,
+                    get_thread_row_offset(i_row_sub_) * sizeof(OutType),
+                    0);
+            });
+        };
+
+        // load gamma/beta
+        static_for<0, RowSubBlocks, 1>{}([&](auto i_row_sub_) {
+            vector_type_maker_t<GammaDataType, RowVectorSize> gamma_vector;
+            vector_type_maker_t<BetaDataType, RowVectorSize> beta_vector;
+
+            int32x4_t gamma_res = make_wave_buffer_resource_with_default_range(p_gamma);
+            int32x4_t beta_res  = make_wave_buffer_resource_with_default_range(p_beta);
+
+            gamma_vector.template AsType<typename decltype(gamma_vector)::type>()(I0) =
+                amd_buffer_load_impl<GammaDataType, RowVectorSize>(
+                    gamma_res, get_thread_row_offset(i_row_sub_) * sizeof(GammaDataType), 0);
+            beta_vector.template AsType<typename decltype(beta_vector)::type>()(I0) =
+                amd_buffer_load_impl<BetaDataType, RowVectorSize>(
+                    beta_res, get_thread_row_offset(i_row_sub_) * sizeof(BetaDataType), 0);
+
+            static_for<0, RowVectorSize, 1>{}([&](auto i_row_vec_) {
+                constexpr auto offset =
+                    row_buf_desc.CalculateOffset(make_tuple(i_row_sub_, i_row_vec_));
+                gamma_thread_buf(Number<offset>{}) = type_convert<AccDataType>(
+                    gamma_vector.template AsType<GammaDataType>()[Number<i_row_vec_>{}]);
+                beta_thread_buf(Number<offset>{}) = type_convert<AccDataType>(
+                    beta_vector.template AsType<BetaDataType>()[Number<i_row_vec_>{}]);
+            });
+        });
+
+        static_for<0, mean_var_buf_size, 1>{}([&](auto I) {
+            mean_thread_buf(I) = type_convert<AccDataType>(0.0f);
+            var_thread_buf(I)  = type_convert<AccDataType>(0.0f);
+        });
+
+        static_for<0, DimSubBlocks, 1>{}([&](auto i_dim_sub) {
+            static_for<0, DimThreadSize, 1>{}(
+                [&](auto i_dim_vec) { pool_current_bag(i_dim_sub, i_dim_vec); });
+
+            // threadwise welford, every bag of the thread has the same number of elements
+            auto threadwise_welford = ThreadwiseWelford();
+
+            static_for<0, RowSubBlocks, 1>{}([&](auto i_row_sub) {
+                static_for<0, RowVectorSize, 1>{}([&](auto i_row_vec) {
+                    threadwise_welford.cur_count_++;
+
+                    static_for<0, DimThreadSize, 1>{}([&](auto i_dim_vec) {
+                        constexpr auto register_offset = thread_buf_desc.CalculateOffset(
+                            make_tuple(i_dim_sub, i_dim_vec, i_row_sub, i_row_vec));
+                        constexpr auto mean_var_offset =
+                            mean_var_buf_desc.CalculateOffset(make_tuple(i_dim_sub, i_dim_vec));
+
+                        threadwise_welford.Update(mean_thread_buf(Number<mean_var_offset>{}),
+                                                  var_thread_buf(Number<mean_var_offset>{}),
+                                                  acc_thread_buf[Number<register_offset>{}]);
+                    });
+                });
+            });
+
+            // blockwise welford, it overwrites the count so each bag works on its own copy
+            static_for<0, DimThreadSize, 1>{}([&](auto i_dim_vec) {
+                constexpr auto mean_var_offset =
+                    mean_var_buf_desc.CalculateOffset(make_tuple(i_dim_sub, i_dim_vec));
+
+                int count = threadwise_welford.cur_count_;
+
+                block_sync_lds();
+                BlockwiseWelford::Run(mean_thread_buf(Number<mean_var_offset>{}),
+                                      var_thread_buf(Number<mean_var_offset>{}),
+                                      count);
+            });
+
+            static_for<0, DimThreadSize, 1>{}(
+                [&](auto i_dim_vec) { normalize_store_current_bag(i_dim_sub, i_dim_vec); });
+        });
+    }
+};
+
+} // namespace ck
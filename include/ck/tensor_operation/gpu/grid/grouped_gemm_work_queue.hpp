@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+
+// Scheduling of a persistent grouped GEMM: about one workgroup per CU is launched, and the
+// workgroups pull work items, i.e. (group, tile) pairs, from a device-side queue until it is
+// empty. The groups are queued largest first, so that the last items to be handed out are the
+// cheap ones and the workgroups finish at about the same time. The items of a group are
+// consecutive, the items [ItemBegin_g, ItemEnd_g) of the g-th group in queue order being its tiles.
+//
+// The host parts below, the order of the groups and a model of the queue, let the scheduling be
+// tested without a GPU.
+
+// Order of the groups in the queue: decreasing cost, e.g. number of tiles times K, ties in group
+// order
+inline std::vector<index_t> MakeLargestFirstGroupOrder(const std::vector<long_index_t>& group_costs)
+{
+    std::vector<index_t> order(group_costs.size());
+
+    std::iota(order.begin(), order.end(), 0);
+
+    std::stable_sort(order.begin(), order.end(), [&](index_t lhs, index_t rhs) {
+        return group_costs[lhs] > group_costs[rhs];
+    });
+
+    return order;
+}
+
+// Position in the queue order of the group that owns work item `item`, where
+// get_item_end(g) is ItemEnd of the g-th group in queue order. The items a workgroup pulls from
+// the queue are increasing, so the search goes forward from the group of its previous item:
+// over all its items a workgroup visits each group at most once, instead of searching all the
+// groups for every tile.
+template <typename GetItemEnd>
+__host__ __device__ index_t FindWorkItemGroup(const GetItemEnd& get_item_end,
+                                              index_t group_count,
+                                              index_t item,
+                                              index_t cursor)
+{
+    while(cursor < group_count - 1 && item >= get_item_end(cursor))
+    {
+        ++cursor;
+    }
+
+    return cursor;
+}
+
+// Host model of the queue: num_workgroups workgroups pull the item_count items in order, a
+// workgroup taking the next item as soon as it is done with its previous one, and item i takes
+// get_item_cost(i). Returns the time the last workgroup is done; the workgroup of each item is
+// written to workgroup_of_item if not null.
+template <typename GetItemCost>
+long_index_t SimulatePersistentWorkQueue(index_t item_count,
+                                         index_t num_workgroups,
+                                         const GetItemCost& get_item_cost,
+                                         std::vector<index_t>* workgroup_of_item = nullptr)
+{
+    // (time the workgroup is free, workgroup), earliest first then lowest workgroup first
+    using Event = std::pair<long_index_t, index_t>;
+
+    std::priority_queue<Event, std::vector<Event>, std::greater<Event>> free_workgroups;
+
+    for(index_t w = 0; w < num_workgroups; ++w)
+    {
+        free_workgroups.emplace(0, w);
+    }
+
+    if(workgroup_of_item != nullptr)
+    {
+        workgroup_of_item->assign(item_count, -1);
+    }
+
+    long_index_t makespan = 0;
+
+    for(index_t item = 0; item < item_count; ++item)
+    {
+        const auto [time, w] = free_workgroups.top();
+
+        free_workgroups.pop();
+
+        const long_index_t done = time + get_item_cost(item);
+
+        makespan = std::max(makespan, done);
+
+        if(workgroup_of_item != nullptr)
+        {
+            (*workgroup_of_item)[item] = w;
+        }
+
+        free_workgroups.emplace(done, w);
+    }
+
+    return makespan;
+}
+
+// Device side of the queue, two counters in global memory: the next work item, and the number of
+// workgroups which are done. They are zeroed by the host on the stream before every launch, and
+// the last workgroup to be done zeroes them again, so that the kernel can be launched back to
+// back without any memset in between, e.g. by the timing loop of launch_and_time_kernel.
+struct PersistentWorkQueue
+{
+    static constexpr std::size_t GetCounterSize() { return 2 * sizeof(uint32_t); }
+
+    // the next work item, the same for all the threads of the workgroup
+    __device__ index_t Pop() const
+    {
+        __shared__ index_t item;
+
+        if(get_thread_local_1d_id() == 0)
+        {
+            item = static_cast<index_t>(atomic_add<uint32_t>(p_counters_, 1));
+        }
+
+        block_sync_lds();
+
+        const index_t v = item;
+
+        // everyone has the item before the next Pop overwrites it
+        block_sync_lds();
+
+        return v;
+    }
+
+    // to be called by every workgroup after its last Pop
+    __device__ void Finish() const
+    {
+        if(get_thread_local_1d_id() == 0)
+        {
+            __threadfence();
+
+            const uint32_t num_done = atomic_add<uint32_t>(p_counters_ + 1, 1) + 1;
+
+            if(num_done == static_cast<uint32_t>(get_grid_size()))
+            {
+                p_counters_[0] = 0;
+                p_counters_[1] = 0;
+
+                __threadfence();
+            }
+        }
+    }
+
+    uint32_t* p_counters_;
+};
+
+// Tile map running the tile of a work item instead of the one of the workgroup id
+template <typename Block2ETileMap>
+struct WorkItemToETileMap
+{
+    template <typename TopIdx>
+    __host__ __device__ constexpr auto CalculateBottomIndex(const TopIdx&) const
+    {
+        return block_2_etile_map_.CalculateBottomIndex(make_multi_index(item_));
+    }
+
+    template <typename CTileIdx, typename CTileDim>
+    __host__ __device__ bool ValidCTileIndex(const CTileIdx& c_tile_idx,
+                                             const CTileDim& c_tile_dim) const
+    {
+        return block_2_etile_map_.ValidCTileIndex(c_tile_idx, c_tile_dim);
+    }
+
+    const Block2ETileMap& block_2_etile_map_;
+    index_t item_;
+};
+
+} // namespace ck
@@ -0,0 +1,212 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/utility/common_header.hpp"
+
+namespace ck {
+
+// Transform matrices of the Winograd minimal filtering algorithm F(m x m, 3 x 3), for which
+//   y = AT * [(G * g * GT) .* (BT * d * B)] * A
+// with d the (m + 2) x (m + 2) input tile, g the 3 x 3 filter and y the m x m output tile
+template <index_t OutputTileSize>
+struct WinogradCoefficients_3x3;
+
+template <>
+struct WinogradCoefficients_3x3<2>
+{
+    struct BT
+    {
+        static constexpr index_t NRow = 4;
+        static constexpr index_t NCol = 4;
+
+        __host__ __device__ static constexpr float At(index_t i, index_t j)
+        {
+            // clang-format off
+            constexpr float m[NRow][NCol] = {
+                {1.f, 0.f, -1.f, 0.f},
+                {0.f, 1.f, 1.f, 0.f},
+                {0.f, -1.f, 1.f, 0.f},
+                {0.f, 1.f, 0.f, -1.f}};
+            // clang-format on
+
+            return m[i][j];
+        }
+    };
+
+    struct G
+    {
+        static constexpr index_t NRow = 4;
+        static constexpr index_t NCol = 3;
+
+        __host__ __device__ static constexpr float At(index_t i, index_t j)
+        {
+            // clang-format off
+            constexpr float m[NRow][NCol] = {
+                {1.f, 0.f, 0.f},
+                {0.5f, 0.5f, 0.5f},
+                {0.5f, -0.5f, 0.5f},
+                {0.f, 0.f, 1.f}};
+            // clang-format on
+
+            return m[i][j];
+        }
+    };
+
+    struct AT
+    {
+        static constexpr index_t NRow = 2;
+        static constexpr index_t NCol = 4;
+
+        __host__ __device__ static constexpr float At(index_t i, index_t j)
+        {
+            // clang-format off
+            constexpr float m[NRow][NCol] = {{1.f, 1.f, 1.f, 0.f}, {0.f, 1.f, -1.f, -1.f}};
+            // clang-format on
+
+            return m[i][j];
+        }
+    };
+};
+
+// interpolation points 0, +-1, +-2 and infinity
+template <>
+struct WinogradCoefficients_3x3<4>
+{
+    struct BT
+    {
+        static constexpr index_t NRow = 6;
+        static constexpr index_t NCol = 6;
+
+        __host__ __device__ static constexpr float At(index_t i, index_t j)
+        {
+            // clang-format off
+            constexpr float m[NRow][NCol] = {
+                {4.f, 0.f, -5.f, 0.f, 1.f, 0.f},
+                {0.f, -4.f, -4.f, 1.f, 1.f, 0.f},
+                {0.f, 4.f, -4.f, -1.f, 1.f, 0.f},
+                {0.f, -2.f, -1.f, 2.f, 1.f, 0.f},
+                {0.f, 2.f, -1.f, -2.f, 1.f, 0.f},
+                {0.f, 4.f, 0.f, -5.f, 0.f, 1.f}};
+            // clang-format on
+
+            return m[i][j];
+        }
+    };
+
+    struct G
+    {
+        static constexpr index_t NRow = 6;
+        static constexpr index_t NCol = 3;
+
+        __host__ __device__ static constexpr float At(index_t i, index_t j)
+        {
+            // clang-format off
+            constexpr float m[NRow][NCol] = {
+                {1.f / 4, 0.f, 0.f},
+                {-1.f / 6, -1.f / 6, -1.f / 6},
+                {-1.f / 6, 1.f / 6, -1.f / 6},
+                {1.f / 24, 1.f / 12, 1.f / 6},
+                {1.f / 24, -1.f / 12, 1.f / 6},
+                {0.f, 0.f, 1.f}};
+            // clang-format on
+
+            return m[i][j];
+        }
+    };
+
+    struct AT
+    {
+        static constexpr index_t NRow = 4;
+        static constexpr index_t NCol = 6;
+
+        __host__ __device__ static constexpr float At(index_t i, index_t j)
+        {
+            // clang-format off
+            constexpr float m[NRow][NCol] = {
+                {1.f, 1.f, 1.f, 1.f, 1.f, 0.f},
+                {0.f, 1.f, -1.f, 2.f, -2.f, 0.f},
+                {0.f, 1.f, 1.f, 4.f, 4.f, 0.f},
+                {0.f, 1.f, -1.f, 8.f, -8.f, 1.f}};
+            // clang-format on
+
+            return m[i][j];
+        }
+    };
+};
+
+// Input, filter and output transforms of one tile, computed in T (float or double). Host code
+// uses the same functions, so the host reference rounds exactly where the kernels do
+template <index_t OutputTileSize>
+struct ThreadwiseWinogradTransform_3x3
+{
+    using Coefficients = WinogradCoefficients_3x3<OutputTileSize>;
+
+    static constexpr index_t FilterSize = 3;
+    static constexpr index_t TileSize   = OutputTileSize + FilterSize - 1;
+
+    // v = BT * d * B
+    template <typename T>
+    __host__ __device__ static void InputTransform(const T (&d)[TileSize][TileSize],
+                                                   T (&v)[TileSize][TileSize])
+    {
+        Apply<typename Coefficients::BT>(d, v);
+    }
+
+    // u = G * g * GT
+    template <typename T>
+    __host__ __device__ static void FilterTransform(const T (&g)[FilterSize][FilterSize],
+                                                    T (&u)[TileSize][TileSize])
+    {
+        Apply<typename Coefficients::G>(g, u);
+    }
+
+    // y = AT * m * A
+    template <typename T>
+    __host__ __device__ static void OutputTransform(const T (&m)[TileSize][TileSize],
+                                                    T (&y)[OutputTileSize][OutputTileSize])
+    {
+        Apply<typename Coefficients::AT>(m, y);
+    }
+
+    private:
+    // y = L * x * LT, the zero coefficients are skipped at compile time
+    template <typename L, typename T>
+    __host__ __device__ static void Apply(const T (&x)[L::NCol][L::NCol], T (&y)[L::NRow][L::NRow])
+    {
+        T tmp[L::NRow][L::NCol];
+
+        static_for<0, L::NRow, 1>{}([&](auto i) {
+            static_for<0, L::NCol, 1>{}([&](auto j) {
+                T acc = 0;
+
+                static_for<0, L::NCol, 1>{}([&](auto k) {
+                    constexpr float c = L::At(i.value, k.value);
+
+                    if constexpr(c < 0 || c > 0)
+                        acc += type_convert<T>(c) * x[k][j];
+                });
+
+                tmp[i][j] = acc;
+            });
+        });
+
+        static_for<0, L::NRow, 1>{}([&](auto i) {
+            static_for<0, L::NRow, 1>{}([&](auto j) {
+                T acc = 0;
+
+                static_for<0, L::NCol, 1>{}([&](auto k) {
+                    constexpr float c = L::At(j.value, k.value);
+
+                    if constexpr(c < 0 || c > 0)
+                        acc += tmp[i][k] * type_convert<T>(c);
+                });
+
+                y[i][j] = acc;
+            });
+        });
+    }
+};
+
+} // namespace ck
@@ -0,0 +1,216 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <stdexcept>
+#include <vector>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/utility/magic_division.hpp"
+
+namespace ck {
+namespace tensor_operation {
+
+/*
+ * Address generation of the A matrix of an implicit GEMM forward convolution, the Default
+ * specialization of TransformConvFwdToGemm with a strided input layout (G_NW_C, NWGC, ...),
+ * without the Pad, Embed and Merge transforms.
+ *
+ * GEMM K = Z * Y * X * C is walked in steps of KPerStep, C being divisible by KPerStep so that
+ * a step stays inside one filter position. The offset of (m, k) splits into a part that only
+ * depends on m, computed once per row, and a part that only depends on the step: the host
+ * builds a table with, for each step, the offset delta from the previous step and the dilated
+ * filter coordinates. The row of an iterator then moves from step to step by adding the delta,
+ * and checks the padding by comparing its input coordinates plus the filter coordinates of the
+ * step to the input lengths.
+ */
+template <index_t NDimSpatial>
+struct ConvFwdAOffsetTable
+{
+    struct Entry
+    {
+        // offset of the step minus the offset of the previous step, the offset of the first one
+        index_t offset_delta_;
+        // filter coordinates of the step times the dilations
+        index_t filter_offsets_[NDimSpatial];
+    };
+
+    // what an iterator needs to place its row, passed to the kernel along with the table
+    struct Problem
+    {
+        index_t n_stride_;
+        index_t c_stride_;
+        index_t input_lengths_[NDimSpatial];
+        index_t input_strides_[NDimSpatial];
+        index_t output_lengths_[NDimSpatial];
+        uint32_t output_magic_multipliers_[NDimSpatial];
+        uint32_t output_magic_shifts_[NDimSpatial];
+        index_t conv_strides_[NDimSpatial];
+        index_t left_pads_[NDimSpatial];
+        index_t k_per_step_;
+        index_t num_steps_;
+    };
+
+    // the lengths and strides are ordered G, N, C, spatial dimensions for the input, G, K, C,
+    // spatial for the weight and G, N, K, spatial for the output
+    ConvFwdAOffsetTable(const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+                        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+                        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                        const std::array<index_t, NDimSpatial + 3>& c_g_n_k_wos_lengths,
+                        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                        const std::array<index_t, NDimSpatial>& input_left_pads,
+                        index_t k_per_step)
+    {
+        const index_t C = a_g_n_c_wis_lengths[2];
+
+        if(k_per_step <= 0 || C % k_per_step != 0)
+        {
+            throw std::runtime_error("wrong! C must be divisible by the K per step");
+        }
+
+        problem_.n_stride_   = a_g_n_c_wis_strides[1];
+        problem_.c_stride_   = a_g_n_c_wis_strides[2];
+        problem_.k_per_step_ = k_per_step;
+
+        index_t num_filter_positions = 1;
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            const index_t output_length = c_g_n_k_wos_lengths[3 + i];
+
+            problem_.input_lengths_[i]  = a_g_n_c_wis_lengths[3 + i];
+            problem_.input_strides_[i]  = a_g_n_c_wis_strides[3 + i];
+            problem_.output_lengths_[i] = output_length;
+            problem_.output_magic_multipliers_[i] =
+                MagicDivision::CalculateMagicMultiplier(static_cast<uint32_t>(output_length));
+            problem_.output_magic_shifts_[i] =
+                MagicDivision::CalculateMagicShift(static_cast<uint32_t>(output_length));
+            problem_.conv_strides_[i] = conv_filter_strides[i];
+            problem_.left_pads_[i]    = input_left_pads[i];
+
+            num_filter_positions *= b_g_k_c_xs_lengths[3 + i];
+        }
+
+        const index_t num_c_steps = C / k_per_step;
+
+        problem_.num_steps_ = num_filter_positions * num_c_steps;
+
+        entries_.resize(problem_.num_steps_);
+
+        index_t prev_offset = 0;
+
+        // K is ordered filter position, then C, the last filter dimension being the fastest
+        for(index_t step = 0; step < problem_.num_steps_; ++step)
+        {
+            Entry& entry = entries_[step];
+
+            const index_t c0 = (step % num_c_steps) * k_per_step;
+
+            index_t filter_position = step / num_c_steps;
+            index_t offset          = c0 * problem_.c_stride_;
+
+            for(index_t i = NDimSpatial - 1; i >= 0; --i)
+            {
+                const index_t x = filter_position % b_g_k_c_xs_lengths[3 + i];
+
+                filter_position /= b_g_k_c_xs_lengths[3 + i];
+
+                entry.filter_offsets_[i] = x * conv_filter_dilations[i];
+
+                offset += entry.filter_offsets_[i] * problem_.input_strides_[i];
+            }
+
+            entry.offset_delta_ = offset - prev_offset;
+
+            prev_offset = offset;
+        }
+    }
+
+    const Problem& GetProblem() const { return problem_; }
+
+    const std::vector<Entry>& GetEntries() const { return entries_; }
+
+    // bytes of the table, for copying it to the device
+    std::size_t GetTableSize() const { return sizeof(Entry) * entries_.size(); }
+
+    private:
+    Problem problem_;
+    std::vector<Entry> entries_;
+};
+
+// Walks one row m of the A matrix over the steps of a ConvFwdAOffsetTable. The offset of
+// (m, k0 + dk), k0 being the first K of the current step, is GetOffset() + dk * c_stride_.
+template <index_t NDimSpatial>
+struct ConvFwdAOffsetIterator
+{
+    using Table = ConvFwdAOffsetTable<NDimSpatial>;
+
+    __host__ __device__ ConvFwdAOffsetIterator(const typename Table::Problem& problem,
+                                               const typename Table::Entry* p_entries,
+                                               index_t m)
+        : problem_{problem}, p_entries_{p_entries}, step_{0}
+    {
+        // m = (n, output coordinates), the last output dimension being the fastest
+        index_t tmp    = m;
+        index_t offset = 0;
+
+        for(index_t i = NDimSpatial - 1; i >= 0; --i)
+        {
+            const index_t tmp2 = MagicDivision::DoMagicDivision(
+                tmp, problem.output_magic_multipliers_[i], problem.output_magic_shifts_[i]);
+
+            const index_t o = tmp - tmp2 * problem.output_lengths_[i];
+
+            tmp = tmp2;
+
+            input_coords_[i] = o * problem.conv_strides_[i] - problem.left_pads_[i];
+
+            offset += input_coords_[i] * problem.input_strides_[i];
+        }
+
+        offset_ = tmp * problem.n_stride_ + offset + p_entries_[0].offset_delta_;
+    }
+
+    __host__ __device__ constexpr index_t GetOffset() const { return offset_; }
+
+    // false if the current step of the row reads padding
+    __host__ __device__ constexpr bool IsValid() const
+    {
+        bool is_valid = true;
+
+        static_for<0, NDimSpatial, 1>{}([&](auto i) {
+            const index_t w = input_coords_[i] + p_entries_[step_].filter_offsets_[i];
+
+            is_valid = is_valid && w >= 0 && w < problem_.input_lengths_[i];
+        });
+
+        return is_valid;
+    }
+
+    __host__ __device__ constexpr bool HasNextStep() const
+    {
+        return step_ + 1 < problem_.num_steps_;
+    }
+
+    __host__ __device__ constexpr void MoveToNextStep()
+    {
+        ++step_;
+
+        offset_ += p_entries_[step_].offset_delta_;
+    }
+
+    private:
+    // a copy, the iterator may outlive the problem it is made from, e.g. a kernel argument
+    typename Table::Problem problem_;
+    const typename Table::Entry* p_entries_;
+    index_t step_;
+    index_t offset_;
+    // input coordinates of the row at the first filter position
+    index_t input_coords_[NDimSpatial];
+};
+
+} // namespace tensor_operation
+} // namespace ck
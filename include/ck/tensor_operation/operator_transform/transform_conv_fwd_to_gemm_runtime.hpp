@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include "ck/utility/common_header.hpp"
+#include "ck/tensor_description/runtime_tensor_descriptor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+
+// Grid-level descriptors of TransformConvFwdToGemm<NDimSpatial, Default> for the strided layouts
+// (G_NW_C, NWGC, ...), as RuntimeTensorDescriptor: the descriptors of 1D, 2D and 3D convolutions
+// have the same type. The lengths and strides are ordered G, N, C, spatial dimensions for the
+// input, G, K, C, spatial for the weight and G, N, K, spatial for the output.
+template <typename Desc = RuntimeTensorDescriptor<>>
+struct TransformConvFwdToGemmRuntime
+{
+    template <index_t NDimSpatial>
+    static Desc
+    MakeADescriptor_M_K(const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_lengths,
+                        const std::array<index_t, NDimSpatial + 3>& a_g_n_c_wis_strides,
+                        const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                        const std::array<index_t, NDimSpatial + 3>& c_g_n_k_wos_lengths,
+                        const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                        const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                        const std::array<index_t, NDimSpatial>& input_left_pads,
+                        const std::array<index_t, NDimSpatial>& input_right_pads)
+    {
+        // N, Wi..., C
+        std::vector<index_t> lengths{a_g_n_c_wis_lengths[1]};
+        std::vector<index_t> strides{a_g_n_c_wis_strides[1]};
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            lengths.push_back(a_g_n_c_wis_lengths[3 + i]);
+            strides.push_back(a_g_n_c_wis_strides[3 + i]);
+        }
+
+        lengths.push_back(a_g_n_c_wis_lengths[2]);
+        strides.push_back(a_g_n_c_wis_strides[2]);
+
+        auto desc = Desc::MakeNaive(lengths, strides);
+
+        // N, Wip..., C
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            desc.Pad(1 + i, input_left_pads[i], input_right_pads[i]);
+        }
+
+        // N, X, Wo, ..., C
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            desc.Embed(1 + 2 * i,
+                       {b_g_k_c_xs_lengths[3 + i], c_g_n_k_wos_lengths[3 + i]},
+                       {conv_filter_dilations[i], conv_filter_strides[i]});
+        }
+
+        // N * Wo..., X..., C
+        std::vector<index_t> m_dims;
+
+        for(index_t i = 0; i <= NDimSpatial; ++i)
+        {
+            m_dims.push_back(2 * i);
+        }
+
+        desc.Merge(m_dims);
+
+        // N * Wo..., X... * C
+        std::vector<index_t> k_dims;
+
+        for(index_t i = 1; i <= NDimSpatial + 1; ++i)
+        {
+            k_dims.push_back(i);
+        }
+
+        desc.Merge(k_dims);
+
+        return desc;
+    }
+
+    template <index_t NDimSpatial>
+    static Desc MakeBDescriptor_N_K(const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_lengths,
+                                    const std::array<index_t, NDimSpatial + 3>& b_g_k_c_xs_strides)
+    {
+        // K, X..., C
+        std::vector<index_t> lengths{b_g_k_c_xs_lengths[1]};
+        std::vector<index_t> strides{b_g_k_c_xs_strides[1]};
+        std::vector<index_t> k_dims;
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            lengths.push_back(b_g_k_c_xs_lengths[3 + i]);
+            strides.push_back(b_g_k_c_xs_strides[3 + i]);
+            k_dims.push_back(1 + i);
+        }
+
+        lengths.push_back(b_g_k_c_xs_lengths[2]);
+        strides.push_back(b_g_k_c_xs_strides[2]);
+        k_dims.push_back(1 + NDimSpatial);
+
+        auto desc = Desc::MakeNaive(lengths, strides);
+
+        // K, X... * C
+        desc.Merge(k_dims);
+
+        return desc;
+    }
+
+    template <index_t NDimSpatial>
+    static Desc MakeCDescriptor_M_N(const std::array<index_t, NDimSpatial + 3>& c_g_n_k_wos_lengths,
+                                    const std::array<index_t, NDimSpatial + 3>& c_g_n_k_wos_strides)
+    {
+        // N, Wo..., K
+        std::vector<index_t> lengths{c_g_n_k_wos_lengths[1]};
+        std::vector<index_t> strides{c_g_n_k_wos_strides[1]};
+        std::vector<index_t> m_dims{0};
+
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            lengths.push_back(c_g_n_k_wos_lengths[3 + i]);
+            strides.push_back(c_g_n_k_wos_strides[3 + i]);
+            m_dims.push_back(1 + i);
+        }
+
+        lengths.push_back(c_g_n_k_wos_lengths[2]);
+        strides.push_back(c_g_n_k_wos_strides[2]);
+
+        auto desc = Desc::MakeNaive(lengths, strides);
+
+        // N * Wo..., K
+        desc.Merge(m_dims);
+
+        return desc;
+    }
+};
+
+} // namespace tensor_operation
+} // namespace ck
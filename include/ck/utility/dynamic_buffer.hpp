@@ -48,6 +48,24 @@ struct DynamicBuffer
         return BufferAddressSpace;
     }
 
+#if CK_HOST_EMULATION
+    // see host_emulation::MemoryAccessTrace
+    template <typename X>
+    void TraceAccess(index_t i, bool is_valid_element, bool is_write) const
+    {
+        if constexpr(GetAddressSpace() == AddressSpaceEnum::Global ||
+                     GetAddressSpace() == AddressSpaceEnum::Lds)
+        {
+            constexpr auto space = GetAddressSpace() == AddressSpaceEnum::Global
+                                       ? host_emulation::MemorySpace::Global
+                                       : host_emulation::MemorySpace::Lds;
+
+            host_emulation::record_access(
+                space, &p_data_[i], sizeof(X), is_valid_element, is_write);
+        }
+    }
+#endif
+
     __host__ __device__ constexpr const T& operator[](index_t i) const { return p_data_[i]; }
 
     __host__ __device__ constexpr T& operator()(index_t i) { return p_data_[i]; }
@@ -66,6 +84,10 @@ struct DynamicBuffer
         static_assert(scalar_per_x_vector % scalar_per_t_vector == 0,
                       "wrong! X should contain multiple T");
 
+#if CK_HOST_EMULATION
+        TraceAccess<X>(i, is_valid_element, false);
+#endif
+
 #if CK_USE_AMD_BUFFER_LOAD
         bool constexpr use_amd_buffer_addressing = true;
 #else
@@ -161,6 +183,10 @@ struct DynamicBuffer
         static_assert(scalar_per_x_vector % scalar_per_t_vector == 0,
                       "wrong! X should contain multiple T");
 
+#if CK_HOST_EMULATION
+        TraceAccess<X>(i, is_valid_element, true);
+#endif
+
 #if CK_USE_AMD_BUFFER_STORE
         bool constexpr use_amd_buffer_addressing = true;
 #else
@@ -306,6 +332,10 @@ struct DynamicBuffer
         static_assert(scalar_per_x_vector % scalar_per_t_vector == 0,
                       "wrong! X should contain multiple T");
 
+#if CK_HOST_EMULATION
+        TraceAccess<X>(i, is_valid_element, true);
+#endif
+
         static_assert(GetAddressSpace() == AddressSpaceEnum::Global, "only support global mem");
 
 #if CK_USE_AMD_BUFFER_ATOMIC_ADD_INTEGER && CK_USE_AMD_BUFFER_ATOMIC_ADD_FLOAT
@@ -353,6 +383,10 @@ struct DynamicBuffer
         static_assert(scalar_per_x_vector % scalar_per_t_vector == 0,
                       "wrong! X should contain multiple T");
 
+#if CK_HOST_EMULATION
+        TraceAccess<X>(i, is_valid_element, true);
+#endif
+
         static_assert(GetAddressSpace() == AddressSpaceEnum::Global, "only support global mem");
 
 #if CK_USE_AMD_BUFFER_ATOMIC_MAX_FLOAT64
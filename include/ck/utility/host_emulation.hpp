@@ -0,0 +1,466 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+// Host emulation of the device side, enabled by building with CK_HOST_EMULATION=1 (included by
+// ck.hpp then). The kernels are built as plain C++ by the host compiler, clang for the vector
+// extensions and _Float16, without -x hip, and launch_and_time_kernel runs them on the CPU:
+//   - every GPU thread of a workgroup is a std::thread, the workgroups of the grid running one
+//     after the other,
+//   - __shared__ variables are static, i.e. shared by the threads of the running workgroup,
+//   - block_sync_lds() / __syncthreads() are barriers of these threads,
+//   - the buffer instructions and inline asm are disabled (see ck.hpp), and the builtins used by
+//     the xdlops GEMM paths have scalar fallbacks below, MFMAs exchanging their operands across
+//     the 64 threads of the wave,
+//   - the accesses of DynamicBuffer to global memory and LDS can be recorded, see
+//     MemoryAccessTrace and host_utility/host_emulation_trace.hpp.
+//
+// It is meant for functional tests of the tile logic and for access-pattern analysis, not speed.
+// Limitations: one translation unit per executable (the device functions are not inline), the
+// single-block MFMAs of fp32, fp16 and bf16 only, no inter-wave scheduling, no wmma, and a thread
+// leaving the kernel early or throwing while others wait at a barrier deadlocks the launch.
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __shared__
+#undef __shared__
+#endif
+#define __shared__ static
+
+struct HostEmulationDim3
+{
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t z = 0;
+};
+
+inline thread_local HostEmulationDim3 threadIdx;
+inline thread_local HostEmulationDim3 blockIdx;
+inline HostEmulationDim3 blockDim;
+inline HostEmulationDim3 gridDim;
+
+inline constexpr int warpSize = 64;
+
+namespace ck {
+namespace host_emulation {
+
+class Barrier
+{
+    public:
+    explicit Barrier(int count) : count_{count} {}
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        const uint64_t generation = generation_;
+
+        if(++num_arrived_ == count_)
+        {
+            num_arrived_ = 0;
+            ++generation_;
+            condition_.notify_all();
+        }
+        else
+        {
+            condition_.wait(lock, [&] { return generation != generation_; });
+        }
+    }
+
+    private:
+    std::mutex mutex_;
+    std::condition_variable condition_;
+    const int count_;
+    int num_arrived_     = 0;
+    uint64_t generation_ = 0;
+};
+
+// MFMA operands of the lanes of a wave
+struct Wave
+{
+    static constexpr int MaxKPerLane = 8;
+
+    explicit Wave(int num_lanes)
+        : barrier{num_lanes}, a(warpSize * MaxKPerLane), b(warpSize * MaxKPerLane)
+    {
+    }
+
+    Barrier barrier;
+    std::vector<float> a;
+    std::vector<float> b;
+};
+
+struct Workgroup
+{
+    explicit Workgroup(int block_size) : barrier{block_size}
+    {
+        for(int w = 0; w * warpSize < block_size; ++w)
+        {
+            waves.emplace_back(std::min(warpSize, block_size - w * warpSize));
+        }
+    }
+
+    Barrier barrier;
+    std::deque<Wave> waves;
+};
+
+struct ThreadState
+{
+    Workgroup* workgroup = nullptr;
+    int thread_id        = 0;
+    int block_id         = 0;
+    uint32_t num_access  = 0;
+};
+
+inline thread_local ThreadState thread_state;
+
+inline void block_barrier() { thread_state.workgroup->barrier.Wait(); }
+
+// memory access trace
+enum struct MemorySpace
+{
+    Global,
+    Lds
+};
+
+struct MemoryAccess
+{
+    MemorySpace space_;
+    int block_id_;
+    int thread_id_;
+    // n-th access of the thread in the workgroup, the same for the lanes of a wave executing the
+    // same instruction as long as they do not diverge
+    uint32_t sequence_;
+    uintptr_t address_;
+    uint32_t num_bytes_;
+    bool is_write_;
+};
+
+struct MemoryAccessTrace
+{
+    void Record(const MemoryAccess& access)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        accesses_.push_back(access);
+    }
+
+    std::mutex mutex_;
+    std::vector<MemoryAccess> accesses_;
+};
+
+// set to record the accesses of the kernels launched afterwards
+inline MemoryAccessTrace* memory_access_trace = nullptr;
+
+inline void
+record_access(MemorySpace space, const void* p, std::size_t num_bytes, bool is_valid, bool is_write)
+{
+    const uint32_t sequence = thread_state.num_access++;
+
+    // invalid elements are not read or written
+    if(memory_access_trace == nullptr || !is_valid)
+    {
+        return;
+    }
+
+    memory_access_trace->Record(MemoryAccess{space,
+                                             thread_state.block_id,
+                                             thread_state.thread_id,
+                                             sequence,
+                                             reinterpret_cast<uintptr_t>(p),
+                                             static_cast<uint32_t>(num_bytes),
+                                             is_write});
+}
+
+// Runs kernel(args...) on grid_x * grid_y * grid_z workgroups of block_x * block_y * block_z
+// threads
+template <typename Kernel, typename... Args>
+void launch_kernel(uint32_t grid_x,
+                   uint32_t grid_y,
+                   uint32_t grid_z,
+                   uint32_t block_x,
+                   uint32_t block_y,
+                   uint32_t block_z,
+                   Kernel kernel,
+                   Args... args)
+{
+    const int block_size = block_x * block_y * block_z;
+
+    gridDim  = HostEmulationDim3{grid_x, grid_y, grid_z};
+    blockDim = HostEmulationDim3{block_x, block_y, block_z};
+
+    Workgroup workgroup{block_size};
+
+    std::vector<std::thread> threads;
+
+    threads.reserve(block_size);
+
+    for(int t = 0; t < block_size; ++t)
+    {
+        threads.emplace_back([&, t] {
+            threadIdx = HostEmulationDim3{static_cast<uint32_t>(t) % block_x,
+                                          static_cast<uint32_t>(t) / block_x % block_y,
+                                          static_cast<uint32_t>(t) / (block_x * block_y)};
+
+            thread_state.workgroup = &workgroup;
+            thread_state.thread_id = t;
+
+            for(uint32_t z = 0; z < grid_z; ++z)
+            {
+                for(uint32_t y = 0; y < grid_y; ++y)
+                {
+                    for(uint32_t x = 0; x < grid_x; ++x)
+                    {
+                        blockIdx = HostEmulationDim3{x, y, z};
+
+                        thread_state.block_id   = (z * grid_y + y) * grid_x + x;
+                        thread_state.num_access = 0;
+
+                        kernel(args...);
+
+                        // the LDS of the workgroup is reused by the next one
+                        block_barrier();
+                    }
+                }
+            }
+        });
+    }
+
+    for(auto& thread : threads)
+    {
+        thread.join();
+    }
+}
+
+// scalar fallbacks of the builtins
+inline float to_float(float x) { return x; }
+
+inline float to_float(_Float16 x) { return static_cast<float>(x); }
+
+// bhalf_t
+inline float to_float(unsigned short x)
+{
+    const uint32_t u = static_cast<uint32_t>(x) << 16;
+
+    float f;
+
+    std::memcpy(&f, &u, sizeof(float));
+
+    return f;
+}
+
+template <typename V>
+float lane_element(const V& v, int i)
+{
+    if constexpr(std::is_same_v<V, float>)
+    {
+        return v;
+    }
+    else
+    {
+        return to_float(v[i]);
+    }
+}
+
+template <typename V>
+constexpr int lane_length()
+{
+    if constexpr(std::is_same_v<V, float>)
+    {
+        return 1;
+    }
+    else
+    {
+        return sizeof(V) / sizeof(std::declval<V>()[0]);
+    }
+}
+
+// D = A * B + C of a single-block M x N x K MFMA, K = KPerLane * 64 / M. Lane l holds
+// A[l % M][k], B[k][l % N] for k in [(l / M) * KPerLane, (l / M + 1) * KPerLane), and the rows
+// (j / 4) * (4 * 64 / N) + 4 * (l / N) + j % 4 of column l % N of D in its j-th register.
+template <int M, int N, typename VA, typename VC>
+VC mfma(const VA& reg_a, const VA& reg_b, const VC& reg_c)
+{
+    static_assert(M == N && M * N % warpSize == 0, "wrong! not a single-block MFMA");
+
+    constexpr int KPerLane   = lane_length<VA>();
+    constexpr int LaneGroups = warpSize / N;
+    constexpr int NumRegs    = M * N / warpSize;
+
+    static_assert(KPerLane <= Wave::MaxKPerLane, "wrong!");
+
+    auto& wave = thread_state.workgroup->waves[thread_state.thread_id / warpSize];
+
+    const int lane = thread_state.thread_id % warpSize;
+
+    for(int k = 0; k < KPerLane; ++k)
+    {
+        wave.a[lane * KPerLane + k] = lane_element(reg_a, k);
+        wave.b[lane * KPerLane + k] = lane_element(reg_b, k);
+    }
+
+    wave.barrier.Wait();
+
+    VC reg_d = reg_c;
+
+    for(int j = 0; j < NumRegs; ++j)
+    {
+        const int m = (j / 4) * (4 * LaneGroups) + 4 * (lane / N) + j % 4;
+        const int n = lane % N;
+
+        float acc = 0;
+
+        for(int g = 0; g < LaneGroups; ++g)
+        {
+            for(int k = 0; k < KPerLane; ++k)
+            {
+                acc += wave.a[(g * M + m) * KPerLane + k] * wave.b[(g * N + n) * KPerLane + k];
+            }
+        }
+
+        reg_d[j] += acc;
+    }
+
+    // the operands stay until all the lanes are done with them
+    wave.barrier.Wait();
+
+    return reg_d;
+}
+
+// v_perm_b32
+inline uint32_t perm(uint32_t src0, uint32_t src1, uint32_t selector)
+{
+    const uint64_t bytes = (static_cast<uint64_t>(src0) << 32) | src1;
+
+    uint32_t result = 0;
+
+    for(int i = 0; i < 4; ++i)
+    {
+        const uint32_t sel = (selector >> (8 * i)) & 0xff;
+
+        uint32_t byte;
+
+        if(sel < 8)
+        {
+            byte = (bytes >> (8 * sel)) & 0xff;
+        }
+        else if(sel < 12)
+        {
+            // sign of byte 1, 3, 5 or 7
+            byte = ((bytes >> (16 * (sel - 8) + 15)) & 1) ? 0xff : 0x00;
+        }
+        else
+        {
+            byte = sel == 12 ? 0x00 : 0xff;
+        }
+
+        result |= byte << (8 * i);
+    }
+
+    return result;
+}
+
+inline int32_t sdot4(int32_t a, int32_t b, int32_t c)
+{
+    for(int i = 0; i < 4; ++i)
+    {
+        c += static_cast<int8_t>(a >> (8 * i)) * static_cast<int8_t>(b >> (8 * i));
+    }
+
+    return c;
+}
+
+template <typename T, typename F>
+T atomic_update(T* p, F f)
+{
+    T old;
+
+    __atomic_load(p, &old, __ATOMIC_RELAXED);
+
+    T desired = f(old);
+
+    while(!__atomic_compare_exchange(p, &old, &desired, false, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+    {
+        desired = f(old);
+    }
+
+    return old;
+}
+
+} // namespace host_emulation
+} // namespace ck
+
+inline void __syncthreads() { ck::host_emulation::block_barrier(); }
+
+inline void __threadfence() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+inline void __threadfence_block() { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+
+template <typename T>
+T atomicAdd(T* p, T x)
+{
+    if constexpr(std::is_integral_v<T>)
+    {
+        return __atomic_fetch_add(p, x, __ATOMIC_SEQ_CST);
+    }
+    else
+    {
+        return ck::host_emulation::atomic_update(p, [&](T old) { return old + x; });
+    }
+}
+
+template <typename T>
+T atomicMax(T* p, T x)
+{
+    return ck::host_emulation::atomic_update(p, [&](T old) { return old < x ? x : old; });
+}
+
+template <typename T>
+T atomicCAS(T* p, T compare, T x)
+{
+    __atomic_compare_exchange(p, &compare, &x, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+
+    return compare;
+}
+
+extern "C" inline float __ocml_native_recip_f32(float x) { return 1.f / x; }
+
+#define __builtin_amdgcn_readfirstlane(x) (x)
+#define __builtin_amdgcn_s_barrier() ck::host_emulation::block_barrier()
+#define __builtin_amdgcn_sched_barrier(mask) static_cast<void>(mask)
+#define __builtin_amdgcn_sched_group_barrier(mask, size, id) static_cast<void>(mask)
+#define __builtin_amdgcn_s_setprio(prio) static_cast<void>(prio)
+#define __builtin_amdgcn_s_waitcnt(cnt) static_cast<void>(cnt)
+#define __builtin_amdgcn_sqrtf(x) std::sqrt(static_cast<float>(x))
+#define __builtin_amdgcn_sqrt(x) std::sqrt(static_cast<double>(x))
+#define __builtin_amdgcn_perm(src0, src1, sel) \
+    static_cast<int32_t>(ck::host_emulation::perm(src0, src1, sel))
+#define __builtin_amdgcn_sdot4(a, b, c, clamp) ck::host_emulation::sdot4(a, b, c)
+
+#define __builtin_amdgcn_mfma_f32_32x32x2f32(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<32, 32>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_16x16x4f32(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<16, 16>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_32x32x8f16(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<32, 32>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_16x16x16f16(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<16, 16>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_32x32x4bf16(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<32, 32>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_16x16x8bf16(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<16, 16>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_32x32x8bf16_1k(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<32, 32>(a, b, c)
+#define __builtin_amdgcn_mfma_f32_16x16x16bf16_1k(a, b, c, cbsz, abid, blgp) \
+    ck::host_emulation::mfma<16, 16>(a, b, c)
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <utility>
+
 #include "ck/utility/integral_constant.hpp"
 #include "ck/utility/type.hpp"
 #include "ck/utility/functional.hpp"
@@ -199,36 +201,23 @@ struct sequence_merge<Seq>
     using type = Seq;
 };
 
-// generate sequence
-template <index_t NSize, typename F>
-struct sequence_gen
-{
-    template <index_t IBegin, index_t NRemain, typename G>
-    struct sequence_gen_impl
-    {
-        static constexpr index_t NRemainLeft  = NRemain / 2;
-        static constexpr index_t NRemainRight = NRemain - NRemainLeft;
-        static constexpr index_t IMiddle      = IBegin + NRemainLeft;
-
-        using type = typename sequence_merge<
-            typename sequence_gen_impl<IBegin, NRemainLeft, G>::type,
-            typename sequence_gen_impl<IMiddle, NRemainRight, G>::type>::type;
-    };
+namespace detail {
 
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 1, G>
-    {
-        static constexpr index_t Is = G{}(Number<I>{});
-        using type                  = Sequence<Is>;
-    };
+template <typename F, index_t... Is>
+__host__ __device__ constexpr auto generate_sequence(std::integer_sequence<index_t, Is...>)
+{
+    return Sequence<F{}(Number<Is>{})...>{};
+}
 
-    template <index_t I, typename G>
-    struct sequence_gen_impl<I, 0, G>
-    {
-        using type = Sequence<>;
-    };
+} // namespace detail
 
-    using type = typename sequence_gen_impl<0, NSize, F>::type;
+// generate sequence, std::make_integer_sequence being a compiler builtin instead of a recursion
+// on NSize
+template <index_t NSize, typename F>
+struct sequence_gen
+{
+    using type =
+        decltype(detail::generate_sequence<F>(std::make_integer_sequence<index_t, NSize>{}));
 };
 
 // arithmetic sequence
@@ -243,13 +232,10 @@ struct arithmetic_sequence_gen
         }
     };
 
-    using type0 = typename sequence_gen<(IEnd - IBegin) / Increment, F>::type;
-    using type1 = Sequence<>;
-
     static constexpr bool kHasContent =
         (Increment > 0 && IBegin < IEnd) || (Increment < 0 && IBegin > IEnd);
 
-    using type = typename conditional<kHasContent, type0, type1>::type;
+    using type = typename sequence_gen<kHasContent ? (IEnd - IBegin) / Increment : 0, F>::type;
 };
 
 // uniform sequence
@@ -307,24 +293,15 @@ struct sequence_split
 template <typename Seq>
 struct sequence_reverse
 {
-    static constexpr index_t NSize = Seq{}.Size();
-
-    using seq_split = sequence_split<Seq, NSize / 2>;
-    using type      = typename sequence_merge<
-        typename sequence_reverse<typename seq_split::right_type>::type,
-        typename sequence_reverse<typename seq_split::left_type>::type>::type;
-};
-
-template <index_t I>
-struct sequence_reverse<Sequence<I>>
-{
-    using type = Sequence<I>;
-};
+    struct F
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return Seq::At(Seq::Size() - 1 - i);
+        }
+    };
 
-template <index_t I0, index_t I1>
-struct sequence_reverse<Sequence<I0, I1>>
-{
-    using type = Sequence<I1, I0>;
+    using type = typename sequence_gen<Seq::Size(), F>::type;
 };
 
 #if 1
@@ -349,158 +326,122 @@ struct sequence_reduce<Reduce, Seq>
 };
 #endif
 
-template <typename Values, typename Ids, typename Compare>
-struct sequence_sort_impl
+namespace detail {
+
+// Values sorted by Less and their positions in the unsorted sequence, the first size_ of them
+// being the result. The sorting is done on constexpr arrays: a recursive merge sort on
+// Sequence types instantiates a class per step and dominates the front-end time of the
+// instances, through GetNumOfHiddenDimension of every tensor descriptor.
+template <index_t N>
+struct SortedSequenceData
+{
+    // one more element, the arrays of an empty sequence not being empty
+    index_t values_[N + 1];
+    index_t ids_[N + 1];
+    index_t size_;
+};
+
+// stable, with the duplicates by Equal removed if Unique
+template <typename Less, typename Equal, bool Unique, index_t... Xs>
+__host__ __device__ constexpr auto sort_sequence_data(Sequence<Xs...>)
 {
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl
-    {
-        static constexpr bool choose_left = LeftValues::Front() < RightValues::Front();
-
-        static constexpr index_t chosen_value =
-            choose_left ? LeftValues::Front() : RightValues::Front();
-        static constexpr index_t chosen_id = choose_left ? LeftIds::Front() : RightIds::Front();
-
-        using new_merged_values = decltype(MergedValues::PushBack(Number<chosen_value>{}));
-        using new_merged_ids    = decltype(MergedIds::PushBack(Number<chosen_id>{}));
-
-        using new_left_values =
-            typename conditional<choose_left, decltype(LeftValues::PopFront()), LeftValues>::type;
-        using new_left_ids =
-            typename conditional<choose_left, decltype(LeftIds::PopFront()), LeftIds>::type;
-
-        using new_right_values =
-            typename conditional<choose_left, RightValues, decltype(RightValues::PopFront())>::type;
-        using new_right_ids =
-            typename conditional<choose_left, RightIds, decltype(RightIds::PopFront())>::type;
-
-        using merge = sorted_sequence_merge_impl<new_left_values,
-                                                 new_left_ids,
-                                                 new_right_values,
-                                                 new_right_ids,
-                                                 new_merged_values,
-                                                 new_merged_ids,
-                                                 Comp>;
-        // this is output
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+    constexpr index_t N = sizeof...(Xs);
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<LeftValues,
-                                      LeftIds,
-                                      Sequence<>,
-                                      Sequence<>,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
-    {
-        using merged_values = typename sequence_merge<MergedValues, LeftValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, LeftIds>::type;
-    };
+    SortedSequenceData<N> data{{Xs..., 0}, {}, N};
 
-    template <typename RightValues,
-              typename RightIds,
-              typename MergedValues,
-              typename MergedIds,
-              typename Comp>
-    struct sorted_sequence_merge_impl<Sequence<>,
-                                      Sequence<>,
-                                      RightValues,
-                                      RightIds,
-                                      MergedValues,
-                                      MergedIds,
-                                      Comp>
+    for(index_t i = 0; i < N; ++i)
     {
-        using merged_values = typename sequence_merge<MergedValues, RightValues>::type;
-        using merged_ids    = typename sequence_merge<MergedIds, RightIds>::type;
-    };
+        data.ids_[i] = i;
+    }
 
-    template <typename LeftValues,
-              typename LeftIds,
-              typename RightValues,
-              typename RightIds,
-              typename Comp>
-    struct sorted_sequence_merge
+    // insertion sort, the sequences are short
+    for(index_t i = 1; i < N; ++i)
     {
-        using merge = sorted_sequence_merge_impl<LeftValues,
-                                                 LeftIds,
-                                                 RightValues,
-                                                 RightIds,
-                                                 Sequence<>,
-                                                 Sequence<>,
-                                                 Comp>;
-
-        using merged_values = typename merge::merged_values;
-        using merged_ids    = typename merge::merged_ids;
-    };
+        const index_t value = data.values_[i];
+        const index_t id    = data.ids_[i];
 
-    static constexpr index_t nsize = Values::Size();
+        index_t j = i;
 
-    using split_unsorted_values = sequence_split<Values, nsize / 2>;
-    using split_unsorted_ids    = sequence_split<Ids, nsize / 2>;
+        for(; j > 0 && Less{}(value, data.values_[j - 1]); --j)
+        {
+            data.values_[j] = data.values_[j - 1];
+            data.ids_[j]    = data.ids_[j - 1];
+        }
 
-    using left_unsorted_values = typename split_unsorted_values::left_type;
-    using left_unsorted_ids    = typename split_unsorted_ids::left_type;
-    using left_sort          = sequence_sort_impl<left_unsorted_values, left_unsorted_ids, Compare>;
-    using left_sorted_values = typename left_sort::sorted_values;
-    using left_sorted_ids    = typename left_sort::sorted_ids;
+        data.values_[j] = value;
+        data.ids_[j]    = id;
+    }
 
-    using right_unsorted_values = typename split_unsorted_values::right_type;
-    using right_unsorted_ids    = typename split_unsorted_ids::right_type;
-    using right_sort = sequence_sort_impl<right_unsorted_values, right_unsorted_ids, Compare>;
-    using right_sorted_values = typename right_sort::sorted_values;
-    using right_sorted_ids    = typename right_sort::sorted_ids;
+    if constexpr(Unique)
+    {
+        data.size_ = N > 0 ? 1 : 0;
 
-    using merged_sorted = sorted_sequence_merge<left_sorted_values,
-                                                left_sorted_ids,
-                                                right_sorted_values,
-                                                right_sorted_ids,
-                                                Compare>;
+        for(index_t i = 1; i < N; ++i)
+        {
+            if(!Equal{}(data.values_[i], data.values_[data.size_ - 1]))
+            {
+                data.values_[data.size_] = data.values_[i];
+                data.ids_[data.size_]    = data.ids_[i];
 
-    using sorted_values = typename merged_sorted::merged_values;
-    using sorted_ids    = typename merged_sorted::merged_ids;
-};
+                ++data.size_;
+            }
+        }
+    }
+
+    return data;
+}
 
-template <index_t ValueX, index_t ValueY, index_t IdX, index_t IdY, typename Compare>
-struct sequence_sort_impl<Sequence<ValueX, ValueY>, Sequence<IdX, IdY>, Compare>
+template <typename Values, typename Less, typename Equal, bool Unique>
+struct sequence_sort_impl
 {
-    static constexpr bool choose_x = Compare{}(ValueX, ValueY);
+    static constexpr auto data_ = sort_sequence_data<Less, Equal, Unique>(Values{});
 
-    using sorted_values =
-        typename conditional<choose_x, Sequence<ValueX, ValueY>, Sequence<ValueY, ValueX>>::type;
-    using sorted_ids = typename conditional<choose_x, Sequence<IdX, IdY>, Sequence<IdY, IdX>>::type;
-};
+    struct GetValue
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const
+        {
+            return data_.values_[i];
+        }
+    };
 
-template <index_t Value, index_t Id, typename Compare>
-struct sequence_sort_impl<Sequence<Value>, Sequence<Id>, Compare>
-{
-    using sorted_values = Sequence<Value>;
-    using sorted_ids    = Sequence<Id>;
+    struct GetId
+    {
+        __host__ __device__ constexpr index_t operator()(index_t i) const { return data_.ids_[i]; }
+    };
+
+    using sorted_values = typename sequence_gen<data_.size_, GetValue>::type;
+    using sorted_ids    = typename sequence_gen<data_.size_, GetId>::type;
 };
 
-template <typename Compare>
-struct sequence_sort_impl<Sequence<>, Sequence<>, Compare>
+// whether Xs is a permutation of 0, ..., N - 1
+template <index_t... Xs>
+__host__ __device__ constexpr bool is_valid_sequence_map_impl(Sequence<Xs...>)
 {
-    using sorted_values = Sequence<>;
-    using sorted_ids    = Sequence<>;
-};
+    constexpr index_t N = sizeof...(Xs);
+
+    const index_t xs[N + 1] = {Xs..., 0};
+
+    bool found[N + 1] = {};
+
+    for(index_t i = 0; i < N; ++i)
+    {
+        if(xs[i] < 0 || xs[i] >= N || found[xs[i]])
+        {
+            return false;
+        }
+
+        found[xs[i]] = true;
+    }
+
+    return true;
+}
+
+} // namespace detail
 
 template <typename Values, typename Compare>
 struct sequence_sort
 {
-    using unsorted_ids = typename arithmetic_sequence_gen<0, Values::Size(), 1>::type;
-    using sort         = sequence_sort_impl<Values, unsorted_ids, Compare>;
+    using sort = detail::sequence_sort_impl<Values, Compare, Compare, false>;
 
     // this is output
     using type                = typename sort::sorted_values;
@@ -510,108 +451,39 @@ struct sequence_sort
 template <typename Values, typename Less, typename Equal>
 struct sequence_unique_sort
 {
-    template <typename RemainValues,
-              typename RemainIds,
-              typename UniquifiedValues,
-              typename UniquifiedIds,
-              typename Eq>
-    struct sorted_sequence_uniquify_impl
-    {
-        static constexpr index_t current_value = RemainValues::Front();
-        static constexpr index_t current_id    = RemainIds::Front();
-
-        static constexpr bool is_unique_value = (current_value != UniquifiedValues::Back());
-
-        using new_remain_values = decltype(RemainValues::PopFront());
-        using new_remain_ids    = decltype(RemainIds::PopFront());
-
-        using new_uniquified_values =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedValues::PushBack(Number<current_value>{})),
-                                 UniquifiedValues>::type;
-
-        using new_uniquified_ids =
-            typename conditional<is_unique_value,
-                                 decltype(UniquifiedIds::PushBack(Number<current_id>{})),
-                                 UniquifiedIds>::type;
-
-        using uniquify = sorted_sequence_uniquify_impl<new_remain_values,
-                                                       new_remain_ids,
-                                                       new_uniquified_values,
-                                                       new_uniquified_ids,
-                                                       Eq>;
-
-        // this is output
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
-
-    template <typename UniquifiedValues, typename UniquifiedIds, typename Eq>
-    struct sorted_sequence_uniquify_impl<Sequence<>,
-                                         Sequence<>,
-                                         UniquifiedValues,
-                                         UniquifiedIds,
-                                         Eq>
-    {
-        using uniquified_values = UniquifiedValues;
-        using uniquified_ids    = UniquifiedIds;
-    };
-
-    template <typename SortedValues, typename SortedIds, typename Eq>
-    struct sorted_sequence_uniquify
-    {
-        using uniquify = sorted_sequence_uniquify_impl<decltype(SortedValues::PopFront()),
-                                                       decltype(SortedIds::PopFront()),
-                                                       Sequence<SortedValues::Front()>,
-                                                       Sequence<SortedIds::Front()>,
-                                                       Eq>;
-
-        using uniquified_values = typename uniquify::uniquified_values;
-        using uniquified_ids    = typename uniquify::uniquified_ids;
-    };
-
-    using sort          = sequence_sort<Values, Less>;
-    using sorted_values = typename sort::type;
-    using sorted_ids    = typename sort::sorted2unsorted_map;
-
-    using uniquify = sorted_sequence_uniquify<sorted_values, sorted_ids, Equal>;
+    using sort = detail::sequence_sort_impl<Values, Less, Equal, true>;
 
     // this is output
-    using type                = typename uniquify::uniquified_values;
-    using sorted2unsorted_map = typename uniquify::uniquified_ids;
+    using type                = typename sort::sorted_values;
+    using sorted2unsorted_map = typename sort::sorted_ids;
 };
 
 template <typename SeqMap>
-struct is_valid_sequence_map : is_same<typename arithmetic_sequence_gen<0, SeqMap::Size(), 1>::type,
-                                       typename sequence_sort<SeqMap, math::less<index_t>>::type>
+struct is_valid_sequence_map
+    : integral_constant<bool, detail::is_valid_sequence_map_impl(SeqMap{})>
 {
 };
 
 template <typename SeqMap>
 struct sequence_map_inverse
 {
-    template <typename X2Y, typename WorkingY2X, index_t XBegin, index_t XRemain>
-    struct sequence_map_inverse_impl
+    struct F
     {
-        static constexpr auto new_y2x =
-            WorkingY2X::Modify(X2Y::At(Number<XBegin>{}), Number<XBegin>{});
+        // position of y in SeqMap
+        __host__ __device__ constexpr index_t operator()(index_t y) const
+        {
+            index_t x = 0;
 
-        using type =
-            typename sequence_map_inverse_impl<X2Y, decltype(new_y2x), XBegin + 1, XRemain - 1>::
-                type;
-    };
+            while(x < SeqMap::Size() && SeqMap::At(x) != y)
+            {
+                ++x;
+            }
 
-    template <typename X2Y, typename WorkingY2X, index_t XBegin>
-    struct sequence_map_inverse_impl<X2Y, WorkingY2X, XBegin, 0>
-    {
-        using type = WorkingY2X;
+            return x;
+        }
     };
 
-    using type =
-        typename sequence_map_inverse_impl<SeqMap,
-                                           typename uniform_sequence_gen<SeqMap::Size(), 0>::type,
-                                           0,
-                                           SeqMap::Size()>::type;
+    using type = typename sequence_gen<SeqMap::Size(), F>::type;
 };
 
 template <index_t... Xs, index_t... Ys>
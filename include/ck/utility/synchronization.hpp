@@ -21,7 +21,8 @@ __device__ void block_sync_lds()
 
 __device__ void s_nop()
 {
-#if 1
+#if CK_HOST_EMULATION
+#elif 1
     asm volatile("\
     s_nop 0 \n \
     " ::);
@@ -3,8 +3,11 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 
@@ -82,186 +85,120 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
-            if constexpr(NDimSpatial == 1)
-            {
-                auto f_kcx = [&](auto g, auto k, auto c, auto x) {
-                    float v_acc = 0;
-
-                    for(std::size_t n = 0; n < arg.output_.GetLengths()[1]; ++n)
-                    {
-                        for(std::size_t wo = 0; wo < arg.output_.GetLengths()[3]; ++wo)
-                        {
-                            auto wi = static_cast<ck::long_index_t>(wo * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(x * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-
-                            if(wi >= 0 &&
-                               ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[3])
-                            {
-                                float v_out;
-                                float v_in;
+            const auto& in_lengths  = arg.input_.mDesc.GetLengths();
+            const auto& in_strides  = arg.input_.mDesc.GetStrides();
+            const auto& wei_lengths = arg.weight_.mDesc.GetLengths();
+            const auto& wei_strides = arg.weight_.mDesc.GetStrides();
+            const auto& out_lengths = arg.output_.mDesc.GetLengths();
+            const auto& out_strides = arg.output_.mDesc.GetStrides();
 
-                                arg.out_element_op_(
-                                    v_out, ck::type_convert<float>(arg.output_(g, n, k, wo)));
+            const std::size_t N = out_lengths[1];
+            const std::size_t C = wei_lengths[2];
 
-                                arg.in_element_op_(
-                                    v_in, ck::type_convert<float>(arg.input_(g, n, c, wi)));
+            std::size_t num_output_position = 1;
+            std::size_t num_filter_position = 1;
 
-                                v_acc += v_out * v_in;
-                            }
-                        }
-                    }
-
-                    float v_wei;
-
-                    arg.wei_element_op_(v_wei, v_acc);
-
-                    arg.weight_(g, k, c, x) = ck::type_convert<WeiDataType>(v_wei);
-                };
+            for(std::size_t i = 0; i < NDimSpatial; ++i)
+            {
+                num_output_position *= out_lengths[3 + i];
+                num_filter_position *= wei_lengths[3 + i];
+            }
 
-                make_ParallelTensorFunctor(f_kcx,
-                                           arg.weight_.GetLengths()[0],
-                                           arg.weight_.GetLengths()[1],
-                                           arg.weight_.GetLengths()[2],
-                                           arg.weight_.GetLengths()[3])(
-                    std::thread::hardware_concurrency());
+            // One task per (g, k, filter position), reducing N * Do * Ho * Wo for all the C at
+            // once: every output value is read once rather than once per input channel, and the
+            // input channels it multiplies are contiguous in the usual layouts. The order of the
+            // sum over (n, do, ho, wo) does not change.
+            auto f_gkx = [&](auto g, auto k, auto filter_position) {
+                std::array<std::size_t, NDimSpatial> x;
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 2)
-            {
-                auto f_kcyx = [&](auto g, auto k, auto c, auto y, auto x) {
-                    std::size_t N = arg.output_.GetLengths()[1];
+                for(std::size_t i = NDimSpatial, tmp = filter_position; i > 0; --i)
+                {
+                    x[i - 1] = tmp % wei_lengths[2 + i];
+                    tmp /= wei_lengths[2 + i];
+                }
 
-                    std::size_t Ho = arg.output_.GetLengths()[3];
-                    std::size_t Wo = arg.output_.GetLengths()[4];
+                std::vector<float> v_acc(C, 0.f);
 
-                    float v_acc = 0;
+                for(std::size_t n = 0; n < N; ++n)
+                {
+                    std::array<std::size_t, NDimSpatial> wo{};
 
-                    for(std::size_t n = 0; n < N; ++n)
+                    for(std::size_t o = 0; o < num_output_position; ++o)
                     {
-                        for(std::size_t ho = 0; ho < Ho; ++ho)
+                        bool is_valid         = true;
+                        std::size_t in_offset = g * in_strides[0] + n * in_strides[1];
+                        std::size_t out_offset =
+                            g * out_strides[0] + n * out_strides[1] + k * out_strides[2];
+
+                        for(std::size_t i = 0; i < NDimSpatial; ++i)
                         {
-                            auto hi = static_cast<ck::long_index_t>(ho * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(y * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+                            const auto wi =
+                                static_cast<ck::long_index_t>(wo[i] * arg.conv_strides_[i]) +
+                                static_cast<ck::long_index_t>(x[i] * arg.conv_dilations_[i]) -
+                                static_cast<ck::long_index_t>(arg.in_left_pads_[i]);
 
-                            for(std::size_t wo = 0; wo < Wo; ++wo)
-                            {
-                                auto wi =
-                                    static_cast<ck::long_index_t>(wo * arg.conv_strides_[1]) +
-                                    static_cast<ck::long_index_t>(x * arg.conv_dilations_[1]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-
-                                if(hi >= 0 &&
-                                   ck::type_convert<std::size_t>(hi) < arg.input_.GetLengths()[3] &&
-                                   wi >= 0 &&
-                                   ck::type_convert<std::size_t>(wi) < arg.input_.GetLengths()[4])
-                                {
-                                    float v_out;
-                                    float v_in;
-
-                                    arg.out_element_op_(
-                                        v_out,
-                                        ck::type_convert<float>(arg.output_(g, n, k, ho, wo)));
-
-                                    arg.in_element_op_(
-                                        v_in, ck::type_convert<float>(arg.input_(g, n, c, hi, wi)));
-
-                                    v_acc += v_out * v_in;
-                                }
-                            }
+                            is_valid = is_valid && wi >= 0 &&
+                                       ck::type_convert<std::size_t>(wi) < in_lengths[3 + i];
+
+                            in_offset += wi * in_strides[3 + i];
+                            out_offset += wo[i] * out_strides[3 + i];
                         }
-                    }
 
-                    float v_wei;
+                        if(is_valid)
+                        {
+                            float v_out;
 
-                    arg.wei_element_op_(v_wei, v_acc);
+                            arg.out_element_op_(
+                                v_out, ck::type_convert<float>(arg.output_.mData[out_offset]));
 
-                    arg.weight_(g, k, c, y, x) = ck::type_convert<WeiDataType>(v_wei);
-                };
+                            for(std::size_t c = 0; c < C; ++c)
+                            {
+                                float v_in;
 
-                make_ParallelTensorFunctor(f_kcyx,
-                                           arg.weight_.GetLengths()[0],
-                                           arg.weight_.GetLengths()[1],
-                                           arg.weight_.GetLengths()[2],
-                                           arg.weight_.GetLengths()[3],
-                                           arg.weight_.GetLengths()[4])(
-                    std::thread::hardware_concurrency());
+                                arg.in_element_op_(
+                                    v_in,
+                                    ck::type_convert<float>(
+                                        arg.input_.mData[in_offset + c * in_strides[2]]));
 
-                return 0;
-            }
-            else if constexpr(NDimSpatial == 3)
-            {
-                auto f_kczyx = [&](auto g, auto k, auto c, auto z, auto y, auto x) {
-                    float v_acc = 0;
+                                v_acc[c] += v_out * v_in;
+                            }
+                        }
 
-                    for(std::size_t n = 0; n < arg.output_.GetLengths()[1]; ++n)
-                    {
-                        for(std::size_t do_ = 0; do_ < arg.output_.GetLengths()[3]; ++do_)
+                        // next output position, the last dimension being the fastest
+                        for(std::size_t i = NDimSpatial; i > 0; --i)
                         {
-                            auto di = static_cast<ck::long_index_t>(do_ * arg.conv_strides_[0]) +
-                                      static_cast<ck::long_index_t>(z * arg.conv_dilations_[0]) -
-                                      static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
-                            for(std::size_t ho = 0; ho < arg.output_.GetLengths()[4]; ++ho)
+                            if(++wo[i - 1] < out_lengths[2 + i])
                             {
-                                auto hi =
-                                    static_cast<ck::long_index_t>(ho * arg.conv_strides_[1]) +
-                                    static_cast<ck::long_index_t>(y * arg.conv_dilations_[1]) -
-                                    static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
-                                for(std::size_t wo = 0; wo < arg.output_.GetLengths()[5]; ++wo)
-                                {
-                                    auto wi =
-                                        static_cast<ck::long_index_t>(wo * arg.conv_strides_[2]) +
-                                        static_cast<ck::long_index_t>(x * arg.conv_dilations_[2]) -
-                                        static_cast<ck::long_index_t>(arg.in_left_pads_[2]);
-
-                                    if(di >= 0 &&
-                                       ck::type_convert<std::size_t>(di) <
-                                           arg.input_.GetLengths()[3] &&
-                                       hi >= 0 &&
-                                       ck::type_convert<std::size_t>(hi) <
-                                           arg.input_.GetLengths()[4] &&
-                                       wi >= 0 &&
-                                       ck::type_convert<std::size_t>(wi) <
-                                           arg.input_.GetLengths()[5])
-                                    {
-                                        float v_out;
-                                        float v_in;
-
-                                        arg.out_element_op_(v_out,
-                                                            ck::type_convert<float>(
-                                                                arg.output_(g, n, k, do_, ho, wo)));
-
-                                        arg.in_element_op_(v_in,
-                                                           ck::type_convert<float>(
-                                                               arg.input_(g, n, c, di, hi, wi)));
-
-                                        v_acc += v_out * v_in;
-                                    }
-                                }
+                                break;
                             }
+
+                            wo[i - 1] = 0;
                         }
                     }
+                }
+
+                std::size_t wei_offset = g * wei_strides[0] + k * wei_strides[1];
 
+                for(std::size_t i = 0; i < NDimSpatial; ++i)
+                {
+                    wei_offset += x[i] * wei_strides[3 + i];
+                }
+
+                for(std::size_t c = 0; c < C; ++c)
+                {
                     float v_wei;
 
-                    arg.wei_element_op_(v_wei, v_acc);
+                    arg.wei_element_op_(v_wei, v_acc[c]);
 
-                    arg.weight_(g, k, c, z, y, x) = ck::type_convert<WeiDataType>(v_wei);
-                };
+                    arg.weight_.mData[wei_offset + c * wei_strides[2]] =
+                        ck::type_convert<WeiDataType>(v_wei);
+                }
+            };
 
-                make_ParallelTensorFunctor(f_kczyx,
-                                           arg.weight_.GetLengths()[0],
-                                           arg.weight_.GetLengths()[1],
-                                           arg.weight_.GetLengths()[2],
-                                           arg.weight_.GetLengths()[3],
-                                           arg.weight_.GetLengths()[4],
-                                           arg.weight_.GetLengths()[5])(
-                    std::thread::hardware_concurrency());
+            make_ParallelTensorFunctor(f_gkx, wei_lengths[0], wei_lengths[1], num_filter_position)(
+                std::thread::hardware_concurrency());
 
-                return 0;
-            }
+            return 0;
         }
 
         float Run(const device::BaseArgument* p_arg,
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// E[g, n, k, wos] = cde_op(sum_c,xs in_op(In[g, n, c, wis]) * wei_op(Wei[g, k, c, xs]),
+//                          D0[g, n, k, wos], D1[g, n, k, wos], ...)
+// Grouped forward convolution with the epilogue of DeviceGroupedConvFwdMultipleD. The sum is
+// done in AccDataType, e.g. int32_t for int8 convolutions, and the CDE op is called with it and
+// the Ds in their own types, as the device epilogue does, so that quantized epilogues are checked
+// bit for bit. Ds are in [G, N, K, Do, Ho, Wo] order like the output, a bias or a per-channel
+// scale [G, K] being broadcast with strides of 0.
+// The output is computed in parallel over all its elements.
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename DsDataType,
+          typename OutDataType,
+          typename AccDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename CDEElementwiseOperation>
+struct ReferenceConvFwdMultipleD;
+
+template <ck::index_t NDimSpatial,
+          typename InDataType,
+          typename WeiDataType,
+          typename... DDataTypes,
+          typename OutDataType,
+          typename AccDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename CDEElementwiseOperation>
+struct ReferenceConvFwdMultipleD<NDimSpatial,
+                                 InDataType,
+                                 WeiDataType,
+                                 ck::Tuple<DDataTypes...>,
+                                 OutDataType,
+                                 AccDataType,
+                                 InElementwiseOperation,
+                                 WeiElementwiseOperation,
+                                 CDEElementwiseOperation> : public device::BaseOperator
+{
+    static_assert(NDimSpatial >= 1 && NDimSpatial <= 3, "wrong! only 1D, 2D and 3D supported");
+
+    using DsTensorRef = std::tuple<const Tensor<DDataTypes>&...>;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& input,
+                 const Tensor<WeiDataType>& weight,
+                 const DsTensorRef& ds,
+                 Tensor<OutDataType>& output,
+                 std::vector<ck::index_t> conv_filter_strides,
+                 std::vector<ck::index_t> conv_filter_dilations,
+                 std::vector<ck::index_t> input_left_pads,
+                 std::vector<ck::index_t> input_right_pads,
+                 InElementwiseOperation in_element_op,
+                 WeiElementwiseOperation wei_element_op,
+                 CDEElementwiseOperation cde_element_op)
+            : input_{input},
+              weight_{weight},
+              ds_{ds},
+              output_{output},
+              conv_strides_{conv_filter_strides},
+              conv_dilations_{conv_filter_dilations},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              in_element_op_{in_element_op},
+              wei_element_op_{wei_element_op},
+              cde_element_op_{cde_element_op}
+        {
+        }
+
+        const Tensor<InDataType>& input_;
+        const Tensor<WeiDataType>& weight_;
+        DsTensorRef ds_;
+        Tensor<OutDataType>& output_;
+
+        std::vector<index_t> conv_strides_;
+        std::vector<index_t> conv_dilations_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        InElementwiseOperation in_element_op_;
+        WeiElementwiseOperation wei_element_op_;
+        CDEElementwiseOperation cde_element_op_;
+    };
+
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceConvFwdMultipleD::Argument;
+
+        float Run(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.weight_.GetNumOfDimension() == NDimSpatial + 3 &&
+                 arg.output_.GetNumOfDimension() == NDimSpatial + 3))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            std::apply(
+                [&](const auto&... ds) {
+                    if(!((ds.GetLengths() == arg.output_.GetLengths()) && ...))
+                    {
+                        throw std::runtime_error("wrong! D and output lengths are different");
+                    }
+                },
+                arg.ds_);
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+
+            std::size_t num_filter = 1;
+
+            for(ck::index_t i = 0; i < NDimSpatial; ++i)
+            {
+                num_filter *= wei_lengths[3 + i];
+            }
+
+            auto func = [&](auto g, auto n, auto k, auto... wos) {
+                const std::array<std::size_t, NDimSpatial> wo{wos...};
+
+                AccDataType v_acc = 0;
+
+                for(std::size_t c = 0; c < wei_lengths[2]; ++c)
+                {
+                    // filter taps [z, y, x], x being the fastest
+                    for(std::size_t f = 0; f < num_filter; ++f)
+                    {
+                        std::size_t in_offset =
+                            g * in_strides[0] + n * in_strides[1] + c * in_strides[2];
+                        std::size_t wei_offset =
+                            g * wei_strides[0] + k * wei_strides[1] + c * wei_strides[2];
+
+                        bool is_in_bound = true;
+                        std::size_t tmp  = f;
+
+                        for(ck::index_t i = NDimSpatial - 1; i >= 0; --i)
+                        {
+                            const std::size_t x = tmp % wei_lengths[3 + i];
+                            tmp /= wei_lengths[3 + i];
+
+                            const auto wi =
+                                static_cast<ck::long_index_t>(wo[i] * arg.conv_strides_[i]) +
+                                static_cast<ck::long_index_t>(x * arg.conv_dilations_[i]) -
+                                static_cast<ck::long_index_t>(arg.in_left_pads_[i]);
+
+                            if(wi < 0 || ck::type_convert<std::size_t>(wi) >= in_lengths[3 + i])
+                            {
+                                is_in_bound = false;
+                                break;
+                            }
+
+                            in_offset += ck::type_convert<std::size_t>(wi) * in_strides[3 + i];
+                            wei_offset += x * wei_strides[3 + i];
+                        }
+
+                        if(is_in_bound)
+                        {
+                            InDataType v_in;
+                            WeiDataType v_wei;
+
+                            arg.in_element_op_(v_in, arg.input_.mData[in_offset]);
+                            arg.wei_element_op_(v_wei, arg.weight_.mData[wei_offset]);
+
+                            v_acc += ck::type_convert<AccDataType>(v_in) *
+                                     ck::type_convert<AccDataType>(v_wei);
+                        }
+                    }
+                }
+
+                std::apply(
+                    [&](const auto&... ds) {
+                        arg.cde_element_op_(
+                            arg.output_(g, n, k, wos...), v_acc, ds(g, n, k, wos...)...);
+                    },
+                    arg.ds_);
+            };
+
+            std::array<std::size_t, NDimSpatial + 3> out_lengths;
+
+            std::copy(arg.output_.GetLengths().begin(),
+                      arg.output_.GetLengths().end(),
+                      out_lengths.begin());
+
+            std::apply(
+                [&](auto... lengths) {
+                    make_ParallelTensorFunctor(func, lengths...)(
+                        std::thread::hardware_concurrency());
+                },
+                out_lengths);
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& input,
+                             const Tensor<WeiDataType>& weight,
+                             const DsTensorRef& ds,
+                             Tensor<OutDataType>& output,
+                             std::vector<ck::index_t> conv_filter_strides,
+                             std::vector<ck::index_t> conv_filter_dilations,
+                             std::vector<ck::index_t> input_left_pads,
+                             std::vector<ck::index_t> input_right_pads,
+                             InElementwiseOperation in_element_op,
+                             WeiElementwiseOperation wei_element_op,
+                             CDEElementwiseOperation cde_element_op)
+    {
+        return Argument{input,
+                        weight,
+                        ds,
+                        output,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        in_element_op,
+                        wei_element_op,
+                        cde_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceConvFwdMultipleD"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
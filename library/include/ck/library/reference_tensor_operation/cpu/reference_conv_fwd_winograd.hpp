@@ -0,0 +1,304 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/thread/threadwise_winograd_transform.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+//
+// @brief      Reference implementation for 2D forward convolution with the Winograd algorithm
+//             F(m x m, 3 x 3), m being OutputTileSize.
+//
+// @paragraph
+//             Follows DeviceGroupedConvFwdMultipleD_Winograd_Xdl_CShuffle step by step: the
+//             transformed filter and input are rounded to TransformDataType, the products are
+//             accumulated in float and the output transform is done in float. It therefore
+//             reproduces the device result up to the order of the GEMM accumulation, while it
+//             differs from ReferenceConvFwd by the rounding error of the transforms.
+//
+//             Same tensor descriptors as ReferenceConvFwd:
+//             input descriptor in [G, N, C, Hi, Wi] order
+//             weight descriptor in [G, K, C, Y, X] order
+//             output descriptor in [G, N, K, Ho, Wo] order
+//             Only 3x3 filters with stride 1 and dilation 1 are supported.
+//
+template <typename InDataType,
+          typename WeiDataType,
+          typename OutDataType,
+          typename TransformDataType,
+          typename InElementwiseOperation,
+          typename WeiElementwiseOperation,
+          typename OutElementwiseOperation,
+          index_t OutputTileSize>
+struct ReferenceConvFwdWinograd : public device::BaseOperator
+{
+    using Transform = ThreadwiseWinogradTransform_3x3<OutputTileSize>;
+
+    static constexpr index_t FilterSize = Transform::FilterSize;
+    static constexpr index_t TileSize   = Transform::TileSize;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& input,
+                 const Tensor<WeiDataType>& weight,
+                 Tensor<OutDataType>& output,
+                 std::vector<ck::index_t> conv_filter_strides,
+                 std::vector<ck::index_t> conv_filter_dilations,
+                 std::vector<ck::index_t> input_left_pads,
+                 std::vector<ck::index_t> input_right_pads,
+                 InElementwiseOperation in_element_op,
+                 WeiElementwiseOperation wei_element_op,
+                 OutElementwiseOperation out_element_op)
+            : input_{input},
+              weight_{weight},
+              output_{output},
+              conv_strides_{conv_filter_strides},
+              conv_dilations_{conv_filter_dilations},
+              in_left_pads_{input_left_pads},
+              in_right_pads_{input_right_pads},
+              in_element_op_{in_element_op},
+              wei_element_op_{wei_element_op},
+              out_element_op_{out_element_op}
+        {
+        }
+
+        const Tensor<InDataType>& input_;
+        const Tensor<WeiDataType>& weight_;
+        Tensor<OutDataType>& output_;
+
+        std::vector<index_t> conv_strides_;
+        std::vector<index_t> conv_dilations_;
+        std::vector<index_t> in_left_pads_;
+        std::vector<index_t> in_right_pads_;
+
+        InElementwiseOperation in_element_op_;
+        WeiElementwiseOperation wei_element_op_;
+        OutElementwiseOperation out_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceConvFwdWinograd::Argument;
+
+        float Run(const Argument& arg)
+        {
+            if(!(arg.input_.GetNumOfDimension() == 5 && arg.weight_.GetNumOfDimension() == 5 &&
+                 arg.output_.GetNumOfDimension() == 5))
+            {
+                throw std::runtime_error("wrong! inconsistent dimension");
+            }
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& out_lengths = arg.output_.GetLengths();
+
+            for(std::size_t i = 0; i < 2; ++i)
+            {
+                if(!(wei_lengths[i + 3] == FilterSize && arg.conv_strides_[i] == 1 &&
+                     arg.conv_dilations_[i] == 1))
+                {
+                    throw std::runtime_error("wrong! Winograd needs a 3x3, stride 1 convolution");
+                }
+            }
+
+            const std::size_t G  = in_lengths[0];
+            const std::size_t N  = in_lengths[1];
+            const std::size_t C  = in_lengths[2];
+            const std::size_t Hi = in_lengths[3];
+            const std::size_t Wi = in_lengths[4];
+            const std::size_t K  = wei_lengths[1];
+            const std::size_t Ho = out_lengths[3];
+            const std::size_t Wo = out_lengths[4];
+
+            const std::size_t num_tile_h = (Ho + OutputTileSize - 1) / OutputTileSize;
+            const std::size_t num_tile_w = (Wo + OutputTileSize - 1) / OutputTileSize;
+
+            // U[g, k, c] and V[g, n, th, tw, c], TileSize x TileSize values each
+            Tensor<float> u(std::vector<std::size_t>{G, K, C, TileSize, TileSize});
+            Tensor<float> v(
+                std::vector<std::size_t>{G, N, num_tile_h, num_tile_w, C, TileSize, TileSize});
+
+            auto f_filter = [&](auto g, auto k, auto c) {
+                float wei[FilterSize][FilterSize];
+
+                for(index_t y = 0; y < FilterSize; ++y)
+                    for(index_t x = 0; x < FilterSize; ++x)
+                        arg.wei_element_op_(wei[y][x],
+                                            ck::type_convert<float>(arg.weight_(g, k, c, y, x)));
+
+                float tile[TileSize][TileSize];
+
+                Transform::FilterTransform(wei, tile);
+
+                for(index_t i = 0; i < TileSize; ++i)
+                    for(index_t j = 0; j < TileSize; ++j)
+                        u(g, k, c, i, j) = ck::type_convert<float>(
+                            ck::type_convert<TransformDataType>(tile[i][j]));
+            };
+
+            auto f_input = [&](auto g, auto n, auto th, auto tw, auto c) {
+                float in[TileSize][TileSize];
+
+                for(index_t i = 0; i < TileSize; ++i)
+                {
+                    for(index_t j = 0; j < TileSize; ++j)
+                    {
+                        const auto hi = static_cast<ck::long_index_t>(th * OutputTileSize + i) -
+                                        static_cast<ck::long_index_t>(arg.in_left_pads_[0]);
+                        const auto wi = static_cast<ck::long_index_t>(tw * OutputTileSize + j) -
+                                        static_cast<ck::long_index_t>(arg.in_left_pads_[1]);
+
+                        if(hi >= 0 && ck::type_convert<std::size_t>(hi) < Hi && wi >= 0 &&
+                           ck::type_convert<std::size_t>(wi) < Wi)
+                        {
+                            arg.in_element_op_(
+                                in[i][j], ck::type_convert<float>(arg.input_(g, n, c, hi, wi)));
+                        }
+                        else
+                        {
+                            in[i][j] = 0;
+                        }
+                    }
+                }
+
+                float tile[TileSize][TileSize];
+
+                Transform::InputTransform(in, tile);
+
+                for(index_t i = 0; i < TileSize; ++i)
+                    for(index_t j = 0; j < TileSize; ++j)
+                        v(g, n, th, tw, c, i, j) = ck::type_convert<float>(
+                            ck::type_convert<TransformDataType>(tile[i][j]));
+            };
+
+            auto f_output = [&](auto g, auto n, auto th, auto tw, auto k) {
+                float m[TileSize][TileSize] = {};
+
+                for(std::size_t c = 0; c < C; ++c)
+                    for(index_t i = 0; i < TileSize; ++i)
+                        for(index_t j = 0; j < TileSize; ++j)
+                            m[i][j] += v(g, n, th, tw, c, i, j) * u(g, k, c, i, j);
+
+                float out[OutputTileSize][OutputTileSize];
+
+                Transform::OutputTransform(m, out);
+
+                for(index_t i = 0; i < OutputTileSize; ++i)
+                {
+                    for(index_t j = 0; j < OutputTileSize; ++j)
+                    {
+                        const std::size_t ho = th * OutputTileSize + i;
+                        const std::size_t wo = tw * OutputTileSize + j;
+
+                        if(ho < Ho && wo < Wo)
+                        {
+                            float v_out;
+
+                            arg.out_element_op_(v_out, out[i][j]);
+
+                            arg.output_(g, n, k, ho, wo) = ck::type_convert<OutDataType>(v_out);
+                        }
+                    }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_filter, G, K, C)(std::thread::hardware_concurrency());
+
+            make_ParallelTensorFunctor(f_input, G, N, num_tile_h, num_tile_w, C)(
+                std::thread::hardware_concurrency());
+
+            make_ParallelTensorFunctor(f_output, G, N, num_tile_h, num_tile_w, K)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument* p_arg) override
+    {
+        const auto* p_arg_ = dynamic_cast<const Argument*>(p_arg);
+
+        for(std::size_t i = 0; i < 2; ++i)
+        {
+            if(!(p_arg_->weight_.GetLengths()[i + 3] == FilterSize &&
+                 p_arg_->conv_strides_[i] == 1 && p_arg_->conv_dilations_[i] == 1))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static auto MakeArgument(const Tensor<InDataType>& input,
+                             const Tensor<WeiDataType>& weight,
+                             Tensor<OutDataType>& output,
+                             std::vector<ck::index_t> conv_filter_strides,
+                             std::vector<ck::index_t> conv_filter_dilations,
+                             std::vector<ck::index_t> input_left_pads,
+                             std::vector<ck::index_t> input_right_pads,
+                             InElementwiseOperation in_element_op,
+                             WeiElementwiseOperation wei_element_op,
+                             OutElementwiseOperation out_element_op)
+    {
+        return Argument{input,
+                        weight,
+                        output,
+                        conv_filter_strides,
+                        conv_filter_dilations,
+                        input_left_pads,
+                        input_right_pads,
+                        in_element_op,
+                        wei_element_op,
+                        out_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceConvFwdWinograd"
+            << "<F(" << OutputTileSize << "x" << OutputTileSize << ", 3x3)>"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// E[m, n] = c_op(sum_k a_op(A[m, k]) * (B[n, k] - Zero[n, g]) * Scale[n, g]), g = k / GroupSize
+// B is read from the packed bytes of DeviceGemmWeightOnlyQuant, so the reference checks the
+// layout produced by ck::utils::pack_weight_only_quant as well
+template <typename ADataType,
+          typename ScaleDataType,
+          typename EDataType,
+          typename AccDataType,
+          index_t WeightBits,
+          typename AElementwiseOperation,
+          typename CElementwiseOperation>
+struct ReferenceGemmWeightOnlyQuant : public device::BaseOperator
+{
+    static constexpr index_t CodePerByte = 8 / WeightBits;
+
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<ADataType>& a_m_k,
+                 const Tensor<uint8_t>& b_packed,
+                 const Tensor<ScaleDataType>& scale_n_g,
+                 const Tensor<ScaleDataType>& zero_n_g,
+                 Tensor<EDataType>& e_m_n,
+                 index_t group_size,
+                 AElementwiseOperation a_element_op,
+                 CElementwiseOperation c_element_op)
+            : a_m_k_{a_m_k},
+              b_packed_{b_packed},
+              scale_n_g_{scale_n_g},
+              zero_n_g_{zero_n_g},
+              e_m_n_{e_m_n},
+              group_size_{group_size},
+              a_element_op_{a_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        const Tensor<ADataType>& a_m_k_;
+        const Tensor<uint8_t>& b_packed_;
+        const Tensor<ScaleDataType>& scale_n_g_;
+        const Tensor<ScaleDataType>& zero_n_g_;
+        Tensor<EDataType>& e_m_n_;
+
+        index_t group_size_;
+
+        AElementwiseOperation a_element_op_;
+        CElementwiseOperation c_element_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Argument = ReferenceGemmWeightOnlyQuant::Argument;
+
+        float Run(const Argument& arg)
+        {
+            auto f_mk_nk_mn = [&](auto m, auto n) {
+                const int K = arg.a_m_k_.mDesc.GetLengths()[1];
+
+                AccDataType v_acc = 0;
+
+                for(int k = 0; k < K; ++k)
+                {
+                    const int g = k / arg.group_size_;
+
+                    const int code = (arg.b_packed_(n, k / CodePerByte) >>
+                                      ((k % CodePerByte) * WeightBits)) &
+                                     ((1 << WeightBits) - 1);
+
+                    const AccDataType v_b =
+                        (ck::type_convert<AccDataType>(code) -
+                         ck::type_convert<AccDataType>(arg.zero_n_g_(n, g))) *
+                        ck::type_convert<AccDataType>(arg.scale_n_g_(n, g));
+
+                    ADataType v_a;
+
+                    arg.a_element_op_(v_a, arg.a_m_k_(m, k));
+
+                    v_acc += ck::type_convert<AccDataType>(v_a) * v_b;
+                }
+
+                arg.c_element_op_(arg.e_m_n_(m, n), ck::type_convert<EDataType>(v_acc));
+            };
+
+            make_ParallelTensorFunctor(
+                f_mk_nk_mn, arg.e_m_n_.mDesc.GetLengths()[0], arg.e_m_n_.mDesc.GetLengths()[1])(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
+                             const Tensor<uint8_t>& b_packed,
+                             const Tensor<ScaleDataType>& scale_n_g,
+                             const Tensor<ScaleDataType>& zero_n_g,
+                             Tensor<EDataType>& e_m_n,
+                             index_t group_size,
+                             AElementwiseOperation a_element_op,
+                             CElementwiseOperation c_element_op)
+    {
+        return Argument{
+            a_m_k, b_packed, scale_n_g, zero_n_g, e_m_n, group_size, a_element_op, c_element_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceGemmWeightOnlyQuant"
+            << "<W" << WeightBits << ">"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
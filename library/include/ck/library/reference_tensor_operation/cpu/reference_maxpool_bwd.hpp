@@ -3,8 +3,10 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <thread>
 #include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
@@ -43,21 +45,113 @@ struct ReferenceMaxPoolBwd : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
+        // din is split into one contiguous range per thread. The dout elements are first bucketed
+        // by the din range their index points into, stably, so that every din element accumulates
+        // its gradients in the same order as a sequential scatter. Then each thread accumulates its
+        // own bucket without any synchronization
         float Run(const Argument& arg)
         {
-            int din_length  = arg.din_.GetElementSpaceSize();
-            int dout_length = arg.dout_.GetElementSpaceSize();
-            std::vector<ConputeDataType> buf(din_length, 0);
+            const std::size_t din_length  = arg.din_.GetElementSpaceSize();
+            const std::size_t dout_length = arg.dout_.GetElementSpaceSize();
 
-            for(int i = 0; i < dout_length; ++i)
+            const std::size_t num_thread =
+                std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+
+            const std::size_t din_per_thread  = (din_length + num_thread - 1) / num_thread;
+            const std::size_t dout_per_thread = (dout_length + num_thread - 1) / num_thread;
+
+            // bucket of the i-th dout element, or num_thread if its index is out of range
+            auto get_bucket = [&](std::size_t i) {
+                const auto index = arg.indices_.mData[i];
+
+                if(index < 0 || static_cast<std::size_t>(index) >= din_length)
+                    return num_thread;
+
+                return static_cast<std::size_t>(index) / din_per_thread;
+            };
+
+            // counts[chunk * num_thread + bucket]
+            std::vector<std::size_t> counts(num_thread * num_thread, 0);
+
+            auto for_each_dout_chunk = [&](auto f_chunk) {
+                std::vector<joinable_thread> threads(num_thread);
+
+                for(std::size_t it = 0; it < num_thread; ++it)
+                {
+                    const std::size_t i_begin = std::min(it * dout_per_thread, dout_length);
+                    const std::size_t i_end   = std::min((it + 1) * dout_per_thread, dout_length);
+
+                    threads[it] = joinable_thread(f_chunk, it, i_begin, i_end);
+                }
+            };
+
+            for_each_dout_chunk([&](std::size_t chunk, std::size_t i_begin, std::size_t i_end) {
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    const std::size_t bucket = get_bucket(i);
+
+                    if(bucket < num_thread)
+                        counts[chunk * num_thread + bucket]++;
+                }
+            });
+
+            // exclusive scan in (bucket, chunk) order, which turns counts into write positions
+            std::vector<std::size_t> bucket_begins(num_thread + 1, 0);
+
+            std::size_t num_valid = 0;
+
+            for(std::size_t bucket = 0; bucket < num_thread; ++bucket)
+            {
+                bucket_begins[bucket] = num_valid;
+
+                for(std::size_t chunk = 0; chunk < num_thread; ++chunk)
+                {
+                    const std::size_t count = counts[chunk * num_thread + bucket];
+
+                    counts[chunk * num_thread + bucket] = num_valid;
+                    num_valid += count;
+                }
+            }
+
+            bucket_begins[num_thread] = num_valid;
+
+            std::vector<std::size_t> sorted_douts(num_valid);
+
+            for_each_dout_chunk([&](std::size_t chunk, std::size_t i_begin, std::size_t i_end) {
+                for(std::size_t i = i_begin; i < i_end; ++i)
+                {
+                    const std::size_t bucket = get_bucket(i);
+
+                    if(bucket < num_thread)
+                        sorted_douts[counts[chunk * num_thread + bucket]++] = i;
+                }
+            });
+
+            std::vector<joinable_thread> threads(num_thread);
+
+            for(std::size_t it = 0; it < num_thread; ++it)
             {
-                int index = arg.indices_.mData[i];
-                if(index >= 0 && index < din_length)
-                    buf[index] += ck::type_convert<ConputeDataType>(arg.dout_.mData[i]);
+                auto f = [&, it] {
+                    const std::size_t din_begin = std::min(it * din_per_thread, din_length);
+                    const std::size_t din_end   = std::min((it + 1) * din_per_thread, din_length);
+
+                    std::vector<ConputeDataType> buf(din_end - din_begin, 0);
+
+                    for(std::size_t j = bucket_begins[it]; j < bucket_begins[it + 1]; ++j)
+                    {
+                        const std::size_t i = sorted_douts[j];
+
+                        buf[static_cast<std::size_t>(arg.indices_.mData[i]) - din_begin] +=
+                            ck::type_convert<ConputeDataType>(arg.dout_.mData[i]);
+                    }
+
+                    for(std::size_t k = din_begin; k < din_end; ++k)
+                        arg.din_.mData[k] = ck::type_convert<DInDataType>(buf[k - din_begin]);
+                };
+
+                threads[it] = joinable_thread(f);
             }
 
-            for(int i = 0; i < din_length; ++i)
-                arg.din_.mData[i] = ck::type_convert<DInDataType>(buf[i]);
             return 0;
         }
 
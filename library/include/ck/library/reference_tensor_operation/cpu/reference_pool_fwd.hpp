@@ -7,6 +7,11 @@
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <type_traits>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
@@ -283,13 +288,416 @@ struct ReferencePoolingFwd : public device::BaseOperator
             return 0;
         }
 
+        // The pooling window of one spatial dimension
+        struct PoolingWindow1d
+        {
+            ck::index_t in_length_;
+            ck::index_t out_length_;
+            ck::index_t window_length_;
+            ck::index_t window_stride_;
+            ck::index_t left_pad_;
+
+            // the window of output position o, clipped to the input
+            ck::index_t GetWindowBegin(ck::index_t o) const
+            {
+                return std::min(std::max(o * window_stride_ - left_pad_, 0), in_length_);
+            }
+
+            ck::index_t GetWindowEnd(ck::index_t o) const
+            {
+                return std::min(o * window_stride_ - left_pad_ + window_length_, in_length_);
+            }
+        };
+
+        // Result of max/min pooling over part of a window. The best value keeps the first index
+        // (in the order of the sequential window loops) among equal values, while the NaN keeps
+        // the last one, which is what sequentially calling Accumulation::Calculate produces
+        struct SelectCandidate
+        {
+            ComputeDataType value_;
+            IndexDataType index_;
+            bool valid_;
+            bool has_nan_;
+            ComputeDataType nan_value_;
+            IndexDataType nan_index_;
+        };
+
+        // Result of average pooling over part of a window. Non-finite inputs are counted rather
+        // than summed, so that they don't pollute the prefix sums of the whole line
+        struct SumCandidate
+        {
+            double sum_;
+            ck::index_t num_nan_;
+            ck::index_t num_pos_inf_;
+            ck::index_t num_neg_inf_;
+        };
+
+        static constexpr bool IsSelectPooling =
+            ReduceOpId == ck::ReduceTensorOp::MAX || ReduceOpId == ck::ReduceTensorOp::AMAX ||
+            ReduceOpId == ck::ReduceTensorOp::MIN;
+
+        static constexpr bool IsAvgPooling = ReduceOpId == ck::ReduceTensorOp::AVG;
+
+        static bool IsBetter(ComputeDataType currVal, ComputeDataType accuVal)
+        {
+            bool changed = false;
+
+            ReduceOperation{}(accuVal, currVal, changed);
+
+            return changed;
+        }
+
+        // Sliding window max/min along the middle dimension of src[outer][in_length][inner] using a
+        // monotonic deque, every position is pushed and popped at most once
+        static void SelectPoolingPass(const std::vector<SelectCandidate>& src,
+                                      std::vector<SelectCandidate>& dst,
+                                      ck::index_t outer,
+                                      ck::index_t inner,
+                                      const PoolingWindow1d& window)
+        {
+            dst.resize(static_cast<std::size_t>(outer) * window.out_length_ * inner);
+
+            std::deque<ck::index_t> candidates;
+
+            for(ck::index_t o = 0; o < outer; ++o)
+                for(ck::index_t i = 0; i < inner; ++i)
+                {
+                    auto src_at = [&](ck::index_t pos) -> const SelectCandidate& {
+                        return src[(static_cast<std::size_t>(o) * window.in_length_ + pos) * inner +
+                                   i];
+                    };
+
+                    candidates.clear();
+
+                    ck::index_t next_pos = 0;
+                    ck::index_t last_nan = -1;
+
+                    for(ck::index_t k = 0; k < window.out_length_; ++k)
+                    {
+                        const ck::index_t begin = window.GetWindowBegin(k);
+                        const ck::index_t end   = window.GetWindowEnd(k);
+
+                        for(; next_pos < end; ++next_pos)
+                        {
+                            const auto& curr = src_at(next_pos);
+
+                            if(curr.has_nan_)
+                                last_nan = next_pos;
+
+                            if(!curr.valid_)
+                                continue;
+
+                            // equal values stay in the deque, so that the front is the first best
+                            while(!candidates.empty() &&
+                                  IsBetter(curr.value_, src_at(candidates.back()).value_))
+                                candidates.pop_back();
+
+                            candidates.push_back(next_pos);
+                        }
+
+                        while(!candidates.empty() && candidates.front() < begin)
+                            candidates.pop_front();
+
+                        SelectCandidate result{
+                            ReduceOperation::template GetIdentityValue<ComputeDataType>(),
+                            0,
+                            false,
+                            false,
+                            ReduceOperation::template GetIdentityValue<ComputeDataType>(),
+                            0};
+
+                        if(!candidates.empty())
+                        {
+                            result.value_ = src_at(candidates.front()).value_;
+                            result.index_ = src_at(candidates.front()).index_;
+                            result.valid_ = true;
+                        }
+
+                        if(last_nan >= begin)
+                        {
+                            result.has_nan_   = true;
+                            result.nan_value_ = src_at(last_nan).nan_value_;
+                            result.nan_index_ = src_at(last_nan).nan_index_;
+                        }
+
+                        dst[(static_cast<std::size_t>(o) * window.out_length_ + k) * inner + i] =
+                            result;
+                    }
+                }
+        }
+
+        // Sliding window sum along the middle dimension of src[outer][in_length][inner] using
+        // prefix sums of each line
+        static void AvgPoolingPass(const std::vector<SumCandidate>& src,
+                                   std::vector<SumCandidate>& dst,
+                                   ck::index_t outer,
+                                   ck::index_t inner,
+                                   const PoolingWindow1d& window)
+        {
+            dst.resize(static_cast<std::size_t>(outer) * window.out_length_ * inner);
+
+            std::vector<SumCandidate> prefix(window.in_length_ + 1);
+
+            for(ck::index_t o = 0; o < outer; ++o)
+                for(ck::index_t i = 0; i < inner; ++i)
+                {
+                    prefix[0] = SumCandidate{0, 0, 0, 0};
+
+                    for(ck::index_t pos = 0; pos < window.in_length_; ++pos)
+                    {
+                        const auto& curr =
+                            src[(static_cast<std::size_t>(o) * window.in_length_ + pos) * inner +
+                                i];
+
+                        prefix[pos + 1].sum_         = prefix[pos].sum_ + curr.sum_;
+                        prefix[pos + 1].num_nan_     = prefix[pos].num_nan_ + curr.num_nan_;
+                        prefix[pos + 1].num_pos_inf_ = prefix[pos].num_pos_inf_ + curr.num_pos_inf_;
+                        prefix[pos + 1].num_neg_inf_ = prefix[pos].num_neg_inf_ + curr.num_neg_inf_;
+                    }
+
+                    for(ck::index_t k = 0; k < window.out_length_; ++k)
+                    {
+                        const ck::index_t begin = window.GetWindowBegin(k);
+                        const ck::index_t end   = std::max(window.GetWindowEnd(k), begin);
+
+                        SumCandidate result{prefix[end].sum_ - prefix[begin].sum_,
+                                            prefix[end].num_nan_ - prefix[begin].num_nan_,
+                                            prefix[end].num_pos_inf_ - prefix[begin].num_pos_inf_,
+                                            prefix[end].num_neg_inf_ - prefix[begin].num_neg_inf_};
+
+                        dst[(static_cast<std::size_t>(o) * window.out_length_ + k) * inner + i] =
+                            result;
+                    }
+                }
+        }
+
+        // Separable pooling: for every (n, c) the window reduction is done as one 1D sliding
+        // window pass per spatial dimension (W, then H, then D), which makes the cost independent
+        // of the window size. Max/min pooling produces the same values and indices as the
+        // sequential window loops, average pooling is equal up to the summation order
+        float RunSeparablePoolingFwd(const Argument& arg)
+        {
+            constexpr ck::index_t NumSpatialDim = 3;
+
+            // 2D pooling is done as 3D pooling with a unit depth
+            constexpr ck::index_t NumUnitDim = NumSpatialDim - WindowRank;
+
+            const auto& in_lengths  = arg.in_.mDesc.GetLengths();
+            const auto& in_strides  = arg.in_.mDesc.GetStrides();
+            const auto& out_lengths = arg.out_.mDesc.GetLengths();
+
+            std::array<PoolingWindow1d, NumSpatialDim> windows;
+            std::array<std::size_t, NumSpatialDim> in_spatial_strides;
+
+            for(ck::index_t d = 0; d < NumSpatialDim; ++d)
+            {
+                if(d < NumUnitDim)
+                {
+                    windows[d]            = PoolingWindow1d{1, 1, 1, 1, 0};
+                    in_spatial_strides[d] = 0;
+                }
+                else
+                {
+                    const ck::index_t i = d - NumUnitDim;
+
+                    windows[d] = PoolingWindow1d{static_cast<ck::index_t>(in_lengths[2 + i]),
+                                                 static_cast<ck::index_t>(out_lengths[2 + i]),
+                                                 arg.window_spatial_lengths_[i],
+                                                 arg.window_strides_[i],
+                                                 arg.in_left_pads_[i]};
+
+                    in_spatial_strides[d] = in_strides[2 + i];
+                }
+            }
+
+            const ck::index_t Di = windows[0].in_length_;
+            const ck::index_t Hi = windows[1].in_length_;
+            const ck::index_t Wi = windows[2].in_length_;
+            const ck::index_t Do = windows[0].out_length_;
+            const ck::index_t Ho = windows[1].out_length_;
+            const ck::index_t Wo = windows[2].out_length_;
+
+            auto elementwise_ops =
+                ck::reduce_unary_operator<ReduceOpId, true, true>::GetElementwiseOperator(
+                    arg.reduceLength_);
+
+            auto in_elementwise_op  = std::get<0>(elementwise_ops);
+            auto acc_elementwise_op = std::get<1>(elementwise_ops);
+
+            auto store_output = [&](std::size_t n,
+                                    std::size_t c,
+                                    ck::index_t do_,
+                                    ck::index_t ho,
+                                    ck::index_t wo,
+                                    ComputeDataType accuVal,
+                                    IndexDataType accuIndex) {
+                acc_elementwise_op(accuVal, accuVal);
+
+                if constexpr(WindowRank == 3)
+                {
+                    arg.out_(n, c, do_, ho, wo) = ck::type_convert<OutDataType>(accuVal);
+
+                    if constexpr(OutputIndex)
+                        arg.out_indices_(n, c, do_, ho, wo) = accuIndex;
+                }
+                else
+                {
+                    ignore = do_;
+
+                    arg.out_(n, c, ho, wo) = ck::type_convert<OutDataType>(accuVal);
+
+                    if constexpr(OutputIndex)
+                        arg.out_indices_(n, c, ho, wo) = accuIndex;
+                }
+
+                ignore = accuIndex;
+            };
+
+            auto f_nc = [&](auto n, auto c) {
+                const std::size_t in_nc_offset = n * in_strides[0] + c * in_strides[1];
+
+                auto load_input = [&](ck::index_t di, ck::index_t hi, ck::index_t wi) {
+                    const std::size_t in_offset = in_nc_offset + di * in_spatial_strides[0] +
+                                                  hi * in_spatial_strides[1] +
+                                                  wi * in_spatial_strides[2];
+
+                    ComputeDataType currVal =
+                        ck::type_convert<ComputeDataType>(arg.in_.mData[in_offset]);
+
+                    in_elementwise_op(currVal, currVal);
+
+                    return std::make_pair(currVal, static_cast<IndexDataType>(in_offset));
+                };
+
+                if constexpr(IsSelectPooling)
+                {
+                    std::vector<SelectCandidate> buf0(static_cast<std::size_t>(Di) * Hi * Wi);
+                    std::vector<SelectCandidate> buf1;
+
+                    for(ck::index_t di = 0; di < Di; ++di)
+                        for(ck::index_t hi = 0; hi < Hi; ++hi)
+                            for(ck::index_t wi = 0; wi < Wi; ++wi)
+                            {
+                                auto [currVal, currIndex] = load_input(di, hi, wi);
+
+                                const bool is_nan = ck::math::isnan(currVal);
+
+                                buf0[(static_cast<std::size_t>(di) * Hi + hi) * Wi + wi] =
+                                    SelectCandidate{currVal,
+                                                    currIndex,
+                                                    !is_nan,
+                                                    PropagateNan && is_nan,
+                                                    currVal,
+                                                    currIndex};
+                            }
+
+                    SelectPoolingPass(buf0, buf1, Di * Hi, 1, windows[2]);
+                    SelectPoolingPass(buf1, buf0, Di, Wo, windows[1]);
+                    SelectPoolingPass(buf0, buf1, 1, Ho * Wo, windows[0]);
+
+                    const auto identityVal =
+                        ReduceOperation::template GetIdentityValue<ComputeDataType>();
+
+                    for(ck::index_t do_ = 0; do_ < Do; ++do_)
+                        for(ck::index_t ho = 0; ho < Ho; ++ho)
+                            for(ck::index_t wo = 0; wo < Wo; ++wo)
+                            {
+                                const auto& result =
+                                    buf1[(static_cast<std::size_t>(do_) * Ho + ho) * Wo + wo];
+
+                                ComputeDataType accuVal = identityVal;
+                                IndexDataType accuIndex = 0;
+
+                                if(result.has_nan_)
+                                {
+                                    accuVal   = result.nan_value_;
+                                    accuIndex = result.nan_index_;
+                                }
+                                else if(result.valid_ && IsBetter(result.value_, identityVal))
+                                {
+                                    accuVal   = result.value_;
+                                    accuIndex = result.index_;
+                                }
+
+                                store_output(n, c, do_, ho, wo, accuVal, accuIndex);
+                            }
+                }
+                else
+                {
+                    std::vector<SumCandidate> buf0(static_cast<std::size_t>(Di) * Hi * Wi);
+                    std::vector<SumCandidate> buf1;
+
+                    for(ck::index_t di = 0; di < Di; ++di)
+                        for(ck::index_t hi = 0; hi < Hi; ++hi)
+                            for(ck::index_t wi = 0; wi < Wi; ++wi)
+                            {
+                                const double currVal =
+                                    ck::type_convert<double>(load_input(di, hi, wi).first);
+
+                                SumCandidate curr{0, 0, 0, 0};
+
+                                if(std::isnan(currVal))
+                                    curr.num_nan_ = 1;
+                                else if(std::isinf(currVal) && currVal > 0)
+                                    curr.num_pos_inf_ = 1;
+                                else if(std::isinf(currVal))
+                                    curr.num_neg_inf_ = 1;
+                                else
+                                    curr.sum_ = currVal;
+
+                                buf0[(static_cast<std::size_t>(di) * Hi + hi) * Wi + wi] = curr;
+                            }
+
+                    AvgPoolingPass(buf0, buf1, Di * Hi, 1, windows[2]);
+                    AvgPoolingPass(buf1, buf0, Di, Wo, windows[1]);
+                    AvgPoolingPass(buf0, buf1, 1, Ho * Wo, windows[0]);
+
+                    for(ck::index_t do_ = 0; do_ < Do; ++do_)
+                        for(ck::index_t ho = 0; ho < Ho; ++ho)
+                            for(ck::index_t wo = 0; wo < Wo; ++wo)
+                            {
+                                const auto& result =
+                                    buf1[(static_cast<std::size_t>(do_) * Ho + ho) * Wo + wo];
+
+                                double sum = result.sum_;
+
+                                if(result.num_nan_ > 0 ||
+                                   (result.num_pos_inf_ > 0 && result.num_neg_inf_ > 0))
+                                    sum = std::numeric_limits<double>::quiet_NaN();
+                                else if(result.num_pos_inf_ > 0)
+                                    sum = std::numeric_limits<double>::infinity();
+                                else if(result.num_neg_inf_ > 0)
+                                    sum = -std::numeric_limits<double>::infinity();
+
+                                store_output(n,
+                                             c,
+                                             do_,
+                                             ho,
+                                             wo,
+                                             ck::type_convert<ComputeDataType>(sum),
+                                             IndexDataType{0});
+                            }
+                }
+            };
+
+            make_ParallelTensorFunctor(f_nc, out_lengths[0], out_lengths[1])(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
         float Run(const Argument& arg)
         {
             // TODO - support generic pooling
-            if constexpr(InOutRank == 5 && WindowRank == 3)
-                return RunPooling3dFwd(arg);
-            else if constexpr(InOutRank == 4 && WindowRank == 2)
-                return RunPooling2dFwd(arg);
+            if constexpr((InOutRank == 5 && WindowRank == 3) || (InOutRank == 4 && WindowRank == 2))
+            {
+                if constexpr(IsSelectPooling || (IsAvgPooling && !OutputIndex))
+                    return RunSeparablePoolingFwd(arg);
+                else if constexpr(WindowRank == 3)
+                    return RunPooling3dFwd(arg);
+                else
+                    return RunPooling2dFwd(arg);
+            }
             else
                 throw std::runtime_error("Only support pooling3d or pooling2d so far");
         }
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/utility/reduction_operator.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// output[indices] = input, or output[indices] = reduce(output[indices], input) for the Add and
+// Max memory operations, which accumulate duplicated indices. Negative indices are skipped
+template <typename InDataType,
+          typename IndexDataType,
+          typename OutDataType,
+          typename ElementwiseOperation,
+          InMemoryDataOperationEnum MemOp>
+struct ReferencePutElement : public device::BaseOperator
+{
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& input,
+                 const Tensor<IndexDataType>& indices,
+                 Tensor<OutDataType>& output,
+                 ElementwiseOperation elementwise_op)
+            : input_(input), indices_(indices), output_(output), elementwise_op_(elementwise_op)
+        {
+        }
+
+        const Tensor<InDataType>& input_;
+        const Tensor<IndexDataType>& indices_;
+        Tensor<OutDataType>& output_;
+        ElementwiseOperation elementwise_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        float Run(const Argument& arg)
+        {
+            const std::size_t input_length  = arg.input_.mDesc.GetElementSize();
+            const std::size_t output_length = arg.output_.mDesc.GetElementSize();
+
+            if(arg.indices_.mDesc.GetElementSize() != input_length)
+                throw std::runtime_error("wrong! input and indices must have the same length");
+
+            for(std::size_t i = 0; i < input_length; ++i)
+            {
+                const IndexDataType index = arg.indices_.mData[i];
+
+                if(index < 0)
+                    continue;
+
+                if(static_cast<std::size_t>(index) >= output_length)
+                    throw std::runtime_error("wrong! out of range");
+
+                InDataType in_value = arg.input_.mData[i];
+                arg.elementwise_op_(in_value, in_value);
+
+                const OutDataType out_value = ck::type_convert<OutDataType>(in_value);
+                OutDataType& out            = arg.output_.mData[index];
+
+                if constexpr(MemOp == InMemoryDataOperationEnum::Set)
+                {
+                    out = out_value;
+                }
+                else if constexpr(MemOp == InMemoryDataOperationEnum::AtomicAdd ||
+                                  MemOp == InMemoryDataOperationEnum::Add)
+                {
+                    reduce::Add{}(out, out_value);
+                }
+                else if constexpr(MemOp == InMemoryDataOperationEnum::AtomicMax)
+                {
+                    reduce::Max{}(out, out_value);
+                }
+                else
+                {
+                    static_assert(MemOp == InMemoryDataOperationEnum::Set ||
+                                  MemOp == InMemoryDataOperationEnum::AtomicAdd ||
+                                  MemOp == InMemoryDataOperationEnum::AtomicMax ||
+                                  MemOp == InMemoryDataOperationEnum::Add);
+                }
+            }
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& input,
+                             const Tensor<IndexDataType>& indices,
+                             Tensor<OutDataType>& output,
+                             ElementwiseOperation elementwise_op)
+    {
+        return Argument{input, indices, output, elementwise_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferencePutElement"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
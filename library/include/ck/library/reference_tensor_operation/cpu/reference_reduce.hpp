@@ -6,7 +6,10 @@
 #include <vector>
 #include <array>
 #include <algorithm>
+#include <functional>
+#include <numeric>
 #include <thread>
+#include <type_traits>
 
 #include "ck/ck.hpp"
 #include "ck/utility/ignore.hpp"
@@ -72,8 +75,6 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
               in_elementwise_op_(in_elementwise_op),
               acc_elementwise_op_(acc_elementwise_op)
         {
-            using ck::host_common::get_index_set;
-
             if(std::any_of(
                    reduceDims.begin(), reduceDims.end(), [](int d) { return d < 0 || d >= Rank; }))
                 throw std::runtime_error("Invalid reduce dimensions!");
@@ -123,10 +124,16 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
                 i++;
             };
 
-            if constexpr(NumInvariantDim > 0)
-                invariant_index_set_ = get_index_set<NumInvariantDim>(invariant_lengths_);
+            // the index spaces are traversed on the fly, only their total lengths are kept
+            invariant_total_length_ = std::accumulate(invariant_lengths_.begin(),
+                                                      invariant_lengths_.end(),
+                                                      std::size_t{1},
+                                                      std::multiplies<std::size_t>{});
 
-            reduce_index_set_ = get_index_set<NumReduceDim>(reduce_lengths_);
+            reduce_total_length_ = std::accumulate(reduce_lengths_.begin(),
+                                                   reduce_lengths_.end(),
+                                                   std::size_t{1},
+                                                   std::multiplies<std::size_t>{});
 
             alpha_ = type_convert<AccDataType>(alpha);
             beta_  = type_convert<AccDataType>(beta);
@@ -152,216 +159,260 @@ struct ReferenceReduce : public device::DeviceReduce<InDataType,
         AccDataType alpha_;
         AccDataType beta_;
 
-        std::vector<std::array<index_t, NumInvariantDim>> invariant_index_set_;
-        std::vector<std::array<index_t, NumReduceDim>> reduce_index_set_;
+        std::size_t invariant_total_length_;
+        std::size_t reduce_total_length_;
     };
 
     struct Invoker : public device::BaseInvoker
     {
-        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        // Length of the pieces a reduction is split into when it is longer. Whether and how a
+        // reduction is split only depends on its length, not on the number of threads, so the
+        // partial results are always combined in the same way and the result is reproducible
+        static constexpr std::size_t ReduceChunkLength = 16384;
+
+        using Accumulation = std::conditional_t<
+            OutputIndex,
+            ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
+                                                       ReduceOperation,
+                                                       AccDataType,
+                                                       IndexDataType>,
+            ck::detail::AccumulateWithNanCheck<PropagateNan, ReduceOperation, AccDataType>>;
+
+        // accumulate the elements [reduce_begin, reduce_end) of the flattened reduce index space
+        // into accuVal/accuIndex, the reduce multi-index and input offset are advanced
+        // incrementally rather than looked up from a pre-computed index set
+        static void AccumulateRange(const Argument& arg,
+                                    std::size_t in_invariant_offset,
+                                    std::size_t reduce_begin,
+                                    std::size_t reduce_end,
+                                    AccDataType& accuVal,
+                                    IndexDataType& accuIndex)
         {
-            ignore = stream_config;
-
-            using ck::float_equal_one;
-            using ck::float_equal_zero;
             using ck::type_convert;
-            using ck::host_common::get_index_set;
+            using ck::host_common::get_index_from_flat_index;
             using ck::host_common::get_offset_from_index;
+            using ck::host_common::move_index_and_offset_forward;
 
-            if constexpr(OutputIndex)
-            {
-                using Accumulation = ck::detail::AccumulateWithIndexAndNanCheck<PropagateNan,
-                                                                                ReduceOperation,
-                                                                                AccDataType,
-                                                                                IndexDataType>;
-
-                if constexpr(NumInvariantDim == 0)
-                {
-                    AccDataType accuVal = ReduceOperation::template GetIdentityValue<AccDataType>();
-                    IndexDataType accuIndex = 0;
+            auto reduce_index =
+                get_index_from_flat_index<NumReduceDim>(arg.reduce_lengths_, reduce_begin);
 
-                    for(std::size_t i = 0; i < arg.reduce_index_set_.size(); i++)
-                    {
-                        auto in_offset = get_offset_from_index<NumReduceDim>(
-                            arg.in_reduce_strides_, arg.reduce_index_set_[i]);
+            std::size_t in_offset =
+                in_invariant_offset +
+                get_offset_from_index<NumReduceDim>(arg.in_reduce_strides_, reduce_index);
 
-                        auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
-
-                        arg.in_elementwise_op_(currVal, currVal);
-
-                        auto currIndex = static_cast<IndexDataType>(i);
-
-                        Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                    };
-
-                    arg.acc_elementwise_op_(accuVal, accuVal);
+            for(std::size_t i = reduce_begin; i < reduce_end; i++)
+            {
+                auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
 
-                    if(!float_equal_one{}(arg.alpha_))
-                        accuVal *= type_convert<AccDataType>(arg.alpha_);
+                arg.in_elementwise_op_(currVal, currVal);
 
-                    if(!float_equal_zero{}(arg.beta_))
-                        accuVal += type_convert<AccDataType>(arg.out_host_[0]) *
-                                   type_convert<AccDataType>(arg.beta_);
+                if constexpr(OutputIndex)
+                {
+                    auto currIndex = static_cast<IndexDataType>(i);
 
-                    arg.out_host_[0]       = type_convert<OutDataType>(accuVal);
-                    arg.out_index_host_[0] = accuIndex;
+                    Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
                 }
                 else
                 {
-                    auto thread_reduce_func = [&](auto invariant_index) {
-                        AccDataType accuVal =
-                            ReduceOperation::template GetIdentityValue<AccDataType>();
-                        IndexDataType accuIndex = 0;
-
-                        auto in_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                            arg.in_invariant_strides_, invariant_index);
+                    ignore = accuIndex;
 
-                        for(std::size_t i = 0; i < arg.reduce_index_set_.size(); i++)
-                        {
-                            auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
-                                arg.in_reduce_strides_, arg.reduce_index_set_[i]);
+                    Accumulation::Calculate(accuVal, currVal);
+                };
 
-                            auto currVal = type_convert<AccDataType>(
-                                arg.in_host_[in_invariant_offset + in_reduce_offset]);
+                move_index_and_offset_forward<NumReduceDim>(
+                    arg.reduce_lengths_, arg.in_reduce_strides_, reduce_index, in_offset);
+            };
+        };
 
-                            arg.in_elementwise_op_(currVal, currVal);
+        // fold a partial result, computed on a later part of the reduce index space, into the
+        // accumulated one. Since the partial results are folded in index order, the semantics of
+        // NaN propagation and of the returned index are the same as for a sequential reduction
+        static void CombinePartial(AccDataType& accuVal,
+                                   IndexDataType& accuIndex,
+                                   AccDataType partialVal,
+                                   IndexDataType partialIndex)
+        {
+            if constexpr(OutputIndex)
+                Accumulation::Calculate(accuVal, partialVal, accuIndex, partialIndex);
+            else
+            {
+                ignore = accuIndex;
+                ignore = partialIndex;
 
-                            auto currIndex = static_cast<IndexDataType>(i);
+                Accumulation::Calculate(accuVal, partialVal);
+            };
+        };
 
-                            Accumulation::Calculate(accuVal, currVal, accuIndex, currIndex);
-                        };
+        static void StoreResult(const Argument& arg,
+                                std::size_t i_invariant,
+                                AccDataType accuVal,
+                                IndexDataType accuIndex)
+        {
+            using ck::float_equal_one;
+            using ck::float_equal_zero;
+            using ck::type_convert;
+            using ck::host_common::get_index_from_flat_index;
+            using ck::host_common::get_offset_from_index;
 
-                        arg.acc_elementwise_op_(accuVal, accuVal);
+            std::size_t dst_offset = 0;
 
-                        if(!float_equal_one{}(arg.alpha_))
-                            accuVal *= type_convert<AccDataType>(arg.alpha_);
+            if constexpr(NumInvariantDim > 0)
+            {
+                auto invariant_index =
+                    get_index_from_flat_index<NumInvariantDim>(arg.invariant_lengths_, i_invariant);
 
-                        auto dst_offset = get_offset_from_index<NumInvariantDim>(arg.outStrides_,
-                                                                                 invariant_index);
+                dst_offset =
+                    get_offset_from_index<NumInvariantDim>(arg.outStrides_, invariant_index);
+            }
+            else
+                ignore = i_invariant;
 
-                        if(!float_equal_zero{}(arg.beta_))
-                            accuVal += type_convert<AccDataType>(arg.out_host_[dst_offset]) *
-                                       type_convert<AccDataType>(arg.beta_);
+            arg.acc_elementwise_op_(accuVal, accuVal);
 
-                        arg.out_host_[dst_offset]       = type_convert<OutDataType>(accuVal);
-                        arg.out_index_host_[dst_offset] = accuIndex;
-                    };
+            if(!float_equal_one{}(arg.alpha_))
+                accuVal *= type_convert<AccDataType>(arg.alpha_);
 
-                    std::size_t num_thread = std::thread::hardware_concurrency();
+            if(!float_equal_zero{}(arg.beta_))
+                accuVal += type_convert<AccDataType>(arg.out_host_[dst_offset]) *
+                           type_convert<AccDataType>(arg.beta_);
 
-                    std::size_t work_per_thread =
-                        (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
+            arg.out_host_[dst_offset] = type_convert<OutDataType>(accuVal);
 
-                    std::vector<joinable_thread> threads(num_thread);
+            if constexpr(OutputIndex)
+                arg.out_index_host_[dst_offset] = accuIndex;
+            else
+                ignore = accuIndex;
+        };
 
-                    for(std::size_t it = 0; it < num_thread; ++it)
-                    {
-                        std::size_t i_begin = it * work_per_thread;
-                        std::size_t i_end =
-                            std::min((it + 1) * work_per_thread, arg.invariant_index_set_.size());
+        static std::size_t GetInvariantOffset(const Argument& arg, std::size_t i_invariant)
+        {
+            using ck::host_common::get_index_from_flat_index;
+            using ck::host_common::get_offset_from_index;
 
-                        auto f = [=] {
-                            for(std::size_t i = i_begin; i < i_end; i++)
-                            {
-                                thread_reduce_func(arg.invariant_index_set_[i]);
-                            }
-                        };
+            if constexpr(NumInvariantDim > 0)
+            {
+                auto invariant_index =
+                    get_index_from_flat_index<NumInvariantDim>(arg.invariant_lengths_, i_invariant);
 
-                        threads[it] = joinable_thread(f);
-                    }
-                };
+                return get_offset_from_index<NumInvariantDim>(arg.in_invariant_strides_,
+                                                              invariant_index);
             }
             else
             {
-                using Accumulation =
-                    ck::detail::AccumulateWithNanCheck<PropagateNan, ReduceOperation, AccDataType>;
+                ignore = arg;
+                ignore = i_invariant;
 
-                if constexpr(NumInvariantDim == 0)
-                {
-                    AccDataType accuVal = ReduceOperation::template GetIdentityValue<AccDataType>();
-
-                    for(const auto& reduce_index : arg.reduce_index_set_)
-                    {
-                        auto in_offset = get_offset_from_index<NumReduceDim>(arg.in_reduce_strides_,
-                                                                             reduce_index);
+                return 0;
+            };
+        };
 
-                        auto currVal = type_convert<AccDataType>(arg.in_host_[in_offset]);
+        float Run(const Argument& arg, const StreamConfig& stream_config = StreamConfig{})
+        {
+            ignore = stream_config;
 
-                        arg.in_elementwise_op_(currVal, currVal);
+            const std::size_t num_thread =
+                std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
 
-                        Accumulation::Calculate(accuVal, currVal);
-                    };
+            const std::size_t invariant_length = arg.invariant_total_length_;
+            const std::size_t reduce_length    = arg.reduce_total_length_;
 
-                    arg.acc_elementwise_op_(accuVal, accuVal);
+            const std::size_t num_chunk_per_reduce =
+                (reduce_length + ReduceChunkLength - 1) / ReduceChunkLength;
 
-                    if(!float_equal_one{}(arg.alpha_))
-                        accuVal *= type_convert<AccDataType>(arg.alpha_);
+            if(num_chunk_per_reduce <= 1)
+            {
+                // short reductions, each thread reduces a contiguous range of invariant outputs
+                std::size_t work_per_thread = (invariant_length + num_thread - 1) / num_thread;
 
-                    if(!float_equal_zero{}(arg.beta_))
-                        accuVal += type_convert<AccDataType>(arg.out_host_[0]) *
-                                   type_convert<AccDataType>(arg.beta_);
+                std::vector<joinable_thread> threads(num_thread);
 
-                    arg.out_host_[0] = type_convert<OutDataType>(accuVal);
-                }
-                else
+                for(std::size_t it = 0; it < num_thread; ++it)
                 {
-                    auto thread_reduce_func = [&](auto invariant_index) {
-                        AccDataType accuVal =
-                            ReduceOperation::template GetIdentityValue<AccDataType>();
-
-                        auto in_invariant_offset = get_offset_from_index<NumInvariantDim>(
-                            arg.in_invariant_strides_, invariant_index);
+                    std::size_t i_begin = it * work_per_thread;
+                    std::size_t i_end   = std::min((it + 1) * work_per_thread, invariant_length);
 
-                        for(const auto& reduce_index : arg.reduce_index_set_)
+                    auto f = [=, &arg] {
+                        for(std::size_t i = i_begin; i < i_end; i++)
                         {
-                            auto in_reduce_offset = get_offset_from_index<NumReduceDim>(
-                                arg.in_reduce_strides_, reduce_index);
-
-                            auto currVal = type_convert<AccDataType>(
-                                arg.in_host_[in_invariant_offset + in_reduce_offset]);
-
-                            arg.in_elementwise_op_(currVal, currVal);
-
-                            Accumulation::Calculate(accuVal, currVal);
-                        };
-
-                        arg.acc_elementwise_op_(accuVal, accuVal);
-
-                        if(!float_equal_one{}(arg.alpha_))
-                            accuVal *= type_convert<AccDataType>(arg.alpha_);
-
-                        auto dst_offset = get_offset_from_index<NumInvariantDim>(arg.outStrides_,
-                                                                                 invariant_index);
-
-                        if(!float_equal_zero{}(arg.beta_))
-                            accuVal += type_convert<AccDataType>(arg.out_host_[dst_offset]) *
-                                       type_convert<AccDataType>(arg.beta_);
-
-                        arg.out_host_[dst_offset] = type_convert<OutDataType>(accuVal);
+                            AccDataType accuVal =
+                                ReduceOperation::template GetIdentityValue<AccDataType>();
+                            IndexDataType accuIndex = 0;
+
+                            AccumulateRange(arg,
+                                            GetInvariantOffset(arg, i),
+                                            0,
+                                            reduce_length,
+                                            accuVal,
+                                            accuIndex);
+
+                            StoreResult(arg, i, accuVal, accuIndex);
+                        }
                     };
 
-                    std::size_t num_thread = std::thread::hardware_concurrency();
+                    threads[it] = joinable_thread(f);
+                }
+            }
+            else
+            {
+                // long reductions, each reduction is split into chunks which are reduced in
+                // parallel, then the partial results are combined in order
+                const std::size_t num_work = invariant_length * num_chunk_per_reduce;
+
+                std::vector<AccDataType> partial_values(num_work);
+                std::vector<IndexDataType> partial_indices(num_work);
 
-                    std::size_t work_per_thread =
-                        (arg.invariant_index_set_.size() + num_thread - 1) / num_thread;
+                {
+                    std::size_t work_per_thread = (num_work + num_thread - 1) / num_thread;
 
                     std::vector<joinable_thread> threads(num_thread);
 
                     for(std::size_t it = 0; it < num_thread; ++it)
                     {
-                        std::size_t i_begin = it * work_per_thread;
-                        std::size_t i_end =
-                            std::min((it + 1) * work_per_thread, arg.invariant_index_set_.size());
+                        std::size_t iw_begin = it * work_per_thread;
+                        std::size_t iw_end   = std::min((it + 1) * work_per_thread, num_work);
 
-                        auto f = [=] {
-                            for(std::size_t i = i_begin; i < i_end; i++)
+                        auto f = [=, &arg, &partial_values, &partial_indices] {
+                            for(std::size_t iw = iw_begin; iw < iw_end; iw++)
                             {
-                                thread_reduce_func(arg.invariant_index_set_[i]);
+                                std::size_t i_invariant = iw / num_chunk_per_reduce;
+                                std::size_t i_chunk     = iw % num_chunk_per_reduce;
+
+                                std::size_t reduce_begin = i_chunk * ReduceChunkLength;
+                                std::size_t reduce_end =
+                                    std::min(reduce_begin + ReduceChunkLength, reduce_length);
+
+                                AccDataType accuVal =
+                                    ReduceOperation::template GetIdentityValue<AccDataType>();
+                                IndexDataType accuIndex = 0;
+
+                                AccumulateRange(arg,
+                                                GetInvariantOffset(arg, i_invariant),
+                                                reduce_begin,
+                                                reduce_end,
+                                                accuVal,
+                                                accuIndex);
+
+                                partial_values[iw]  = accuVal;
+                                partial_indices[iw] = accuIndex;
                             }
                         };
 
                         threads[it] = joinable_thread(f);
                     }
+                }
+
+                for(std::size_t i = 0; i < invariant_length; i++)
+                {
+                    AccDataType accuVal     = partial_values[i * num_chunk_per_reduce];
+                    IndexDataType accuIndex = partial_indices[i * num_chunk_per_reduce];
+
+                    for(std::size_t i_chunk = 1; i_chunk < num_chunk_per_reduce; i_chunk++)
+                        CombinePartial(accuVal,
+                                       accuIndex,
+                                       partial_values[i * num_chunk_per_reduce + i_chunk],
+                                       partial_indices[i * num_chunk_per_reduce + i_chunk]);
+
+                    StoreResult(arg, i, accuVal, accuIndex);
                 };
             };
 
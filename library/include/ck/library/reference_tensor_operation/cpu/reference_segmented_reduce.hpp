@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/reduction_functions_accumulate.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/device_segmented_reduce.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// in is a [TotalLength, InnerLength] tensor, out is a [NumSegments, InnerLength] tensor and
+// offsets holds the NumSegments + 1 row offsets of the segments, see DeviceSegmentedReduce
+template <typename InDataType,
+          typename AccDataType,
+          typename OutDataType,
+          typename ReduceOperation,
+          typename InElementwiseOperation,
+          typename AccElementwiseOperation,
+          bool PropagateNan>
+struct ReferenceSegmentedReduce : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& in,
+                 const std::vector<index_t>& offsets,
+                 Tensor<OutDataType>& out,
+                 double alpha,
+                 double beta,
+                 const InElementwiseOperation in_elementwise_op,
+                 const AccElementwiseOperation acc_elementwise_op)
+            : in_(in),
+              offsets_(offsets),
+              out_(out),
+              in_elementwise_op_(in_elementwise_op),
+              acc_elementwise_op_(acc_elementwise_op)
+        {
+            alpha_ = type_convert<AccDataType>(alpha);
+            beta_  = type_convert<AccDataType>(beta);
+        }
+
+        const Tensor<InDataType>& in_;
+        const std::vector<index_t>& offsets_;
+        Tensor<OutDataType>& out_;
+        AccDataType alpha_;
+        AccDataType beta_;
+        const InElementwiseOperation in_elementwise_op_;
+        const AccElementwiseOperation acc_elementwise_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        using Accumulation =
+            ck::detail::AccumulateWithNanCheck<PropagateNan, ReduceOperation, AccDataType>;
+
+        float Run(const Argument& arg)
+        {
+            const std::size_t num_segments = arg.out_.mDesc.GetLengths()[0];
+            const std::size_t inner_length = arg.out_.mDesc.GetLengths()[1];
+
+            if(arg.offsets_.size() != num_segments + 1 ||
+               arg.in_.mDesc.GetLengths()[1] != inner_length)
+                throw std::runtime_error("wrong! inconsistent segment lengths");
+
+            if(arg.offsets_.front() < 0 ||
+               static_cast<std::size_t>(arg.offsets_.back()) > arg.in_.mDesc.GetLengths()[0])
+                throw std::runtime_error("wrong! segment offsets out of range");
+
+            auto f_segment_column = [&](auto i_segment, auto i_inner) {
+                const index_t segment_begin  = arg.offsets_[i_segment];
+                const index_t segment_length = arg.offsets_[i_segment + 1] - segment_begin;
+
+                AccDataType accuVal = ReduceOperation::template GetIdentityValue<AccDataType>();
+
+                for(index_t i = 0; i < segment_length; ++i)
+                {
+                    auto currVal = type_convert<AccDataType>(arg.in_(segment_begin + i, i_inner));
+
+                    arg.in_elementwise_op_(currVal, currVal);
+
+                    Accumulation::Calculate(accuVal, currVal);
+                }
+
+                device::GetSegmentAccElementwiseOperation(arg.acc_elementwise_op_,
+                                                          segment_length)(accuVal, accuVal);
+
+                if(!float_equal_one{}(arg.alpha_))
+                    accuVal *= arg.alpha_;
+
+                if(!float_equal_zero{}(arg.beta_))
+                    accuVal += type_convert<AccDataType>(arg.out_(i_segment, i_inner)) * arg.beta_;
+
+                arg.out_(i_segment, i_inner) = type_convert<OutDataType>(accuVal);
+            };
+
+            make_ParallelTensorFunctor(f_segment_column, num_segments, inner_length)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& in,
+                             const std::vector<index_t>& offsets,
+                             Tensor<OutDataType>& out,
+                             double alpha,
+                             double beta,
+                             const InElementwiseOperation in_elementwise_op,
+                             const AccElementwiseOperation acc_elementwise_op)
+    {
+        return Argument{in, offsets, out, alpha, beta, in_elementwise_op, acc_elementwise_op};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSegmentedReduce"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Softmax of every column of every segment of a [TotalLength, InnerLength] tensor, the segments
+// being given by their NumSegments + 1 row offsets, see DeviceSegmentedSoftmax
+template <typename InDataType, typename OutDataType, typename AccDataType>
+struct ReferenceSegmentedSoftmax : public device::BaseOperator
+{
+    // Argument
+    struct Argument : public device::BaseArgument
+    {
+        Argument(const Tensor<InDataType>& in,
+                 const std::vector<index_t>& offsets,
+                 Tensor<OutDataType>& out,
+                 double alpha,
+                 double beta)
+            : in_(in), offsets_(offsets), out_(out)
+        {
+            alpha_ = static_cast<AccDataType>(alpha);
+            beta_  = static_cast<AccDataType>(beta);
+        }
+
+        const Tensor<InDataType>& in_;
+        const std::vector<index_t>& offsets_;
+        Tensor<OutDataType>& out_;
+        AccDataType alpha_;
+        AccDataType beta_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        float Run(const Argument& arg)
+        {
+            const std::size_t num_segments = arg.offsets_.size() - 1;
+            const std::size_t inner_length = arg.in_.mDesc.GetLengths()[1];
+
+            if(arg.out_.mDesc.GetLengths() != arg.in_.mDesc.GetLengths())
+                throw std::runtime_error("wrong! in and out must have the same lengths");
+
+            if(arg.offsets_.front() < 0 ||
+               static_cast<std::size_t>(arg.offsets_.back()) > arg.in_.mDesc.GetLengths()[0])
+                throw std::runtime_error("wrong! segment offsets out of range");
+
+            auto f_segment_column = [&](auto i_segment, auto i_inner) {
+                const index_t segment_begin = arg.offsets_[i_segment];
+                const index_t segment_end   = arg.offsets_[i_segment + 1];
+
+                AccDataType reduce_max = std::numeric_limits<AccDataType>::lowest();
+                for(index_t i = segment_begin; i < segment_end; ++i)
+                    reduce_max =
+                        std::max(reduce_max, ck::type_convert<AccDataType>(arg.in_(i, i_inner)));
+
+                AccDataType reduce_sum = 0;
+                for(index_t i = segment_begin; i < segment_end; ++i)
+                    reduce_sum +=
+                        std::exp(ck::type_convert<AccDataType>(arg.in_(i, i_inner)) - reduce_max);
+
+                for(index_t i = segment_begin; i < segment_end; ++i)
+                {
+                    AccDataType temp_result =
+                        arg.alpha_ *
+                            std::exp(ck::type_convert<AccDataType>(arg.in_(i, i_inner)) -
+                                     reduce_max) /
+                            reduce_sum +
+                        arg.beta_ * ck::type_convert<AccDataType>(arg.out_(i, i_inner));
+
+                    arg.out_(i, i_inner) = ck::type_convert<OutDataType>(temp_result);
+                }
+            };
+
+            make_ParallelTensorFunctor(f_segment_column, num_segments, inner_length)(
+                std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    static constexpr bool IsValidCompilationParameter()
+    {
+        // TODO: properly implement this check
+        return true;
+    }
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto MakeArgument(const Tensor<InDataType>& in,
+                             const std::vector<index_t>& offsets,
+                             Tensor<OutDataType>& out,
+                             double alpha,
+                             double beta)
+    {
+        return Argument{in, offsets, out, alpha, beta};
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSegmentedSoftmax"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
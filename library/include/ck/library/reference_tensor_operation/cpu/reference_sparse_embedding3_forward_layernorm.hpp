@@ -55,14 +55,14 @@ struct ReferenceSparseEmbedding3ForwardLayernorm : public device::BaseOperator
         {
         }
         Tensor<OutType>& output_;
-        const Tensor<EmbType> emb_a_;
-        const Tensor<EmbType> emb_b_;
-        const Tensor<EmbType> emb_c_;
-        const Tensor<IndexType> index_a_;
-        const Tensor<IndexType> index_b_;
-        const Tensor<IndexType> index_c_;
-        const Tensor<GammaDataType> gamma_;
-        const Tensor<BetaDataType> beta_;
+        const Tensor<EmbType>& emb_a_;
+        const Tensor<EmbType>& emb_b_;
+        const Tensor<EmbType>& emb_c_;
+        const Tensor<IndexType>& index_a_;
+        const Tensor<IndexType>& index_b_;
+        const Tensor<IndexType>& index_c_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
         ck::index_t NumRows_;
         ck::index_t EmbeddingDim_;
         ck::index_t IndexLength_;
@@ -0,0 +1,240 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/device/embedding_bag_pooling_mode.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+
+// Host reference of DeviceSparseEmbeddingsBagForwardLayernorm. The tables, indexes, offsets and
+// optional per-sample weights are referred to, not copied, and bags are processed in parallel
+template <typename EmbType,
+          typename IndexType,
+          typename WeightDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename AccDataType,
+          typename OutType,
+          typename EmbElementwiseOperation,
+          ck::index_t NumEmbeddings>
+struct ReferenceSparseEmbeddingsBagForwardLayernorm : public device::BaseOperator
+{
+    struct Argument : public device::BaseArgument
+    {
+        Argument(Tensor<OutType>& output,
+                 const std::array<const Tensor<EmbType>*, NumEmbeddings>& embs,
+                 const std::array<const Tensor<IndexType>*, NumEmbeddings>& indexes,
+                 const std::array<const Tensor<IndexType>*, NumEmbeddings>& offsets,
+                 const std::array<const Tensor<WeightDataType>*, NumEmbeddings>& per_sample_weights,
+                 const Tensor<GammaDataType>& gamma,
+                 const Tensor<BetaDataType>& beta,
+                 device::EmbeddingBagPoolingMode pooling_mode,
+                 AccDataType epsilon,
+                 EmbElementwiseOperation emb_elementwise_op)
+            : output_(output),
+              embs_(embs),
+              indexes_(indexes),
+              offsets_(offsets),
+              per_sample_weights_(per_sample_weights),
+              gamma_(gamma),
+              beta_(beta),
+              pooling_mode_(pooling_mode),
+              epsilon_(epsilon),
+              emb_elementwise_op_(emb_elementwise_op)
+        {
+        }
+
+        Tensor<OutType>& output_;
+        const std::array<const Tensor<EmbType>*, NumEmbeddings> embs_;
+        const std::array<const Tensor<IndexType>*, NumEmbeddings> indexes_;
+        const std::array<const Tensor<IndexType>*, NumEmbeddings> offsets_;
+        const std::array<const Tensor<WeightDataType>*, NumEmbeddings> per_sample_weights_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
+        device::EmbeddingBagPoolingMode pooling_mode_;
+        AccDataType epsilon_;
+        EmbElementwiseOperation emb_elementwise_op_;
+    };
+
+    // Invoker
+    struct Invoker : public device::BaseInvoker
+    {
+        float Run(const Argument& arg)
+        {
+            const std::size_t num_bags = arg.output_.mDesc.GetLengths()[0];
+            const std::size_t D        = arg.output_.mDesc.GetLengths()[1];
+
+            // validate everything up front, an exception must not escape the worker threads
+            for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+            {
+                const auto& emb    = *arg.embs_[i];
+                const auto& index  = *arg.indexes_[i];
+                const auto& offset = *arg.offsets_[i];
+
+                if(offset.mDesc.GetElementSize() != num_bags + 1)
+                    throw(std::runtime_error("wrong! offsets must hold NumBags + 1 entries"));
+
+                const auto num_rows    = static_cast<IndexType>(emb.mDesc.GetLengths()[0]);
+                const auto num_indexes = static_cast<IndexType>(index.mDesc.GetElementSize());
+
+                for(std::size_t bag = 0; bag < num_bags; ++bag)
+                {
+                    if(offset(bag) < 0 || offset(bag) > offset(bag + 1) ||
+                       offset(bag + 1) > num_indexes)
+                        throw(std::runtime_error("wrong! offsets out of range"));
+                }
+
+                for(IndexType j = offset(0); j < offset(num_bags); ++j)
+                    if(index(j) < 0 || index(j) >= num_rows)
+                        throw(std::runtime_error("wrong! out of range"));
+            }
+
+            auto f_bag = [&](auto bag) {
+                std::array<std::vector<AccDataType>, NumEmbeddings> pooled;
+
+                for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                {
+                    const auto& emb     = *arg.embs_[i];
+                    const auto& index   = *arg.indexes_[i];
+                    const auto& offset  = *arg.offsets_[i];
+                    const auto* weights = arg.per_sample_weights_[i];
+
+                    const IndexType bag_begin = offset(bag);
+                    const IndexType bag_end   = offset(bag + 1);
+
+                    pooled[i].assign(D, type_convert<AccDataType>(0.0f));
+
+                    for(IndexType j = bag_begin; j < bag_end; ++j)
+                    {
+                        const IndexType row = index(j);
+
+                        const AccDataType weight = weights == nullptr
+                                                       ? type_convert<AccDataType>(1.0f)
+                                                       : type_convert<AccDataType>((*weights)(j));
+
+                        for(std::size_t d = 0; d < D; ++d)
+                            pooled[i][d] += weight * type_convert<AccDataType>(emb(row, d));
+                    }
+
+                    if(arg.pooling_mode_ == device::EmbeddingBagPoolingMode::Mean &&
+                       bag_end > bag_begin)
+                    {
+                        const auto bag_length = type_convert<AccDataType>(
+                            static_cast<float>(bag_end - bag_begin));
+
+                        for(std::size_t d = 0; d < D; ++d)
+                            pooled[i][d] = pooled[i][d] / bag_length;
+                    }
+                }
+
+                // combine the tables
+                std::vector<AccDataType> x(D);
+
+                for(std::size_t d = 0; d < D; ++d)
+                {
+                    std::array<AccDataType, NumEmbeddings> values;
+
+                    for(ck::index_t i = 0; i < NumEmbeddings; ++i)
+                        values[i] = pooled[i][d];
+
+                    std::apply([&](auto... xs) { arg.emb_elementwise_op_(x[d], xs...); }, values);
+                }
+
+                // layernorm
+                AccDataType mean = 0;
+                AccDataType var  = 0;
+
+                for(std::size_t d = 0; d < D; ++d)
+                    mean += x[d];
+
+                mean = mean / D;
+
+                for(std::size_t d = 0; d < D; ++d)
+                    var += (x[d] - mean) * (x[d] - mean);
+
+                var = var / D;
+
+                for(std::size_t d = 0; d < D; ++d)
+                {
+                    auto y_val = (x[d] - mean) / std::sqrt(var + arg.epsilon_);
+                    y_val      = y_val * type_convert<AccDataType>(arg.gamma_(d)) +
+                            type_convert<AccDataType>(arg.beta_(d));
+
+                    arg.output_(bag, d) = type_convert<OutType>(y_val);
+                }
+            };
+
+            make_ParallelTensorFunctor(f_bag, num_bags)(std::thread::hardware_concurrency());
+
+            return 0;
+        }
+
+        float Run(const device::BaseArgument* p_arg,
+                  const StreamConfig& /* stream_config */ = StreamConfig{}) override
+        {
+            return Run(*dynamic_cast<const Argument*>(p_arg));
+        }
+    };
+
+    bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
+
+    static auto
+    MakeArgument(Tensor<OutType>& output,
+                 const std::array<const Tensor<EmbType>*, NumEmbeddings>& embs,
+                 const std::array<const Tensor<IndexType>*, NumEmbeddings>& indexes,
+                 const std::array<const Tensor<IndexType>*, NumEmbeddings>& offsets,
+                 const std::array<const Tensor<WeightDataType>*, NumEmbeddings>& per_sample_weights,
+                 const Tensor<GammaDataType>& gamma,
+                 const Tensor<BetaDataType>& beta,
+                 device::EmbeddingBagPoolingMode pooling_mode,
+                 AccDataType epsilon,
+                 EmbElementwiseOperation emb_elementwise_op)
+    {
+        return Argument(output,
+                        embs,
+                        indexes,
+                        offsets,
+                        per_sample_weights,
+                        gamma,
+                        beta,
+                        pooling_mode,
+                        epsilon,
+                        emb_elementwise_op);
+    }
+
+    static auto MakeInvoker() { return Invoker{}; }
+
+    virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
+    {
+        return std::make_unique<Invoker>(Invoker{});
+    }
+
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
+        // clang-format off
+        str << "ReferenceSparseEmbeddingsBagForwardLayernorm"
+            << std::endl;
+        // clang-format on
+
+        return str.str();
+    }
+};
+
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -20,6 +20,7 @@ using F16  = ck::half_t;
 using BF16 = ck::bhalf_t;
 using I8   = int8_t;
 using I32  = int32_t;
+using F8   = ck::f8_t;
 
 using Empty_Tuple = ck::Tuple<>;
 
@@ -30,6 +31,10 @@ using F64_Tuple     = ck::Tuple<F64>;
 using F32_Tuple     = ck::Tuple<F32>;
 using I32_Tuple     = ck::Tuple<I32>;
 using I32_F32_Tuple = ck::Tuple<I32, F32>;
+using F32_F32_Tuple = ck::Tuple<F32, F32>;
+
+using I32_F32_I8_Tuple = ck::Tuple<I32, F32, I8>;
+using I32_F32_F8_Tuple = ck::Tuple<I32, F32, F8>;
 
 // GEMM layout
 using Row = ck::tensor_layout::gemm::RowMajor;
@@ -37,6 +42,7 @@ using Col = ck::tensor_layout::gemm::ColumnMajor;
 
 using Row_Tuple     = ck::Tuple<Row>;
 using Row_Row_Tuple = ck::Tuple<Row, Row>;
+using Col_Row_Tuple = ck::Tuple<Col, Row>;
 
 // Conv layout
 //
@@ -83,6 +89,10 @@ using GK          = ck::tensor_layout::convolution::G_K;
 using GK_Tuple    = ck::Tuple<GK>;
 using GK_GK_Tuple = ck::Tuple<GK, GK>;
 
+using GK_GK_NWGK_Tuple   = ck::Tuple<GK, GK, NWGK>;
+using GK_GK_NHWGK_Tuple  = ck::Tuple<GK, GK, NHWGK>;
+using GK_GK_NDHWGK_Tuple = ck::Tuple<GK, GK, NDHWGK>;
+
 // pointwise functor
 using PassThrough    = ck::tensor_operation::element_wise::PassThrough;
 using Relu           = ck::tensor_operation::element_wise::Relu;
@@ -120,6 +130,10 @@ template <typename Activation>
 using Add_Mul2_Activation_Mul_Clamp =
     ck::tensor_operation::element_wise::Add_Mul2_Activation_Mul_Clamp<Activation>;
 
+template <typename Activation>
+using Add_Mul2_Add_Activation_Clamp =
+    ck::tensor_operation::element_wise::Add_Mul2_Add_Activation_Clamp<Activation>;
+
 template <typename DeviceOp, typename Tag = void>
 struct DeviceOperationInstanceFactory;
 
@@ -0,0 +1,230 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+#include <vector>
+#include <memory>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f16_mk_nk_mn_scale_tensor_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Empty_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    Empty_Tuple,
+                                                    F16,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleTensor>>>&);
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_bf16_mk_nk_mn_scale_tensor_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Empty_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    Empty_Tuple,
+                                                    BF16,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleTensor>>>&);
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f8_mk_nk_mn_scale_tensor_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Empty_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    Empty_Tuple,
+                                                    F8,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleTensor>>>&);
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_f16_mk_nk_mn_scale_rowcol_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Col_Row_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    F32_F32_Tuple,
+                                                    F16,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleRowCol>>>&);
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_bf16_mk_nk_mn_scale_rowcol_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Col_Row_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    F32_F32_Tuple,
+                                                    BF16,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleRowCol>>>&);
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_f8_mk_nk_mn_scale_rowcol_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Col_Row_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    F32_F32_Tuple,
+                                                    F8,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleRowCol>>>&);
+
+// FP8 GEMM, E = scale_a * scale_b * (A * B) with a scale per tensor
+template <typename ALayout,
+          typename BLayout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename EDataType>
+struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGemmMultipleD<
+    ALayout,
+    BLayout,
+    Empty_Tuple,
+    ELayout,
+    ADataType,
+    BDataType,
+    Empty_Tuple,
+    EDataType,
+    ck::tensor_operation::element_wise::PassThrough,
+    ck::tensor_operation::element_wise::PassThrough,
+    ck::tensor_operation::element_wise::ScaleTensor>>
+{
+    using DeviceOp = DeviceGemmMultipleD<ALayout,
+                                         BLayout,
+                                         Empty_Tuple,
+                                         ELayout,
+                                         ADataType,
+                                         BDataType,
+                                         Empty_Tuple,
+                                         EDataType,
+                                         ck::tensor_operation::element_wise::PassThrough,
+                                         ck::tensor_operation::element_wise::PassThrough,
+                                         ck::tensor_operation::element_wise::ScaleTensor>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        if constexpr(is_same_v<ADataType, f8_t> && is_same_v<BDataType, f8_t> &&
+                     is_same_v<ALayout, Row> && is_same_v<BLayout, Col> && is_same_v<ELayout, Row>)
+        {
+            if constexpr(is_same_v<EDataType, half_t>)
+            {
+                add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f16_mk_nk_mn_scale_tensor_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<EDataType, bhalf_t>)
+            {
+                add_device_gemm_fp8_xdl_c_shuffle_f8_f8_bf16_mk_nk_mn_scale_tensor_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<EDataType, f8_t>)
+            {
+                add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f8_mk_nk_mn_scale_tensor_instances(op_ptrs);
+            }
+        }
+
+        return op_ptrs;
+    }
+};
+
+// FP8 GEMM, E[m, n] = (A * B)[m, n] * D0[m] * D1[n] with a scale per row of A (D0, column-major
+// with a stride of 0) and a scale per column of B (D1, row-major with a stride of 0)
+template <typename ALayout,
+          typename BLayout,
+          typename D0Layout,
+          typename D1Layout,
+          typename ELayout,
+          typename ADataType,
+          typename BDataType,
+          typename D0DataType,
+          typename D1DataType,
+          typename EDataType>
+struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGemmMultipleD<
+    ALayout,
+    BLayout,
+    ck::Tuple<D0Layout, D1Layout>,
+    ELayout,
+    ADataType,
+    BDataType,
+    ck::Tuple<D0DataType, D1DataType>,
+    EDataType,
+    ck::tensor_operation::element_wise::PassThrough,
+    ck::tensor_operation::element_wise::PassThrough,
+    ck::tensor_operation::element_wise::ScaleRowCol>>
+{
+    using DeviceOp = DeviceGemmMultipleD<ALayout,
+                                         BLayout,
+                                         ck::Tuple<D0Layout, D1Layout>,
+                                         ELayout,
+                                         ADataType,
+                                         BDataType,
+                                         ck::Tuple<D0DataType, D1DataType>,
+                                         EDataType,
+                                         ck::tensor_operation::element_wise::PassThrough,
+                                         ck::tensor_operation::element_wise::PassThrough,
+                                         ck::tensor_operation::element_wise::ScaleRowCol>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        if constexpr(is_same_v<ADataType, f8_t> && is_same_v<BDataType, f8_t> &&
+                     is_same_v<D0DataType, float> && is_same_v<D1DataType, float> &&
+                     is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
+                     is_same_v<D0Layout, Col> && is_same_v<D1Layout, Row> &&
+                     is_same_v<ELayout, Row>)
+        {
+            if constexpr(is_same_v<EDataType, half_t>)
+            {
+                add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_f16_mk_nk_mn_scale_rowcol_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<EDataType, bhalf_t>)
+            {
+                add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_bf16_mk_nk_mn_scale_rowcol_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<EDataType, f8_t>)
+            {
+                add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_f8_mk_nk_mn_scale_rowcol_instances(
+                    op_ptrs);
+            }
+        }
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdlib>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_weight_only_quant.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// A: f16, B: 4-bit codes, Scale/Zero: f16, E: f16
+void add_device_gemm_weight_only_quant_f16_i4_f16_f16_mk_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmWeightOnlyQuant<F16, F16, F16, 4, PassThrough, PassThrough>>>& instances);
+
+// A: f16, B: 8-bit codes, Scale/Zero: f16, E: f16
+void add_device_gemm_weight_only_quant_f16_i8_f16_f16_mk_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmWeightOnlyQuant<F16, F16, F16, 8, PassThrough, PassThrough>>>& instances);
+
+template <typename ADataType, typename ScaleDataType, typename EDataType, index_t WeightBits>
+struct DeviceOperationInstanceFactory<
+    ck::tensor_operation::device::DeviceGemmWeightOnlyQuant<ADataType,
+                                                            ScaleDataType,
+                                                            EDataType,
+                                                            WeightBits,
+                                                            PassThrough,
+                                                            PassThrough>>
+{
+    using DeviceOp = DeviceGemmWeightOnlyQuant<ADataType,
+                                               ScaleDataType,
+                                               EDataType,
+                                               WeightBits,
+                                               PassThrough,
+                                               PassThrough>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        if constexpr(is_same_v<ADataType, half_t> && is_same_v<ScaleDataType, half_t> &&
+                     is_same_v<EDataType, half_t>)
+        {
+            if constexpr(WeightBits == 4)
+            {
+                add_device_gemm_weight_only_quant_f16_i4_f16_f16_mk_nk_mn_instances(op_ptrs);
+            }
+            else if constexpr(WeightBits == 8)
+            {
+                add_device_gemm_weight_only_quant_f16_i8_f16_f16_mk_nk_mn_instances(op_ptrs);
+            }
+        }
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_grouped_conv_fwd_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// grouped conv1d forward, NWGC/GKXC/NWGK, residual in NWGK
+void add_device_conv1d_xdl_bias_relu_residual_perchannel_quantization_int8_instances(
+    std::vector<
+        std::unique_ptr<DeviceGroupedConvFwdMultipleD<1,
+                                                      NWGC,
+                                                      GKXC,
+                                                      GK_GK_NWGK_Tuple,
+                                                      NWGK,
+                                                      I8,
+                                                      I8,
+                                                      I32_F32_I8_Tuple,
+                                                      I8,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      Add_Mul2_Add_Activation_Clamp<Relu>>>>&
+        instances);
+
+void add_device_conv1d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+    std::vector<
+        std::unique_ptr<DeviceGroupedConvFwdMultipleD<1,
+                                                      NWGC,
+                                                      GKXC,
+                                                      GK_GK_NWGK_Tuple,
+                                                      NWGK,
+                                                      I8,
+                                                      I8,
+                                                      I32_F32_F8_Tuple,
+                                                      F8,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      Add_Mul2_Add_Activation_Clamp<Relu>>>>&
+        instances);
+
+// grouped conv2d forward, NHWGC/GKYXC/NHWGK, residual in NHWGK
+void add_device_conv2d_xdl_bias_relu_residual_perchannel_quantization_int8_instances(
+    std::vector<
+        std::unique_ptr<DeviceGroupedConvFwdMultipleD<2,
+                                                      NHWGC,
+                                                      GKYXC,
+                                                      GK_GK_NHWGK_Tuple,
+                                                      NHWGK,
+                                                      I8,
+                                                      I8,
+                                                      I32_F32_I8_Tuple,
+                                                      I8,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      Add_Mul2_Add_Activation_Clamp<Relu>>>>&
+        instances);
+
+void add_device_conv2d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+    std::vector<
+        std::unique_ptr<DeviceGroupedConvFwdMultipleD<2,
+                                                      NHWGC,
+                                                      GKYXC,
+                                                      GK_GK_NHWGK_Tuple,
+                                                      NHWGK,
+                                                      I8,
+                                                      I8,
+                                                      I32_F32_F8_Tuple,
+                                                      F8,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      Add_Mul2_Add_Activation_Clamp<Relu>>>>&
+        instances);
+
+// grouped conv3d forward, NDHWGC/GKZYXC/NDHWGK, residual in NDHWGK
+void add_device_conv3d_xdl_bias_relu_residual_perchannel_quantization_int8_instances(
+    std::vector<
+        std::unique_ptr<DeviceGroupedConvFwdMultipleD<3,
+                                                      NDHWGC,
+                                                      GKZYXC,
+                                                      GK_GK_NDHWGK_Tuple,
+                                                      NDHWGK,
+                                                      I8,
+                                                      I8,
+                                                      I32_F32_I8_Tuple,
+                                                      I8,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      Add_Mul2_Add_Activation_Clamp<Relu>>>>&
+        instances);
+
+void add_device_conv3d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+    std::vector<
+        std::unique_ptr<DeviceGroupedConvFwdMultipleD<3,
+                                                      NDHWGC,
+                                                      GKZYXC,
+                                                      GK_GK_NDHWGK_Tuple,
+                                                      NDHWGK,
+                                                      I8,
+                                                      I8,
+                                                      I32_F32_F8_Tuple,
+                                                      F8,
+                                                      PassThrough,
+                                                      PassThrough,
+                                                      Add_Mul2_Add_Activation_Clamp<Relu>>>>&
+        instances);
+
+// bias + perchannel requantization + residual add, piecewise activation function
+// Ds are the bias [G, K], the requantization scale [G, K] and the residual, laid out as the output
+template <ck::index_t NumDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename DsLayout,
+          typename OutLayout,
+          typename InDataType,
+          typename WeiDataType,
+          typename DsDataType,
+          typename OutDataType,
+          typename Activation>
+struct DeviceOperationInstanceFactory<ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD<
+    NumDimSpatial,
+    InLayout,
+    WeiLayout,
+    DsLayout,
+    OutLayout,
+    InDataType,
+    WeiDataType,
+    DsDataType,
+    OutDataType,
+    ck::tensor_operation::element_wise::PassThrough,
+    ck::tensor_operation::element_wise::PassThrough,
+    Add_Mul2_Add_Activation_Clamp<Activation>>>
+{
+    using DeviceOp = DeviceGroupedConvFwdMultipleD<NumDimSpatial,
+                                                   InLayout,
+                                                   WeiLayout,
+                                                   DsLayout,
+                                                   OutLayout,
+                                                   InDataType,
+                                                   WeiDataType,
+                                                   DsDataType,
+                                                   OutDataType,
+                                                   ck::tensor_operation::element_wise::PassThrough,
+                                                   ck::tensor_operation::element_wise::PassThrough,
+                                                   Add_Mul2_Add_Activation_Clamp<Activation>>;
+
+    static auto GetInstances()
+    {
+        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+
+        if constexpr(NumDimSpatial == 1 && is_same_v<InLayout, NWGC> &&
+                     is_same_v<WeiLayout, GKXC> && is_same_v<DsLayout, GK_GK_NWGK_Tuple> &&
+                     is_same_v<OutLayout, NWGK> && is_same_v<InDataType, I8> &&
+                     is_same_v<WeiDataType, I8> && is_same_v<Activation, Relu>)
+        {
+            if constexpr(is_same_v<DsDataType, I32_F32_I8_Tuple> && is_same_v<OutDataType, I8>)
+            {
+                add_device_conv1d_xdl_bias_relu_residual_perchannel_quantization_int8_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<DsDataType, I32_F32_F8_Tuple> &&
+                              is_same_v<OutDataType, F8>)
+            {
+                add_device_conv1d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+                    op_ptrs);
+            }
+        }
+        else if constexpr(NumDimSpatial == 2 && is_same_v<InLayout, NHWGC> &&
+                          is_same_v<WeiLayout, GKYXC> && is_same_v<DsLayout, GK_GK_NHWGK_Tuple> &&
+                          is_same_v<OutLayout, NHWGK> && is_same_v<InDataType, I8> &&
+                          is_same_v<WeiDataType, I8> && is_same_v<Activation, Relu>)
+        {
+            if constexpr(is_same_v<DsDataType, I32_F32_I8_Tuple> && is_same_v<OutDataType, I8>)
+            {
+                add_device_conv2d_xdl_bias_relu_residual_perchannel_quantization_int8_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<DsDataType, I32_F32_F8_Tuple> &&
+                              is_same_v<OutDataType, F8>)
+            {
+                add_device_conv2d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+                    op_ptrs);
+            }
+        }
+        else if constexpr(NumDimSpatial == 3 && is_same_v<InLayout, NDHWGC> &&
+                          is_same_v<WeiLayout, GKZYXC> && is_same_v<DsLayout, GK_GK_NDHWGK_Tuple> &&
+                          is_same_v<OutLayout, NDHWGK> && is_same_v<InDataType, I8> &&
+                          is_same_v<WeiDataType, I8> && is_same_v<Activation, Relu>)
+        {
+            if constexpr(is_same_v<DsDataType, I32_F32_I8_Tuple> && is_same_v<OutDataType, I8>)
+            {
+                add_device_conv3d_xdl_bias_relu_residual_perchannel_quantization_int8_instances(
+                    op_ptrs);
+            }
+            else if constexpr(is_same_v<DsDataType, I32_F32_F8_Tuple> &&
+                              is_same_v<OutDataType, F8>)
+            {
+                add_device_conv3d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+                    op_ptrs);
+            }
+        }
+
+        return op_ptrs;
+    }
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -10,6 +10,7 @@
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <ostream>
 #include <type_traits>
 #include <vector>
 
@@ -23,6 +24,33 @@
 namespace ck {
 namespace utils {
 
+namespace detail {
+// messages of check_err on the calling thread, std::cerr if nullptr
+inline thread_local std::ostream* p_check_err_stream = nullptr;
+} // namespace detail
+
+inline std::ostream& check_err_stream()
+{
+    return detail::p_check_err_stream != nullptr ? *detail::p_check_err_stream : std::cerr;
+}
+
+// sends the messages of check_err on the calling thread to os while in scope, e.g. to buffer the
+// messages of checks run on another thread
+struct ScopedCheckErrStream
+{
+    explicit ScopedCheckErrStream(std::ostream& os) : p_prev_(detail::p_check_err_stream)
+    {
+        detail::p_check_err_stream = &os;
+    }
+
+    ScopedCheckErrStream(const ScopedCheckErrStream&) = delete;
+    ScopedCheckErrStream& operator=(const ScopedCheckErrStream&) = delete;
+
+    ~ScopedCheckErrStream() { detail::p_check_err_stream = p_prev_; }
+
+    std::ostream* p_prev_;
+};
+
 template <typename Range, typename RefRange>
 typename std::enable_if<
     std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
@@ -37,8 +65,8 @@ check_err(const Range& out,
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        check_err_stream() << msg << " out.size() != ref.size(), :" << out.size()
+                           << " != " << ref.size() << std::endl;
         return false;
     }
 
@@ -57,15 +85,17 @@ check_err(const Range& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                check_err_stream() << msg << std::setw(12) << std::setprecision(7) << " out["
+                                   << i << "] != ref[" << i << "]: " << o << " != " << r
+                                   << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        check_err_stream() << std::setw(12) << std::setprecision(7) << "max err: " << max_err
+                           << std::endl;
     }
     return res;
 }
@@ -83,8 +113,8 @@ check_err(const Range& out,
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        check_err_stream() << msg << " out.size() != ref.size(), :" << out.size()
+                           << " != " << ref.size() << std::endl;
         return false;
     }
 
@@ -104,15 +134,17 @@ check_err(const Range& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                check_err_stream() << msg << std::setw(12) << std::setprecision(7) << " out["
+                                   << i << "] != ref[" << i << "]: " << o << " != " << r
+                                   << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        check_err_stream() << std::setw(12) << std::setprecision(7) << "max err: " << max_err
+                           << std::endl;
     }
     return res;
 }
@@ -130,8 +162,8 @@ check_err(const Range& out,
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        check_err_stream() << msg << " out.size() != ref.size(), :" << out.size()
+                           << " != " << ref.size() << std::endl;
         return false;
     }
 
@@ -150,15 +182,17 @@ check_err(const Range& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                check_err_stream() << msg << std::setw(12) << std::setprecision(7) << " out["
+                                   << i << "] != ref[" << i << "]: " << o << " != " << r
+                                   << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
+        check_err_stream() << std::setw(12) << std::setprecision(7) << "max err: " << max_err
+                           << std::endl;
     }
     return res;
 }
@@ -180,8 +214,8 @@ check_err(const Range& out,
 {
     if(out.size() != ref.size())
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
+        check_err_stream() << msg << " out.size() != ref.size(), :" << out.size()
+                           << " != " << ref.size() << std::endl;
         return false;
     }
 
@@ -201,15 +235,15 @@ check_err(const Range& out,
             err_count++;
             if(err_count < 5)
             {
-                std::cerr << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
-                          << std::endl;
+                check_err_stream() << msg << " out[" << i << "] != ref[" << i << "]: " << o
+                                   << " != " << r << std::endl;
             }
             res = false;
         }
     }
     if(!res)
     {
-        std::cerr << "max err: " << max_err << std::endl;
+        check_err_stream() << "max err: " << max_err << std::endl;
     }
     return res;
 }
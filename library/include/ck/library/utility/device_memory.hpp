@@ -3,12 +3,18 @@
 
 #pragma once
 
+#include <algorithm>
+#include <stdexcept>
+
 #include <hip/hip_runtime.h>
 
+class DeviceMemoryPool;
+
 template <typename T>
 __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
 {
-    for(uint64_t i = threadIdx.x; i < buffer_element_size; i += blockDim.x)
+    for(uint64_t i = blockIdx.x * blockDim.x + threadIdx.x; i < buffer_element_size;
+        i += gridDim.x * blockDim.x)
     {
         p[i] = x;
     }
@@ -17,15 +23,26 @@ __global__ void set_buffer_value(T* p, T x, uint64_t buffer_element_size)
 /**
  * @brief Container for storing data in GPU device memory
  *
+ * The memory comes from hipMalloc, or from a DeviceMemoryPool, in which case it goes back to the
+ * pool on destruction, to be reused once the work queued on stream before is done.
+ *
+ * ToDevice / FromDevice are synchronous. Large copies go through pinned staging buffers, chunk
+ * by chunk, the host copy of a chunk overlapping the transfer of the previous one.
+ * ToDeviceAsync / FromDeviceAsync are queued on a stream and record done, if not null, once
+ * the copy is complete; the host memory should be pinned, e.g. a PinnedHostMem, for them to
+ * return before the copy is done.
  */
 struct DeviceMem
 {
     DeviceMem() = delete;
     DeviceMem(std::size_t mem_size);
+    DeviceMem(std::size_t mem_size, DeviceMemoryPool& pool, hipStream_t stream = nullptr);
     void* GetDeviceBuffer() const;
     std::size_t GetBufferSize() const;
     void ToDevice(const void* p) const;
     void FromDevice(void* p) const;
+    void ToDeviceAsync(const void* p, hipStream_t stream, hipEvent_t done = nullptr) const;
+    void FromDeviceAsync(void* p, hipStream_t stream, hipEvent_t done = nullptr) const;
     void SetZero() const;
     template <typename T>
     void SetValue(T x) const;
@@ -33,6 +50,26 @@ struct DeviceMem
 
     void* mpDeviceBuf;
     std::size_t mMemSize;
+    DeviceMemoryPool* mpPool = nullptr;
+    hipStream_t mStream      = nullptr;
+};
+
+/**
+ * @brief Container for storing data in page-locked host memory
+ *
+ */
+struct PinnedHostMem
+{
+    PinnedHostMem() = delete;
+    PinnedHostMem(std::size_t mem_size);
+    PinnedHostMem(const PinnedHostMem&) = delete;
+    PinnedHostMem& operator=(const PinnedHostMem&) = delete;
+    void* GetHostBuffer() const;
+    std::size_t GetBufferSize() const;
+    ~PinnedHostMem();
+
+    void* mpHostBuf;
+    std::size_t mMemSize;
 };
 
 template <typename T>
@@ -43,5 +80,11 @@ void DeviceMem::SetValue(T x) const
         throw std::runtime_error("wrong! not entire DeviceMem will be set");
     }
 
-    set_buffer_value<T><<<1, 1024>>>(static_cast<T*>(mpDeviceBuf), x, mMemSize / sizeof(T));
+    const uint64_t element_size = mMemSize / sizeof(T);
+    const uint64_t block_size   = 256;
+    const uint64_t grid_size =
+        std::clamp<uint64_t>((element_size + block_size - 1) / block_size, 1, 1024);
+
+    set_buffer_value<T><<<grid_size, block_size, 0, mStream>>>(
+        static_cast<T*>(mpDeviceBuf), x, element_size);
 }
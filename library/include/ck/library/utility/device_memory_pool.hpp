@@ -0,0 +1,200 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <hip/hip_runtime.h>
+
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+
+/**
+ * @brief Allocation backend of a DeviceMemoryPool
+ *
+ */
+struct MemoryPoolBackend
+{
+    // nullptr if out of memory
+    virtual void* Allocate(std::size_t size) = 0;
+    virtual void Free(void* p)               = 0;
+    // waits for the work queued on the stream, DeviceMemoryPool::Allocate calls it unlocked
+    virtual void Synchronize(hipStream_t stream) = 0;
+
+    virtual ~MemoryPoolBackend() {}
+};
+
+// hipMalloc / hipFree
+struct HipMemoryPoolBackend : public MemoryPoolBackend
+{
+    void* Allocate(std::size_t size) override;
+    void Free(void* p) override;
+    void Synchronize(hipStream_t stream) override;
+};
+
+// host memory, for testing the bookkeeping of the pool without a GPU: capacity is the number of
+// bytes that can be allocated at once, 0 for no limit
+struct HostMemoryPoolBackend : public MemoryPoolBackend
+{
+    explicit HostMemoryPoolBackend(std::size_t capacity = 0) : capacity_{capacity} {}
+
+    void* Allocate(std::size_t size) override;
+    void Free(void* p) override;
+    void Synchronize(hipStream_t stream) override;
+
+    std::size_t capacity_;
+    std::size_t bytes_allocated_ = 0;
+    std::unordered_map<void*, std::size_t> allocations_;
+    // guards synchronized_streams_, Synchronize is called outside the lock of the pool
+    std::mutex mutex_;
+    std::vector<hipStream_t> synchronized_streams_;
+};
+
+struct MemoryPoolStats
+{
+    // calls of Allocate, and how many of them were served from the cache
+    std::size_t num_requests_ = 0;
+    std::size_t num_reuses_   = 0;
+    // calls of the backend
+    std::size_t num_backend_allocations_ = 0;
+    std::size_t num_backend_frees_       = 0;
+    // blocks in use: the requested bytes, and the bytes of their size classes
+    std::size_t bytes_requested_ = 0;
+    std::size_t bytes_in_use_    = 0;
+    // free blocks kept by the pool
+    std::size_t bytes_cached_ = 0;
+    // largest bytes_in_use_ + bytes_cached_ so far
+    std::size_t peak_bytes_reserved_ = 0;
+
+    // share of the bytes in use lost to the rounding to size classes
+    double GetInternalFragmentation() const
+    {
+        if(bytes_in_use_ == 0)
+        {
+            return 0.;
+        }
+
+        return 1. - static_cast<double>(bytes_requested_) / static_cast<double>(bytes_in_use_);
+    }
+
+    // share of the reserved bytes that are cached, i.e. not in use
+    double GetCachedRatio() const
+    {
+        const std::size_t bytes_reserved = bytes_in_use_ + bytes_cached_;
+
+        return bytes_reserved == 0
+                   ? 0.
+                   : static_cast<double>(bytes_cached_) / static_cast<double>(bytes_reserved);
+    }
+};
+
+/**
+ * @brief Stream-ordered caching allocator
+ *
+ * Requests are rounded up to size classes, four per power of two, and freed blocks are kept in
+ * bins by size class instead of being returned to the backend. A block freed on a stream is
+ * reused right away by a request on the same stream, the work queued before on that stream
+ * being done by the time the new work runs; a request on another stream first waits for the
+ * stream the block was freed on. When the backend is out of memory, the cached blocks are
+ * released and the allocation retried.
+ */
+class DeviceMemoryPool
+{
+    public:
+    static constexpr std::size_t MinBlockSize                = 512;
+    static constexpr std::size_t NumSizeClassesPerPowerOfTwo = 4;
+
+    explicit DeviceMemoryPool(std::unique_ptr<MemoryPoolBackend> backend);
+
+    DeviceMemoryPool(const DeviceMemoryPool&) = delete;
+    DeviceMemoryPool& operator=(const DeviceMemoryPool&) = delete;
+
+    // releases the cached blocks, the blocks in use are left to their owners
+    ~DeviceMemoryPool();
+
+    // smallest size class holding size bytes
+    static std::size_t GetSizeClass(std::size_t size);
+
+    void* Allocate(std::size_t size, hipStream_t stream = nullptr);
+
+    // stream is the one the last work using the block was queued on
+    void Free(void* p, hipStream_t stream = nullptr);
+
+    // returns the cached blocks to the backend
+    void ReleaseCached();
+
+    MemoryPoolStats GetStats() const;
+
+    private:
+    struct FreeBlock
+    {
+        void* p_;
+        hipStream_t stream_;
+    };
+
+    struct UsedBlock
+    {
+        std::size_t size_;
+        std::size_t size_class_;
+    };
+
+    void ReleaseCachedLocked();
+
+    mutable std::mutex mutex_;
+    std::unique_ptr<MemoryPoolBackend> backend_;
+    // free blocks by size class
+    std::multimap<std::size_t, FreeBlock> free_blocks_;
+    std::unordered_map<void*, UsedBlock> used_blocks_;
+    MemoryPoolStats stats_;
+};
+
+// pool of the process for the current HIP device, one per device
+DeviceMemoryPool& GetDeviceMemoryPool();
+
+/**
+ * @brief Workspace of a device op drawn from a DeviceMemoryPool
+ *
+ * Allocates op.GetWorkSpaceSize(p_arg) bytes, if any, and sets them as the workspace of the
+ * argument; the block goes back to the pool on destruction.
+ */
+struct PooledWorkspace
+{
+    PooledWorkspace(const ck::tensor_operation::device::BaseOperator& op,
+                    ck::tensor_operation::device::BaseArgument* p_arg,
+                    DeviceMemoryPool& pool = GetDeviceMemoryPool(),
+                    hipStream_t stream     = nullptr)
+        : mPool(pool), mStream(stream), mMemSize(op.GetWorkSpaceSize(p_arg))
+    {
+        if(mMemSize > 0)
+        {
+            mpDeviceBuf = mPool.Allocate(mMemSize, mStream);
+
+            op.SetWorkSpacePointer(p_arg, mpDeviceBuf);
+        }
+    }
+
+    PooledWorkspace(const PooledWorkspace&) = delete;
+    PooledWorkspace& operator=(const PooledWorkspace&) = delete;
+
+    ~PooledWorkspace()
+    {
+        if(mpDeviceBuf != nullptr)
+        {
+            mPool.Free(mpDeviceBuf, mStream);
+        }
+    }
+
+    void* GetDeviceBuffer() const { return mpDeviceBuf; }
+
+    std::size_t GetBufferSize() const { return mMemSize; }
+
+    DeviceMemoryPool& mPool;
+    hipStream_t mStream;
+    std::size_t mMemSize;
+    void* mpDeviceBuf = nullptr;
+};
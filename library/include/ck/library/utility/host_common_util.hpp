@@ -132,5 +132,43 @@ static inline size_t get_offset_from_index(const std::array<index_t, NDim>& stri
     return (offset);
 };
 
+// get the multi-index of the i-th element of a packed (row-major) index space without
+// materializing the whole index set
+template <int NDim>
+static inline std::array<index_t, NDim> get_index_from_flat_index(
+    const std::array<index_t, NDim>& dim_lengths, size_t flat_index)
+{
+    std::array<index_t, NDim> index;
+
+    for(int i = NDim - 1; i >= 0; i--)
+    {
+        index[i] = static_cast<index_t>(flat_index % dim_lengths[i]);
+        flat_index /= dim_lengths[i];
+    };
+
+    return (index);
+};
+
+// step the multi-index to the next element of the packed (row-major) index space, and keep
+// the tensor offset corresponding to the multi-index in sync with it
+template <int NDim>
+static inline void move_index_and_offset_forward(const std::array<index_t, NDim>& dim_lengths,
+                                                 const std::array<index_t, NDim>& strides,
+                                                 std::array<index_t, NDim>& index,
+                                                 size_t& offset)
+{
+    for(int i = NDim - 1; i >= 0; i--)
+    {
+        index[i]++;
+        offset += static_cast<size_t>(strides[i]);
+
+        if(index[i] < dim_lengths[i])
+            return;
+
+        offset -= static_cast<size_t>(dim_lengths[i]) * static_cast<size_t>(strides[i]);
+        index[i] = 0;
+    };
+};
+
 } // namespace host_common
 } // namespace ck
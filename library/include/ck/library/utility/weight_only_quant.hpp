@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+#include "ck/ck.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// Asymmetric per-group quantization of the weights B[N, K] to WeightBits-bit unsigned codes, for
+// DeviceGemmWeightOnlyQuant. For each group of group_size consecutive k of a row:
+//   scale = (max - min) / (2^WeightBits - 1), zero = round(-min / scale)
+//   code  = clamp(round(b / scale) + zero, 0, 2^WeightBits - 1)
+// with min <= 0 <= max, so that b ~ (code - zero) * scale. The codes are computed with the scale
+// rounded to ScaleDataType, i.e. the one the kernels use.
+//   b_n_k: [N, K], code_n_k: [N, K], scale_n_g and zero_n_g: [N, K / group_size]
+template <index_t WeightBits, typename WeightDataType, typename ScaleDataType>
+void quantize_weight_only(const Tensor<WeightDataType>& b_n_k,
+                          index_t group_size,
+                          Tensor<uint8_t>& code_n_k,
+                          Tensor<ScaleDataType>& scale_n_g,
+                          Tensor<ScaleDataType>& zero_n_g)
+{
+    static_assert(WeightBits == 4 || WeightBits == 8, "wrong! only 4-bit and 8-bit weights");
+
+    constexpr float max_code = (1 << WeightBits) - 1;
+
+    const std::size_t N = b_n_k.GetLengths()[0];
+    const std::size_t K = b_n_k.GetLengths()[1];
+
+    if(group_size <= 0 || K % group_size != 0)
+    {
+        throw std::runtime_error("wrong! K is not a multiple of the group size");
+    }
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        for(std::size_t g = 0; g < K / group_size; ++g)
+        {
+            float min_value = 0.f;
+            float max_value = 0.f;
+
+            for(std::size_t k = g * group_size; k < (g + 1) * group_size; ++k)
+            {
+                const float b = ck::type_convert<float>(b_n_k(n, k));
+
+                min_value = std::min(min_value, b);
+                max_value = std::max(max_value, b);
+            }
+
+            const auto scale = ck::type_convert<ScaleDataType>(
+                max_value > min_value ? (max_value - min_value) / max_code : 1.f);
+
+            const float scale_f32 = ck::type_convert<float>(scale);
+
+            const float zero = std::clamp(std::round(-min_value / scale_f32), 0.f, max_code);
+
+            scale_n_g(n, g) = scale;
+            zero_n_g(n, g)  = ck::type_convert<ScaleDataType>(zero);
+
+            for(std::size_t k = g * group_size; k < (g + 1) * group_size; ++k)
+            {
+                const float b = ck::type_convert<float>(b_n_k(n, k));
+
+                const float code = std::clamp(std::round(b / scale_f32) + zero, 0.f, max_code);
+
+                code_n_k(n, k) = static_cast<uint8_t>(code);
+            }
+        }
+    }
+}
+
+// Pack the codes of B[N, K] in the layout of DeviceGemmWeightOnlyQuant: row n of the result holds
+// the codes of row n of B in stride_b bytes, two codes per byte with WeightBits = 4, the even k in
+// the low nibble
+template <index_t WeightBits>
+Tensor<uint8_t> pack_weight_only_quant(const Tensor<uint8_t>& code_n_k, std::size_t stride_b)
+{
+    static_assert(WeightBits == 4 || WeightBits == 8, "wrong! only 4-bit and 8-bit weights");
+
+    constexpr std::size_t code_per_byte = 8 / WeightBits;
+
+    const std::size_t N = code_n_k.GetLengths()[0];
+    const std::size_t K = code_n_k.GetLengths()[1];
+
+    if(K % code_per_byte != 0 || stride_b < K / code_per_byte)
+    {
+        throw std::runtime_error("wrong! K or stride_b does not fit the packed codes");
+    }
+
+    Tensor<uint8_t> b_packed({N, stride_b});
+
+    b_packed.SetZero();
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            const uint8_t code = code_n_k(n, k) & ((1 << WeightBits) - 1);
+            const auto shift   = (k % code_per_byte) * WeightBits;
+
+            b_packed(n, k / code_per_byte) |= static_cast<uint8_t>(code << shift);
+        }
+    }
+
+    return b_packed;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_skinny.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// Compilation parameters for a[m, k] * b[k, n] = c[m, n], M <= 16
+using device_gemm_skinny_f32_f32_f32_mk_kn_mn_instances =
+    std::tuple<
+        // clang-format off
+        //###############| AData| BData| CData| AccData| ALayout| BLayout| CLayout|           A|           B|           C| Block|  MPer|  NPer|   NPer|   KPer|   BScalar|
+        //###############|  Type|  Type|  Type|    Type|        |        |        | Elementwise| Elementwise| Elementwise|  Size| Block| Block| Thread| Thread| PerVector|
+        //###############|      |      |      |        |        |        |        |   Operation|   Operation|   Operation|      |      |      |       |       |          |
+        // M = 1, K split across up to 32 threads
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     1,    32,      4,      2,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     1,    64,      4,      2,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     1,   128,      4,      1,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     1,    16,      2,      4,         2>,
+        // M up to 16
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     4,    32,      4,      2,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     4,    64,      4,      1,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     8,    32,      4,      1,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,    16,    16,      2,      1,         2>,
+        // N not a multiple of the vector length
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     1,    16,      2,      1,         2>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,     4,    16,      1,      1,         1>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Row,     Row, PassThrough, PassThrough, PassThrough,   256,    16,    16,      1,      1,         1>
+        // clang-format on
+        >;
+
+void add_device_gemm_skinny_f32_f32_f32_mk_kn_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Row, Row, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        instances)
+{
+    add_device_operation_instances(instances, device_gemm_skinny_f32_f32_f32_mk_kn_mn_instances{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
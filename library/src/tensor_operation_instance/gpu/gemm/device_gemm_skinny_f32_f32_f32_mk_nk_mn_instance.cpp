@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_skinny.hpp"
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// Compilation parameters for a[m, k] * b[n, k] = c[m, n], M <= 16
+using device_gemm_skinny_f32_f32_f32_mk_nk_mn_instances =
+    std::tuple<
+        // clang-format off
+        //###############| AData| BData| CData| AccData| ALayout| BLayout| CLayout|           A|           B|           C| Block|  MPer|  NPer|   NPer|   KPer|   BScalar|
+        //###############|  Type|  Type|  Type|    Type|        |        |        | Elementwise| Elementwise| Elementwise|  Size| Block| Block| Thread| Thread| PerVector|
+        //###############|      |      |      |        |        |        |        |   Operation|   Operation|   Operation|      |      |      |       |       |          |
+        // M = 1, K split across up to 128 threads
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     1,     2,      1,      4,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     1,     4,      1,      4,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     1,     8,      1,      4,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     1,     8,      1,      8,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     1,    16,      1,      4,         4>,
+        // M up to 16
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     4,     4,      1,      4,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     4,     8,      1,      4,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     8,     8,      1,      4,         4>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,    16,    16,      1,      4,         4>,
+        // K not a multiple of the vector length
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     1,     8,      1,      2,         2>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,     4,     8,      1,      1,         1>,
+        DeviceGemmSkinny<   F32,   F32,   F32,     F32,     Row,     Col,     Row, PassThrough, PassThrough, PassThrough,   256,    16,    16,      1,      1,         1>
+        // clang-format on
+        >;
+
+void add_device_gemm_skinny_f32_f32_f32_mk_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemm<Row, Col, Row, F32, F32, F32, PassThrough, PassThrough, PassThrough>>>&
+        instances)
+{
+    add_device_operation_instances(instances, device_gemm_skinny_f32_f32_f32_mk_nk_mn_instances{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
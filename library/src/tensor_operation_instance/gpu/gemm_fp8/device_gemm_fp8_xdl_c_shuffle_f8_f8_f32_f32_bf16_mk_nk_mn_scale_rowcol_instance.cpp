@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_multiple_d_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using ScaleRowCol = ck::tensor_operation::element_wise::ScaleRowCol;
+
+static constexpr auto GemmDefault    = ck::tensor_operation::device::GemmSpecialization::Default;
+static constexpr auto GemmMNKPadding = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+// E = type_convert<E>(D0[m] * D1[n] * (A[m, k] * B[k, n]))
+// the per-row scale D0 is read as a ColumnMajor tensor broadcast along N, which requires
+// scalar access in the epilogue
+using device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_bf16_mk_nk_mn_scale_rowcol_instances =
+    std::tuple<
+        // clang-format off
+        // no padding
+        // M % MPerBlock == 0 && N % NPerBlock == 0 && K % KPerBlock == 0, i.e. K % 64 == 0
+        //##############################|      A|      B|            Ds|      E| AData| BData| AccData| CShuffle|        DsData| EData|           A|           B|            CDE|           GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths|  CBlockTransfer|
+        //##############################| Layout| Layout|        Layout| Layout|  Type|  Type|    Type| DataType|          Type|  Type| Elementwise| Elementwise|    Elementwise| Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|  SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl| ScalarPerVector|
+        //##############################|       |       |              |       |      |      |        |         |              |      |   Operation|   Operation|      Operation|               |    Stage|      |      |      |      |    |    |     |     | Wave| Wave| Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          | Lengths_K0_N_K1|   ArrangeOrder|               |              |      PerVector|   PerVector_K1|          |  PerShuffle|  PerShuffle|         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl|
+        //##############################|       |       |              |       |      |      |        |         |              |      |            |            |               |               |         |      |      |      |      |    |    |     |     |     |     |                |               |               |               |               |               |          |                |               |               |              |               |               |          |            |            |                             |                |
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   256,   256,   128,    64,  16,  16,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   256,   128,   256,    64,  16,  16,   32,   32,    2,    4,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   128,   128,   128,    64,  16,  16,   32,   32,    4,    2,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 16, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   256,   128,   128,    64,  16,  16,   32,   32,    2,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   128,   128,    64,    64,  16,  16,   32,   32,    2,    2,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 4>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   128,    64,   128,    64,  16,  16,   32,   32,    2,    2,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 16, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,    64,    64,    64,    64,  16,  16,   32,   32,    2,    2,     S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 16, 1, 4>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   256,   128,    64,    64,  16,  16,   32,   32,    2,    1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol,    GemmDefault,        1,   256,    64,   128,    64,  16,  16,   32,   32,    1,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+
+        // M/N/K padding
+        // K % 16 == 0 for the 16-wide vector loads of A and B
+        //##############################|      A|      B|            Ds|      E| AData| BData| AccData| CShuffle|        DsData| EData|           A|           B|            CDE|           GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths|  CBlockTransfer|
+        //##############################| Layout| Layout|        Layout| Layout|  Type|  Type|    Type| DataType|          Type|  Type| Elementwise| Elementwise|    Elementwise| Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|  SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl| ScalarPerVector|
+        //##############################|       |       |              |       |      |      |        |         |              |      |   Operation|   Operation|      Operation|               |    Stage|      |      |      |      |    |    |     |     | Wave| Wave| Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          | Lengths_K0_N_K1|   ArrangeOrder|               |              |      PerVector|   PerVector_K1|          |  PerShuffle|  PerShuffle|         _NBlock_NWaveNPerXdl|   _NWaveNPerXdl|
+        //##############################|       |       |              |       |      |      |        |         |              |      |            |            |               |               |         |      |      |      |      |    |    |     |     |     |     |                |               |               |               |               |               |          |                |               |               |              |               |               |          |            |            |                             |                |
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   256,   256,   128,    64,  16,  16,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   256,   128,   256,    64,  16,  16,   32,   32,    2,    4,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   128,   128,   128,    64,  16,  16,   32,   32,    4,    2,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 16, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   256,   128,   128,    64,  16,  16,   32,   32,    2,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   128,   128,    64,    64,  16,  16,   32,   32,    2,    2,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 4>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   128,    64,   128,    64,  16,  16,   32,   32,    2,    2,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 32, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 16, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,    64,    64,    64,    64,  16,  16,   32,   32,    2,    2,     S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 16, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 16, 1, 4>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   256,   128,    64,    64,  16,  16,   32,   32,    2,    1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        DeviceGemmMultipleD_Xdl_CShuffle<    Row,    Col, Col_Row_Tuple,    Row,    F8,    F8,     F32,      F32, F32_F32_Tuple,  BF16, PassThrough, PassThrough,    ScaleRowCol, GemmMNKPadding,        1,   256,    64,   128,    64,  16,  16,   32,   32,    1,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,             16,             16,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,             16,             16,         1,           1,           1,               S<1, 32, 1, 8>,               1>,
+        // clang-format on
+        >;
+
+void add_device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_bf16_mk_nk_mn_scale_rowcol_instances(
+    std::vector<std::unique_ptr<DeviceGemmMultipleD<Row,
+                                                    Col,
+                                                    Col_Row_Tuple,
+                                                    Row,
+                                                    F8,
+                                                    F8,
+                                                    F32_F32_Tuple,
+                                                    BF16,
+                                                    PassThrough,
+                                                    PassThrough,
+                                                    ScaleRowCol>>>& instances)
+{
+    add_device_operation_instances(
+        instances,
+        device_gemm_fp8_xdl_c_shuffle_f8_f8_f32_f32_bf16_mk_nk_mn_scale_rowcol_instances{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
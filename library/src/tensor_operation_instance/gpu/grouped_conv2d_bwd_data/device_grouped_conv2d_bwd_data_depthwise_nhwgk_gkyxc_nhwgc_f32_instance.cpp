@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_bwd_data_multiple_d_depthwise.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/add_device_operation_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F32 = float;
+
+using Empty_Tuple = ck::Tuple<>;
+
+using NHWGC = ck::tensor_layout::convolution::NHWGC;
+using GKYXC = ck::tensor_layout::convolution::GKYXC;
+using NHWGK = ck::tensor_layout::convolution::NHWGK;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// Compilation parameters for out[n, ho, wo, g, k] * wei[g, k, y, x, c] = in[n, hi, wi, g, c]
+// with c = 1
+using device_grouped_conv2d_bwd_data_depthwise_nhwgk_gkyxc_nhwgc_f32_instances = std::tuple<
+    // clang-format off
+        // ###########################################|    NDim| ALayout| BLayout|    DsLayout| ELayout| AData| BData| AccData|      DsData| EData| AElementwise| BElementwise| CDEElementwise| Block|     G|
+        // ###########################################| Spatial|        |        |            |        |  Type|  Type|    Type|        Type|  Type|    Operation|    Operation|      Operation|  Size|    Per|
+        // ###########################################|        |        |        |            |        |      |      |        |            |      |             |             |               |      | Thread|
+        DeviceGroupedConvBwdDataMultipleD_Depthwise<       2,   NHWGK,   GKYXC, Empty_Tuple,   NHWGC,   F32,   F32,     F32, Empty_Tuple,   F32,  PassThrough,  PassThrough,    PassThrough,   256,       4>,
+        DeviceGroupedConvBwdDataMultipleD_Depthwise<       2,   NHWGK,   GKYXC, Empty_Tuple,   NHWGC,   F32,   F32,     F32, Empty_Tuple,   F32,  PassThrough,  PassThrough,    PassThrough,   256,       2>,
+        DeviceGroupedConvBwdDataMultipleD_Depthwise<       2,   NHWGK,   GKYXC, Empty_Tuple,   NHWGC,   F32,   F32,     F32, Empty_Tuple,   F32,  PassThrough,  PassThrough,    PassThrough,   256,       1>
+    // clang-format on
+    >;
+
+void add_device_grouped_conv2d_bwd_data_depthwise_nhwgk_gkyxc_nhwgc_f32_instances(
+    std::vector<std::unique_ptr<DeviceGroupedConvBwdDataMultipleD<2,
+                                                                  NHWGK,
+                                                                  GKYXC,
+                                                                  Empty_Tuple,
+                                                                  NHWGC,
+                                                                  F32,
+                                                                  F32,
+                                                                  Empty_Tuple,
+                                                                  F32,
+                                                                  PassThrough,
+                                                                  PassThrough,
+                                                                  PassThrough>>>& instances)
+{
+    add_device_operation_instances(
+        instances, device_grouped_conv2d_bwd_data_depthwise_nhwgk_gkyxc_nhwgc_f32_instances{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,44 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "gemm_quantization_common.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_weight_only_quant_impl.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+using F16 = ck::half_t;
+using F32 = float;
+
+// A: f16 [M, K], B: 8-bit codes [N, K], Scale/Zero: f16 [N, K / GroupSize], E: f16 [M, N]
+using device_gemm_weight_only_quant_f16_i8_f16_f16_mk_nk_mn_instances = std::tuple<
+    // clang-format off
+        //############################| AData| Scale|  Acc| EData| Weight|           A|           C| Block|  MPer|  NPer|   KPer|
+        //############################|  Type|  Type| Type|  Type|   Bits| Elementwise| Elementwise|  Size| Block| Block| Thread|
+        //############################|      |      |     |      |       |   Operation|   Operation|      |      |      |       |
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     1,     8,     16>,
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     1,     4,     16>,
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     1,    16,      8>,
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     4,     8,     16>,
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     8,    16,      8>,
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,    16,    32,      8>,
+        // small groups
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     1,     8,      4>,
+        DeviceGemmWeightOnlyQuantImpl<   F16,   F16,  F32,   F16,      8, PassThrough, PassThrough,   256,     4,    16,      4>
+    // clang-format on
+    >;
+
+void add_device_gemm_weight_only_quant_f16_i8_f16_f16_mk_nk_mn_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmWeightOnlyQuant<F16, F16, F16, 8, PassThrough, PassThrough>>>& instances)
+{
+    add_device_operation_instances(
+        instances, device_gemm_weight_only_quant_f16_i8_f16_f16_mk_nk_mn_instances{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
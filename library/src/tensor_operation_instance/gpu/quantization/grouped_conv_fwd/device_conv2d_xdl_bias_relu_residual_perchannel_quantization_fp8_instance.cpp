@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include "device_grouped_conv_fwd_xdl_int8_residual_quantization_instance.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+void add_device_conv2d_xdl_bias_relu_residual_perchannel_quantization_fp8_instances(
+    std::vector<std::unique_ptr<DeviceGroupedConvFwdMultipleD<2,
+                                                              NHWGC,
+                                                              GKYXC,
+                                                              GK_GK_NHWGK_Tuple,
+                                                              NHWGK,
+                                                              I8,
+                                                              I8,
+                                                              I32_F32_F8_Tuple,
+                                                              F8,
+                                                              PassThrough,
+                                                              PassThrough,
+                                                              Add_Mul2_Add_Relu_Clamp>>>& instances)
+{
+    add_device_operation_instances(
+        instances,
+        device_grouped_conv_fwd_xdl_int8_residual_quantization_instances<2,
+                                                                         NHWGC,
+                                                                         GKYXC,
+                                                                         GK_GK_NHWGK_Tuple,
+                                                                         NHWGK,
+                                                                         I32_F32_F8_Tuple,
+                                                                         F8,
+                                                                         Add_Mul2_Add_Relu_Clamp,
+                                                                         ConvFwdDefault,
+                                                                         8>{});
+    add_device_operation_instances(
+        instances,
+        device_grouped_conv_fwd_xdl_int8_residual_quantization_instances<2,
+                                                                         NHWGC,
+                                                                         GKYXC,
+                                                                         GK_GK_NHWGK_Tuple,
+                                                                         NHWGK,
+                                                                         I32_F32_F8_Tuple,
+                                                                         F8,
+                                                                         Add_Mul2_Add_Relu_Clamp,
+                                                                         ConvFwd1x1P0,
+                                                                         8>{});
+    add_device_operation_instances(
+        instances,
+        device_grouped_conv_fwd_xdl_int8_residual_quantization_instances<2,
+                                                                         NHWGC,
+                                                                         GKYXC,
+                                                                         GK_GK_NHWGK_Tuple,
+                                                                         NHWGK,
+                                                                         I32_F32_F8_Tuple,
+                                                                         F8,
+                                                                         Add_Mul2_Add_Relu_Clamp,
+                                                                         ConvFwd1x1S1P0,
+                                                                         8>{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
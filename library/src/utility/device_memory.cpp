@@ -1,29 +1,206 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <cstring>
+#include <mutex>
+
 #include "ck/host_utility/hip_check_error.hpp"
 
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/device_memory_pool.hpp"
+
+namespace {
+
+// Pinned buffers the synchronous copies of pageable memory go through, two chunks in flight
+struct PinnedStaging
+{
+    static constexpr std::size_t ChunkSize = 32 << 20;
+
+    PinnedStaging()
+    {
+        for(int i = 0; i < 2; ++i)
+        {
+            hip_check_error(hipHostMalloc(&buffers_[i], ChunkSize));
+            hip_check_error(hipEventCreateWithFlags(&events_[i], hipEventDisableTiming));
+        }
+
+        hip_check_error(hipEventCreateWithFlags(&start_, hipEventDisableTiming));
+        hip_check_error(hipStreamCreateWithFlags(&stream_, hipStreamNonBlocking));
+    }
+
+    // the copy starts after the work queued on stream
+    void WaitFor(hipStream_t stream)
+    {
+        hip_check_error(hipEventRecord(start_, stream));
+        hip_check_error(hipStreamWaitEvent(stream_, start_, 0));
+    }
+
+    std::mutex mutex_;
+    void* buffers_[2];
+    hipEvent_t events_[2];
+    hipEvent_t start_;
+    hipStream_t stream_;
+};
+
+// never destroyed: the HIP runtime may be torn down before the static objects
+PinnedStaging& GetPinnedStaging()
+{
+    static auto* staging = new PinnedStaging;
+
+    return *staging;
+}
+
+} // namespace
 
 DeviceMem::DeviceMem(std::size_t mem_size) : mMemSize(mem_size)
 {
     hip_check_error(hipMalloc(static_cast<void**>(&mpDeviceBuf), mMemSize));
 }
 
+DeviceMem::DeviceMem(std::size_t mem_size, DeviceMemoryPool& pool, hipStream_t stream)
+    : mpDeviceBuf(pool.Allocate(mem_size, stream)),
+      mMemSize(mem_size),
+      mpPool(&pool),
+      mStream(stream)
+{
+}
+
 void* DeviceMem::GetDeviceBuffer() const { return mpDeviceBuf; }
 
 std::size_t DeviceMem::GetBufferSize() const { return mMemSize; }
 
 void DeviceMem::ToDevice(const void* p) const
 {
-    hip_check_error(hipMemcpy(mpDeviceBuf, const_cast<void*>(p), mMemSize, hipMemcpyHostToDevice));
+    if(mMemSize <= PinnedStaging::ChunkSize)
+    {
+        hip_check_error(
+            hipMemcpy(mpDeviceBuf, const_cast<void*>(p), mMemSize, hipMemcpyHostToDevice));
+
+        return;
+    }
+
+    auto& staging = GetPinnedStaging();
+
+    std::lock_guard<std::mutex> lock(staging.mutex_);
+
+    staging.WaitFor(mStream);
+
+    const auto* src = static_cast<const char*>(p);
+    auto* dst       = static_cast<char*>(mpDeviceBuf);
+
+    for(std::size_t offset = 0, chunk = 0; offset < mMemSize;
+        offset += PinnedStaging::ChunkSize, ++chunk)
+    {
+        const std::size_t size = std::min(PinnedStaging::ChunkSize, mMemSize - offset);
+        const std::size_t i    = chunk % 2;
+
+        // the transfer of the chunk before last is done with the buffer
+        hip_check_error(hipEventSynchronize(staging.events_[i]));
+
+        std::memcpy(staging.buffers_[i], src + offset, size);
+
+        hip_check_error(hipMemcpyAsync(
+            dst + offset, staging.buffers_[i], size, hipMemcpyHostToDevice, staging.stream_));
+        hip_check_error(hipEventRecord(staging.events_[i], staging.stream_));
+    }
+
+    hip_check_error(hipStreamSynchronize(staging.stream_));
 }
 
 void DeviceMem::FromDevice(void* p) const
 {
-    hip_check_error(hipMemcpy(p, mpDeviceBuf, mMemSize, hipMemcpyDeviceToHost));
+    if(mMemSize <= PinnedStaging::ChunkSize)
+    {
+        hip_check_error(hipMemcpy(p, mpDeviceBuf, mMemSize, hipMemcpyDeviceToHost));
+
+        return;
+    }
+
+    auto& staging = GetPinnedStaging();
+
+    std::lock_guard<std::mutex> lock(staging.mutex_);
+
+    staging.WaitFor(mStream);
+
+    const auto* src = static_cast<const char*>(mpDeviceBuf);
+    auto* dst       = static_cast<char*>(p);
+
+    const std::size_t num_chunks =
+        (mMemSize + PinnedStaging::ChunkSize - 1) / PinnedStaging::ChunkSize;
+
+    // copies chunk out of its staging buffer, once its transfer is done
+    const auto drain = [&](std::size_t chunk) {
+        const std::size_t offset = chunk * PinnedStaging::ChunkSize;
+        const std::size_t size   = std::min(PinnedStaging::ChunkSize, mMemSize - offset);
+        const std::size_t i      = chunk % 2;
+
+        hip_check_error(hipEventSynchronize(staging.events_[i]));
+
+        std::memcpy(dst + offset, staging.buffers_[i], size);
+    };
+
+    for(std::size_t chunk = 0; chunk < num_chunks; ++chunk)
+    {
+        const std::size_t offset = chunk * PinnedStaging::ChunkSize;
+        const std::size_t size   = std::min(PinnedStaging::ChunkSize, mMemSize - offset);
+        const std::size_t i      = chunk % 2;
+
+        hip_check_error(hipMemcpyAsync(
+            staging.buffers_[i], src + offset, size, hipMemcpyDeviceToHost, staging.stream_));
+        hip_check_error(hipEventRecord(staging.events_[i], staging.stream_));
+
+        // the previous chunk is copied out while this one is transferred
+        if(chunk > 0)
+        {
+            drain(chunk - 1);
+        }
+    }
+
+    drain(num_chunks - 1);
+}
+
+void DeviceMem::ToDeviceAsync(const void* p, hipStream_t stream, hipEvent_t done) const
+{
+    hip_check_error(hipMemcpyAsync(
+        mpDeviceBuf, const_cast<void*>(p), mMemSize, hipMemcpyHostToDevice, stream));
+
+    if(done != nullptr)
+    {
+        hip_check_error(hipEventRecord(done, stream));
+    }
+}
+
+void DeviceMem::FromDeviceAsync(void* p, hipStream_t stream, hipEvent_t done) const
+{
+    hip_check_error(hipMemcpyAsync(p, mpDeviceBuf, mMemSize, hipMemcpyDeviceToHost, stream));
+
+    if(done != nullptr)
+    {
+        hip_check_error(hipEventRecord(done, stream));
+    }
 }
 
 void DeviceMem::SetZero() const { hip_check_error(hipMemset(mpDeviceBuf, 0, mMemSize)); }
 
-DeviceMem::~DeviceMem() { hip_check_error(hipFree(mpDeviceBuf)); }
+DeviceMem::~DeviceMem()
+{
+    if(mpPool != nullptr)
+    {
+        mpPool->Free(mpDeviceBuf, mStream);
+    }
+    else
+    {
+        hip_check_error(hipFree(mpDeviceBuf));
+    }
+}
+
+PinnedHostMem::PinnedHostMem(std::size_t mem_size) : mMemSize(mem_size)
+{
+    hip_check_error(hipHostMalloc(&mpHostBuf, mMemSize));
+}
+
+void* PinnedHostMem::GetHostBuffer() const { return mpHostBuf; }
+
+std::size_t PinnedHostMem::GetBufferSize() const { return mMemSize; }
+
+PinnedHostMem::~PinnedHostMem() { hip_check_error(hipHostFree(mpHostBuf)); }
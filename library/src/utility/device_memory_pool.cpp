@@ -0,0 +1,259 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+
+#include "ck/host_utility/hip_check_error.hpp"
+
+#include "ck/library/utility/device_memory_pool.hpp"
+
+void* HipMemoryPoolBackend::Allocate(std::size_t size)
+{
+    void* p = nullptr;
+
+    const hipError_t status = hipMalloc(&p, size);
+
+    if(status == hipErrorOutOfMemory)
+    {
+        // clear the error, the pool retries after releasing its cache
+        static_cast<void>(hipGetLastError());
+
+        return nullptr;
+    }
+
+    hip_check_error(status);
+
+    return p;
+}
+
+void HipMemoryPoolBackend::Free(void* p) { hip_check_error(hipFree(p)); }
+
+void HipMemoryPoolBackend::Synchronize(hipStream_t stream)
+{
+    hip_check_error(hipStreamSynchronize(stream));
+}
+
+void* HostMemoryPoolBackend::Allocate(std::size_t size)
+{
+    if(capacity_ != 0 && bytes_allocated_ + size > capacity_)
+    {
+        return nullptr;
+    }
+
+    void* p = std::malloc(size);
+
+    if(p == nullptr)
+    {
+        return nullptr;
+    }
+
+    bytes_allocated_ += size;
+    allocations_.emplace(p, size);
+
+    return p;
+}
+
+void HostMemoryPoolBackend::Free(void* p)
+{
+    const auto it = allocations_.find(p);
+
+    if(it == allocations_.end())
+    {
+        throw std::runtime_error("wrong! freeing memory not allocated by the backend");
+    }
+
+    bytes_allocated_ -= it->second;
+    allocations_.erase(it);
+
+    std::free(p);
+}
+
+void HostMemoryPoolBackend::Synchronize(hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    synchronized_streams_.push_back(stream);
+}
+
+DeviceMemoryPool::DeviceMemoryPool(std::unique_ptr<MemoryPoolBackend> backend)
+    : backend_(std::move(backend))
+{
+}
+
+DeviceMemoryPool::~DeviceMemoryPool() { ReleaseCachedLocked(); }
+
+std::size_t DeviceMemoryPool::GetSizeClass(std::size_t size)
+{
+    if(size <= MinBlockSize)
+    {
+        return MinBlockSize;
+    }
+
+    // largest power of two not above size
+    std::size_t power_of_two = MinBlockSize;
+
+    while(power_of_two <= size / 2)
+    {
+        power_of_two *= 2;
+    }
+
+    const std::size_t step = power_of_two / NumSizeClassesPerPowerOfTwo;
+
+    return (size + step - 1) / step * step;
+}
+
+void* DeviceMemoryPool::Allocate(std::size_t size, hipStream_t stream)
+{
+    const std::size_t size_class = GetSizeClass(size);
+
+    void* p = nullptr;
+
+    // the stream a block reused from another one was freed on, waited for after the lock is
+    // released so that the requests of the other threads do not wait as well
+    bool wait_for_free_stream = false;
+    hipStream_t free_stream   = nullptr;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        stats_.num_requests_ += 1;
+
+        const auto [first, last] = free_blocks_.equal_range(size_class);
+
+        if(first != last)
+        {
+            // a block freed on the same stream if any, else the first one
+            auto it = std::find_if(
+                first, last, [&](const auto& block) { return block.second.stream_ == stream; });
+
+            if(it == last)
+            {
+                it = first;
+
+                wait_for_free_stream = true;
+                free_stream          = it->second.stream_;
+            }
+
+            p = it->second.p_;
+
+            // out of the bins, no other request gets the block while its stream is waited for
+            free_blocks_.erase(it);
+
+            stats_.num_reuses_ += 1;
+            stats_.bytes_cached_ -= size_class;
+        }
+        else
+        {
+            p = backend_->Allocate(size_class);
+
+            if(p == nullptr)
+            {
+                ReleaseCachedLocked();
+
+                p = backend_->Allocate(size_class);
+            }
+
+            if(p == nullptr)
+            {
+                throw std::runtime_error("wrong! out of device memory");
+            }
+
+            stats_.num_backend_allocations_ += 1;
+        }
+
+        used_blocks_.emplace(p, UsedBlock{size, size_class});
+
+        stats_.bytes_requested_ += size;
+        stats_.bytes_in_use_ += size_class;
+        stats_.peak_bytes_reserved_ =
+            std::max(stats_.peak_bytes_reserved_, stats_.bytes_in_use_ + stats_.bytes_cached_);
+    }
+
+    if(wait_for_free_stream)
+    {
+        backend_->Synchronize(free_stream);
+    }
+
+    return p;
+}
+
+void DeviceMemoryPool::Free(void* p, hipStream_t stream)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const auto it = used_blocks_.find(p);
+
+    if(it == used_blocks_.end())
+    {
+        throw std::runtime_error("wrong! freeing a block not allocated by the pool");
+    }
+
+    const UsedBlock block = it->second;
+
+    used_blocks_.erase(it);
+
+    free_blocks_.emplace(block.size_class_, FreeBlock{p, stream});
+
+    stats_.bytes_requested_ -= block.size_;
+    stats_.bytes_in_use_ -= block.size_class_;
+    stats_.bytes_cached_ += block.size_class_;
+}
+
+void DeviceMemoryPool::ReleaseCached()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ReleaseCachedLocked();
+}
+
+void DeviceMemoryPool::ReleaseCachedLocked()
+{
+    for(const auto& block : free_blocks_)
+    {
+        // the block may still be in use by work queued before it was freed
+        backend_->Synchronize(block.second.stream_);
+        backend_->Free(block.second.p_);
+
+        stats_.num_backend_frees_ += 1;
+    }
+
+    free_blocks_.clear();
+
+    stats_.bytes_cached_ = 0;
+}
+
+MemoryPoolStats DeviceMemoryPool::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    return stats_;
+}
+
+DeviceMemoryPool& GetDeviceMemoryPool()
+{
+    struct DevicePools
+    {
+        std::mutex mutex_;
+        std::map<int, std::unique_ptr<DeviceMemoryPool>> pools_;
+    };
+
+    // never destroyed: the HIP runtime may be torn down before the static objects
+    static auto* device_pools = new DevicePools{};
+
+    int device = 0;
+
+    hip_check_error(hipGetDevice(&device));
+
+    std::lock_guard<std::mutex> lock(device_pools->mutex_);
+
+    auto& pool = device_pools->pools_[device];
+
+    if(!pool)
+    {
+        pool = std::make_unique<DeviceMemoryPool>(std::make_unique<HipMemoryPoolBackend>());
+    }
+
+    return *pool;
+}
@@ -0,0 +1,261 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <condition_variable>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/hip_check_error.hpp"
+#include "ck/utility/span.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Verification of the instances overlapping with the run of the next one. The instances write
+// their output to GetDeviceBuffer(), which alternates between two buffers when verifying:
+// Submit() reads the output of the instance back on a copy stream, into pinned memory, and a
+// worker thread checks it against the reference while the caller goes on with the next instance.
+// The pass flag and the messages of check_err are kept per instance, and printed by Finish() in
+// the order of the instances, so that they do not interleave with the rest of the output of the
+// profiler. Without verification a single output buffer is allocated, no worker is started, and
+// Submit() must not be called.
+template <typename DataType>
+class AsyncResultCheck
+{
+    public:
+    AsyncResultCheck(const Tensor<DataType>& reference, bool do_verification)
+        : reference_(reference), do_verification_(do_verification)
+    {
+        const std::size_t size = sizeof(DataType) * reference.mData.size();
+
+        device_bufs_[0] = std::make_unique<DeviceMem>(size);
+
+        if(!do_verification_)
+        {
+            return;
+        }
+
+        device_bufs_[1] = std::make_unique<DeviceMem>(size);
+
+        for(int i = 0; i < 2; ++i)
+        {
+            host_bufs_[i] = std::make_unique<PinnedHostMem>(size);
+
+            hip_check_error(hipEventCreateWithFlags(&copy_done_[i], hipEventDisableTiming));
+        }
+
+        hip_check_error(hipStreamCreateWithFlags(&copy_stream_, hipStreamNonBlocking));
+        hip_check_error(hipEventCreateWithFlags(&kernel_done_, hipEventDisableTiming));
+
+        worker_ = std::thread([this] { Work(); });
+    }
+
+    AsyncResultCheck(const AsyncResultCheck&) = delete;
+    AsyncResultCheck& operator=(const AsyncResultCheck&) = delete;
+
+    ~AsyncResultCheck()
+    {
+        if(!do_verification_)
+        {
+            return;
+        }
+
+        // the pending checks are done before the worker stops
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            stop_ = true;
+        }
+
+        cv_.notify_all();
+
+        worker_.join();
+
+        // the pending copies are done before their buffers are freed
+        static_cast<void>(hipStreamSynchronize(copy_stream_));
+
+        static_cast<void>(hipEventDestroy(copy_done_[0]));
+        static_cast<void>(hipEventDestroy(copy_done_[1]));
+        static_cast<void>(hipEventDestroy(kernel_done_));
+        static_cast<void>(hipStreamDestroy(copy_stream_));
+    }
+
+    // output buffer of the next instance
+    DeviceMem& GetDeviceBuffer() { return *device_bufs_[current_]; }
+
+    // checks the output of the instance that was just run on stream
+    void Submit(const std::string& op_name, hipStream_t stream = nullptr)
+    {
+        if(!do_verification_)
+        {
+            throw std::runtime_error("wrong! AsyncResultCheck was made without verification");
+        }
+
+        const int i = current_;
+
+        // the read back starts once the instance is done
+        hip_check_error(hipEventRecord(kernel_done_, stream));
+        hip_check_error(hipStreamWaitEvent(copy_stream_, kernel_done_, 0));
+
+        device_bufs_[i]->FromDeviceAsync(
+            host_bufs_[i]->GetHostBuffer(), copy_stream_, copy_done_[i]);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            checks_.push({results_.size(), i, op_name});
+            results_.emplace_back();
+
+            is_pending_[i] = true;
+        }
+
+        cv_.notify_all();
+
+        // the other buffers are reused by the next instance, once their output is checked
+        current_ = 1 - i;
+
+        Wait(current_);
+    }
+
+    // waits for the pending checks and prints their messages in the order of the instances, true
+    // if all the results were correct
+    bool Finish()
+    {
+        if(do_verification_)
+        {
+            Wait(0);
+            Wait(1);
+        }
+
+        bool pass = true;
+
+        for(const auto& result : results_)
+        {
+            std::cerr << result.messages_;
+
+            pass = pass && result.pass_;
+        }
+
+        results_.clear();
+
+        return pass;
+    }
+
+    private:
+    struct Check
+    {
+        // position of the instance in the order of Submit()
+        std::size_t index_;
+        int buffer_;
+        std::string op_name_;
+    };
+
+    struct CheckResult
+    {
+        bool pass_ = true;
+        std::string messages_;
+    };
+
+    // waits for the check of the output in buffer i, if any
+    void Wait(int i)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        cv_.wait(lock, [&] { return !is_pending_[i]; });
+    }
+
+    // runs the checks in the order of Submit(), until the destructor stops it
+    void Work()
+    {
+        while(true)
+        {
+            Check check;
+
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                cv_.wait(lock, [&] { return stop_ || !checks_.empty(); });
+
+                if(checks_.empty())
+                {
+                    return;
+                }
+
+                check = std::move(checks_.front());
+
+                checks_.pop();
+            }
+
+            CheckResult result;
+
+            std::ostringstream messages;
+
+            try
+            {
+                hip_check_error(hipEventSynchronize(copy_done_[check.buffer_]));
+
+                const auto out = ck::span<const DataType>{
+                    static_cast<const DataType*>(host_bufs_[check.buffer_]->GetHostBuffer()),
+                    reference_.mData.size()};
+
+                ck::utils::ScopedCheckErrStream redirect(messages);
+
+                result.pass_ =
+                    ck::utils::check_err(out, reference_.mData, "Error: " + check.op_name_);
+            }
+            catch(const std::exception& e)
+            {
+                messages << "Error: " << check.op_name_ << ": " << e.what() << std::endl;
+
+                result.pass_ = false;
+            }
+
+            result.messages_ = messages.str();
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+
+                results_[check.index_] = std::move(result);
+
+                is_pending_[check.buffer_] = false;
+            }
+
+            cv_.notify_all();
+        }
+    }
+
+    const Tensor<DataType>& reference_;
+    const bool do_verification_;
+    std::unique_ptr<DeviceMem> device_bufs_[2];
+    std::unique_ptr<PinnedHostMem> host_bufs_[2];
+    hipStream_t copy_stream_ = nullptr;
+    hipEvent_t kernel_done_  = nullptr;
+    hipEvent_t copy_done_[2] = {nullptr, nullptr};
+    int current_             = 0;
+
+    // guards the members below, shared with the worker
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::queue<Check> checks_;
+    std::vector<CheckResult> results_;
+    bool is_pending_[2] = {false, false};
+    bool stop_          = false;
+    std::thread worker_;
+};
+
+} // namespace profiler
+} // namespace ck
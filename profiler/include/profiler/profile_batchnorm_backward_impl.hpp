@@ -10,6 +10,7 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/device_memory_pool.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_backward.hpp"
@@ -305,11 +306,7 @@ bool profile_batchnorm_backward_impl(bool do_verification,
             continue;
         };
 
-        size_t workspace_sz = inst_ptr->GetWorkSpaceSize(argument_ptr.get());
-
-        DeviceMem workspace_dev(workspace_sz);
-
-        inst_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace_dev.GetDeviceBuffer());
+        PooledWorkspace workspace(*inst_ptr, argument_ptr.get());
 
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
 
@@ -14,6 +14,7 @@
 
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/device_memory_pool.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
@@ -284,9 +285,7 @@ bool profile_gemm_add_relu_add_layernorm_impl(int do_verification,
         {
             ++num_kernel;
 
-            size_t workspace_sz = op_ptr->GetWorkSpaceSize(argument_ptr.get());
-            DeviceMem workspace_dev(workspace_sz);
-            op_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace_dev.GetDeviceBuffer());
+            PooledWorkspace workspace(*op_ptr, argument_ptr.get());
 
             // re-init E to zero before profiling a kernel
             h_device_buf.SetZero();
@@ -0,0 +1,331 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iomanip>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_multiple_d.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm_fp8.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/literals.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_multiple_d.hpp"
+
+namespace ck {
+namespace profiler {
+
+// FP8 GEMM with the A/B scales applied in the epilogue:
+//   ScaleTensor: E = scale_a * scale_b * (A * B)
+//   ScaleRowCol: E[m, n] = (A * B)[m, n] * ScaleA[m] * ScaleB[n]
+// f8 values are generated in float and converted with type_convert<f8_t>, and the host reference
+// runs the same CDE op, so the f8 rounding of E is the one of type_convert<f8_t>
+template <typename ADataType,
+          typename BDataType,
+          typename AccDataType,
+          typename EDataType,
+          typename ALayout,
+          typename BLayout,
+          typename ELayout,
+          typename CDEElementOp>
+bool profile_gemm_fp8_impl(int do_verification,
+                           int init_method,
+                           bool do_log,
+                           bool time_kernel,
+                           int M,
+                           int N,
+                           int K,
+                           int StrideA,
+                           int StrideB,
+                           int StrideE)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using ScaleRowCol = ck::tensor_operation::element_wise::ScaleRowCol;
+    using F32         = float;
+    using Row         = ck::tensor_layout::gemm::RowMajor;
+    using Col         = ck::tensor_layout::gemm::ColumnMajor;
+
+    // the epilogue of all the fp8 instances holds C in fp32
+    using CShuffleDataType = F32;
+
+    constexpr bool is_rowcol = is_same_v<CDEElementOp, ScaleRowCol>;
+
+    // per-row scale of A and per-column scale of B, broadcast with a stride of 0
+    using DsLayout   = conditional_t<is_rowcol, ck::Tuple<Col, Row>, ck::Tuple<>>;
+    using DsDataType = conditional_t<is_rowcol, ck::Tuple<F32, F32>, ck::Tuple<>>;
+
+    constexpr index_t NumDTensor = DsDataType::Size();
+
+    auto f_host_tensor_descriptor =
+        [](std::size_t row, std::size_t col, std::size_t stride, auto layout) {
+            using namespace ck::literals;
+
+            if(is_same<decltype(layout), tensor_layout::gemm::RowMajor>::value)
+            {
+                return HostTensorDescriptor({row, col}, {stride, 1_uz});
+            }
+            else
+            {
+                return HostTensorDescriptor({row, col}, {1_uz, stride});
+            }
+        };
+
+    Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
+    Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
+    Tensor<F32> scale_a_m_n(f_host_tensor_descriptor(M, N, 0, Col{}));
+    Tensor<F32> scale_b_m_n(f_host_tensor_descriptor(M, N, 0, Row{}));
+    Tensor<EDataType> e_m_n_device_result(f_host_tensor_descriptor(M, N, StrideE, ELayout{}));
+    Tensor<EDataType> e_m_n_host_result(f_host_tensor_descriptor(M, N, StrideE, ELayout{}));
+
+    std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
+    std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
+    if constexpr(is_rowcol)
+    {
+        std::cout << "scale_a_m_n: " << scale_a_m_n.mDesc << std::endl;
+        std::cout << "scale_b_m_n: " << scale_b_m_n.mDesc << std::endl;
+    }
+    std::cout << "e_m_n: " << e_m_n_device_result.mDesc << std::endl;
+
+    // f8_t is a storage type, generate in float and convert
+    auto f_generate_f8 = [](auto& tensor, auto generator) {
+        tensor.ForEach([&](auto& self, auto idx) {
+            self(idx) = ck::type_convert<ck::f8_t>(ck::type_convert<float>(generator(idx)));
+        });
+    };
+
+    float scale_a = 1.f;
+    float scale_b = 1.f;
+
+    switch(init_method)
+    {
+    case 0: break;
+    case 1:
+        f_generate_f8(a_m_k, GeneratorTensor_2<float>{-5, 5});
+        f_generate_f8(b_k_n, GeneratorTensor_2<float>{-5, 5});
+        scale_a_m_n.GenerateTensorValue(GeneratorTensor_2<F32>{1, 3});
+        scale_b_m_n.GenerateTensorValue(GeneratorTensor_2<F32>{1, 3});
+        scale_a = 2.f;
+        scale_b = 0.5f;
+        break;
+    default:
+        f_generate_f8(a_m_k, GeneratorTensor_3<float>{-1.0, 1.0});
+        f_generate_f8(b_k_n, GeneratorTensor_3<float>{-1.0, 1.0});
+        scale_a_m_n.GenerateTensorValue(GeneratorTensor_3<F32>{0.5, 1.5});
+        scale_b_m_n.GenerateTensorValue(GeneratorTensor_3<F32>{0.5, 1.5});
+        scale_a = 0.75f;
+        scale_b = 1.25f;
+    }
+
+    const auto a_element_op = PassThrough{};
+    const auto b_element_op = PassThrough{};
+
+    const auto cde_element_op = [&]() {
+        if constexpr(is_rowcol)
+        {
+            return CDEElementOp{};
+        }
+        else
+        {
+            return CDEElementOp{ck::tensor_operation::element_wise::stage::Scale{scale_a *
+                                                                                   scale_b}};
+        }
+    }();
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmMultipleD<ALayout,
+                                                                       BLayout,
+                                                                       DsLayout,
+                                                                       ELayout,
+                                                                       ADataType,
+                                                                       BDataType,
+                                                                       DsDataType,
+                                                                       EDataType,
+                                                                       PassThrough,
+                                                                       PassThrough,
+                                                                       CDEElementOp>;
+
+    // get device op instances
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
+
+    // run reference
+    if(do_verification)
+    {
+        using ReferenceGemmInstance =
+            ck::tensor_operation::host::ReferenceGemmMultipleD<ADataType,
+                                                               BDataType,
+                                                               DsDataType,
+                                                               EDataType,
+                                                               AccDataType,
+                                                               PassThrough,
+                                                               PassThrough,
+                                                               CDEElementOp,
+                                                               CShuffleDataType>;
+
+        auto ref_gemm    = ReferenceGemmInstance{};
+        auto ref_invoker = ref_gemm.MakeInvoker();
+
+        auto ref_argument = [&]() {
+            if constexpr(is_rowcol)
+            {
+                return ref_gemm.MakeArgument(a_m_k,
+                                             b_k_n,
+                                             {scale_a_m_n, scale_b_m_n},
+                                             e_m_n_host_result,
+                                             a_element_op,
+                                             b_element_op,
+                                             cde_element_op);
+            }
+            else
+            {
+                return ref_gemm.MakeArgument(a_m_k,
+                                             b_k_n,
+                                             {},
+                                             e_m_n_host_result,
+                                             a_element_op,
+                                             b_element_op,
+                                             cde_element_op);
+            }
+        }();
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem scale_a_device_buf(sizeof(F32) * scale_a_m_n.mDesc.GetElementSpaceSize());
+    DeviceMem scale_b_device_buf(sizeof(F32) * scale_b_m_n.mDesc.GetElementSpaceSize());
+    DeviceMem e_device_buf(sizeof(EDataType) * e_m_n_device_result.mDesc.GetElementSpaceSize());
+
+    a_device_buf.ToDevice(a_m_k.mData.data());
+    b_device_buf.ToDevice(b_k_n.mData.data());
+    scale_a_device_buf.ToDevice(scale_a_m_n.mData.data());
+    scale_b_device_buf.ToDevice(scale_b_m_n.mData.data());
+
+    std::array<const void*, NumDTensor> p_ds;
+    std::array<ck::index_t, NumDTensor> stride_ds;
+
+    if constexpr(is_rowcol)
+    {
+        p_ds      = {scale_a_device_buf.GetDeviceBuffer(), scale_b_device_buf.GetDeviceBuffer()};
+        stride_ds = {0, 0};
+    }
+
+    std::string best_op_name;
+    float best_ave_time   = 0;
+    float best_tflops     = 0;
+    float best_gb_per_sec = 0;
+
+    bool pass = true;
+
+    // profile device operation instances
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(a_device_buf.GetDeviceBuffer(),
+                                                        b_device_buf.GetDeviceBuffer(),
+                                                        p_ds,
+                                                        e_device_buf.GetDeviceBuffer(),
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        StrideA,
+                                                        StrideB,
+                                                        stride_ds,
+                                                        StrideE,
+                                                        a_element_op,
+                                                        b_element_op,
+                                                        cde_element_op);
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        std::string op_name = op_ptr->GetTypeString();
+
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            // re-init E to zero before profiling a kernel
+            e_device_buf.SetZero();
+
+            float ave_time =
+                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+            std::size_t flop = std::size_t(2) * M * N * K;
+
+            std::size_t num_btype =
+                sizeof(ADataType) * M * K + sizeof(BDataType) * K * N + sizeof(EDataType) * M * N;
+
+            float tflops = static_cast<float>(flop) / 1.E9 / ave_time;
+
+            float gb_per_sec = num_btype / 1.E6 / ave_time;
+
+            std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops << " TFlops, "
+                      << gb_per_sec << " GB/s, " << op_name << std::endl;
+
+            if(tflops > best_tflops)
+            {
+                best_op_name    = op_name;
+                best_tflops     = tflops;
+                best_ave_time   = ave_time;
+                best_gb_per_sec = gb_per_sec;
+            }
+
+            if(do_verification)
+            {
+                e_device_buf.FromDevice(e_m_n_device_result.mData.data());
+
+                if constexpr(is_same_v<EDataType, ck::f8_t>)
+                {
+                    // compare values rather than encodings, allowing for one f8 ulp due to the
+                    // different order of accumulation
+                    const Tensor<float> e_device_f32(e_m_n_device_result);
+                    const Tensor<float> e_host_f32(e_m_n_host_result);
+
+                    pass = pass && ck::utils::check_err(e_device_f32,
+                                                        e_host_f32,
+                                                        "Error: Incorrect results!",
+                                                        0.125,
+                                                        0.125);
+                }
+                else
+                {
+                    pass = pass && ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                }
+
+                if(do_log)
+                {
+                    // f8 and bf16 are storage types, print their values through float tensors
+                    LogRangeAsType<float>(std::cout << "a : ", Tensor<float>(a_m_k).mData, ",")
+                        << std::endl;
+                    LogRangeAsType<float>(std::cout << "b: ", Tensor<float>(b_k_n).mData, ",")
+                        << std::endl;
+                    LogRangeAsType<float>(
+                        std::cout << "e_host  : ", Tensor<float>(e_m_n_host_result).mData, ",")
+                        << std::endl;
+                    LogRangeAsType<float>(
+                        std::cout << "e_device: ", Tensor<float>(e_m_n_device_result).mData, ",")
+                        << std::endl;
+                }
+
+            }
+        }
+        else
+        {
+            std::cout << op_name << " does not support this problem" << std::endl;
+        }
+    }
+
+    std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
+              << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/async_result_check.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -89,7 +91,6 @@ int profile_gemm_impl(int do_verification,
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
     DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
 
     a_device_buf.ToDevice(a_m_k.mData.data());
     b_device_buf.ToDevice(b_k_n.mData.data());
@@ -135,9 +136,14 @@ int profile_gemm_impl(int do_verification,
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
 
+    // the result of an instance is read back while the next one runs
+    AsyncResultCheck<CDataType> result_check(c_m_n_host_result, do_verification);
+
     // profile device op instances
     for(auto& op_ptr : op_ptrs)
     {
+        auto& c_device_buf = result_check.GetDeviceBuffer();
+
         auto argument_ptr =
             op_ptr->MakeArgumentPointer(static_cast<ADataType*>(a_device_buf.GetDeviceBuffer()),
                                         static_cast<BDataType*>(b_device_buf.GetDeviceBuffer()),
@@ -186,12 +192,10 @@ int profile_gemm_impl(int do_verification,
 
             if(do_verification)
             {
-                c_device_buf.FromDevice(c_m_n_device_result.mData.data());
-
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
-
                 if(do_log)
                 {
+                    c_device_buf.FromDevice(c_m_n_device_result.mData.data());
+
                     LogRangeAsType<float>(std::cout << "a : ", a_m_k.mData, ",") << std::endl;
                     LogRangeAsType<float>(std::cout << "b: ", b_k_n.mData, ",") << std::endl;
                     LogRangeAsType<float>(std::cout << "c_host  : ", c_m_n_host_result.mData, ",")
@@ -199,6 +203,8 @@ int profile_gemm_impl(int do_verification,
                     LogRangeAsType<float>(std::cout << "c_device: ", c_m_n_device_result.mData, ",")
                         << std::endl;
                 }
+
+                result_check.Submit(op_name);
             }
         }
         else
@@ -207,6 +213,11 @@ int profile_gemm_impl(int do_verification,
         }
     }
 
+    if(do_verification)
+    {
+        pass = result_check.Finish() && pass;
+    }
+
     if constexpr(is_same<CDataType, float>::value)
     {
         std::cout << "Best Perf for datatype = f32";
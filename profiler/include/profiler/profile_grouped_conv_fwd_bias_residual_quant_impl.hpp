@@ -0,0 +1,344 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iomanip>
+#include <iostream>
+#include <typeinfo>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/quantization/grouped_convolution_bias_residual_forward_perchannel_quantization.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_multiple_d.hpp"
+
+namespace ck {
+namespace profiler {
+
+// int8 grouped conv forward with the bias, the per-channel requantization scale and the residual
+// as Ds, E = Relu(requant_scale[k] * (conv + bias[k]) + residual_scale * residual) in OutDataType,
+// int8_t or f8_t, the residual having the type and the layout of E
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename OutDataType>
+bool profile_grouped_conv_fwd_bias_residual_quant_impl(int do_verification,
+                                                       int init_method,
+                                                       bool do_log,
+                                                       bool time_kernel,
+                                                       const ck::utils::conv::ConvParam& conv_param)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using Relu        = ck::tensor_operation::element_wise::Relu;
+
+    using InDataType           = int8_t;
+    using WeiDataType          = int8_t;
+    using AccDataType          = int32_t;
+    using BiasDataType         = int32_t;
+    using RequantScaleDataType = float;
+    using ResidualDataType     = OutDataType;
+
+    using GK = ck::tensor_layout::convolution::G_K;
+
+    using DsLayout   = ck::Tuple<GK, GK, OutLayout>;
+    using DsDataType = ck::Tuple<BiasDataType, RequantScaleDataType, ResidualDataType>;
+
+    using InElementOp  = PassThrough;
+    using WeiElementOp = PassThrough;
+    using OutElementOp = ck::tensor_operation::element_wise::Add_Mul2_Add_Activation_Clamp<Relu>;
+
+    const auto in_element_op  = InElementOp{};
+    const auto wei_element_op = WeiElementOp{};
+    const auto out_element_op = OutElementOp{0.5f, Relu{}};
+
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    // bias and requantization scale [G, K], broadcast over N and the output pixels
+    std::vector<std::size_t> g_k_lengths{static_cast<std::size_t>(conv_param.G_),
+                                         static_cast<std::size_t>(conv_param.N_),
+                                         static_cast<std::size_t>(conv_param.K_)};
+    std::vector<std::size_t> g_k_strides{static_cast<std::size_t>(conv_param.K_), 0, 1};
+
+    for(ck::index_t i = 0; i < NDimSpatial; ++i)
+    {
+        g_k_lengths.push_back(conv_param.output_spatial_lengths_[i]);
+        g_k_strides.push_back(0);
+    }
+
+    const auto g_k_desc = HostTensorDescriptor(g_k_lengths, g_k_strides);
+
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> d_g_k_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> d_g_k_strides{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, NDimSpatial + 3> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_strides{};
+    std::array<ck::index_t, NDimSpatial> conv_filter_dilations{};
+    std::array<ck::index_t, NDimSpatial> input_left_pads{};
+    std::array<ck::index_t, NDimSpatial> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(g_k_desc.GetLengths(), d_g_k_lengths);
+    copy(g_k_desc.GetStrides(), d_g_k_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    Tensor<InDataType> input(in_g_n_c_wis_desc);
+    Tensor<WeiDataType> weight(wei_g_k_c_xs_desc);
+    Tensor<BiasDataType> bias(g_k_desc);
+    Tensor<RequantScaleDataType> requant_scale(g_k_desc);
+    Tensor<ResidualDataType> residual(out_g_n_k_wos_desc);
+    Tensor<OutDataType> host_output(out_g_n_k_wos_desc);
+    Tensor<OutDataType> device_output(out_g_n_k_wos_desc);
+
+    std::cout << "input: " << input.mDesc << std::endl;
+    std::cout << "weight: " << weight.mDesc << std::endl;
+    std::cout << "bias: " << bias.mDesc << std::endl;
+    std::cout << "requant_scale: " << requant_scale.mDesc << std::endl;
+    std::cout << "residual: " << residual.mDesc << std::endl;
+    std::cout << "output: " << host_output.mDesc << std::endl;
+
+    // f8_t is a storage type, generate in float and convert
+    auto f_generate_residual = [&](auto generator) {
+        residual.ForEach([&](auto& self, auto idx) {
+            self(idx) =
+                ck::type_convert<ResidualDataType>(ck::type_convert<float>(generator(idx)));
+        });
+    };
+
+    switch(init_method)
+    {
+    case 0: break;
+    case 1:
+        input.GenerateTensorValue(GeneratorTensor_2<InDataType>{-5, 5});
+        weight.GenerateTensorValue(GeneratorTensor_2<WeiDataType>{-5, 5});
+        bias.GenerateTensorValue(GeneratorTensor_2<BiasDataType>{-5, 5});
+        requant_scale.GenerateTensorValue(GeneratorTensor_2<RequantScaleDataType>{1, 2});
+        f_generate_residual(GeneratorTensor_2<float>{-5, 5});
+        break;
+    default:
+        input.GenerateTensorValue(GeneratorTensor_2<InDataType>{-128, 127});
+        weight.GenerateTensorValue(GeneratorTensor_2<WeiDataType>{-128, 127});
+        bias.GenerateTensorValue(GeneratorTensor_2<BiasDataType>{-1024, 1024});
+        requant_scale.GenerateTensorValue(GeneratorTensor_3<RequantScaleDataType>{0.f, 0.001f});
+        f_generate_residual(GeneratorTensor_2<float>{-128, 127});
+    }
+
+    DeviceMem in_device_buf(sizeof(InDataType) * input.mDesc.GetElementSpaceSize());
+    DeviceMem wei_device_buf(sizeof(WeiDataType) * weight.mDesc.GetElementSpaceSize());
+    DeviceMem bias_device_buf(sizeof(BiasDataType) * bias.mDesc.GetElementSpaceSize());
+    DeviceMem requant_scale_device_buf(sizeof(RequantScaleDataType) *
+                                       requant_scale.mDesc.GetElementSpaceSize());
+    DeviceMem residual_device_buf(sizeof(ResidualDataType) *
+                                  residual.mDesc.GetElementSpaceSize());
+    DeviceMem out_device_buf(sizeof(OutDataType) * device_output.mDesc.GetElementSpaceSize());
+
+    in_device_buf.ToDevice(input.mData.data());
+    wei_device_buf.ToDevice(weight.mData.data());
+    bias_device_buf.ToDevice(bias.mData.data());
+    requant_scale_device_buf.ToDevice(requant_scale.mData.data());
+    residual_device_buf.ToDevice(residual.mData.data());
+
+    // run reference op
+    if(do_verification)
+    {
+        auto ref_conv =
+            ck::tensor_operation::host::ReferenceConvFwdMultipleD<NDimSpatial,
+                                                                  InDataType,
+                                                                  WeiDataType,
+                                                                  DsDataType,
+                                                                  OutDataType,
+                                                                  AccDataType,
+                                                                  InElementOp,
+                                                                  WeiElementOp,
+                                                                  OutElementOp>{};
+
+        auto ref_invoker  = ref_conv.MakeInvoker();
+        auto ref_argument = ref_conv.MakeArgument(input,
+                                                  weight,
+                                                  {bias, requant_scale, residual},
+                                                  host_output,
+                                                  conv_param.conv_filter_strides_,
+                                                  conv_param.conv_filter_dilations_,
+                                                  conv_param.input_left_pads_,
+                                                  conv_param.input_right_pads_,
+                                                  in_element_op,
+                                                  wei_element_op,
+                                                  out_element_op);
+
+        ref_invoker.Run(ref_argument);
+    }
+
+    std::string best_op_name;
+    float best_avg_time   = 0;
+    float best_tflops     = 0;
+    float best_gb_per_sec = 0;
+
+    // profile device op instances
+    bool pass = true;
+
+    auto run_impl = [&](auto& op_ptr, auto& argument_ptr) {
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            // re-init output to zero before profiling next kernel
+            out_device_buf.SetZero();
+
+            std::string op_name = op_ptr->GetTypeString();
+
+            auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+            float avg_time =
+                invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+
+            std::size_t flop = conv_param.GetFlops();
+
+            // the residual is read once more than the output is written
+            std::size_t num_btype = conv_param.GetByte<InDataType, WeiDataType, OutDataType>() +
+                                    sizeof(ResidualDataType) * host_output.mDesc.GetElementSize();
+
+            float tflops = static_cast<float>(flop) / 1.E9 / avg_time;
+
+            float gb_per_sec = num_btype / 1.E6 / avg_time;
+
+            std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << tflops << " TFlops, "
+                      << gb_per_sec << " GB/s, " << op_name << std::endl;
+
+            if(tflops > best_tflops)
+            {
+                best_op_name    = op_name;
+                best_tflops     = tflops;
+                best_avg_time   = avg_time;
+                best_gb_per_sec = gb_per_sec;
+            }
+
+            if(do_verification)
+            {
+                out_device_buf.FromDevice(device_output.mData.data());
+
+                // compare values rather than encodings, allowing for one quantization step due to
+                // the contraction of the epilogue into FMAs on the device
+                const Tensor<float> device_output_f32(device_output);
+                const Tensor<float> host_output_f32(host_output);
+
+                if constexpr(is_same_v<OutDataType, ck::f8_t>)
+                {
+                    pass = pass && ck::utils::check_err(device_output_f32,
+                                                        host_output_f32,
+                                                        "Error: Incorrect results!",
+                                                        0.125,
+                                                        0.125);
+                }
+                else
+                {
+                    pass = pass && ck::utils::check_err(device_output_f32,
+                                                        host_output_f32,
+                                                        "Error: Incorrect results!",
+                                                        0,
+                                                        1);
+                }
+
+                if(do_log)
+                {
+                    LogRangeAsType<float>(std::cout << "input : ", input.mData, ",") << std::endl;
+                    LogRangeAsType<float>(std::cout << "weight: ", weight.mData, ",") << std::endl;
+                    LogRangeAsType<float>(
+                        std::cout << "host_output  : ", host_output_f32.mData, ",")
+                        << std::endl;
+                    LogRangeAsType<float>(
+                        std::cout << "device_output: ", device_output_f32.mData, ",")
+                        << std::endl;
+                }
+            }
+        }
+        else
+        {
+            std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+        }
+    };
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD<NDimSpatial,
+                                                                                 InLayout,
+                                                                                 WeiLayout,
+                                                                                 DsLayout,
+                                                                                 OutLayout,
+                                                                                 InDataType,
+                                                                                 WeiDataType,
+                                                                                 DsDataType,
+                                                                                 OutDataType,
+                                                                                 InElementOp,
+                                                                                 WeiElementOp,
+                                                                                 OutElementOp>;
+
+    // get device op instances
+    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
+        DeviceOp>::GetInstances();
+
+    std::cout << "xdl found " << op_ptrs.size() << " instances" << std::endl;
+
+    for(auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(
+            in_device_buf.GetDeviceBuffer(),
+            wei_device_buf.GetDeviceBuffer(),
+            {bias_device_buf.GetDeviceBuffer(),
+             requant_scale_device_buf.GetDeviceBuffer(),
+             residual_device_buf.GetDeviceBuffer()},
+            out_device_buf.GetDeviceBuffer(),
+            a_g_n_c_wis_lengths,
+            a_g_n_c_wis_strides,
+            b_g_k_c_xs_lengths,
+            b_g_k_c_xs_strides,
+            {d_g_k_lengths, d_g_k_lengths, e_g_n_k_wos_lengths},
+            {d_g_k_strides, d_g_k_strides, e_g_n_k_wos_strides},
+            e_g_n_k_wos_lengths,
+            e_g_n_k_wos_strides,
+            conv_filter_strides,
+            conv_filter_dilations,
+            input_left_pads,
+            input_right_pads,
+            in_element_op,
+            wei_element_op,
+            out_element_op);
+
+        run_impl(op_ptr, argument_ptr);
+    }
+
+    std::cout << "Best configuration parameters:"
+              << "\nname: " << best_op_name << "\navg_time: " << best_avg_time
+              << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << std::endl;
+
+    return pass;
+}
+
+} // namespace profiler
+} // namespace ck
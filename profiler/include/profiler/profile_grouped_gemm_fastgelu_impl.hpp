@@ -9,6 +9,7 @@
 #include "ck/library/tensor_operation_instance/gpu/grouped_gemm_fastgelu.hpp"
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/device_memory_pool.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/utility/literals.hpp"
@@ -176,8 +177,7 @@ bool profile_grouped_gemm_fastgelu_impl(int do_verification,
             p_a, p_b, p_ds, p_c, gemm_descs, a_element_op, b_element_op, c_element_op);
 
         auto invoker_ptr = gemm_ptr->MakeInvokerPointer();
-        DeviceMem gemm_desc_workspace(gemm_ptr->GetWorkSpaceSize(argument_ptr.get()));
-        gemm_ptr->SetWorkSpacePointer(argument_ptr.get(), gemm_desc_workspace.GetDeviceBuffer());
+        PooledWorkspace gemm_desc_workspace(*gemm_ptr, argument_ptr.get());
 
         if(gemm_ptr->IsSupportedArgument(argument_ptr.get()))
         {
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+
+#include "profiler/profile_gemm_fp8_impl.hpp"
+#include "profiler_operation_registry.hpp"
+
+#define OP_NAME "gemm_fp8"
+#define OP_DESC "Scaled FP8 GEMM"
+
+int profile_gemm_fp8(int argc, char* argv[])
+{
+    enum struct MatrixLayout
+    {
+        MK_NK_MN, // 0
+    };
+
+    enum struct MatrixDataType
+    {
+        F8_F8_F16,  // 0
+        F8_F8_BF16, // 1
+        F8_F8_F8,   // 2
+    };
+
+    enum struct ScaleMode
+    {
+        Tensor, // 0
+        RowCol, // 1
+    };
+
+    if(argc != 15)
+    {
+        // clang-format off
+        printf("arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n");
+        printf("arg2: data type (0: f8->fp16; 1: f8->bf16; 2: f8->f8)\n");
+        printf("arg3: matrix layout (0: E[m, n] = A[m, k] * B[n, k])\n");
+        printf("arg4: scale (0: per tensor, E = scale_a * scale_b * (A * B);\n");
+        printf("             1: per row/column, E[m, n] = (A * B)[m, n] * ScaleA[m] * ScaleB[n])\n");
+        printf("arg5: verification (0: no; 1: yes)\n");
+        printf("arg6: initialization (0: no init; 1: integer value; 2: decimal value)\n");
+        printf("arg7: print tensor value (0: no; 1: yes)\n");
+        printf("arg8: time kernel (0=no, 1=yes)\n");
+        printf("arg9 to 14: M, N, K, StrideA, StrideB, StrideE\n");
+        // clang-format on
+        exit(1);
+    }
+
+    const auto data_type       = static_cast<MatrixDataType>(std::stoi(argv[2]));
+    const auto layout          = static_cast<MatrixLayout>(std::stoi(argv[3]));
+    const auto scale_mode      = static_cast<ScaleMode>(std::stoi(argv[4]));
+    const bool do_verification = std::stoi(argv[5]);
+    const int init_method      = std::stoi(argv[6]);
+    const bool do_log          = std::stoi(argv[7]);
+    const bool time_kernel     = std::stoi(argv[8]);
+
+    const int M = std::stoi(argv[9]);
+    const int N = std::stoi(argv[10]);
+    const int K = std::stoi(argv[11]);
+
+    const int StrideA = std::stoi(argv[12]);
+    const int StrideB = std::stoi(argv[13]);
+    const int StrideE = std::stoi(argv[14]);
+
+    using F8   = ck::f8_t;
+    using F16  = ck::half_t;
+    using BF16 = ck::bhalf_t;
+    using F32  = float;
+
+    using Row = ck::tensor_layout::gemm::RowMajor;
+    using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+    using ScaleTensor = ck::tensor_operation::element_wise::ScaleTensor;
+    using ScaleRowCol = ck::tensor_operation::element_wise::ScaleRowCol;
+
+    auto profile = [&](auto e_type, auto cde_op) {
+        using ADataType   = F8;
+        using BDataType   = F8;
+        using AccDataType = F32;
+        using EDataType   = decltype(e_type);
+
+        using ALayout = Row;
+        using BLayout = Col;
+        using ELayout = Row;
+
+        using CDEElementOp = decltype(cde_op);
+
+        const int DefaultStrideA = K;
+        const int DefaultStrideB = K;
+        const int DefaultStrideE = N;
+
+        bool pass = ck::profiler::profile_gemm_fp8_impl<ADataType,
+                                                        BDataType,
+                                                        AccDataType,
+                                                        EDataType,
+                                                        ALayout,
+                                                        BLayout,
+                                                        ELayout,
+                                                        CDEElementOp>(
+            do_verification,
+            init_method,
+            do_log,
+            time_kernel,
+            M,
+            N,
+            K,
+            (StrideA < 0) ? DefaultStrideA : StrideA,
+            (StrideB < 0) ? DefaultStrideB : StrideB,
+            (StrideE < 0) ? DefaultStrideE : StrideE);
+
+        return pass ? 0 : 1;
+    };
+
+    auto profile_scale = [&](auto e_type) {
+        if(scale_mode == ScaleMode::Tensor)
+        {
+            return profile(e_type, ScaleTensor{});
+        }
+        else
+        {
+            return profile(e_type, ScaleRowCol{});
+        }
+    };
+
+    if(layout != MatrixLayout::MK_NK_MN ||
+       (scale_mode != ScaleMode::Tensor && scale_mode != ScaleMode::RowCol))
+    {
+        std::cout << "this data_type & layout is not implemented" << std::endl;
+
+        return 1;
+    }
+
+    if(data_type == MatrixDataType::F8_F8_F16)
+    {
+        return profile_scale(F16{});
+    }
+    else if(data_type == MatrixDataType::F8_F8_BF16)
+    {
+        return profile_scale(BF16{});
+    }
+    else if(data_type == MatrixDataType::F8_F8_F8)
+    {
+        return profile_scale(F8{});
+    }
+    else
+    {
+        std::cout << "this data_type & layout is not implemented" << std::endl;
+
+        return 1;
+    }
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_gemm_fp8);
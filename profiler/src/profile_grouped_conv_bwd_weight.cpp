@@ -41,7 +41,10 @@ static void print_helper_msg()
               << "arg5: initialization (0: no init, 1: integer value, 2: decimal value)\n"
               << "arg6: print tensor value (0: no; 1: yes)\n"
               << "arg7: time kernel (0: no, 1: yes)\n"
-              << ck::utils::conv::get_conv_param_parser_helper_msg() << " SplitK\n"
+              << ck::utils::conv::get_conv_param_parser_helper_msg()
+              << " SplitK (<= 0: picked by each instance)\n"
+              << " Deterministic, optional (0: splits of GEMM K accumulated with atomics, default; "
+                 "1: summed in a fixed order through a workspace)\n"
               << std::endl;
 }
 
@@ -64,8 +67,11 @@ int profile_grouped_conv_bwd_weight(int argc, char* argv[])
     const bool time_kernel     = std::stoi(argv[7]);
     const int num_dim_spatial  = std::stoi(argv[8]);
 
-    // 8 for control, 1 for num_dim_spatial, 4 for G/N/K/C, and 6 * num_dim_spatial, 1 for split-K
-    if(argc != 8 + 1 + 4 + 6 * num_dim_spatial + 1)
+    // 8 for control, 1 for num_dim_spatial, 4 for G/N/K/C, and 6 * num_dim_spatial, 1 for split-K,
+    // 1 for the optional deterministic flag
+    const int num_arg = 8 + 1 + 4 + 6 * num_dim_spatial + 1;
+
+    if(!(argc == num_arg || argc == num_arg + 1))
     {
         print_helper_msg();
         return 1;
@@ -73,8 +79,8 @@ int profile_grouped_conv_bwd_weight(int argc, char* argv[])
 
     const auto params = ck::utils::conv::parse_conv_param(num_dim_spatial, 9, argv);
 
-    ck::index_t split_k = std::stoi(argv[8 + 1 + 4 + 6 * num_dim_spatial]);
-    split_k             = std::max(1, split_k);
+    const ck::index_t split_k = std::stoi(argv[num_arg - 1]);
+    const bool deterministic  = argc == num_arg + 1 && std::stoi(argv[num_arg]) != 0;
 
     using F32  = float;
     using F16  = ck::half_t;
@@ -120,7 +126,7 @@ int profile_grouped_conv_bwd_weight(int argc, char* argv[])
                                                                        InDataType,
                                                                        WeiDataType,
                                                                        OutDataType>(
-            do_verification, init_method, do_log, time_kernel, params, split_k);
+            do_verification, init_method, do_log, time_kernel, params, split_k, deterministic);
 
         return pass ? 0 : 1;
     };
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <numeric>
+#include <initializer_list>
+#include <cstdlib>
+
+#include "profiler/profile_grouped_conv_fwd_bias_residual_quant_impl.hpp"
+#include "profiler_operation_registry.hpp"
+
+namespace {
+
+enum struct ConvLayout
+{
+    NHWGC_GKYXC_NHWGK, // 0
+};
+
+enum struct ConvDataType
+{
+    INT8_INT8_INT8, // 0
+    INT8_INT8_F8,   // 1
+};
+
+#define OP_NAME "grouped_conv_fwd_bias_residual_quant"
+#define OP_DESC "Grouped Convolution Forward + Bias + Residual + Relu + Per-channel Requantization"
+
+static void print_helper_msg()
+{
+    std::cout
+        // clang-format off
+        << "arg1: tensor operation (" OP_NAME ": " OP_DESC ")\n"
+        << "arg2: data type (0: Input int8, Weight int8, Residual int8, Output int8\n"
+        << "                 1: Input int8, Weight int8, Residual fp8, Output fp8)\n"
+        << "arg3: tensor layout (0: Input[N, Hi, Wi, G, C], Weight[G, K, Y, X, C], Output[N, Ho, Wo, G, K])\n"
+        << "arg4: verification (0: no, 1: yes)\n"
+        << "arg5: initialization (0: no init, 1: integer value, 2: decimal value)\n"
+        << "arg6: print tensor value (0: no; 1: yes)\n"
+        << "arg7: time kernel (0: no, 1: yes)\n"
+        << ck::utils::conv::get_conv_param_parser_helper_msg() << std::endl;
+    // clang-format on
+}
+
+} // namespace
+
+int profile_grouped_conv_fwd_bias_residual_quant(int argc, char* argv[])
+{
+    // 8 for control, 1 for num_dim_spatial
+    if(argc < 9)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const auto data_type       = static_cast<ConvDataType>(std::stoi(argv[2]));
+    const auto layout          = static_cast<ConvLayout>(std::stoi(argv[3]));
+    const bool do_verification = std::stoi(argv[4]);
+    const int init_method      = std::stoi(argv[5]);
+    const bool do_log          = std::stoi(argv[6]);
+    const bool time_kernel     = std::stoi(argv[7]);
+    const int num_dim_spatial  = std::stoi(argv[8]);
+
+    // 8 for control, 1 for num_dim_spatial, 4 for G/N/K/C, and 6 * num_dim_spatial
+    if(argc != 8 + 1 + 4 + 6 * num_dim_spatial)
+    {
+        print_helper_msg();
+        return 1;
+    }
+
+    const auto params = ck::utils::conv::parse_conv_param(num_dim_spatial, 9, argv);
+
+    using INT8 = int8_t;
+    using F8   = ck::f8_t;
+
+    using NWGC   = ck::tensor_layout::convolution::NWGC;
+    using NHWGC  = ck::tensor_layout::convolution::NHWGC;
+    using NDHWGC = ck::tensor_layout::convolution::NDHWGC;
+
+    using GKXC   = ck::tensor_layout::convolution::GKXC;
+    using GKYXC  = ck::tensor_layout::convolution::GKYXC;
+    using GKZYXC = ck::tensor_layout::convolution::GKZYXC;
+
+    using NWGK   = ck::tensor_layout::convolution::NWGK;
+    using NHWGK  = ck::tensor_layout::convolution::NHWGK;
+    using NDHWGK = ck::tensor_layout::convolution::NDHWGK;
+
+    constexpr auto I1 = ck::Number<1>{};
+    constexpr auto I2 = ck::Number<2>{};
+    constexpr auto I3 = ck::Number<3>{};
+
+    auto profile = [&](auto num_dim_spatial_tmp,
+                       auto in_layout,
+                       auto wei_layout,
+                       auto out_layout,
+                       auto out_type) {
+        constexpr ck::index_t NDimSpatial = num_dim_spatial_tmp.value;
+
+        using InLayout  = decltype(in_layout);
+        using WeiLayout = decltype(wei_layout);
+        using OutLayout = decltype(out_layout);
+
+        using OutDataType = decltype(out_type);
+
+        bool pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            NDimSpatial,
+            InLayout,
+            WeiLayout,
+            OutLayout,
+            OutDataType>(do_verification, init_method, do_log, time_kernel, params);
+
+        return pass ? 0 : 1;
+    };
+
+    if(layout == ConvLayout::NHWGC_GKYXC_NHWGK)
+    {
+        if(num_dim_spatial == 1)
+        {
+            if(data_type == ConvDataType::INT8_INT8_INT8)
+            {
+                return profile(I1, NWGC{}, GKXC{}, NWGK{}, INT8{});
+            }
+            else if(data_type == ConvDataType::INT8_INT8_F8)
+            {
+                return profile(I1, NWGC{}, GKXC{}, NWGK{}, F8{});
+            }
+        }
+        else if(num_dim_spatial == 2)
+        {
+            if(data_type == ConvDataType::INT8_INT8_INT8)
+            {
+                return profile(I2, NHWGC{}, GKYXC{}, NHWGK{}, INT8{});
+            }
+            else if(data_type == ConvDataType::INT8_INT8_F8)
+            {
+                return profile(I2, NHWGC{}, GKYXC{}, NHWGK{}, F8{});
+            }
+        }
+        else if(num_dim_spatial == 3)
+        {
+            if(data_type == ConvDataType::INT8_INT8_INT8)
+            {
+                return profile(I3, NDHWGC{}, GKZYXC{}, NDHWGK{}, INT8{});
+            }
+            else if(data_type == ConvDataType::INT8_INT8_F8)
+            {
+                return profile(I3, NDHWGC{}, GKZYXC{}, NDHWGK{}, F8{});
+            }
+        }
+    }
+
+    std::cout << "this data_type & layout is not implemented" << std::endl;
+
+    return 1;
+}
+
+REGISTER_PROFILER_OPERATION(OP_NAME, OP_DESC, profile_grouped_conv_fwd_bias_residual_quant);
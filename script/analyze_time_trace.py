@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+# Aggregates the clang -ftime-trace reports of a build (cmake -DCK_TIME_TRACE=ON): front-end and
+# back-end time per translation unit, and the templates taking the most instantiation time.
+import os, re, json, argparse
+from collections import defaultdict
+
+# summary events emitted once per report
+TOTALS = ['Total Frontend', 'Total Backend', 'Total InstantiateClass', 'Total InstantiateFunction',
+          'Total Source', 'Total CodeGen Function']
+
+def parse_args():
+    parser = argparse.ArgumentParser(description='Aggregate clang -ftime-trace reports')
+    parser.add_argument('build_dir', type=str, help='Build directory to search for the reports')
+    parser.add_argument('--filter', type=str, default='',
+                        help='Only the reports whose path matches this regular expression')
+    parser.add_argument('--top', type=int, default=20,
+                        help='Number of translation units and templates to list')
+    parser.add_argument('--output', type=str, default='',
+                        help='Also write the per translation unit totals to this csv file')
+    return parser.parse_args()
+
+def find_reports(build_dir, pattern):
+    reports = []
+    for root, _, files in os.walk(build_dir):
+        # clang writes the report next to the object file
+        if 'CMakeFiles' not in root:
+            continue
+        for name in files:
+            if not name.endswith('.json'):
+                continue
+            path = os.path.join(root, name)
+            if pattern and not re.search(pattern, path):
+                continue
+            reports.append(path)
+    return sorted(reports)
+
+def template_name(detail):
+    # drop the template arguments, the instantiations of a template are counted together
+    return re.split(r'[<(]', detail, 1)[0].strip()
+
+def read_report(path, instantiations):
+    with open(path) as f:
+        try:
+            events = json.load(f).get('traceEvents', [])
+        except (ValueError, AttributeError):
+            return None
+    totals = defaultdict(float)
+    for event in events:
+        name = event.get('name', '')
+        dur_ms = event.get('dur', 0) / 1000.
+        if name in TOTALS:
+            totals[name] += dur_ms
+        elif name in ('InstantiateClass', 'InstantiateFunction'):
+            detail = event.get('args', {}).get('detail', '')
+            instantiations[template_name(detail)][0] += 1
+            instantiations[template_name(detail)][1] += dur_ms
+    return totals if totals else None
+
+def main():
+    args = parse_args()
+    instantiations = defaultdict(lambda: [0, 0.])
+    units = []
+    for path in find_reports(args.build_dir, args.filter):
+        totals = read_report(path, instantiations)
+        if totals is not None:
+            units.append((os.path.relpath(path, args.build_dir), totals))
+
+    if not units:
+        print('no -ftime-trace reports found in', args.build_dir)
+        return
+
+    units.sort(key=lambda unit: unit[1]['Total Frontend'], reverse=True)
+    frontend = sum(totals['Total Frontend'] for _, totals in units)
+    backend = sum(totals['Total Backend'] for _, totals in units)
+
+    print('translation units: {}'.format(len(units)))
+    print('front-end: {:.1f} s total, {:.2f} s per unit'.format(frontend / 1000.,
+                                                                 frontend / 1000. / len(units)))
+    print('back-end:  {:.1f} s total, {:.2f} s per unit'.format(backend / 1000.,
+                                                                 backend / 1000. / len(units)))
+
+    print('\nslowest front-ends (ms): frontend, backend, instantiate class, instantiate function')
+    for path, totals in units[:args.top]:
+        print('{:10.0f} {:10.0f} {:10.0f} {:10.0f}  {}'.format(
+            totals['Total Frontend'], totals['Total Backend'], totals['Total InstantiateClass'],
+            totals['Total InstantiateFunction'], path))
+
+    # nested instantiations are included in the time of the enclosing one
+    print('\ntemplates by instantiation time (ms, including nested instantiations): time, count')
+    ranked = sorted(instantiations.items(), key=lambda item: item[1][1], reverse=True)
+    for name, (count, dur_ms) in ranked[:args.top]:
+        print('{:10.0f} {:8d}  {}'.format(dur_ms, count, name))
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            f.write('unit,' + ','.join(TOTALS) + '\n')
+            for path, totals in units:
+                f.write(path + ',' + ','.join('{:.1f}'.format(totals[t]) for t in TOTALS) + '\n')
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+# Generates the registry of a manifest build (cmake -DCK_INSTANCE_MANIFEST=...): the instance
+# sources left out of the build are replaced by definitions adding no instance, so that
+# DeviceOperationInstanceFactory only returns the instances that were built.
+import os, re, sys, argparse
+from collections import defaultdict
+
+DEFINITION = re.compile(r'^\s*void\s+(add_\w+)\s*\(([^;{]*)\)\s*\{', re.MULTILINE)
+DECLARATION = re.compile(r'^\s*void\s+(add_\w+)\s*\(([^;{]*)\)\s*;', re.MULTILINE)
+INCLUDE = re.compile(r'^\s*#\s*include\s*"([^"]+)"', re.MULTILINE)
+ALIAS = re.compile(r'(template\s*<[^;{]*>\s*)?\busing\s+(\w+)\s*=\s*([^;]+);')
+CONSTANT = re.compile(r'\bconstexpr\s+[\w:]+\s+(\w+)\s*=\s*([^;]+);')
+NAMESPACE = re.compile(
+    r'\b(?:ck|std|tensor_operation|device|instance|element_wise|tensor_layout|gemm|convolution)::')
+TUPLE_SIZE = re.compile(r'\bTuple<([^<>]*(?:<[^<>]*>[^<>]*)*)>::Size\(\)')
+
+def parse_args():
+    parser = argparse.ArgumentParser(
+        description='Generate the instance registry of a manifest build')
+    parser.add_argument('--sources', type=str, required=True,
+                        help='File listing the instance sources left out of the build')
+    parser.add_argument('--include-dirs', type=str, nargs='+', required=True,
+                        help='Include directories of the headers declaring the instances')
+    parser.add_argument('--output-dir', type=str, required=True,
+                        help='Directory of the generated sources')
+    return parser.parse_args()
+
+def read(path):
+    with open(path) as f:
+        return f.read()
+
+def strip_comments(text):
+    return re.sub(r'//[^\n]*|/\*.*?\*/', '', text, flags=re.DOTALL)
+
+class Aliases:
+    # non-template aliases and constants visible in a file, the ones of the file itself and of the
+    # files it includes from the given include directories, so that the parameters of a
+    # definition and of its declaration can be compared whatever the names they use
+    def __init__(self, include_dirs):
+        self.include_dirs = include_dirs
+        self.cache = {}
+
+    def resolve_include(self, path, include):
+        for base in [os.path.dirname(path)] + self.include_dirs:
+            candidate = os.path.join(base, include)
+            if os.path.isfile(candidate):
+                return os.path.normpath(candidate)
+        return None
+
+    def of(self, path, visiting=None):
+        if path in self.cache:
+            return self.cache[path]
+        visiting = visiting or set()
+        if path in visiting:
+            return {}
+        visiting.add(path)
+        text = strip_comments(read(path))
+        aliases = {}
+        for include in INCLUDE.findall(text):
+            included = self.resolve_include(path, include)
+            if included is not None:
+                aliases.update(self.of(included, visiting))
+        for m in ALIAS.finditer(text):
+            if not m.group(1):
+                aliases[m.group(2)] = m.group(3)
+        for m in CONSTANT.finditer(text):
+            aliases[m.group(1)] = m.group(2)
+        self.cache[path] = aliases
+        return aliases
+
+def split_top_level(text):
+    parts, depth, begin = [], 0, 0
+    for i, c in enumerate(text):
+        if c in '<([':
+            depth += 1
+        elif c in '>)]':
+            depth -= 1
+        elif c == ',' and depth == 0:
+            parts.append(text[begin:i])
+            begin = i + 1
+    parts.append(text[begin:])
+    return parts
+
+def normalize_parameters(parameters, aliases):
+    # parameter types with the aliases and constants substituted, the namespaces, the whitespace
+    # and the parameter names removed
+    text = NAMESPACE.sub('', strip_comments(parameters))
+    for _ in range(16):
+        substituted = re.sub(r'(?<!::)\b[A-Za-z_]\w*\b',
+                             lambda m: NAMESPACE.sub('', aliases.get(m.group(0), m.group(0))),
+                             text)
+        substituted = TUPLE_SIZE.sub(
+            lambda m: str(len(split_top_level(m.group(1)))) if m.group(1).strip() else '0',
+            substituted)
+        if substituted == text:
+            break
+        text = substituted
+    types = []
+    for parameter in split_top_level(text):
+        parameter = re.sub(r'\s+', '', parameter)
+        types.append(re.sub(r'(?<=[&*>])\w+$', '', parameter))
+    return ','.join(types)
+
+def find_declarations(include_dirs, aliases):
+    # name -> {normalized parameters -> (path, header, parameters)} of the functions declared by
+    # the factories and the profilers, one entry per overload. A function declared by several
+    # headers is kept once, with the first of them.
+    declarations = defaultdict(dict)
+    for include_dir in include_dirs:
+        for dirpath, _, files in sorted(os.walk(include_dir)):
+            for name in sorted(files):
+                if not name.endswith('.hpp'):
+                    continue
+                path = os.path.normpath(os.path.join(dirpath, name))
+                header = os.path.relpath(path, include_dir)
+                for m in DECLARATION.finditer(strip_comments(read(path))):
+                    key = normalize_parameters(m.group(2), aliases.of(path))
+                    declarations[m.group(1)].setdefault(
+                        key, (path, header, ' '.join(m.group(2).split())))
+    return declarations
+
+def find_declaration(declarations, aliases, name, parameters, source):
+    # (header, parameters) of the declaration of the overload defined by source, None if nothing
+    # refers to it. The source may use the aliases of the header without including it.
+    overloads = declarations.get(name)
+    if not overloads:
+        # not declared in a header
+        return None
+    for key, (path, header, header_parameters) in overloads.items():
+        visible = dict(aliases.of(path))
+        visible.update(aliases.of(source))
+        if normalize_parameters(parameters, visible) == key:
+            return header, header_parameters
+    if len(overloads) == 1:
+        # the parameters are spelled differently, there is nothing else they can match
+        _, header, header_parameters = next(iter(overloads.values()))
+        return header, header_parameters
+    raise RuntimeError('wrong! {} in {} matches none of the overloads declared:\n  {}'.format(
+        name, source, '\n  '.join(overloads)))
+
+def write_registry(path, header, stubs):
+    with open(path, 'w') as f:
+        f.write('// Generated by script/generate_instance_registry.py, do not edit.\n\n')
+        f.write('#include "{}"\n\n'.format(header))
+        f.write('#pragma clang diagnostic push\n')
+        f.write('#pragma clang diagnostic ignored "-Wunused-parameter"\n\n')
+        f.write('namespace ck {\nnamespace tensor_operation {\nnamespace device {\n')
+        f.write('namespace instance {\n\n')
+        for stub in sorted(stubs):
+            f.write(stub + '\n')
+        f.write('\n} // namespace instance\n} // namespace device\n')
+        f.write('} // namespace tensor_operation\n} // namespace ck\n\n')
+        f.write('#pragma clang diagnostic pop\n')
+
+def main():
+    args = parse_args()
+    sources = [line.strip() for line in read(args.sources).splitlines() if line.strip()]
+    include_dirs = [os.path.normpath(d) for d in args.include_dirs]
+    aliases = Aliases(include_dirs)
+    declarations = find_declarations(include_dirs, aliases)
+
+    # header -> definitions adding no instance, one per overload left out, one source per header
+    # as the headers of the profilers may define the same aliases differently
+    stubs = defaultdict(set)
+    for source in sources:
+        source = os.path.normpath(source)
+        for m in DEFINITION.finditer(strip_comments(read(source))):
+            try:
+                declaration = find_declaration(
+                    declarations, aliases, m.group(1), m.group(2), source)
+            except RuntimeError as e:
+                sys.exit(str(e))
+            if declaration is None:
+                continue
+            header, header_parameters = declaration
+            stubs[header].add('void {}({}) {{}}'.format(m.group(1), header_parameters))
+
+    os.makedirs(args.output_dir, exist_ok=True)
+    for name in os.listdir(args.output_dir):
+        if name.endswith('.cpp'):
+            os.remove(os.path.join(args.output_dir, name))
+
+    for header, header_stubs in stubs.items():
+        name = os.path.splitext(header)[0].replace('/', '_') + '_registry.cpp'
+        write_registry(os.path.join(args.output_dir, name), header, header_stubs)
+
+if __name__ == '__main__':
+    main()
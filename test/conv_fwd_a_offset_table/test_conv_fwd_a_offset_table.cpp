@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+#include "ck/tensor_operation/operator_transform/conv_fwd_a_offset_table.hpp"
+
+#include "test/conv_util/conv_fwd_test_util.hpp"
+
+using namespace ck;
+using conv_fwd_test_util::ConvFwdProblem;
+
+// walks every row of the A matrix with the offset table and compares the offsets and the
+// validity with the transform-based descriptor
+template <index_t NDimSpatial, typename ALayout>
+void TestConvFwdAOffsetTable(const std::array<index_t, NDimSpatial>& input_spatial_lengths,
+                             const std::array<index_t, NDimSpatial>& filter_spatial_lengths,
+                             const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                             const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                             const std::array<index_t, NDimSpatial>& input_left_pads,
+                             const std::array<index_t, NDimSpatial>& input_right_pads,
+                             index_t C,
+                             index_t k_per_step)
+{
+    constexpr index_t G = 2;
+    constexpr index_t N = 2;
+    constexpr index_t K = 4;
+
+    const ConvFwdProblem<NDimSpatial> problem(G,
+                                              N,
+                                              C,
+                                              K,
+                                              input_spatial_lengths,
+                                              filter_spatial_lengths,
+                                              conv_filter_strides,
+                                              conv_filter_dilations,
+                                              input_left_pads,
+                                              input_right_pads);
+
+    const auto& a_g_n_c_wis_lengths = problem.a_g_n_c_wis_lengths_;
+    const auto& b_g_k_c_xs_lengths  = problem.b_g_k_c_xs_lengths_;
+    const auto& c_g_n_k_wos_lengths = problem.c_g_n_k_wos_lengths_;
+    const auto& a_g_n_c_wis_strides = problem.a_g_n_c_wis_strides_;
+    const auto& b_g_k_c_xs_strides  = problem.b_g_k_c_xs_strides_;
+    const auto& c_g_n_k_wos_strides = problem.c_g_n_k_wos_strides_;
+
+    using Transform = tensor_operation::
+        TransformConvFwdToGemm<NDimSpatial,
+                               tensor_operation::device::ConvolutionForwardSpecialization::Default>;
+
+    const auto a_grid_desc_m_k =
+        Transform::template MakeADescriptor_M_K<ALayout>(a_g_n_c_wis_lengths,
+                                                         a_g_n_c_wis_strides,
+                                                         b_g_k_c_xs_lengths,
+                                                         b_g_k_c_xs_strides,
+                                                         c_g_n_k_wos_lengths,
+                                                         c_g_n_k_wos_strides,
+                                                         conv_filter_strides,
+                                                         conv_filter_dilations,
+                                                         input_left_pads,
+                                                         input_right_pads);
+
+    const tensor_operation::ConvFwdAOffsetTable<NDimSpatial> table(a_g_n_c_wis_lengths,
+                                                                   a_g_n_c_wis_strides,
+                                                                   b_g_k_c_xs_lengths,
+                                                                   c_g_n_k_wos_lengths,
+                                                                   conv_filter_strides,
+                                                                   conv_filter_dilations,
+                                                                   input_left_pads,
+                                                                   k_per_step);
+
+    const index_t M = a_grid_desc_m_k.GetLength(Number<0>{});
+
+    ASSERT_EQ(table.GetProblem().num_steps_ * k_per_step, a_grid_desc_m_k.GetLength(Number<1>{}));
+
+    for(index_t m = 0; m < M; ++m)
+    {
+        tensor_operation::ConvFwdAOffsetIterator<NDimSpatial> iter(
+            table.GetProblem(), table.GetEntries().data(), m);
+
+        for(index_t step = 0; step < table.GetProblem().num_steps_; ++step)
+        {
+            for(index_t dk = 0; dk < k_per_step; ++dk)
+            {
+                const index_t k = step * k_per_step + dk;
+
+                const auto coord = make_tensor_coordinate(a_grid_desc_m_k, make_multi_index(m, k));
+                const bool valid = coordinate_has_valid_offset(a_grid_desc_m_k, coord);
+
+                ASSERT_EQ(iter.IsValid(), valid) << m << ", " << k;
+
+                if(valid)
+                {
+                    ASSERT_EQ(iter.GetOffset() + dk * a_g_n_c_wis_strides[2], coord.GetOffset())
+                        << m << ", " << k;
+                }
+            }
+
+            ASSERT_EQ(iter.HasNextStep(), step + 1 < table.GetProblem().num_steps_);
+
+            if(iter.HasNextStep())
+            {
+                iter.MoveToNextStep();
+            }
+        }
+    }
+}
+
+TEST(ConvFwdAOffsetTable, ConvFwd1d)
+{
+    using namespace tensor_layout::convolution;
+
+    TestConvFwdAOffsetTable<1, NWGC>({9}, {3}, {2}, {1}, {1}, {1}, 8, 4);
+}
+
+TEST(ConvFwdAOffsetTable, ConvFwd2d)
+{
+    using namespace tensor_layout::convolution;
+
+    TestConvFwdAOffsetTable<2, NHWGC>({7, 6}, {3, 2}, {2, 1}, {1, 2}, {1, 0}, {2, 1}, 6, 2);
+    TestConvFwdAOffsetTable<2, NHWGC>({7, 6}, {3, 2}, {2, 1}, {1, 2}, {1, 0}, {2, 1}, 4, 1);
+}
+
+TEST(ConvFwdAOffsetTable, ConvFwd3d)
+{
+    using namespace tensor_layout::convolution;
+
+    TestConvFwdAOffsetTable<3, NDHWGC>(
+        {5, 4, 6}, {3, 1, 2}, {1, 2, 2}, {2, 1, 1}, {1, 0, 1}, {1, 1, 0}, 3, 3);
+}
+
+TEST(ConvFwdAOffsetTable, KPerStepNotDividingC)
+{
+    EXPECT_THROW((tensor_operation::ConvFwdAOffsetTable<1>(
+                     {1, 1, 6, 8}, {6, 48, 1, 6}, {1, 1, 6, 3}, {1, 1, 1, 6}, {1}, {1}, {0}, 4)),
+                 std::runtime_error);
+}
@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <array>
+
+#include "ck/ck.hpp"
+
+namespace ck {
+namespace conv_fwd_test_util {
+
+// strides of a tensor whose lengths are ordered G, N, C, spatial and stored as N, spatial, G, C
+template <index_t NDimSpatial>
+std::array<index_t, NDimSpatial + 3>
+MakeNSpatialGCStrides(const std::array<index_t, NDimSpatial + 3>& lengths)
+{
+    std::array<index_t, NDimSpatial + 3> strides;
+
+    strides[2] = 1;
+    strides[0] = lengths[2];
+
+    index_t stride = lengths[0] * lengths[2];
+
+    for(index_t i = NDimSpatial - 1; i >= 0; --i)
+    {
+        strides[3 + i] = stride;
+        stride *= lengths[3 + i];
+    }
+
+    strides[1] = stride;
+
+    return strides;
+}
+
+// lengths and strides of the tensors of a grouped forward convolution, ordered G, N/K, C/K,
+// spatial and stored as N, spatial, G, C
+template <index_t NDimSpatial>
+struct ConvFwdProblem
+{
+    ConvFwdProblem(index_t G,
+                   index_t N,
+                   index_t C,
+                   index_t K,
+                   const std::array<index_t, NDimSpatial>& input_spatial_lengths,
+                   const std::array<index_t, NDimSpatial>& filter_spatial_lengths,
+                   const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                   const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                   const std::array<index_t, NDimSpatial>& input_left_pads,
+                   const std::array<index_t, NDimSpatial>& input_right_pads)
+        : a_g_n_c_wis_lengths_{G, N, C}, b_g_k_c_xs_lengths_{G, K, C}, c_g_n_k_wos_lengths_{G, N, K}
+    {
+        for(index_t i = 0; i < NDimSpatial; ++i)
+        {
+            const index_t x_eff = (filter_spatial_lengths[i] - 1) * conv_filter_dilations[i] + 1;
+
+            a_g_n_c_wis_lengths_[3 + i] = input_spatial_lengths[i];
+            b_g_k_c_xs_lengths_[3 + i]  = filter_spatial_lengths[i];
+            c_g_n_k_wos_lengths_[3 + i] =
+                (input_spatial_lengths[i] + input_left_pads[i] + input_right_pads[i] - x_eff) /
+                    conv_filter_strides[i] +
+                1;
+        }
+
+        a_g_n_c_wis_strides_ = MakeNSpatialGCStrides<NDimSpatial>(a_g_n_c_wis_lengths_);
+        b_g_k_c_xs_strides_  = MakeNSpatialGCStrides<NDimSpatial>(b_g_k_c_xs_lengths_);
+        c_g_n_k_wos_strides_ = MakeNSpatialGCStrides<NDimSpatial>(c_g_n_k_wos_lengths_);
+    }
+
+    std::array<index_t, NDimSpatial + 3> a_g_n_c_wis_lengths_;
+    std::array<index_t, NDimSpatial + 3> b_g_k_c_xs_lengths_;
+    std::array<index_t, NDimSpatial + 3> c_g_n_k_wos_lengths_;
+    std::array<index_t, NDimSpatial + 3> a_g_n_c_wis_strides_;
+    std::array<index_t, NDimSpatial + 3> b_g_k_c_xs_strides_;
+    std::array<index_t, NDimSpatial + 3> c_g_n_k_wos_strides_;
+};
+
+} // namespace conv_fwd_test_util
+} // namespace ck
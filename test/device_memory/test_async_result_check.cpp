@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+#include "profiler/async_result_check.hpp"
+
+namespace {
+
+// submits num_instances outputs, the ones in wrong being off by one at a few elements, and
+// returns the result of Finish() and what it printed
+std::pair<bool, std::string> RunChecks(std::size_t num_elements,
+                                       int num_instances,
+                                       const std::set<int>& wrong)
+{
+    Tensor<float> reference({num_elements});
+
+    reference.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    ck::profiler::AsyncResultCheck<float> result_check(reference, true);
+
+    for(int instance = 0; instance < num_instances; ++instance)
+    {
+        auto out = reference;
+
+        if(wrong.count(instance) != 0)
+        {
+            out.mData[0] += 1.f;
+            out.mData[num_elements - 1] += 1.f;
+        }
+
+        // the buffers alternate, the previous output of this one is checked by now
+        result_check.GetDeviceBuffer().ToDevice(out.mData.data());
+
+        result_check.Submit("instance " + std::to_string(instance));
+    }
+
+    testing::internal::CaptureStderr();
+
+    const bool pass = result_check.Finish();
+
+    return {pass, testing::internal::GetCapturedStderr()};
+}
+
+} // namespace
+
+TEST(AsyncResultCheck, AllCorrect)
+{
+    const auto [pass, messages] = RunChecks(4096, 7, {});
+
+    EXPECT_TRUE(pass);
+    EXPECT_TRUE(messages.empty()) << messages;
+}
+
+TEST(AsyncResultCheck, MessagesInInstanceOrder)
+{
+    const auto [pass, messages] = RunChecks(1 << 20, 9, {1, 4, 8});
+
+    EXPECT_FALSE(pass);
+
+    std::size_t last = 0;
+
+    for(int instance = 0; instance < 9; ++instance)
+    {
+        const auto pos = messages.find("Error: instance " + std::to_string(instance) + " ");
+
+        if(instance == 1 || instance == 4 || instance == 8)
+        {
+            ASSERT_NE(pos, std::string::npos) << messages;
+            EXPECT_GE(pos, last) << messages;
+
+            last = pos;
+        }
+        else
+        {
+            EXPECT_EQ(pos, std::string::npos) << messages;
+        }
+    }
+}
+
+TEST(AsyncResultCheck, SingleInstance)
+{
+    EXPECT_TRUE(RunChecks(100, 1, {}).first);
+    EXPECT_FALSE(RunChecks(100, 1, {0}).first);
+}
+
+TEST(AsyncResultCheck, WithoutVerification)
+{
+    Tensor<float> reference({16});
+
+    ck::profiler::AsyncResultCheck<float> result_check(reference, false);
+
+    EXPECT_EQ(result_check.GetDeviceBuffer().GetBufferSize(), 16 * sizeof(float));
+    EXPECT_THROW(result_check.Submit("instance 0"), std::runtime_error);
+    EXPECT_TRUE(result_check.Finish());
+}
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/host_utility/hip_check_error.hpp"
+#include "ck/library/utility/device_memory.hpp"
+
+namespace {
+
+// the size of a chunk of the pinned staging of DeviceMem, the copies above go through it
+constexpr std::size_t ChunkSize = 32 << 20;
+
+std::vector<uint8_t> MakeBytes(std::size_t size, uint8_t seed)
+{
+    std::vector<uint8_t> bytes(size);
+
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = static_cast<uint8_t>((i * 131 + (i >> 16) + seed) & 0xff);
+    }
+
+    return bytes;
+}
+
+// first differing byte, size if none
+std::size_t FirstMismatch(const void* p, const void* q, std::size_t size)
+{
+    const auto* a = static_cast<const uint8_t*>(p);
+    const auto* b = static_cast<const uint8_t*>(q);
+
+    return std::mismatch(a, a + size, b).first - a;
+}
+
+} // namespace
+
+TEST(DeviceMem, CopiesThroughPinnedStaging)
+{
+    // below one chunk, exactly one, a partial last chunk, and an odd number of chunks
+    for(const std::size_t size :
+        {std::size_t{1} << 20, ChunkSize, ChunkSize + 3, 3 * ChunkSize + 12345})
+    {
+        const auto in = MakeBytes(size, static_cast<uint8_t>(size));
+
+        std::vector<uint8_t> out(size, 0);
+
+        DeviceMem device_buf(size);
+
+        device_buf.ToDevice(in.data());
+        device_buf.FromDevice(out.data());
+
+        EXPECT_EQ(FirstMismatch(in.data(), out.data(), size), size) << "size " << size;
+
+        // each direction on its own, against the plain copies of ToDeviceAsync / FromDeviceAsync
+        std::vector<uint8_t> out_async(size, 0);
+
+        device_buf.FromDeviceAsync(out_async.data(), nullptr);
+        hip_check_error(hipStreamSynchronize(nullptr));
+
+        EXPECT_EQ(FirstMismatch(in.data(), out_async.data(), size), size) << "size " << size;
+
+        const auto other_in = MakeBytes(size, static_cast<uint8_t>(size + 1));
+
+        device_buf.ToDeviceAsync(other_in.data(), nullptr);
+        hip_check_error(hipStreamSynchronize(nullptr));
+
+        device_buf.FromDevice(out.data());
+
+        EXPECT_EQ(FirstMismatch(other_in.data(), out.data(), size), size) << "size " << size;
+    }
+}
+
+TEST(DeviceMem, StagedCopiesWaitForTheStreamOfTheBuffer)
+{
+    // queued on the stream of the buffer, the staged read back must see the values
+    const std::size_t num_elements = (2 * ChunkSize + 4096) / sizeof(float);
+
+    DeviceMem device_buf(num_elements * sizeof(float));
+
+    device_buf.SetValue(2.f);
+
+    std::vector<float> out(num_elements, 0.f);
+
+    device_buf.FromDevice(out.data());
+
+    EXPECT_EQ(std::count(out.begin(), out.end(), 2.f), static_cast<long>(num_elements));
+
+    // a staged write after a kernel writing the buffer is not overwritten by it
+    std::vector<float> in(num_elements);
+
+    std::iota(in.begin(), in.end(), 0.f);
+
+    device_buf.SetZero();
+    device_buf.ToDevice(in.data());
+    device_buf.FromDevice(out.data());
+
+    EXPECT_EQ(FirstMismatch(in.data(), out.data(), num_elements * sizeof(float)),
+              num_elements * sizeof(float));
+}
+
+TEST(DeviceMem, AsyncCopiesOfPinnedMemory)
+{
+    const std::size_t size = ChunkSize + 777;
+
+    const auto in = MakeBytes(size, 7);
+
+    PinnedHostMem host_in(size);
+    PinnedHostMem host_out(size);
+
+    std::memcpy(host_in.GetHostBuffer(), in.data(), size);
+    std::memset(host_out.GetHostBuffer(), 0, size);
+
+    EXPECT_EQ(host_in.GetBufferSize(), size);
+
+    DeviceMem device_buf(size);
+
+    hipStream_t stream;
+    hipEvent_t to_device_done;
+    hipEvent_t from_device_done;
+
+    hip_check_error(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    hip_check_error(hipEventCreateWithFlags(&to_device_done, hipEventDisableTiming));
+    hip_check_error(hipEventCreateWithFlags(&from_device_done, hipEventDisableTiming));
+
+    device_buf.ToDeviceAsync(host_in.GetHostBuffer(), stream, to_device_done);
+    device_buf.FromDeviceAsync(host_out.GetHostBuffer(), stream, from_device_done);
+
+    // the events are recorded after their copies, on the stream of the copies
+    hip_check_error(hipEventSynchronize(from_device_done));
+
+    EXPECT_EQ(hipEventQuery(to_device_done), hipSuccess);
+    EXPECT_EQ(FirstMismatch(in.data(), host_out.GetHostBuffer(), size), size);
+
+    // without an event
+    std::memset(host_out.GetHostBuffer(), 0, size);
+
+    device_buf.FromDeviceAsync(host_out.GetHostBuffer(), stream);
+
+    hip_check_error(hipStreamSynchronize(stream));
+
+    EXPECT_EQ(FirstMismatch(in.data(), host_out.GetHostBuffer(), size), size);
+
+    hip_check_error(hipEventDestroy(from_device_done));
+    hip_check_error(hipEventDestroy(to_device_done));
+    hip_check_error(hipStreamDestroy(stream));
+}
@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/utility/device_memory_pool.hpp"
+
+namespace {
+
+// the pool only compares streams, they are never used by the host backend
+hipStream_t MakeStream(int i) { return reinterpret_cast<hipStream_t>(static_cast<uintptr_t>(i)); }
+
+struct MemoryPoolTest : public ::testing::Test
+{
+    explicit MemoryPoolTest(std::size_t capacity = 0)
+        : backend_(new HostMemoryPoolBackend(capacity)),
+          pool_(std::unique_ptr<MemoryPoolBackend>(backend_))
+    {
+    }
+
+    // owned by pool_
+    HostMemoryPoolBackend* backend_;
+    DeviceMemoryPool pool_;
+};
+
+// op with a workspace of the given size
+struct WorkspaceOp : public ck::tensor_operation::device::BaseOperator
+{
+    explicit WorkspaceOp(std::size_t workspace_size) : workspace_size_{workspace_size} {}
+
+    bool IsSupportedArgument(const ck::tensor_operation::device::BaseArgument*) override
+    {
+        return true;
+    }
+
+    size_t GetWorkSpaceSize(const ck::tensor_operation::device::BaseArgument*) const override
+    {
+        return workspace_size_;
+    }
+
+    std::size_t workspace_size_;
+};
+
+} // namespace
+
+TEST(DeviceMemoryPool, SizeClasses)
+{
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(0), 512u);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(1), 512u);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(512), 512u);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(513), 640u);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(1000), 1024u);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(1025), 1280u);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass(3 << 20), 3u << 20);
+    EXPECT_EQ(DeviceMemoryPool::GetSizeClass((3 << 20) + 1), 7u << 19);
+
+    // at most a quarter of the requested size is lost to rounding
+    for(std::size_t size = 513; size < (1 << 20); size = size * 9 / 7)
+    {
+        const std::size_t size_class = DeviceMemoryPool::GetSizeClass(size);
+
+        EXPECT_GE(size_class, size);
+        EXPECT_LE(size_class, size + size / 4);
+        EXPECT_EQ(DeviceMemoryPool::GetSizeClass(size_class), size_class);
+    }
+}
+
+TEST_F(MemoryPoolTest, ReuseOnSameStream)
+{
+    void* p = pool_.Allocate(1000, MakeStream(1));
+
+    pool_.Free(p, MakeStream(1));
+
+    // same size class
+    EXPECT_EQ(pool_.Allocate(900, MakeStream(1)), p);
+
+    // another size class
+    void* q = pool_.Allocate(2000, MakeStream(1));
+
+    EXPECT_NE(q, p);
+
+    const auto stats = pool_.GetStats();
+
+    EXPECT_EQ(stats.num_requests_, 3u);
+    EXPECT_EQ(stats.num_reuses_, 1u);
+    EXPECT_EQ(stats.num_backend_allocations_, 2u);
+    EXPECT_EQ(stats.bytes_requested_, 900u + 2000u);
+    EXPECT_EQ(stats.bytes_in_use_, 1024u + 2048u);
+    EXPECT_EQ(stats.bytes_cached_, 0u);
+    EXPECT_TRUE(backend_->synchronized_streams_.empty());
+}
+
+TEST_F(MemoryPoolTest, OtherStreamWaits)
+{
+    void* p = pool_.Allocate(4096, MakeStream(1));
+    void* q = pool_.Allocate(4096, MakeStream(2));
+
+    pool_.Free(p, MakeStream(1));
+    pool_.Free(q, MakeStream(2));
+
+    // the block freed on the same stream, although another one came first
+    EXPECT_EQ(pool_.Allocate(4096, MakeStream(2)), q);
+    EXPECT_TRUE(backend_->synchronized_streams_.empty());
+
+    // only the block of stream 1 is left
+    EXPECT_EQ(pool_.Allocate(4096, MakeStream(3)), p);
+    EXPECT_EQ(backend_->synchronized_streams_, std::vector<hipStream_t>{MakeStream(1)});
+}
+
+// backend asking the pool for its stats from another thread while a stream is waited for, which
+// only completes if the pool is not locked meanwhile
+struct ObservingMemoryPoolBackend : public HostMemoryPoolBackend
+{
+    void Synchronize(hipStream_t stream) override
+    {
+        HostMemoryPoolBackend::Synchronize(stream);
+
+        if(pool_ != nullptr)
+        {
+            pending_stats_ = std::async(std::launch::async, [this] { return pool_->GetStats(); });
+
+            pool_locked_ = pool_locked_ || pending_stats_.wait_for(std::chrono::seconds(1)) !=
+                                               std::future_status::ready;
+        }
+    }
+
+    DeviceMemoryPool* pool_ = nullptr;
+    bool pool_locked_       = false;
+    // kept until the end of the test, the wait for it in a destructor would run under the lock
+    std::future<MemoryPoolStats> pending_stats_;
+};
+
+TEST(DeviceMemoryPool, WaitForOtherStreamUnlocked)
+{
+    auto* backend = new ObservingMemoryPoolBackend;
+
+    DeviceMemoryPool pool{std::unique_ptr<MemoryPoolBackend>(backend)};
+
+    void* p = pool.Allocate(4096, MakeStream(1));
+
+    pool.Free(p, MakeStream(1));
+
+    backend->pool_ = &pool;
+
+    EXPECT_EQ(pool.Allocate(4096, MakeStream(2)), p);
+
+    backend->pool_ = nullptr;
+
+    EXPECT_EQ(backend->synchronized_streams_, std::vector<hipStream_t>{MakeStream(1)});
+    EXPECT_FALSE(backend->pool_locked_);
+
+    // the stats read while waiting already count the block as in use
+    ASSERT_TRUE(backend->pending_stats_.valid());
+    EXPECT_EQ(backend->pending_stats_.get().bytes_in_use_, 4096u);
+
+    pool.Free(p, MakeStream(2));
+}
+
+struct LimitedMemoryPoolTest : public MemoryPoolTest
+{
+    LimitedMemoryPoolTest() : MemoryPoolTest(8192) {}
+};
+
+TEST_F(LimitedMemoryPoolTest, ReleaseCacheWhenOutOfMemory)
+{
+    void* p = pool_.Allocate(4096);
+    void* q = pool_.Allocate(2048);
+
+    pool_.Free(p);
+
+    // 4096 + 2048 + 4096 does not fit: the cached block is released
+    void* r = pool_.Allocate(3000);
+
+    EXPECT_NE(r, nullptr);
+
+    auto stats = pool_.GetStats();
+
+    EXPECT_EQ(stats.num_backend_allocations_, 3u);
+    EXPECT_EQ(stats.num_backend_frees_, 1u);
+    EXPECT_EQ(stats.bytes_cached_, 0u);
+    EXPECT_EQ(stats.peak_bytes_reserved_, 4096u + 2048u);
+    EXPECT_EQ(backend_->bytes_allocated_, 2048u + 3072u);
+
+    EXPECT_THROW(pool_.Allocate(4096), std::runtime_error);
+
+    pool_.Free(q);
+    pool_.Free(r);
+    pool_.ReleaseCached();
+
+    EXPECT_EQ(backend_->bytes_allocated_, 0u);
+}
+
+TEST_F(MemoryPoolTest, Fragmentation)
+{
+    std::vector<void*> blocks;
+
+    // 640 bytes for 513
+    for(int i = 0; i < 4; ++i)
+    {
+        blocks.push_back(pool_.Allocate(513));
+    }
+
+    auto stats = pool_.GetStats();
+
+    EXPECT_DOUBLE_EQ(stats.GetInternalFragmentation(), 1. - 513. / 640.);
+    EXPECT_DOUBLE_EQ(stats.GetCachedRatio(), 0.);
+
+    pool_.Free(blocks[0]);
+    pool_.Free(blocks[1]);
+
+    stats = pool_.GetStats();
+
+    EXPECT_EQ(stats.bytes_in_use_, 2u * 640u);
+    EXPECT_EQ(stats.bytes_cached_, 2u * 640u);
+    EXPECT_DOUBLE_EQ(stats.GetCachedRatio(), 0.5);
+
+    EXPECT_THROW(pool_.Free(blocks[0]), std::runtime_error);
+}
+
+TEST_F(MemoryPoolTest, PooledWorkspace)
+{
+    ck::tensor_operation::device::BaseArgument argument;
+
+    {
+        WorkspaceOp op{1 << 16};
+
+        PooledWorkspace workspace(op, &argument, pool_);
+
+        EXPECT_NE(workspace.GetDeviceBuffer(), nullptr);
+        EXPECT_EQ(argument.p_workspace_, workspace.GetDeviceBuffer());
+        EXPECT_EQ(pool_.GetStats().bytes_in_use_, 1u << 16);
+    }
+
+    EXPECT_EQ(pool_.GetStats().bytes_cached_, 1u << 16);
+
+    {
+        // no workspace, nothing is allocated
+        WorkspaceOp op{0};
+
+        ck::tensor_operation::device::BaseArgument other_argument;
+
+        PooledWorkspace workspace(op, &other_argument, pool_);
+
+        EXPECT_EQ(workspace.GetDeviceBuffer(), nullptr);
+        EXPECT_EQ(other_argument.p_workspace_, nullptr);
+    }
+
+    EXPECT_EQ(pool_.GetStats().num_requests_, 1u);
+}
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_elementwise_broadcast.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+using namespace ck;
+using namespace ck::tensor_operation::device;
+
+using Add = ck::tensor_operation::element_wise::Add;
+
+TEST(ElementwiseBroadcast, BroadcastLengths)
+{
+    EXPECT_EQ(BroadcastElementwiseLengths({{2, 3, 4}, {4}}), (std::vector<index_t>{2, 3, 4}));
+    EXPECT_EQ(BroadcastElementwiseLengths({{8, 1, 16}, {4, 1}}), (std::vector<index_t>{8, 4, 16}));
+    EXPECT_EQ(BroadcastElementwiseLengths({{}, {5}}), (std::vector<index_t>{5}));
+
+    EXPECT_THROW(BroadcastElementwiseLengths({{3}, {4}}), std::runtime_error);
+}
+
+TEST(ElementwiseBroadcast, BroadcastStrides)
+{
+    const std::vector<index_t> lengths{2, 3, 4};
+
+    EXPECT_EQ(MakeElementwiseBroadcastStrides({2, 3, 4}, lengths),
+              (std::vector<index_t>{12, 4, 1}));
+    EXPECT_EQ(MakeElementwiseBroadcastStrides({4}, lengths), (std::vector<index_t>{0, 0, 1}));
+    EXPECT_EQ(MakeElementwiseBroadcastStrides({2, 1, 4}, lengths),
+              (std::vector<index_t>{4, 0, 1}));
+
+    EXPECT_THROW(MakeElementwiseBroadcastStrides({3, 3}, lengths), std::runtime_error);
+    EXPECT_THROW(MakeElementwiseBroadcastStrides({1, 2, 3, 4}, lengths), std::runtime_error);
+}
+
+TEST(ElementwiseBroadcast, CoalesceContiguous)
+{
+    const auto problem =
+        CoalesceElementwiseProblem({{2, 3, 4, 5}, {{60, 20, 5, 1}, {60, 20, 5, 1}}});
+
+    EXPECT_EQ(problem.lengths_, (std::vector<index_t>{120}));
+    EXPECT_EQ(problem.strides_[0], (std::vector<index_t>{1}));
+    EXPECT_EQ(problem.strides_[1], (std::vector<index_t>{1}));
+}
+
+TEST(ElementwiseBroadcast, CoalesceScalar)
+{
+    const auto problem = CoalesceElementwiseProblem({{1, 1}, {{0, 0}, {1, 1}}});
+
+    EXPECT_EQ(problem.lengths_, (std::vector<index_t>{1}));
+    EXPECT_EQ(problem.strides_[0], (std::vector<index_t>{1}));
+    EXPECT_EQ(problem.strides_[1], (std::vector<index_t>{1}));
+}
+
+TEST(ElementwiseBroadcast, CoalesceRankMismatch)
+{
+    EXPECT_THROW(CoalesceElementwiseProblem({{2, 3}, {{3}}}), std::runtime_error);
+}
+
+TEST(ElementwiseBroadcast, ProblemDescBias)
+{
+    // 5-D activation plus a per-channel bias folds to [N * D * H * W, C]
+    using DeviceOp = DeviceElementwiseBroadcast<Tuple<float, float>, Tuple<float>, Add, 2>;
+
+    const auto problem = DeviceOp::MakeProblemDesc({{{2, 3, 4, 5, 64}, {64}}});
+
+    EXPECT_EQ(problem.lengths_, (std::vector<index_t>{120, 64}));
+    EXPECT_EQ(problem.strides_[0], (std::vector<index_t>{64, 1}));
+    EXPECT_EQ(problem.strides_[1], (std::vector<index_t>{0, 1}));
+    EXPECT_EQ(problem.strides_[2], (std::vector<index_t>{64, 1}));
+}
+
+TEST(ElementwiseBroadcast, ProblemDescOuterProduct)
+{
+    // broadcast in different dimensions can not be folded
+    using DeviceOp = DeviceElementwiseBroadcast<Tuple<float, float>, Tuple<float>, Add, 3>;
+
+    const auto problem = DeviceOp::MakeProblemDesc({{{8, 1, 16}, {1, 4, 16}}});
+
+    EXPECT_EQ(problem.lengths_, (std::vector<index_t>{8, 4, 16}));
+    EXPECT_EQ(problem.strides_[0], (std::vector<index_t>{16, 0, 1}));
+    EXPECT_EQ(problem.strides_[1], (std::vector<index_t>{0, 16, 1}));
+    EXPECT_EQ(problem.strides_[2], (std::vector<index_t>{64, 16, 1}));
+}
@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+using namespace ck::tensor_operation::element_wise;
+
+namespace {
+
+const std::vector<float> values{-3.5f, -1.f, -0.25f, 0.f, 0.5f, 1.f, 2.75f, 6.f};
+
+} // namespace
+
+TEST(ElementwiseCompose, NumDTensor)
+{
+    using Op = Compose<stage::Add, stage::Relu, stage::Mul, stage::Clamp>;
+
+    EXPECT_EQ(Op::NumStage, 4);
+    EXPECT_EQ(Op::NumDTensor, 2);
+    EXPECT_EQ(Op::GetDOffset<0>(), 0);
+    EXPECT_EQ(Op::GetDOffset<2>(), 1);
+    EXPECT_EQ(Op::GetDOffset<3>(), 2);
+}
+
+TEST(ElementwiseCompose, AddReluAdd)
+{
+    const auto ref = AddReluAdd{};
+    const auto op  = Compose<stage::Add, stage::Relu, stage::Add>{};
+
+    for(float c : values)
+        for(float d0 : values)
+            for(float d1 : values)
+            {
+                float e_ref, e;
+
+                ref(e_ref, c, d0, d1);
+                op(e, c, d0, d1);
+
+                EXPECT_EQ(e, e_ref);
+            }
+}
+
+TEST(ElementwiseCompose, AddAddFastGelu)
+{
+    const auto ref = AddAddFastGelu{};
+    const auto op  = Compose<stage::Add, stage::Add, stage::Unary<FastGelu>>{};
+
+    for(float c : values)
+        for(float d0 : values)
+            for(float d1 : values)
+            {
+                float e_ref, e;
+
+                ref(e_ref, c, d0, d1);
+                op(e, c, d0, d1);
+
+                EXPECT_FLOAT_EQ(e, e_ref);
+            }
+}
+
+TEST(ElementwiseCompose, AddMultiply)
+{
+    const auto ref = AddMultiply{};
+    const auto op  = Compose<stage::Add, stage::Mul>{};
+
+    for(float c : values)
+        for(float d0 : values)
+            for(float d1 : values)
+            {
+                float e_ref, e;
+
+                ref(e_ref, c, ck::type_convert<ck::half_t>(d0), ck::type_convert<ck::half_t>(d1));
+                op(e, c, ck::type_convert<ck::half_t>(d0), ck::type_convert<ck::half_t>(d1));
+
+                EXPECT_FLOAT_EQ(e, e_ref);
+            }
+}
+
+TEST(ElementwiseCompose, Bilinear)
+{
+    const auto ref = Bilinear{0.5f, -2.f};
+    const auto op  = Compose<stage::Binary<Bilinear>>{stage::Binary<Bilinear>{ref}};
+
+    for(float c : values)
+        for(float d : values)
+        {
+            float e_ref, e;
+
+            ref(e_ref, c, d);
+            op(e, c, d);
+
+            EXPECT_EQ(e, e_ref);
+        }
+}
+
+TEST(ElementwiseCompose, AddActivationMulClamp)
+{
+    const float requant_scale = 37.f;
+
+    const auto ref = Add_Activation_Mul_Clamp<Relu>{requant_scale, Relu{}};
+    const auto op  = Compose<stage::Add, stage::Relu, stage::Scale, stage::Clamp>{
+        stage::Add{}, stage::Relu{}, stage::Scale{requant_scale}, stage::Clamp{}};
+
+    for(int32_t c = -8; c <= 8; ++c)
+        for(int32_t bias = -3; bias <= 3; ++bias)
+        {
+            int8_t e_ref, e;
+
+            ref(e_ref, c, bias);
+            op(e, c, bias);
+
+            EXPECT_EQ(e, e_ref);
+        }
+}
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "profiler/profile_gemm_fp8_impl.hpp"
+
+using F8   = ck::f8_t;
+using F16  = ck::half_t;
+using BF16 = ck::bhalf_t;
+using F32  = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using ScaleTensor = ck::tensor_operation::element_wise::ScaleTensor;
+using ScaleRowCol = ck::tensor_operation::element_wise::ScaleRowCol;
+
+template <typename Tuple>
+class TestGemmFp8 : public ::testing::Test
+{
+    protected:
+    using EDataType    = std::tuple_element_t<0, Tuple>;
+    using CDEElementOp = std::tuple_element_t<1, Tuple>;
+
+    void Run(int M, int N, int K)
+    {
+        bool pass = ck::profiler::
+            profile_gemm_fp8_impl<F8, F8, F32, EDataType, Row, Col, Row, CDEElementOp>(
+                true, 1, false, false, M, N, K, K, K, N);
+
+        EXPECT_TRUE(pass);
+    }
+};
+
+using KernelTypes = ::testing::Types<std::tuple<F16, ScaleTensor>,
+                                     std::tuple<BF16, ScaleTensor>,
+                                     std::tuple<F8, ScaleTensor>,
+                                     std::tuple<F16, ScaleRowCol>,
+                                     std::tuple<BF16, ScaleRowCol>,
+                                     std::tuple<F8, ScaleRowCol>>;
+
+TYPED_TEST_SUITE(TestGemmFp8, KernelTypes);
+
+TYPED_TEST(TestGemmFp8, TileMultiples)
+{
+    // M, N and K multiples of the block tiles, all the GemmDefault instances apply
+    this->Run(256, 256, 64);
+    this->Run(512, 256, 256);
+    this->Run(256, 512, 1024);
+}
+
+TYPED_TEST(TestGemmFp8, PaddedMNK)
+{
+    // only the MNKPadding instances apply, K is a multiple of the 16-wide vector loads of A and
+    // B only, N of the 8-wide stores of E of the per tensor instances
+    this->Run(100, 200, 80);
+    this->Run(33, 48, 16);
+    this->Run(1, 136, 144);
+}
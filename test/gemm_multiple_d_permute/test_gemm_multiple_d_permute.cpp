@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_multiple_d_permute_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+namespace {
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Add         = ck::tensor_operation::element_wise::Add;
+
+using ADataType   = F16;
+using BDataType   = F16;
+using AccDataType = F32;
+using DDataType   = F16;
+using EDataType   = F16;
+
+static constexpr ck::index_t NumDimM = 2;
+static constexpr ck::index_t NumDimN = 3;
+
+static constexpr auto GemmSpec = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+// clang-format off
+template <ck::index_t CDEScalarPerVector>
+using DeviceOpInstance = ck::tensor_operation::device::
+        //#######################################| NumDimM| NumDimN| ALayout| BLayout| AData| BData| AccData| CShuffle|                DsData| EData|           A|           B|          CDE|           GEMM| NumGemmK| Block|  MPer|  NPer|  KPer| AK1| BK1| MPer| NPer| MXdl| NXdl|  ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockTransfer| ABlockLds|  BBlockTransfer| BBlockTransfer| BBlockTransfer| BlockTransfer| BBlockTransfer| BBlockTransfer| BBlockLds|    CShuffle|    CShuffle| CBlockTransferClusterLengths|     CBlockTransfer|
+        //#######################################|        |        |        |        |  Type|  Type|    Type| DataType|                  Type|  Type| Elementwise| Elementwise|  Elementwise| Specialization| Prefetch|  Size| Block| Block| Block|    |    |  XDL|  XDL|  Per|  Per|   ThreadCluster|  ThreadCluster| SrcAccessOrder|   SrcVectorDim|      SrcScalar|      DstScalar| AddExtraM|   ThreadCluster|  ThreadCluster| SrcAccessOrder|  SrcVectorDim|      SrcScalar|      DstScalar| AddExtraN| MXdlPerWave| NXdlPerWave|         _MBlock_MWaveMPerXdl|    ScalarPerVector|
+        //#######################################|        |        |        |        |      |      |        |         |                      |      |   Operation|   Operation|    Operation|               |    Stage|      |      |      |      |    |    |     |     | Wave| Wave| Lengths_K0_M_K1|   ArrangeOrder|               |               |      PerVector|   PerVector_K1|          | Lengths_K0_N_K1|   ArrangeOrder|               |              |      PerVector|   PerVector_K1|          |  PerShuffle|  PerShuffle|         _NBlock_NWaveNPerXdl|      _NWaveNPerXdl|
+        //#######################################|        |        |        |        |      |      |        |         |                      |      |            |            |             |               |         |      |      |      |      |    |    |     |     |     |     |                |               |               |               |               |               |          |                |               |               |              |               |               |          |            |            |                             |                   |
+        DeviceGemmMultipleDPermute_Xdl_CShuffle< NumDimM, NumDimN,     Row,     Col,   F16,   F16,     F32,      F16, ck::Tuple<DDataType>,   F16, PassThrough, PassThrough,          Add,       GemmSpec,        1,   256,   256,   128,    32,   8,   8,   32,   32,    4,    2,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,              2,              8,              8,         1,     S<4, 64, 1>,     S<1, 0, 2>,     S<1, 0, 2>,             2,              8,              8,         1,           1,           1,              S<1, 32, 1, 8>, CDEScalarPerVector>;
+// clang-format on
+
+struct PermuteProblem
+{
+    // M = M0 * M1, N = N0 * N1 * N2
+    std::vector<ck::index_t> lengths_;
+    ck::index_t K_;
+    ck::index_t StrideA_;
+    ck::index_t StrideB_;
+    std::vector<ck::index_t> d_strides_;
+    std::vector<ck::index_t> e_strides_;
+};
+
+// returns false if the problem is not supported, the result is checked with EXPECT_TRUE
+template <ck::index_t CDEScalarPerVector>
+bool RunGemmMultipleDPermute(const PermuteProblem& problem)
+{
+    const auto& lengths = problem.lengths_;
+
+    const ck::index_t M1 = lengths[1];
+    const ck::index_t N1 = lengths[3];
+    const ck::index_t N2 = lengths[4];
+
+    const std::size_t M = lengths[0] * M1;
+    const std::size_t N = lengths[2] * N1 * N2;
+    const std::size_t K = problem.K_;
+
+    Tensor<ADataType> a_m_k({M, K}, {static_cast<std::size_t>(problem.StrideA_), std::size_t{1}});
+    Tensor<BDataType> b_k_n({K, N}, {std::size_t{1}, static_cast<std::size_t>(problem.StrideB_)});
+    Tensor<DDataType> d_ms_ns(lengths, problem.d_strides_);
+    Tensor<EDataType> e_ms_ns_host_result(lengths, problem.e_strides_);
+    Tensor<EDataType> e_ms_ns_device_result(lengths, problem.e_strides_);
+
+    // integer values, so that the sums do not depend on the order of the additions
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<ADataType>{-3, 3});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<BDataType>{-3, 3});
+    d_ms_ns.GenerateTensorValue(GeneratorTensor_2<DDataType>{-5, 5});
+
+    DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
+    DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
+    DeviceMem d_device_buf(sizeof(DDataType) * d_ms_ns.mDesc.GetElementSpaceSize());
+    DeviceMem e_device_buf(sizeof(EDataType) * e_ms_ns_device_result.mDesc.GetElementSpaceSize());
+
+    a_device_buf.ToDevice(a_m_k.mData.data());
+    b_device_buf.ToDevice(b_k_n.mData.data());
+    d_device_buf.ToDevice(d_ms_ns.mData.data());
+    e_device_buf.SetZero();
+
+    auto op       = DeviceOpInstance<CDEScalarPerVector>{};
+    auto invoker  = op.MakeInvoker();
+    auto argument = op.MakeArgument(a_device_buf.GetDeviceBuffer(),
+                                    b_device_buf.GetDeviceBuffer(),
+                                    std::array<const void*, 1>{d_device_buf.GetDeviceBuffer()},
+                                    e_device_buf.GetDeviceBuffer(),
+                                    problem.K_,
+                                    problem.StrideA_,
+                                    problem.StrideB_,
+                                    std::array<std::vector<ck::index_t>, 1>{lengths},
+                                    std::array<std::vector<ck::index_t>, 1>{problem.d_strides_},
+                                    lengths,
+                                    problem.e_strides_,
+                                    PassThrough{},
+                                    PassThrough{},
+                                    Add{});
+
+    if(!op.IsSupportedArgument(argument))
+    {
+        return false;
+    }
+
+    invoker.Run(argument, StreamConfig{nullptr, false});
+
+    e_device_buf.FromDevice(e_ms_ns_device_result.mData.data());
+
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            AccDataType,
+                                                                            AccDataType,
+                                                                            PassThrough,
+                                                                            PassThrough,
+                                                                            PassThrough>;
+
+    Tensor<AccDataType> c_m_n({M, N}, {N, std::size_t{1}});
+
+    auto ref_argument = ReferenceGemmInstance{}.MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ReferenceGemmInstance{}.MakeInvoker().Run(ref_argument);
+
+    // E[m0, m1, n0, n1, n2] = C[m0 * M1 + m1, (n0 * N1 + n1) * N2 + n2] + D[m0, m1, n0, n1, n2]
+    e_ms_ns_host_result.ForEach([&](auto& self, auto idx) {
+        const auto m = idx[0] * M1 + idx[1];
+        const auto n = (idx[2] * N1 + idx[3]) * N2 + idx[4];
+
+        Add{}(self(idx), c_m_n(m, n), d_ms_ns(idx));
+    });
+
+    EXPECT_TRUE(ck::utils::check_err(e_ms_ns_device_result, e_ms_ns_host_result));
+
+    return true;
+}
+
+// strides of a packed tensor whose dimensions are stored in the given order, outermost first
+std::vector<ck::index_t> MakePackedStrides(const std::vector<ck::index_t>& lengths,
+                                           const std::vector<std::size_t>& order)
+{
+    std::vector<ck::index_t> strides(lengths.size());
+
+    ck::index_t stride = 1;
+
+    for(std::size_t i = order.size(); i > 0; --i)
+    {
+        strides[order[i - 1]] = stride;
+        stride *= lengths[order[i - 1]];
+    }
+
+    return strides;
+}
+
+PermuteProblem MakeProblem(const std::vector<ck::index_t>& lengths,
+                           ck::index_t K,
+                           const std::vector<std::size_t>& d_order,
+                           const std::vector<std::size_t>& e_order)
+{
+    return PermuteProblem{lengths,
+                          K,
+                          K,
+                          K,
+                          MakePackedStrides(lengths, d_order),
+                          MakePackedStrides(lengths, e_order)};
+}
+
+} // namespace
+
+TEST(TestGemmMultipleDPermute, RowMajorE)
+{
+    EXPECT_TRUE(RunGemmMultipleDPermute<8>(
+        MakeProblem({2, 128, 2, 4, 32}, 64, {0, 1, 2, 3, 4}, {0, 1, 2, 3, 4})));
+}
+
+TEST(TestGemmMultipleDPermute, PermutedE)
+{
+    // E stored as [N0, M0, N1, M1, N2], like the output of a head split
+    EXPECT_TRUE(RunGemmMultipleDPermute<8>(
+        MakeProblem({4, 64, 4, 16, 32}, 128, {0, 1, 2, 3, 4}, {2, 0, 3, 1, 4})));
+
+    // E stored as [M1, N1, M0, N0, N2], D as [N2, ...] with scalar access
+    EXPECT_TRUE(RunGemmMultipleDPermute<1>(
+        MakeProblem({3, 40, 2, 5, 24}, 72, {4, 3, 2, 1, 0}, {1, 3, 0, 2, 4})));
+}
+
+TEST(TestGemmMultipleDPermute, BroadcastD)
+{
+    // a bias broadcast along M
+    const std::vector<ck::index_t> lengths{4, 64, 4, 16, 32};
+
+    auto problem       = MakeProblem(lengths, 96, {0, 1, 2, 3, 4}, {2, 0, 3, 1, 4});
+    problem.d_strides_ = {0, 0, 16 * 32, 32, 1};
+
+    EXPECT_TRUE(RunGemmMultipleDPermute<8>(problem));
+}
+
+TEST(TestGemmMultipleDPermute, PaddedMNK)
+{
+    // M, N and K are no multiples of the tile sizes
+    EXPECT_TRUE(RunGemmMultipleDPermute<8>(
+        MakeProblem({3, 37, 3, 7, 8}, 40, {0, 1, 2, 3, 4}, {2, 0, 3, 1, 4})));
+
+    EXPECT_TRUE(RunGemmMultipleDPermute<1>(
+        MakeProblem({5, 13, 1, 3, 3}, 24, {0, 1, 2, 3, 4}, {4, 2, 3, 0, 1})));
+}
+
+TEST(TestGemmMultipleDPermute, UnsupportedVectorAccess)
+{
+    // the last N dimension of E is not contiguous
+    EXPECT_FALSE(RunGemmMultipleDPermute<8>(
+        MakeProblem({2, 64, 2, 4, 32}, 64, {0, 1, 2, 3, 4}, {4, 0, 1, 2, 3})));
+
+    // the last N dimension of E is not a multiple of the vector size
+    EXPECT_FALSE(RunGemmMultipleDPermute<8>(
+        MakeProblem({2, 64, 2, 4, 12}, 64, {0, 1, 2, 3, 4}, {0, 1, 2, 3, 4})));
+
+    // K is a multiple of the vector size, but the rows of A and B are not aligned to it
+    auto problem     = MakeProblem({2, 64, 2, 4, 32}, 64, {0, 1, 2, 3, 4}, {0, 1, 2, 3, 4});
+    problem.StrideA_ = 68;
+    problem.StrideB_ = 66;
+
+    EXPECT_FALSE(RunGemmMultipleDPermute<8>(problem));
+}
@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iostream>
+#include <type_traits>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/tensor_operation_instance/gpu/quantization/gemm_weight_only_quantization.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/weight_only_quant.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_weight_only_quant.hpp"
+
+using F16 = ck::half_t;
+using F32 = float;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// all the instances of DeviceGemmWeightOnlyQuant against the reference, which reads the bytes
+// packed by ck::utils::pack_weight_only_quant as well
+template <typename WeightBitsType>
+class TestGemmWeightOnlyQuant : public ::testing::Test
+{
+    protected:
+    static constexpr ck::index_t WeightBits  = WeightBitsType::value;
+    static constexpr ck::index_t CodePerByte = 8 / WeightBits;
+
+    using ADataType     = F16;
+    using ScaleDataType = F16;
+    using AccDataType   = F32;
+    using EDataType     = F16;
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmWeightOnlyQuant<ADataType,
+                                                                             ScaleDataType,
+                                                                             EDataType,
+                                                                             WeightBits,
+                                                                             PassThrough,
+                                                                             PassThrough>;
+
+    using ReferenceGemmInstance =
+        ck::tensor_operation::host::ReferenceGemmWeightOnlyQuant<ADataType,
+                                                                 ScaleDataType,
+                                                                 EDataType,
+                                                                 AccDataType,
+                                                                 WeightBits,
+                                                                 PassThrough,
+                                                                 PassThrough>;
+
+    void Run(ck::index_t M, ck::index_t N, ck::index_t K, ck::index_t GroupSize)
+    {
+        const ck::index_t StrideA = K;
+        const ck::index_t StrideB = K / CodePerByte;
+        const ck::index_t StrideE = N;
+
+        const std::size_t num_group = K / GroupSize;
+
+        Tensor<ADataType> a_m_k({M, K}, {StrideA, 1});
+        Tensor<float> b_n_k({N, K});
+        Tensor<uint8_t> code_n_k({N, K});
+        Tensor<ScaleDataType> scale_n_g({static_cast<std::size_t>(N), num_group});
+        Tensor<ScaleDataType> zero_n_g({static_cast<std::size_t>(N), num_group});
+        Tensor<EDataType> e_m_n_host_result({M, N}, {StrideE, 1});
+        Tensor<EDataType> e_m_n_device_result({M, N}, {StrideE, 1});
+
+        a_m_k.GenerateTensorValue(GeneratorTensor_3<ADataType>{-1.0, 1.0});
+        b_n_k.GenerateTensorValue(GeneratorTensor_3<float>{-0.5, 0.5});
+
+        ck::utils::quantize_weight_only<WeightBits>(
+            b_n_k, GroupSize, code_n_k, scale_n_g, zero_n_g);
+
+        const auto b_packed = ck::utils::pack_weight_only_quant<WeightBits>(code_n_k, StrideB);
+
+        DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
+        DeviceMem b_device_buf(sizeof(uint8_t) * b_packed.mDesc.GetElementSpaceSize());
+        DeviceMem scale_device_buf(sizeof(ScaleDataType) * scale_n_g.mDesc.GetElementSpaceSize());
+        DeviceMem zero_device_buf(sizeof(ScaleDataType) * zero_n_g.mDesc.GetElementSpaceSize());
+        DeviceMem e_device_buf(sizeof(EDataType) *
+                               e_m_n_device_result.mDesc.GetElementSpaceSize());
+
+        a_device_buf.ToDevice(a_m_k.mData.data());
+        b_device_buf.ToDevice(b_packed.mData.data());
+        scale_device_buf.ToDevice(scale_n_g.mData.data());
+        zero_device_buf.ToDevice(zero_n_g.mData.data());
+
+        auto ref_argument = ReferenceGemmInstance::MakeArgument(a_m_k,
+                                                                b_packed,
+                                                                scale_n_g,
+                                                                zero_n_g,
+                                                                e_m_n_host_result,
+                                                                GroupSize,
+                                                                PassThrough{},
+                                                                PassThrough{});
+
+        ReferenceGemmInstance::MakeInvoker().Run(ref_argument);
+
+        const auto op_ptrs = ck::tensor_operation::device::instance::
+            DeviceOperationInstanceFactory<DeviceOp>::GetInstances();
+
+        ASSERT_FALSE(op_ptrs.empty());
+
+        int num_supported = 0;
+
+        for(auto& op_ptr : op_ptrs)
+        {
+            auto argument_ptr = op_ptr->MakeArgumentPointer(a_device_buf.GetDeviceBuffer(),
+                                                            b_device_buf.GetDeviceBuffer(),
+                                                            scale_device_buf.GetDeviceBuffer(),
+                                                            zero_device_buf.GetDeviceBuffer(),
+                                                            e_device_buf.GetDeviceBuffer(),
+                                                            M,
+                                                            N,
+                                                            K,
+                                                            StrideA,
+                                                            StrideB,
+                                                            StrideE,
+                                                            GroupSize,
+                                                            PassThrough{},
+                                                            PassThrough{});
+
+            if(!op_ptr->IsSupportedArgument(argument_ptr.get()))
+            {
+                continue;
+            }
+
+            ++num_supported;
+
+            e_device_buf.SetZero();
+
+            op_ptr->MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+            e_device_buf.FromDevice(e_m_n_device_result.mData.data());
+
+            EXPECT_TRUE(ck::utils::check_err(e_m_n_device_result, e_m_n_host_result))
+                << op_ptr->GetTypeString();
+        }
+
+        EXPECT_GT(num_supported, 0);
+    }
+};
+
+using KernelTypes = ::testing::Types<std::integral_constant<ck::index_t, 4>,
+                                     std::integral_constant<ck::index_t, 8>>;
+
+TYPED_TEST_SUITE(TestGemmWeightOnlyQuant, KernelTypes);
+
+TYPED_TEST(TestGemmWeightOnlyQuant, SingleToken)
+{
+    // decoding, a single row of A
+    this->Run(1, 256, 512, 128);
+    this->Run(1, 1000, 1024, 64);
+}
+
+TYPED_TEST(TestGemmWeightOnlyQuant, SmallM)
+{
+    // M and N no multiples of the block tiles
+    this->Run(3, 100, 256, 32);
+    this->Run(16, 64, 1024, 128);
+    this->Run(37, 129, 512, 64);
+}
+
+TYPED_TEST(TestGemmWeightOnlyQuant, SmallGroups)
+{
+    // only the instances loading at most 8 codes per thread apply
+    this->Run(1, 128, 256, 8);
+    this->Run(4, 96, 128, 8);
+}
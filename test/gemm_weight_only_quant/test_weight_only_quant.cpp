@@ -0,0 +1,219 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/weight_only_quant.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm_weight_only_quant.hpp"
+
+namespace {
+
+using F16 = ck::half_t;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+// the codes of row n are n + k, wrapped to the range of WeightBits-bit codes
+template <ck::index_t WeightBits>
+Tensor<uint8_t> MakeCodes(std::size_t N, std::size_t K)
+{
+    Tensor<uint8_t> code_n_k({N, K});
+
+    for(std::size_t n = 0; n < N; ++n)
+        for(std::size_t k = 0; k < K; ++k)
+            code_n_k(n, k) = static_cast<uint8_t>((3 * n + k) % (1 << WeightBits));
+
+    return code_n_k;
+}
+
+// dequantize B[N, K] through the reference, with A the identity E[k, n] = dequant(B[n, k])
+template <ck::index_t WeightBits>
+Tensor<float> Dequantize(const Tensor<uint8_t>& b_packed,
+                         const Tensor<F16>& scale_n_g,
+                         const Tensor<F16>& zero_n_g,
+                         std::size_t K,
+                         ck::index_t group_size)
+{
+    using ReferenceGemmInstance =
+        ck::tensor_operation::host::ReferenceGemmWeightOnlyQuant<float,
+                                                                 F16,
+                                                                 float,
+                                                                 float,
+                                                                 WeightBits,
+                                                                 PassThrough,
+                                                                 PassThrough>;
+
+    const std::size_t N = b_packed.GetLengths()[0];
+
+    Tensor<float> a_k_k({K, K});
+    Tensor<float> b_k_n({K, N});
+
+    a_k_k.SetZero();
+
+    for(std::size_t k = 0; k < K; ++k)
+        a_k_k(k, k) = 1.f;
+
+    auto ref_argument = ReferenceGemmInstance::MakeArgument(
+        a_k_k, b_packed, scale_n_g, zero_n_g, b_k_n, group_size, PassThrough{}, PassThrough{});
+
+    ReferenceGemmInstance::MakeInvoker().Run(ref_argument);
+
+    return b_k_n;
+}
+
+template <ck::index_t WeightBits>
+void TestRoundTrip(std::size_t N, std::size_t K, ck::index_t group_size, float min, float max)
+{
+    constexpr std::size_t CodePerByte = 8 / WeightBits;
+
+    const std::size_t num_group = K / group_size;
+
+    Tensor<float> b_n_k({N, K});
+    Tensor<uint8_t> code_n_k({N, K});
+    Tensor<F16> scale_n_g({N, num_group});
+    Tensor<F16> zero_n_g({N, num_group});
+
+    b_n_k.GenerateTensorValue(GeneratorTensor_3<float>{min, max});
+
+    ck::utils::quantize_weight_only<WeightBits>(b_n_k, group_size, code_n_k, scale_n_g, zero_n_g);
+
+    const auto b_packed = ck::utils::pack_weight_only_quant<WeightBits>(code_n_k, K / CodePerByte);
+
+    const auto b_k_n = Dequantize<WeightBits>(b_packed, scale_n_g, zero_n_g, K, group_size);
+
+    for(std::size_t n = 0; n < N; ++n)
+    {
+        for(std::size_t k = 0; k < K; ++k)
+        {
+            const float scale = ck::type_convert<float>(scale_n_g(n, k / group_size));
+
+            // half a step of rounding. The rounding of the zero point shifts the codes by up to
+            // half a step, the ones clamped at the ends of the range are off by up to a step
+            const bool clamped = code_n_k(n, k) == 0 || code_n_k(n, k) == (1 << WeightBits) - 1;
+            const float steps  = clamped ? 1.f : 0.5f;
+
+            // the rounding of the scale to f16
+            EXPECT_NEAR(b_k_n(k, n), b_n_k(n, k), steps * scale * (1.f + 1e-2f) + 1e-6f)
+                << "(" << n << ", " << k << ")";
+        }
+    }
+}
+
+} // anonymous namespace
+
+TEST(PackWeightOnlyQuant, Int4EvenKInLowNibble)
+{
+    const auto code_n_k = MakeCodes<4>(3, 8);
+    const auto b_packed = ck::utils::pack_weight_only_quant<4>(code_n_k, 6);
+
+    ASSERT_EQ(b_packed.GetLengths(), (std::vector<std::size_t>{3, 6}));
+
+    for(std::size_t n = 0; n < 3; ++n)
+    {
+        for(std::size_t i = 0; i < 4; ++i)
+        {
+            EXPECT_EQ(b_packed(n, i) & 0xf, code_n_k(n, 2 * i));
+            EXPECT_EQ(b_packed(n, i) >> 4, code_n_k(n, 2 * i + 1));
+        }
+
+        // the bytes of the row past the codes are zero
+        EXPECT_EQ(b_packed(n, 4), 0);
+        EXPECT_EQ(b_packed(n, 5), 0);
+    }
+}
+
+TEST(PackWeightOnlyQuant, Int8OneCodePerByte)
+{
+    const auto code_n_k = MakeCodes<8>(2, 300);
+    const auto b_packed = ck::utils::pack_weight_only_quant<8>(code_n_k, 304);
+
+    for(std::size_t n = 0; n < 2; ++n)
+        for(std::size_t k = 0; k < 300; ++k)
+            EXPECT_EQ(b_packed(n, k), code_n_k(n, k));
+}
+
+TEST(PackWeightOnlyQuant, RejectsCodesNotFittingTheRows)
+{
+    // an odd K does not fill the last byte, stride_b is shorter than the packed codes
+    EXPECT_THROW(ck::utils::pack_weight_only_quant<4>(MakeCodes<4>(2, 7), 4), std::runtime_error);
+    EXPECT_THROW(ck::utils::pack_weight_only_quant<4>(MakeCodes<4>(2, 8), 3), std::runtime_error);
+    EXPECT_THROW(ck::utils::pack_weight_only_quant<8>(MakeCodes<8>(2, 8), 7), std::runtime_error);
+}
+
+TEST(QuantizeWeightOnly, PerGroupScalesAndZeroPoints)
+{
+    constexpr ck::index_t group_size = 4;
+
+    // a group of each kind on one row: mixed signs, positive only, negative only and all zero
+    const std::vector<float> values{-1.5f, 6.f, 0.5f, 2.f,   // scale 7.5 / 15, zero 3
+                                    1.f,   3.f, 7.5f, 0.f,   // scale 7.5 / 15, zero 0
+                                    -3.f,  -1.f, -0.f, -2.f, // scale 3 / 15, zero 15
+                                    0.f,   0.f, 0.f,  0.f};  // scale 1, zero 0
+
+    Tensor<float> b_n_k({1, 16});
+    Tensor<uint8_t> code_n_k({1, 16});
+    Tensor<F16> scale_n_g({1, 4});
+    Tensor<F16> zero_n_g({1, 4});
+
+    for(std::size_t k = 0; k < 16; ++k)
+        b_n_k(0, k) = values[k];
+
+    ck::utils::quantize_weight_only<4>(b_n_k, group_size, code_n_k, scale_n_g, zero_n_g);
+
+    const std::vector<float> scales{0.5f, 0.5f, 0.2f, 1.f};
+    const std::vector<float> zeros{3.f, 0.f, 15.f, 0.f};
+
+    for(std::size_t g = 0; g < 4; ++g)
+    {
+        const float scale = ck::type_convert<float>(ck::type_convert<F16>(scales[g]));
+
+        EXPECT_EQ(ck::type_convert<float>(scale_n_g(0, g)), scale);
+        EXPECT_EQ(ck::type_convert<float>(zero_n_g(0, g)), zeros[g]);
+    }
+
+    // the codes of the exact multiples of the scale of the first group
+    const std::vector<int> codes{0, 15, 4, 7};
+
+    for(std::size_t k = 0; k < 4; ++k)
+        EXPECT_EQ(code_n_k(0, k), codes[k]);
+
+    // the zero point is the code of 0
+    for(std::size_t k = 12; k < 16; ++k)
+        EXPECT_EQ(code_n_k(0, k), 0);
+}
+
+TEST(QuantizeWeightOnly, RejectsKNotMultipleOfGroupSize)
+{
+    Tensor<float> b_n_k({2, 12});
+    Tensor<uint8_t> code_n_k({2, 12});
+    Tensor<F16> scale_n_g({2, 2});
+    Tensor<F16> zero_n_g({2, 2});
+
+    b_n_k.SetZero();
+
+    EXPECT_THROW(ck::utils::quantize_weight_only<4>(b_n_k, 8, code_n_k, scale_n_g, zero_n_g),
+                 std::runtime_error);
+    EXPECT_THROW(ck::utils::quantize_weight_only<4>(b_n_k, 0, code_n_k, scale_n_g, zero_n_g),
+                 std::runtime_error);
+}
+
+TEST(QuantizeWeightOnly, Int4RoundTripThroughDequantizer)
+{
+    TestRoundTrip<4>(16, 256, 32, -1.f, 1.f);
+    TestRoundTrip<4>(5, 96, 8, -0.5f, 2.f);
+    TestRoundTrip<4>(3, 128, 128, 0.1f, 4.f);
+}
+
+TEST(QuantizeWeightOnly, Int8RoundTripThroughDequantizer)
+{
+    TestRoundTrip<8>(16, 256, 64, -1.f, 1.f);
+    TestRoundTrip<8>(5, 96, 16, -3.f, -0.25f);
+}
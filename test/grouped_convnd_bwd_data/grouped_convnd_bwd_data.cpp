@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <tuple>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "profiler/profile_grouped_conv_bwd_data_impl.hpp"
+
+template <typename Tuple>
+class TestGroupedConvndBwdData : public ::testing::Test
+{
+    protected:
+    using DataType = std::tuple_element_t<0, Tuple>;
+    std::vector<ck::utils::conv::ConvParam> conv_params;
+
+    template <ck::index_t NDimSpatial, typename OutLayout, typename WeiLayout, typename InLayout>
+    void Run()
+    {
+        EXPECT_FALSE(conv_params.empty());
+
+        for(auto& param : conv_params)
+        {
+            bool pass = ck::profiler::profile_grouped_conv_bwd_data_impl<NDimSpatial,
+                                                                         OutLayout,
+                                                                         WeiLayout,
+                                                                         InLayout,
+                                                                         DataType,
+                                                                         DataType,
+                                                                         DataType>(
+                true,  // do_verification
+                1,     // init_method: integer value
+                false, // do_log
+                false, // time_kernel
+                param);
+            EXPECT_TRUE(pass);
+        }
+    }
+};
+
+using KernelTypes = ::testing::Types<std::tuple<float>, std::tuple<ck::half_t>>;
+TYPED_TEST_SUITE(TestGroupedConvndBwdData, KernelTypes);
+
+// 2d GNHWK/GKYXC/GNHWC
+TYPED_TEST(TestGroupedConvndBwdData, Test2D)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    this->conv_params.clear();
+    this->conv_params.push_back(
+        {2, 2, 4, 192, 192, {3, 3}, {28, 28}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back(
+        {2, 2, 32, 128, 256, {3, 3}, {14, 14}, {2, 2}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back(
+        {2, 2, 32, 128, 256, {1, 1}, {7, 7}, {2, 2}, {1, 1}, {0, 0}, {0, 0}});
+    this->template Run<2, GNHWK, GKYXC, GNHWC>();
+}
+
+// 2d depthwise NHWGK/GKYXC/NHWGC, C = K = 1 per group
+TYPED_TEST(TestGroupedConvndBwdData, Test2DDepthwise)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    this->conv_params.clear();
+    this->conv_params.push_back({2, 32, 4, 1, 1, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back({2, 64, 2, 1, 1, {3, 3}, {28, 28}, {2, 2}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back({2, 48, 2, 1, 1, {5, 5}, {17, 17}, {1, 1}, {2, 2}, {4, 4}, {4, 4}});
+    this->conv_params.push_back({2, 24, 1, 1, 1, {3, 3}, {15, 15}, {2, 2}, {1, 1}, {0, 0}, {0, 0}});
+    this->template Run<2, NHWGK, GKYXC, NHWGC>();
+}
@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_backward_data_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_bwd_data_utils.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/grid/block_to_ctile_map.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_bwd_data_to_gemm_v1.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+
+using namespace ck;
+
+static constexpr auto I0 = Number<0>{};
+static constexpr auto I1 = Number<1>{};
+static constexpr auto I2 = Number<2>{};
+
+static constexpr index_t MPerBlock = 16;
+static constexpr index_t NPerBlock = 8;
+static constexpr index_t AK1       = 2;
+static constexpr index_t BK1       = 2;
+
+template <typename AGridDesc_AK0_M_AK1,
+          typename BGridDesc_BK0_N_BK1,
+          typename EGridDesc_M_N,
+          typename Block2ETileMap>
+struct SubGemm
+{
+    AGridDesc_AK0_M_AK1 a_grid_desc_ak0_m_ak1_;
+    BGridDesc_BK0_N_BK1 b_grid_desc_bk0_n_bk1_;
+    EGridDesc_M_N e_grid_desc_m_n_;
+    Block2ETileMap block_2_etile_map_;
+    index_t BlockStart_, BlockEnd_;
+};
+
+// runs the sub-GEMMs of a 2D backward data convolution (out: GNHWK, wei: GKYXC, in: GNHWC) on the
+// CPU as the single-launch grid would: every block of the combined grid looks up its sub-GEMM and
+// group, then computes the tile given by its block-to-tile map. The result is compared with
+// ReferenceConvBwdData, and no input pixel may be written twice.
+void TestConvBwdDataSubGemms(const std::array<index_t, 2>& input_spatial_lengths,
+                             const std::array<index_t, 2>& filter_spatial_lengths,
+                             const std::array<index_t, 2>& conv_filter_strides,
+                             const std::array<index_t, 2>& conv_filter_dilations,
+                             const std::array<index_t, 2>& input_left_pads,
+                             const std::array<index_t, 2>& input_right_pads,
+                             index_t expected_num_gemm)
+{
+    using namespace tensor_layout::convolution;
+
+    using PassThrough = tensor_operation::element_wise::PassThrough;
+
+    constexpr index_t G = 2;
+    constexpr index_t N = 2;
+    constexpr index_t K = 4;
+    constexpr index_t C = 6;
+
+    const index_t Hi = input_spatial_lengths[0];
+    const index_t Wi = input_spatial_lengths[1];
+    const index_t Y  = filter_spatial_lengths[0];
+    const index_t X  = filter_spatial_lengths[1];
+
+    std::array<index_t, 2> output_spatial_lengths;
+
+    for(index_t i = 0; i < 2; ++i)
+    {
+        const index_t x_eff = (filter_spatial_lengths[i] - 1) * conv_filter_dilations[i] + 1;
+
+        output_spatial_lengths[i] =
+            (input_spatial_lengths[i] + input_left_pads[i] + input_right_pads[i] - x_eff) /
+                conv_filter_strides[i] +
+            1;
+    }
+
+    const index_t Ho = output_spatial_lengths[0];
+    const index_t Wo = output_spatial_lengths[1];
+
+    // packed GNHWK, GKYXC and GNHWC
+    const std::array<index_t, 5> a_g_n_k_wos_lengths{G, N, K, Ho, Wo};
+    const std::array<index_t, 5> a_g_n_k_wos_strides{N * Ho * Wo * K, Ho * Wo * K, 1, Wo * K, K};
+    const std::array<index_t, 5> b_g_k_c_xs_lengths{G, K, C, Y, X};
+    const std::array<index_t, 5> b_g_k_c_xs_strides{K * Y * X * C, Y * X * C, 1, X * C, C};
+    const std::array<index_t, 5> e_g_n_c_wis_lengths{G, N, C, Hi, Wi};
+    const std::array<index_t, 5> e_g_n_c_wis_strides{N * Hi * Wi * C, Hi * Wi * C, 1, Wi * C, C};
+
+    auto make_host_tensor = [](const std::array<index_t, 5>& lengths,
+                               const std::array<index_t, 5>& strides) {
+        return Tensor<float>(HostTensorDescriptor(std::vector<std::size_t>(lengths.begin(),
+                                                                           lengths.end()),
+                                                  std::vector<std::size_t>(strides.begin(),
+                                                                           strides.end())));
+    };
+
+    Tensor<float> out = make_host_tensor(a_g_n_k_wos_lengths, a_g_n_k_wos_strides);
+    Tensor<float> wei = make_host_tensor(b_g_k_c_xs_lengths, b_g_k_c_xs_strides);
+    Tensor<float> in_host = make_host_tensor(e_g_n_c_wis_lengths, e_g_n_c_wis_strides);
+    Tensor<float> in_grid = make_host_tensor(e_g_n_c_wis_lengths, e_g_n_c_wis_strides);
+
+    // small integers, for sums that do not depend on their order
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(-3, 3);
+
+    for(auto& v : out.mData)
+    {
+        v = dist(rng);
+    }
+
+    for(auto& v : wei.mData)
+    {
+        v = dist(rng);
+    }
+
+    std::fill(in_grid.mData.begin(), in_grid.mData.end(), 0.f);
+
+    auto ref_conv = tensor_operation::host::
+        ReferenceConvBwdData<2, float, float, float, PassThrough, PassThrough, PassThrough>{};
+
+    auto ref_argument = ref_conv.MakeArgument(
+        in_host,
+        wei,
+        out,
+        std::vector<index_t>(conv_filter_strides.begin(), conv_filter_strides.end()),
+        std::vector<index_t>(conv_filter_dilations.begin(), conv_filter_dilations.end()),
+        std::vector<index_t>(input_left_pads.begin(), input_left_pads.end()),
+        std::vector<index_t>(input_right_pads.begin(), input_right_pads.end()),
+        PassThrough{},
+        PassThrough{},
+        PassThrough{});
+
+    ref_conv.MakeInvoker().Run(ref_argument);
+
+    using Transform = tensor_operation::TransformConvBwdDataToGemm_v1<
+        2,
+        tensor_operation::device::ConvolutionBackwardDataSpecialization::Default,
+        AK1,
+        BK1,
+        MPerBlock,
+        NPerBlock,
+        true,
+        true>;
+
+    using Block2ETileMap = BlockToCTileMap_M00_N0_M01Adapt<MPerBlock, NPerBlock>;
+
+    auto make_sub_gemm = [&](const std::array<index_t, 2>& tildes, index_t block_start) {
+        const auto a_grid_desc_ak0_m_ak1 =
+            Transform::template MakeADescriptor_AK0_M_AK1<GNHWK>(a_g_n_k_wos_lengths,
+                                                                 a_g_n_k_wos_strides,
+                                                                 b_g_k_c_xs_lengths,
+                                                                 b_g_k_c_xs_strides,
+                                                                 e_g_n_c_wis_lengths,
+                                                                 e_g_n_c_wis_strides,
+                                                                 conv_filter_strides,
+                                                                 conv_filter_dilations,
+                                                                 input_left_pads,
+                                                                 input_right_pads,
+                                                                 tildes);
+
+        const auto b_grid_desc_bk0_n_bk1 =
+            Transform::template MakeBDescriptor_BK0_N_BK1<GKYXC>(a_g_n_k_wos_lengths,
+                                                                 a_g_n_k_wos_strides,
+                                                                 b_g_k_c_xs_lengths,
+                                                                 b_g_k_c_xs_strides,
+                                                                 e_g_n_c_wis_lengths,
+                                                                 e_g_n_c_wis_strides,
+                                                                 conv_filter_strides,
+                                                                 conv_filter_dilations,
+                                                                 input_left_pads,
+                                                                 input_right_pads,
+                                                                 tildes);
+
+        const auto e_grid_desc_m_n =
+            Transform::template MakeCDescriptor_M_N<GNHWC>(a_g_n_k_wos_lengths,
+                                                           a_g_n_k_wos_strides,
+                                                           b_g_k_c_xs_lengths,
+                                                           b_g_k_c_xs_strides,
+                                                           e_g_n_c_wis_lengths,
+                                                           e_g_n_c_wis_strides,
+                                                           conv_filter_strides,
+                                                           conv_filter_dilations,
+                                                           input_left_pads,
+                                                           input_right_pads,
+                                                           tildes);
+
+        const Block2ETileMap block_2_etile_map(e_grid_desc_m_n);
+
+        const index_t grid_size = block_2_etile_map.CalculateGridSize(e_grid_desc_m_n) * G;
+
+        return SubGemm<remove_cvref_t<decltype(a_grid_desc_ak0_m_ak1)>,
+                       remove_cvref_t<decltype(b_grid_desc_bk0_n_bk1)>,
+                       remove_cvref_t<decltype(e_grid_desc_m_n)>,
+                       OffsettedBlockToCTileMap<Block2ETileMap>>{
+            a_grid_desc_ak0_m_ak1,
+            b_grid_desc_bk0_n_bk1,
+            e_grid_desc_m_n,
+            OffsettedBlockToCTileMap<Block2ETileMap>(block_2_etile_map, block_start),
+            block_start,
+            block_start + grid_size};
+    };
+
+    const auto tilde_slices = tensor_operation::device::GetConvBwdDataTildeSlices<2>(
+        b_g_k_c_xs_lengths, conv_filter_strides, conv_filter_dilations);
+
+    ASSERT_EQ(static_cast<index_t>(tilde_slices.size()), expected_num_gemm);
+
+    using SubGemmType = decltype(make_sub_gemm(tilde_slices[0], 0));
+
+    std::vector<SubGemmType> sub_gemms;
+
+    index_t grid_size = 0;
+
+    for(const auto& tildes : tilde_slices)
+    {
+        sub_gemms.push_back(make_sub_gemm(tildes, grid_size));
+
+        grid_size = sub_gemms.back().BlockEnd_;
+    }
+
+    std::vector<int> num_write(in_grid.mData.size(), 0);
+
+    for(index_t block_id = 0; block_id < grid_size; ++block_id)
+    {
+        const index_t gemm_idx = tensor_operation::device::FindGroupedGridGemmIndex(
+            sub_gemms.data(), static_cast<index_t>(sub_gemms.size()), block_id);
+
+        const auto& sub_gemm = sub_gemms[gemm_idx];
+
+        ASSERT_GE(block_id, sub_gemm.BlockStart_);
+        ASSERT_LT(block_id, sub_gemm.BlockEnd_);
+
+        const index_t num_block_per_group = (sub_gemm.BlockEnd_ - sub_gemm.BlockStart_) / G;
+        const index_t g = (block_id - sub_gemm.BlockStart_) / num_block_per_group;
+
+        const auto tile_idx =
+            sub_gemm.block_2_etile_map_.CalculateBottomIndex(make_multi_index(block_id));
+
+        const auto& a_desc = sub_gemm.a_grid_desc_ak0_m_ak1_;
+        const auto& b_desc = sub_gemm.b_grid_desc_bk0_n_bk1_;
+        const auto& e_desc = sub_gemm.e_grid_desc_m_n_;
+
+        const index_t gemm_k = a_desc.GetLength(I0) * a_desc.GetLength(I2);
+
+        ASSERT_EQ(gemm_k, b_desc.GetLength(I0) * b_desc.GetLength(I2));
+
+        for(index_t m = tile_idx[I0] * MPerBlock; m < (tile_idx[I0] + 1) * MPerBlock; ++m)
+        {
+            for(index_t n = tile_idx[I1] * NPerBlock; n < (tile_idx[I1] + 1) * NPerBlock; ++n)
+            {
+                const auto e_coord = make_tensor_coordinate(e_desc, make_multi_index(m, n));
+
+                if(m >= e_desc.GetLength(I0) || n >= e_desc.GetLength(I1) ||
+                   !coordinate_has_valid_offset(e_desc, e_coord))
+                {
+                    continue;
+                }
+
+                float acc = 0;
+
+                for(index_t k = 0; k < gemm_k; ++k)
+                {
+                    const auto a_coord =
+                        make_tensor_coordinate(a_desc, make_multi_index(k / AK1, m, k % AK1));
+                    const auto b_coord =
+                        make_tensor_coordinate(b_desc, make_multi_index(k / BK1, n, k % BK1));
+
+                    if(coordinate_has_valid_offset(a_desc, a_coord) &&
+                       coordinate_has_valid_offset(b_desc, b_coord))
+                    {
+                        acc += out.mData[g * a_g_n_k_wos_strides[0] + a_coord.GetOffset()] *
+                               wei.mData[g * b_g_k_c_xs_strides[0] + b_coord.GetOffset()];
+                    }
+                }
+
+                const std::size_t offset = g * e_g_n_c_wis_strides[0] + e_coord.GetOffset();
+
+                in_grid.mData[offset] = acc;
+                ++num_write[offset];
+            }
+        }
+    }
+
+    for(std::size_t i = 0; i < in_grid.mData.size(); ++i)
+    {
+        ASSERT_LE(num_write[i], 1) << i;
+        ASSERT_EQ(in_grid.mData[i], in_host.mData[i]) << i;
+    }
+}
+
+TEST(ConvBwdDataSubGemm, Stride1)
+{
+    TestConvBwdDataSubGemms({7, 6}, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, 1);
+}
+
+TEST(ConvBwdDataSubGemm, Stride2)
+{
+    TestConvBwdDataSubGemms({9, 8}, {3, 3}, {2, 2}, {1, 1}, {1, 1}, {1, 1}, 4);
+}
+
+TEST(ConvBwdDataSubGemm, StrideDilation)
+{
+    // XTilde = 3 / gcd(3, 2) = 3, the slice i_xtilde = 2 has no filter tap
+    TestConvBwdDataSubGemms({11, 13}, {3, 2}, {2, 3}, {1, 2}, {1, 0}, {2, 1}, 4);
+}
+
+TEST(ConvBwdDataSubGemm, StrideLargerThanFilter)
+{
+    TestConvBwdDataSubGemms({8, 9}, {1, 1}, {2, 3}, {1, 1}, {0, 0}, {0, 0}, 1);
+}
+
+TEST(ConvBwdDataSubGemm, GridGemmIndex)
+{
+    struct BlockRange
+    {
+        index_t BlockStart_, BlockEnd_;
+    };
+
+    const std::vector<BlockRange> ranges{{0, 3}, {3, 4}, {4, 10}, {10, 12}};
+
+    for(index_t i = 0; i < static_cast<index_t>(ranges.size()); ++i)
+    {
+        for(index_t block_id = ranges[i].BlockStart_; block_id < ranges[i].BlockEnd_; ++block_id)
+        {
+            EXPECT_EQ(tensor_operation::device::FindGroupedGridGemmIndex(
+                          ranges.data(), static_cast<index_t>(ranges.size()), block_id),
+                      i);
+        }
+    }
+}
@@ -18,39 +18,50 @@ class TestGroupedConvndBwdWeight : public ::testing::Test
     using DataType = std::tuple_element_t<0, Tuple>;
     std::vector<ck::utils::conv::ConvParam> conv_params;
     ck::index_t split_k{2};
+    bool deterministic{false};
 
-    template <ck::index_t NDimSpatial>
-    void Run()
+    template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+    void RunLayout()
     {
         for(auto& param : conv_params)
         {
             bool pass;
             EXPECT_FALSE(conv_params.empty());
-            pass = ck::profiler::profile_grouped_conv_bwd_weight_impl<
-                NDimSpatial,
-                ck::tuple_element_t<NDimSpatial - 1,
-                                    ck::Tuple<ck::tensor_layout::convolution::GNWC,
-                                              ck::tensor_layout::convolution::GNHWC,
-                                              ck::tensor_layout::convolution::GNDHWC>>,
-                ck::tuple_element_t<NDimSpatial - 1,
-                                    ck::Tuple<ck::tensor_layout::convolution::GKXC,
-                                              ck::tensor_layout::convolution::GKYXC,
-                                              ck::tensor_layout::convolution::GKZYXC>>,
-                ck::tuple_element_t<NDimSpatial - 1,
-                                    ck::Tuple<ck::tensor_layout::convolution::GNWK,
-                                              ck::tensor_layout::convolution::GNHWK,
-                                              ck::tensor_layout::convolution::GNDHWK>>,
-                DataType,
-                DataType,
-                DataType>(true,  // do_verification
-                          1,     // init_method: integer value
-                          false, // do_log
-                          false, // time_kernel
-                          param,
-                          split_k);
+            pass = ck::profiler::profile_grouped_conv_bwd_weight_impl<NDimSpatial,
+                                                                      InLayout,
+                                                                      WeiLayout,
+                                                                      OutLayout,
+                                                                      DataType,
+                                                                      DataType,
+                                                                      DataType>(
+                true,  // do_verification
+                1,     // init_method: integer value
+                false, // do_log
+                false, // time_kernel
+                param,
+                split_k,
+                deterministic);
             EXPECT_TRUE(pass);
         }
     }
+
+    template <ck::index_t NDimSpatial>
+    void Run()
+    {
+        RunLayout<NDimSpatial,
+                  ck::tuple_element_t<NDimSpatial - 1,
+                                      ck::Tuple<ck::tensor_layout::convolution::GNWC,
+                                                ck::tensor_layout::convolution::GNHWC,
+                                                ck::tensor_layout::convolution::GNDHWC>>,
+                  ck::tuple_element_t<NDimSpatial - 1,
+                                      ck::Tuple<ck::tensor_layout::convolution::GKXC,
+                                                ck::tensor_layout::convolution::GKYXC,
+                                                ck::tensor_layout::convolution::GKZYXC>>,
+                  ck::tuple_element_t<NDimSpatial - 1,
+                                      ck::Tuple<ck::tensor_layout::convolution::GNWK,
+                                                ck::tensor_layout::convolution::GNHWK,
+                                                ck::tensor_layout::convolution::GNDHWK>>>();
+    }
 };
 
 using KernelTypes =
@@ -78,6 +89,36 @@ TYPED_TEST(TestGroupedConvndBwdWeight, Test2D)
     this->template Run<2>();
 }
 
+TYPED_TEST(TestGroupedConvndBwdWeight, Test2DDeterministicAutoSplitK)
+{
+    this->split_k       = 0;
+    this->deterministic = true;
+    this->conv_params.clear();
+    this->conv_params.push_back(
+        {2, 2, 4, 128, 256, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back(
+        {2, 1, 32, 64, 64, {3, 3}, {28, 28}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    this->template Run<2>();
+}
+
+// 2d depthwise NHWGC/GKYXC/NHWGK, C = K = 1 per group. The depthwise instances reduce within a
+// workgroup and only take split_k = 1
+TYPED_TEST(TestGroupedConvndBwdWeight, Test2DDepthwise)
+{
+    this->split_k = 1;
+    this->conv_params.clear();
+    this->conv_params.push_back(
+        {2, 32, 4, 1, 1, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back(
+        {2, 64, 2, 1, 1, {3, 3}, {28, 28}, {2, 2}, {1, 1}, {1, 1}, {1, 1}});
+    this->conv_params.push_back(
+        {2, 48, 2, 1, 1, {5, 5}, {17, 17}, {1, 1}, {2, 2}, {4, 4}, {4, 4}});
+    this->template RunLayout<2,
+                             ck::tensor_layout::convolution::NHWGC,
+                             ck::tensor_layout::convolution::GKYXC,
+                             ck::tensor_layout::convolution::NHWGK>();
+}
+
 TYPED_TEST(TestGroupedConvndBwdWeight, Test3D)
 {
     this->conv_params.clear();
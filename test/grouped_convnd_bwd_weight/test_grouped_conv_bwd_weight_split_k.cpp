@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_bwd_weight_utils.hpp"
+
+using ck::tensor_operation::device::ConvBwdWeightSplitKHeuristic;
+
+namespace {
+
+// 128x128 tiles and K per block 32 on a device of 120 CUs, that is 240 blocks to fill
+ck::index_t GetSplitK(ck::index_t G, ck::index_t K, ck::index_t CYX, ck::index_t NHoWo)
+{
+    return ConvBwdWeightSplitKHeuristic::GetSplitK(G, K, CYX, NHoWo, 128, 128, 32, 120);
+}
+
+} // namespace
+
+TEST(ConvBwdWeightSplitK, WeightFillsDevice)
+{
+    // 8 * 36 tiles
+    EXPECT_EQ(GetSplitK(1, 1024, 512 * 9, 7 * 7 * 32), 1);
+
+    // 8 groups of 2 * 18 tiles
+    EXPECT_EQ(GetSplitK(8, 256, 256 * 9, 14 * 14 * 32), 1);
+}
+
+TEST(ConvBwdWeightSplitK, SplitToFillDevice)
+{
+    // 4 * 36 tiles need 2 splits, which keep 24 blocks of GEMM K each
+    EXPECT_EQ(GetSplitK(1, 512, 512 * 9, 7 * 7 * 32), 2);
+
+    // 5 tiles would need 48 splits
+    EXPECT_EQ(GetSplitK(1, 64, 64 * 9, 56 * 56 * 32), ConvBwdWeightSplitKHeuristic::MaxSplitK);
+}
+
+TEST(ConvBwdWeightSplitK, SplitKeepsKBlocksPerSplit)
+{
+    // 8 blocks of GEMM K
+    EXPECT_EQ(GetSplitK(1, 64, 64 * 9, 256), 2);
+
+    // 2 blocks of GEMM K
+    EXPECT_EQ(GetSplitK(1, 64, 64 * 9, 64), 1);
+}
+
+TEST(ConvBwdWeightSplitK, UnknownDevice)
+{
+    // no CU count, as from a failed device query, is handled as one CU
+    EXPECT_EQ(ConvBwdWeightSplitKHeuristic::GetSplitK(1, 64, 64 * 9, 56 * 56 * 32, 128, 128, 32, 0),
+              1);
+}
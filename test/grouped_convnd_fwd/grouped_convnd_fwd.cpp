@@ -268,3 +268,48 @@ TEST_F(TestGroupedConvNdFwd, GroupedConv2dFwdNHWGC)
         EXPECT_TRUE(pass);
     }
 }
+
+// 2d depthwise NHWGC/GKYXC/NHWGK, C = K = 1 per group
+TEST_F(TestGroupedConvNdFwd, GroupedConv2dFwdNHWGCDepthwise)
+{
+    conv_params.clear();
+    conv_params.push_back({2, 32, 4, 1, 1, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    conv_params.push_back({2, 64, 2, 1, 1, {3, 3}, {28, 28}, {2, 2}, {1, 1}, {1, 1}, {1, 1}});
+    conv_params.push_back({2, 48, 2, 1, 1, {5, 5}, {17, 17}, {1, 1}, {2, 2}, {4, 4}, {4, 4}});
+    conv_params.push_back({2, 24, 1, 1, 1, {3, 3}, {15, 15}, {2, 2}, {1, 1}, {0, 0}, {0, 0}});
+
+    for(auto& param : conv_params)
+    {
+        bool pass;
+
+        // fp32
+        pass = ck::profiler::profile_grouped_conv_fwd_impl<2,
+                                                           ck::tensor_layout::convolution::NHWGC,
+                                                           ck::tensor_layout::convolution::GKYXC,
+                                                           ck::tensor_layout::convolution::NHWGK,
+                                                           float,
+                                                           float,
+                                                           float>(true,  // do_verification
+                                                                  1,     // init_method
+                                                                  false, // do_log
+                                                                  false, // time_kernel
+                                                                  param);
+
+        EXPECT_TRUE(pass);
+
+        // fp16
+        pass = ck::profiler::profile_grouped_conv_fwd_impl<2,
+                                                           ck::tensor_layout::convolution::NHWGC,
+                                                           ck::tensor_layout::convolution::GKYXC,
+                                                           ck::tensor_layout::convolution::NHWGK,
+                                                           ck::half_t,
+                                                           ck::half_t,
+                                                           ck::half_t>(true,  // do_verification
+                                                                       1,     // init_method
+                                                                       false, // do_log
+                                                                       false, // time_kernel
+                                                                       param);
+
+        EXPECT_TRUE(pass);
+    }
+}
@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "profiler/profile_grouped_conv_fwd_bias_residual_quant_impl.hpp"
+
+class TestGroupedConvNdFwdBiasResidualQuant : public ::testing::Test
+{
+    protected:
+    std::vector<ck::utils::conv::ConvParam> conv_params;
+};
+
+// 1d NWGC/GKXC/NWGK
+TEST_F(TestGroupedConvNdFwdBiasResidualQuant, GroupedConv1dFwdNWGC)
+{
+    conv_params.clear();
+    conv_params.push_back({1, 2, 4, 64, 64, {1}, {14}, {2}, {1}, {0}, {0}});
+    conv_params.push_back({1, 2, 4, 64, 64, {3}, {28}, {1}, {1}, {1}, {1}});
+    conv_params.push_back({1, 2, 4, 64, 64, {1}, {3}, {1}, {1}, {0}, {0}});
+
+    for(auto& param : conv_params)
+    {
+        bool pass;
+
+        // int8
+        pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            1,
+            ck::tensor_layout::convolution::NWGC,
+            ck::tensor_layout::convolution::GKXC,
+            ck::tensor_layout::convolution::NWGK,
+            int8_t>(true,  // do_verification
+                    1,     // init_method
+                    false, // do_log
+                    false, // time_kernel
+                    param);
+
+        EXPECT_TRUE(pass);
+
+        // fp8
+        pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            1,
+            ck::tensor_layout::convolution::NWGC,
+            ck::tensor_layout::convolution::GKXC,
+            ck::tensor_layout::convolution::NWGK,
+            ck::f8_t>(true,  // do_verification
+                      1,     // init_method
+                      false, // do_log
+                      false, // time_kernel
+                      param);
+
+        EXPECT_TRUE(pass);
+    }
+}
+
+// 2d NHWGC/GKYXC/NHWGK
+TEST_F(TestGroupedConvNdFwdBiasResidualQuant, GroupedConv2dFwdNHWGC)
+{
+    conv_params.clear();
+    conv_params.push_back({2, 2, 4, 64, 64, {1, 1}, {7, 7}, {2, 2}, {1, 1}, {0, 0}, {0, 0}});
+    conv_params.push_back({2, 2, 4, 64, 64, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    conv_params.push_back({2, 2, 4, 64, 64, {1, 1}, {3, 3}, {1, 1}, {1, 1}, {0, 0}, {0, 0}});
+
+    for(auto& param : conv_params)
+    {
+        bool pass;
+
+        // int8
+        pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            2,
+            ck::tensor_layout::convolution::NHWGC,
+            ck::tensor_layout::convolution::GKYXC,
+            ck::tensor_layout::convolution::NHWGK,
+            int8_t>(true,  // do_verification
+                    1,     // init_method
+                    false, // do_log
+                    false, // time_kernel
+                    param);
+
+        EXPECT_TRUE(pass);
+
+        // fp8
+        pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            2,
+            ck::tensor_layout::convolution::NHWGC,
+            ck::tensor_layout::convolution::GKYXC,
+            ck::tensor_layout::convolution::NHWGK,
+            ck::f8_t>(true,  // do_verification
+                      1,     // init_method
+                      false, // do_log
+                      false, // time_kernel
+                      param);
+
+        EXPECT_TRUE(pass);
+    }
+}
+
+// 3d NDHWGC/GKZYXC/NDHWGK
+TEST_F(TestGroupedConvNdFwdBiasResidualQuant, GroupedConv3dFwdNDHWGC)
+{
+    conv_params.clear();
+    conv_params.push_back(
+        {3, 2, 4, 64, 64, {1, 1, 1}, {7, 7, 7}, {2, 2, 2}, {1, 1, 1}, {0, 0, 0}, {0, 0, 0}});
+    conv_params.push_back(
+        {3, 2, 4, 64, 64, {3, 3, 3}, {14, 14, 3}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}, {1, 1, 1}});
+    conv_params.push_back(
+        {3, 2, 4, 64, 64, {1, 1, 1}, {3, 3, 3}, {1, 1, 1}, {1, 1, 1}, {0, 0, 0}, {0, 0, 0}});
+
+    for(auto& param : conv_params)
+    {
+        bool pass;
+
+        // int8
+        pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            3,
+            ck::tensor_layout::convolution::NDHWGC,
+            ck::tensor_layout::convolution::GKZYXC,
+            ck::tensor_layout::convolution::NDHWGK,
+            int8_t>(true,  // do_verification
+                    1,     // init_method
+                    false, // do_log
+                    false, // time_kernel
+                    param);
+
+        EXPECT_TRUE(pass);
+
+        // fp8
+        pass = ck::profiler::profile_grouped_conv_fwd_bias_residual_quant_impl<
+            3,
+            ck::tensor_layout::convolution::NDHWGC,
+            ck::tensor_layout::convolution::GKZYXC,
+            ck::tensor_layout::convolution::NDHWGK,
+            ck::f8_t>(true,  // do_verification
+                      1,     // init_method
+                      false, // do_log
+                      false, // time_kernel
+                      param);
+
+        EXPECT_TRUE(pass);
+    }
+}
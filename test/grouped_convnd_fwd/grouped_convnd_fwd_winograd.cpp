@@ -0,0 +1,312 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_fwd_multiple_d_winograd_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_winograd.hpp"
+
+namespace {
+
+template <ck::index_t... Is>
+using S = ck::Sequence<Is...>;
+
+using InDataType       = ck::half_t;
+using WeiDataType      = ck::half_t;
+using AccDataType      = float;
+using CShuffleDataType = ck::half_t;
+using OutDataType      = ck::half_t;
+
+using InLayout  = ck::tensor_layout::convolution::NHWGC;
+using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+using OutLayout = ck::tensor_layout::convolution::NHWGK;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+static constexpr auto WinogradConvSpec =
+    ck::tensor_operation::device::ConvolutionForwardSpecialization::Filter3x3Stride1;
+
+static constexpr auto GemmSpec = ck::tensor_operation::device::GemmSpecialization::MNKPadding;
+
+template <ck::index_t OutputTileSize>
+using DeviceConvFwdInstance =
+    ck::tensor_operation::device::DeviceGroupedConvFwdMultipleD_Winograd_Xdl_CShuffle<
+        2,
+        InLayout,
+        WeiLayout,
+        ck::Tuple<>,
+        OutLayout,
+        InDataType,
+        WeiDataType,
+        AccDataType,
+        CShuffleDataType,
+        ck::Tuple<>,
+        OutDataType,
+        PassThrough,
+        PassThrough,
+        PassThrough,
+        WinogradConvSpec, // ConvForwardSpecialization
+        OutputTileSize,   // OutputTileSize
+        GemmSpec,         // GemmSpecialization
+        1,                //
+        256,              // BlockSize
+        128,              // MPerBlock
+        256,              // NPerBlock
+        16,               // KPerBlock
+        4,                // AK1
+        4,                // BK1
+        32,               // MPerXdl
+        32,               // NPerXdl
+        2,                // MXdlPerWave
+        4,                // NXdlPerWave
+        S<4, 64, 1>,      // ABlockTransferThreadClusterLengths_AK0_M_AK1
+        S<1, 0, 2>,       // ABlockTransferThreadClusterArrangeOrder
+        S<1, 0, 2>,       // ABlockTransferSrcAccessOrder
+        2,                // ABlockTransferSrcVectorDim
+        4,                // ABlockTransferSrcScalarPerVector
+        4,                // ABlockTransferDstScalarPerVector_AK1
+        1,                // ABlockLdsExtraM
+        S<4, 64, 1>,      // BBlockTransferThreadClusterLengths_BK0_N_BK1
+        S<1, 0, 2>,       // BBlockTransferThreadClusterArrangeOrder
+        S<1, 0, 2>,       // BBlockTransferSrcAccessOrder
+        2,                // BBlockTransferSrcVectorDim
+        4,                // BBlockTransferSrcScalarPerVector
+        4,                // BBlockTransferDstScalarPerVector_BK1
+        1,                // BBlockLdsExtraN
+        1,
+        1,
+        S<1, 16, 1, 16>,
+        4>;
+
+using RefConvFwd = ck::tensor_operation::host::ReferenceConvFwd<2,
+                                                                InDataType,
+                                                                WeiDataType,
+                                                                OutDataType,
+                                                                PassThrough,
+                                                                PassThrough,
+                                                                PassThrough>;
+
+template <ck::index_t OutputTileSize>
+using RefConvFwdWinograd = ck::tensor_operation::host::ReferenceConvFwdWinograd<InDataType,
+                                                                                WeiDataType,
+                                                                                OutDataType,
+                                                                                InDataType,
+                                                                                PassThrough,
+                                                                                PassThrough,
+                                                                                PassThrough,
+                                                                                OutputTileSize>;
+
+// returns false if the problem is not supported, the results are checked with EXPECT_TRUE
+template <ck::index_t OutputTileSize>
+bool RunGroupedConvFwdWinograd(const ck::utils::conv::ConvParam& conv_param)
+{
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    Tensor<InDataType> in(in_g_n_c_wis_desc);
+    Tensor<WeiDataType> wei(wei_g_k_c_xs_desc);
+    Tensor<OutDataType> out_host(out_g_n_k_wos_desc);
+    Tensor<OutDataType> out_host_winograd(out_g_n_k_wos_desc);
+    Tensor<OutDataType> out_device(out_g_n_k_wos_desc);
+
+    in.GenerateTensorValue(GeneratorTensor_3<InDataType>{0.0, 1.0});
+    wei.GenerateTensorValue(GeneratorTensor_3<WeiDataType>{-0.5, 0.5});
+
+    DeviceMem in_device_buf(sizeof(InDataType) * in.mDesc.GetElementSpaceSize());
+    DeviceMem wei_device_buf(sizeof(WeiDataType) * wei.mDesc.GetElementSpaceSize());
+    DeviceMem out_device_buf(sizeof(OutDataType) * out_device.mDesc.GetElementSpaceSize());
+
+    in_device_buf.ToDevice(in.mData.data());
+    wei_device_buf.ToDevice(wei.mData.data());
+
+    std::array<ck::index_t, 5> a_g_n_c_wis_lengths{};
+    std::array<ck::index_t, 5> a_g_n_c_wis_strides{};
+    std::array<ck::index_t, 5> b_g_k_c_xs_lengths{};
+    std::array<ck::index_t, 5> b_g_k_c_xs_strides{};
+    std::array<ck::index_t, 5> e_g_n_k_wos_lengths{};
+    std::array<ck::index_t, 5> e_g_n_k_wos_strides{};
+    std::array<ck::index_t, 2> conv_filter_strides{};
+    std::array<ck::index_t, 2> conv_filter_dilations{};
+    std::array<ck::index_t, 2> input_left_pads{};
+    std::array<ck::index_t, 2> input_right_pads{};
+
+    auto copy = [](const auto& x, auto& y) { ck::ranges::copy(x, y.begin()); };
+
+    copy(in_g_n_c_wis_desc.GetLengths(), a_g_n_c_wis_lengths);
+    copy(in_g_n_c_wis_desc.GetStrides(), a_g_n_c_wis_strides);
+    copy(wei_g_k_c_xs_desc.GetLengths(), b_g_k_c_xs_lengths);
+    copy(wei_g_k_c_xs_desc.GetStrides(), b_g_k_c_xs_strides);
+    copy(out_g_n_k_wos_desc.GetLengths(), e_g_n_k_wos_lengths);
+    copy(out_g_n_k_wos_desc.GetStrides(), e_g_n_k_wos_strides);
+    copy(conv_param.conv_filter_strides_, conv_filter_strides);
+    copy(conv_param.conv_filter_dilations_, conv_filter_dilations);
+    copy(conv_param.input_left_pads_, input_left_pads);
+    copy(conv_param.input_right_pads_, input_right_pads);
+
+    auto conv     = DeviceConvFwdInstance<OutputTileSize>{};
+    auto invoker  = conv.MakeInvoker();
+    auto argument = conv.MakeArgument(in_device_buf.GetDeviceBuffer(),
+                                      wei_device_buf.GetDeviceBuffer(),
+                                      std::array<const void*, 0>{},
+                                      out_device_buf.GetDeviceBuffer(),
+                                      a_g_n_c_wis_lengths,
+                                      a_g_n_c_wis_strides,
+                                      b_g_k_c_xs_lengths,
+                                      b_g_k_c_xs_strides,
+                                      std::array<std::array<ck::index_t, 5>, 0>{},
+                                      std::array<std::array<ck::index_t, 5>, 0>{},
+                                      e_g_n_k_wos_lengths,
+                                      e_g_n_k_wos_strides,
+                                      conv_filter_strides,
+                                      conv_filter_dilations,
+                                      input_left_pads,
+                                      input_right_pads,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+
+    DeviceMem workspace_device_buf(conv.GetWorkSpaceSize(&argument));
+
+    conv.SetWorkSpacePointer(&argument, workspace_device_buf.GetDeviceBuffer());
+
+    if(!conv.IsSupportedArgument(argument))
+    {
+        return false;
+    }
+
+    invoker.Run(argument, StreamConfig{nullptr, false});
+
+    out_device_buf.FromDevice(out_device.mData.data());
+
+    auto ref_winograd_argument =
+        RefConvFwdWinograd<OutputTileSize>::MakeArgument(in,
+                                                         wei,
+                                                         out_host_winograd,
+                                                         conv_param.conv_filter_strides_,
+                                                         conv_param.conv_filter_dilations_,
+                                                         conv_param.input_left_pads_,
+                                                         conv_param.input_right_pads_,
+                                                         PassThrough{},
+                                                         PassThrough{},
+                                                         PassThrough{});
+
+    RefConvFwdWinograd<OutputTileSize>::MakeInvoker().Run(ref_winograd_argument);
+
+    auto ref_argument = RefConvFwd{}.MakeArgument(in,
+                                                  wei,
+                                                  out_host,
+                                                  conv_param.conv_filter_strides_,
+                                                  conv_param.conv_filter_dilations_,
+                                                  conv_param.input_left_pads_,
+                                                  conv_param.input_right_pads_,
+                                                  PassThrough{},
+                                                  PassThrough{},
+                                                  PassThrough{});
+
+    RefConvFwd{}.MakeInvoker().Run(ref_argument);
+
+    double max_abs_out = 0;
+
+    for(const auto& v : out_host.mData)
+        max_abs_out = std::max(max_abs_out, std::abs(ck::type_convert<double>(v)));
+
+    // the Winograd reference rounds where the kernels do
+    EXPECT_TRUE(ck::utils::check_err(out_device,
+                                     out_host_winograd,
+                                     "Error: incorrect results (winograd)!",
+                                     1e-3,
+                                     1e-3 * max_abs_out));
+
+    // the direct convolution is matched up to the fp16 rounding of the transforms, which the
+    // output transform amplifies more for the larger tile
+    const double eps   = std::pow(2.0, -10);
+    const double bound = OutputTileSize == 2 ? 8 * eps : 64 * eps;
+
+    EXPECT_TRUE(ck::utils::check_err(out_device,
+                                     out_host,
+                                     "Error: incorrect results (direct)!",
+                                     bound,
+                                     bound * max_abs_out));
+
+    return true;
+}
+
+} // namespace
+
+template <typename Tuple>
+class TestGroupedConvNdFwdWinograd : public ::testing::Test
+{
+    protected:
+    static constexpr ck::index_t OutputTileSize = std::tuple_element_t<0, Tuple>::value;
+
+    std::vector<ck::utils::conv::ConvParam> conv_params;
+};
+
+using KernelTypes = ::testing::Types<std::tuple<std::integral_constant<ck::index_t, 2>>,
+                                     std::tuple<std::integral_constant<ck::index_t, 4>>>;
+
+TYPED_TEST_SUITE(TestGroupedConvNdFwdWinograd, KernelTypes);
+
+// 2d NHWGC/GKYXC/NHWGK
+TYPED_TEST(TestGroupedConvNdFwdWinograd, GroupedConv2dFwdNHWGC)
+{
+    auto& conv_params = this->conv_params;
+
+    conv_params.clear();
+    // output lengths multiple of both tile sizes
+    conv_params.push_back({2, 2, 4, 64, 64, {3, 3}, {16, 16}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    // output lengths that are no tile multiple, the last tiles are partial
+    conv_params.push_back({2, 2, 4, 64, 32, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+    conv_params.push_back({2, 1, 2, 32, 64, {3, 3}, {17, 9}, {1, 1}, {1, 1}, {0, 0}, {0, 0}});
+    // asymmetric padding, output smaller than one tile
+    conv_params.push_back({2, 2, 3, 16, 16, {3, 3}, {5, 3}, {1, 1}, {1, 1}, {2, 1}, {0, 1}});
+    // more than one GEMM tile along M (the tiles) and N (K)
+    conv_params.push_back({2, 1, 2, 320, 64, {3, 3}, {19, 19}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+
+    for(auto& param : conv_params)
+    {
+        EXPECT_TRUE(RunGroupedConvFwdWinograd<TestFixture::OutputTileSize>(param));
+    }
+}
+
+// the specialization rejects the convolutions Winograd does not compute
+TYPED_TEST(TestGroupedConvNdFwdWinograd, UnsupportedConv2dFwd)
+{
+    auto& conv_params = this->conv_params;
+
+    conv_params.clear();
+    conv_params.push_back({2, 1, 2, 16, 16, {3, 3}, {14, 14}, {2, 2}, {1, 1}, {1, 1}, {1, 1}});
+    conv_params.push_back({2, 1, 2, 16, 16, {3, 3}, {14, 14}, {1, 1}, {2, 2}, {1, 1}, {1, 1}});
+    conv_params.push_back({2, 1, 2, 16, 16, {1, 1}, {14, 14}, {1, 1}, {1, 1}, {0, 0}, {0, 0}});
+    conv_params.push_back({2, 1, 2, 16, 18, {3, 3}, {14, 14}, {1, 1}, {1, 1}, {1, 1}, {1, 1}});
+
+    for(auto& param : conv_params)
+    {
+        EXPECT_FALSE(RunGroupedConvFwdWinograd<TestFixture::OutputTileSize>(param));
+    }
+}
@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_grouped_conv_fwd_im2col_utils.hpp"
+
+using ck::index_t;
+using ck::tensor_operation::device::ConvFwdIm2ColChunkPlan;
+using ck::tensor_operation::device::GetMergedDimensionStride;
+using ck::tensor_operation::device::MakeConvFwdIm2ColChunkPlan;
+
+namespace {
+
+constexpr index_t G     = 2;
+constexpr index_t M     = 1000;
+constexpr index_t K     = 27;
+constexpr index_t Align = 64;
+
+// bytes of num_row rows of the f16 im2col matrix
+constexpr std::size_t RowBytes(std::size_t num_row) { return num_row * G * K * 2; }
+
+// the chunks cover [0, GemmM) in order and all but the last one are full and aligned
+void CheckChunks(const ConvFwdIm2ColChunkPlan& plan)
+{
+    index_t m = 0;
+
+    for(index_t chunk = 0; chunk < plan.NumChunk_; ++chunk)
+    {
+        EXPECT_EQ(plan.GetChunkBegin(chunk), m);
+        EXPECT_GT(plan.GetChunkSize(chunk), 0);
+
+        if(chunk + 1 < plan.NumChunk_)
+        {
+            EXPECT_EQ(plan.GetChunkSize(chunk), plan.MPerChunk_);
+            EXPECT_EQ(plan.MPerChunk_ % Align, 0);
+        }
+
+        m += plan.GetChunkSize(chunk);
+    }
+
+    EXPECT_EQ(m, plan.GemmM_);
+}
+
+} // namespace
+
+TEST(ConvFwdIm2ColChunkPlan, SingleChunk)
+{
+    const auto plan = MakeConvFwdIm2ColChunkPlan(G, M, K, 2, RowBytes(M), Align);
+
+    EXPECT_EQ(plan.NumChunk_, 1);
+    EXPECT_EQ(plan.MPerChunk_, M);
+    EXPECT_EQ(plan.GetChunkElementSize(), static_cast<std::size_t>(G) * M * K);
+    CheckChunks(plan);
+}
+
+TEST(ConvFwdIm2ColChunkPlan, EvenChunks)
+{
+    // 256 aligned rows fit in 300, hence 4 chunks of 250 rows, aligned to 256
+    const auto plan0 = MakeConvFwdIm2ColChunkPlan(G, M, K, 2, RowBytes(300), Align);
+
+    EXPECT_EQ(plan0.MPerChunk_, 256);
+    EXPECT_EQ(plan0.NumChunk_, 4);
+    CheckChunks(plan0);
+
+    // 448 rows fit in 500, which needs 3 chunks of 334 rows, aligned to 384
+    const auto plan1 = MakeConvFwdIm2ColChunkPlan(G, M, K, 2, RowBytes(500), Align);
+
+    EXPECT_EQ(plan1.MPerChunk_, 384);
+    EXPECT_EQ(plan1.NumChunk_, 3);
+    EXPECT_LE(plan1.GetChunkElementSize() * 2, RowBytes(500));
+    CheckChunks(plan1);
+}
+
+TEST(ConvFwdIm2ColChunkPlan, BudgetBelowAlignment)
+{
+    const auto plan = MakeConvFwdIm2ColChunkPlan(G, M, K, 2, RowBytes(10), Align);
+
+    EXPECT_EQ(plan.MPerChunk_, Align);
+    EXPECT_EQ(plan.NumChunk_, 16);
+    CheckChunks(plan);
+}
+
+TEST(ConvFwdIm2ColChunkPlan, MergedDimensionStride)
+{
+    // K, C, Y, X of a KYXC weight with C = 4, Y = 3, X = 2
+    const std::array<index_t, 4> lengths{8, 4, 3, 2};
+    const std::array<index_t, 4> strides{24, 1, 8, 4};
+
+    // (Y, X, C) merges into GemmK, (C, Y, X) does not
+    EXPECT_EQ(GetMergedDimensionStride(lengths, strides, std::array<index_t, 3>{2, 3, 1}), 1);
+    EXPECT_EQ(GetMergedDimensionStride(lengths, strides, std::array<index_t, 3>{1, 2, 3}), -1);
+    EXPECT_EQ(GetMergedDimensionStride(lengths, strides, std::array<index_t, 2>{0, 2}), 8);
+
+    // dimensions of length 1 do not break the merge
+    const std::array<index_t, 4> lengths1{8, 4, 1, 1};
+    const std::array<index_t, 4> strides1{4, 1, 100, 200};
+
+    EXPECT_EQ(GetMergedDimensionStride(lengths1, strides1, std::array<index_t, 3>{2, 3, 1}), 1);
+    EXPECT_EQ(GetMergedDimensionStride(lengths1, strides1, std::array<index_t, 2>{2, 3}), 200);
+}
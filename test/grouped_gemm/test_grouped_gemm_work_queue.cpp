@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <numeric>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/grid/grouped_gemm_work_queue.hpp"
+
+using namespace ck;
+
+namespace {
+
+// ItemEnd of the groups in queue order
+std::vector<index_t> MakeItemEnds(const std::vector<index_t>& tile_counts,
+                                  const std::vector<index_t>& order)
+{
+    std::vector<index_t> item_ends;
+
+    index_t item_end = 0;
+
+    for(const index_t g : order)
+    {
+        item_end += tile_counts[g];
+
+        item_ends.push_back(item_end);
+    }
+
+    return item_ends;
+}
+
+} // namespace
+
+TEST(GroupedGemmWorkQueue, LargestFirstOrder)
+{
+    const std::vector<long_index_t> group_costs{4, 16, 4, 1, 16, 8};
+
+    EXPECT_EQ(MakeLargestFirstGroupOrder(group_costs), (std::vector<index_t>{1, 4, 5, 0, 2, 3}));
+
+    EXPECT_TRUE(MakeLargestFirstGroupOrder({}).empty());
+}
+
+TEST(GroupedGemmWorkQueue, EveryTileOnce)
+{
+    // includes a group without tiles, which the search must step over
+    const std::vector<index_t> tile_counts{3, 1, 7, 0, 2, 12, 1, 5};
+    const std::vector<long_index_t> group_costs{3, 1, 7, 0, 2, 12, 1, 5};
+
+    const auto order     = MakeLargestFirstGroupOrder(group_costs);
+    const auto item_ends = MakeItemEnds(tile_counts, order);
+
+    const index_t group_count = order.size();
+    const index_t item_count  = item_ends.back();
+
+    const auto get_item_end = [&](index_t g) { return item_ends[g]; };
+
+    for(const index_t num_workgroups : {1, 3, 4, 64})
+    {
+        std::vector<index_t> workgroup_of_item;
+
+        SimulatePersistentWorkQueue(
+            item_count, num_workgroups, [](index_t) { return 1; }, &workgroup_of_item);
+
+        std::vector<index_t> cursors(num_workgroups, 0);
+        std::vector<index_t> tiles_done(group_count, 0);
+
+        // the items in the order they are popped, each workgroup keeping its own cursor
+        for(index_t item = 0; item < item_count; ++item)
+        {
+            const index_t w = workgroup_of_item[item];
+
+            ASSERT_GE(w, 0);
+            ASSERT_LT(w, num_workgroups);
+
+            cursors[w] = FindWorkItemGroup(get_item_end, group_count, item, cursors[w]);
+
+            // brute force
+            index_t expected = 0;
+
+            while(item >= item_ends[expected])
+            {
+                ++expected;
+            }
+
+            EXPECT_EQ(cursors[w], expected) << "item " << item << ", " << num_workgroups;
+
+            ++tiles_done[cursors[w]];
+        }
+
+        for(index_t g = 0; g < group_count; ++g)
+        {
+            EXPECT_EQ(tiles_done[g], tile_counts[order[g]]);
+        }
+    }
+}
+
+TEST(GroupedGemmWorkQueue, LargestFirstBalancesSkewedGroups)
+{
+    // 64 cheap groups of one tile, then a group of 4 tiles with a 16 times larger K
+    std::vector<index_t> tile_counts(64, 1);
+    std::vector<long_index_t> group_costs(64, 1);
+
+    tile_counts.push_back(4);
+    group_costs.push_back(4 * 16);
+
+    const index_t num_workgroups = 8;
+
+    const auto makespan = [&](const std::vector<index_t>& order) {
+        const auto item_ends = MakeItemEnds(tile_counts, order);
+
+        const index_t group_count = order.size();
+
+        index_t group = 0;
+
+        return SimulatePersistentWorkQueue(item_ends.back(), num_workgroups, [&](index_t item) {
+            group = FindWorkItemGroup(
+                [&](index_t g) { return item_ends[g]; }, group_count, item, group);
+
+            return group_costs[order[group]] / tile_counts[order[group]];
+        });
+    };
+
+    std::vector<index_t> original_order(tile_counts.size());
+
+    std::iota(original_order.begin(), original_order.end(), 0);
+
+    // the large tiles go last and run alone: 64 / 8 + 16
+    EXPECT_EQ(makespan(original_order), 24);
+
+    // the large tiles go first and the small ones fill in around them
+    EXPECT_EQ(makespan(MakeLargestFirstGroupOrder(group_costs)), 16);
+}
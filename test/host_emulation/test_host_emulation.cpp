@@ -0,0 +1,253 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+// built with CK_HOST_EMULATION=1, the kernels run on the CPU
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_gemm_xdl_cshuffle.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/host_utility/host_emulation_trace.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+using namespace ck;
+
+namespace {
+
+using F16 = half_t;
+using F32 = float;
+
+using Row = tensor_layout::gemm::RowMajor;
+using Col = tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = tensor_operation::element_wise::PassThrough;
+
+template <index_t... Is>
+using S = Sequence<Is...>;
+
+constexpr auto GemmDefault = tensor_operation::device::GemmSpecialization::Default;
+
+// clang-format off
+using DeviceGemmInstance = tensor_operation::device::DeviceGemm_Xdl_CShuffle<
+    Row, Col, Row, F16, F16, F16, F32, F16, PassThrough, PassThrough, PassThrough, GemmDefault,
+    1, 256, 128, 128, 32, 8, 8, 32, 32, 2, 2,
+    S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1,
+    S<4, 64, 1>, S<1, 0, 2>, S<1, 0, 2>, 2, 8, 8, 1,
+    1, 1, S<1, 32, 1, 8>, 8>;
+// clang-format on
+
+using ReferenceGemmInstance = tensor_operation::host::
+    ReferenceGemm<F16, F16, F16, F32, PassThrough, PassThrough, PassThrough>;
+
+constexpr index_t BlockSize = 256;
+
+// every thread writes its id to LDS and reads the one of its neighbor
+__global__ void kernel_rotate_lds(index_t* p_out)
+{
+    __shared__ index_t lds[BlockSize];
+
+    const index_t tid = get_thread_local_1d_id();
+
+    lds[tid] = get_block_1d_id() * BlockSize + tid;
+
+    block_sync_lds();
+
+    p_out[get_block_1d_id() * BlockSize + tid] = lds[(tid + 1) % BlockSize];
+}
+
+// one float per thread of global memory, read at index thread_id * stride
+__global__ void kernel_strided_global_read(const float* p_in, float* p_out, index_t stride)
+{
+    const index_t tid = get_thread_local_1d_id();
+
+    const auto in_buf = make_dynamic_buffer<AddressSpaceEnum::Global>(p_in, BlockSize * stride);
+
+    p_out[tid] = in_buf.template Get<float>(tid * stride, true);
+}
+
+// one float per thread of LDS, written at index thread_id * stride
+__global__ void kernel_strided_lds_write(index_t stride)
+{
+    __shared__ float lds[BlockSize * 32];
+
+    const index_t tid = get_thread_local_1d_id();
+
+    auto lds_buf = make_dynamic_buffer<AddressSpaceEnum::Lds>(lds, BlockSize * 32);
+
+    lds_buf.template Set<float>(tid * stride, true, 1.f);
+}
+
+} // namespace
+
+TEST(HostEmulation, LdsAndBarrier)
+{
+    const index_t grid_size = 3;
+
+    std::vector<index_t> out(grid_size * BlockSize, -1);
+
+    host_emulation::launch_kernel(
+        grid_size, 1, 1, BlockSize, 1, 1, kernel_rotate_lds, out.data());
+
+    for(index_t b = 0; b < grid_size; ++b)
+    {
+        for(index_t t = 0; t < BlockSize; ++t)
+        {
+            EXPECT_EQ(out[b * BlockSize + t], b * BlockSize + (t + 1) % BlockSize);
+        }
+    }
+}
+
+TEST(HostEmulation, GemmXdlCShuffle)
+{
+    const index_t M = 256;
+    const index_t N = 128;
+    const index_t K = 64;
+
+    Tensor<F16> a_m_k(HostTensorDescriptor({M, K}, {K, 1}));
+    Tensor<F16> b_k_n(HostTensorDescriptor({K, N}, {1, K}));
+    Tensor<F16> c_m_n(HostTensorDescriptor({M, N}, {N, 1}));
+    Tensor<F16> c_m_n_ref(HostTensorDescriptor({M, N}, {N, 1}));
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<F16>{-5, 5});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<F16>{-5, 5});
+
+    // the kernel reads and writes host memory
+    auto gemm     = DeviceGemmInstance{};
+    auto invoker  = gemm.MakeInvoker();
+    auto argument = gemm.MakeArgument(a_m_k.mData.data(),
+                                      b_k_n.mData.data(),
+                                      c_m_n.mData.data(),
+                                      M,
+                                      N,
+                                      K,
+                                      K,
+                                      K,
+                                      N,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      PassThrough{});
+
+    invoker.Run(argument, StreamConfig{nullptr, false});
+
+    auto ref_invoker  = ReferenceGemmInstance{}.MakeInvoker();
+    auto ref_argument = ReferenceGemmInstance{}.MakeArgument(
+        a_m_k, b_k_n, c_m_n_ref, PassThrough{}, PassThrough{}, PassThrough{});
+
+    ref_invoker.Run(ref_argument);
+
+    EXPECT_TRUE(utils::check_err(c_m_n, c_m_n_ref));
+}
+
+TEST(HostEmulation, GlobalMemoryCoalescing)
+{
+    const auto analyze = [](index_t stride) {
+        std::vector<float> in(BlockSize * stride, 1.f);
+        std::vector<float> out(BlockSize);
+
+        host_emulation::MemoryAccessTrace trace;
+
+        host_emulation::memory_access_trace = &trace;
+
+        host_emulation::launch_kernel(
+            1, 1, 1, BlockSize, 1, 1, kernel_strided_global_read, in.data(), out.data(), stride);
+
+        host_emulation::memory_access_trace = nullptr;
+
+        return host_emulation::AnalyzeGlobalMemoryCoalescing(trace.accesses_, 64);
+    };
+
+    // 4 waves of 64 lanes reading 256 bytes each
+    const auto coalesced = analyze(1);
+    const auto strided   = analyze(32);
+
+    EXPECT_EQ(coalesced.num_requests_, 4u);
+    EXPECT_EQ(coalesced.num_transactions_, 4u * 4u);
+    EXPECT_EQ(coalesced.num_min_transactions_, 4u * 4u);
+
+    EXPECT_EQ(strided.num_requests_, 4u);
+    EXPECT_EQ(strided.num_transactions_, 4u * 64u);
+    EXPECT_EQ(strided.num_min_transactions_, 4u * 4u);
+}
+
+TEST(HostEmulation, LdsBankConflicts)
+{
+    const auto analyze = [](index_t stride) {
+        host_emulation::MemoryAccessTrace trace;
+
+        host_emulation::memory_access_trace = &trace;
+
+        host_emulation::launch_kernel(1, 1, 1, BlockSize, 1, 1, kernel_strided_lds_write, stride);
+
+        host_emulation::memory_access_trace = nullptr;
+
+        return host_emulation::AnalyzeLdsBankConflicts(trace.accesses_, 32, 4);
+    };
+
+    // 64 words per wave: 2 per bank without conflicts, all in the same bank with a stride of 32
+    const auto linear  = analyze(1);
+    const auto strided = analyze(32);
+
+    EXPECT_EQ(linear.num_requests_, 4u);
+    EXPECT_EQ(linear.num_cycles_, 4u * 2u);
+    EXPECT_EQ(linear.num_min_cycles_, 4u * 2u);
+
+    EXPECT_EQ(strided.num_requests_, 4u);
+    EXPECT_EQ(strided.num_cycles_, 4u * 64u);
+    EXPECT_EQ(strided.num_min_cycles_, 4u * 2u);
+}
+
+TEST(HostEmulation, LdsBankConflictsUnaligned)
+{
+    // one request of a wave, lane i accessing num_bytes at offset + i * stride
+    const auto analyze = [](uintptr_t offset, uint32_t num_bytes, uintptr_t stride) {
+        std::vector<host_emulation::MemoryAccess> accesses;
+
+        for(int lane = 0; lane < warpSize; ++lane)
+        {
+            accesses.push_back(host_emulation::MemoryAccess{host_emulation::MemorySpace::Lds,
+                                                            0,
+                                                            lane,
+                                                            0,
+                                                            offset + lane * stride,
+                                                            num_bytes,
+                                                            true});
+        }
+
+        return host_emulation::AnalyzeLdsBankConflicts(accesses, 32, 4);
+    };
+
+    // 64 words, 2 per bank
+    const auto aligned = analyze(0, 4, 4);
+
+    EXPECT_EQ(aligned.num_requests_, 1u);
+    EXPECT_EQ(aligned.num_cycles_, 2u);
+    EXPECT_EQ(aligned.num_min_cycles_, 2u);
+
+    // every float straddles two words: 65 words, 3 in bank 0
+    const auto straddling = analyze(2, 4, 4);
+
+    EXPECT_EQ(straddling.num_cycles_, 3u);
+    EXPECT_EQ(straddling.num_min_cycles_, 3u);
+
+    // a 2-byte access at byte 3 of a word ends in the next one: 128 words, 4 per bank
+    const auto half = analyze(3, 2, 8);
+
+    EXPECT_EQ(half.num_cycles_, 4u);
+    EXPECT_EQ(half.num_min_cycles_, 4u);
+
+    // 8 bytes from byte 2 of a word touch 3 words, 2 with an aligned access: 192 words against
+    // 128, 6 per bank against 4
+    const auto wide_unaligned = analyze(2, 8, 12);
+    const auto wide_aligned   = analyze(0, 8, 12);
+
+    EXPECT_EQ(wide_unaligned.num_cycles_, 6u);
+    EXPECT_EQ(wide_aligned.num_cycles_, 4u);
+}
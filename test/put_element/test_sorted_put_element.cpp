@@ -0,0 +1,179 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_sorted_put_element_impl.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_put_element.hpp"
+
+namespace {
+
+using XDataType     = float;
+using YDataType     = float;
+using IndexDataType = int32_t;
+
+using YElementwiseOp = ck::tensor_operation::element_wise::PassThrough;
+
+using ck::InMemoryDataOperationEnum;
+
+// a tile is BlockSize * ThreadTileSize = 256 elements, so that short runs already cross tiles
+constexpr ck::index_t BlockSize      = 64;
+constexpr ck::index_t ThreadTileSize = 4;
+constexpr ck::index_t TileSize       = BlockSize * ThreadTileSize;
+
+template <InMemoryDataOperationEnum MemOp, bool IndicesSorted>
+bool RunSortedPutElement(const std::vector<IndexDataType>& index_values, int M)
+{
+    using DeviceInstance = ck::tensor_operation::device::DeviceSortedPutElementImpl<XDataType,
+                                                                                    IndexDataType,
+                                                                                    YDataType,
+                                                                                    YElementwiseOp,
+                                                                                    MemOp,
+                                                                                    BlockSize,
+                                                                                    ThreadTileSize,
+                                                                                    IndicesSorted>;
+    using ReferenceInstance = ck::tensor_operation::host::
+        ReferencePutElement<XDataType, IndexDataType, YDataType, YElementwiseOp, MemOp>;
+
+    const int N = static_cast<int>(index_values.size());
+
+    Tensor<XDataType> x(HostTensorDescriptor{N, 1});
+    Tensor<IndexDataType> indices(HostTensorDescriptor{N, 1});
+    Tensor<YDataType> y_host(HostTensorDescriptor{M, 1});
+    Tensor<YDataType> y_device(HostTensorDescriptor{M, 1});
+
+    // integer values, so that the sums do not depend on the order of the additions
+    x.GenerateTensorValue(GeneratorTensor_2<XDataType>{-5, 5});
+    y_host.GenerateTensorValue(GeneratorTensor_2<YDataType>{-5, 5});
+    std::copy(index_values.begin(), index_values.end(), indices.mData.begin());
+
+    DeviceMem x_device_buf(sizeof(XDataType) * x.mDesc.GetElementSpaceSize());
+    DeviceMem y_device_buf(sizeof(YDataType) * y_device.mDesc.GetElementSpaceSize());
+    DeviceMem indices_device_buf(sizeof(IndexDataType) * indices.mDesc.GetElementSpaceSize());
+
+    x_device_buf.ToDevice(x.mData.data());
+    indices_device_buf.ToDevice(indices.mData.data());
+    y_device_buf.ToDevice(y_host.mData.data());
+
+    auto ref_argument = ReferenceInstance::MakeArgument(x, indices, y_host, YElementwiseOp{});
+    ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+    auto put_instance     = DeviceInstance{};
+    auto put_invoker_ptr  = put_instance.MakeInvokerPointer();
+    auto put_argument_ptr = put_instance.MakeArgumentPointer(x_device_buf.GetDeviceBuffer(),
+                                                             indices_device_buf.GetDeviceBuffer(),
+                                                             y_device_buf.GetDeviceBuffer(),
+                                                             N,
+                                                             M,
+                                                             YElementwiseOp{});
+
+    if(!put_instance.IsSupportedArgument(put_argument_ptr.get()))
+    {
+        return false;
+    }
+
+    put_invoker_ptr->Run(put_argument_ptr.get(), StreamConfig{nullptr, false});
+
+    y_device_buf.FromDevice(y_device.mData.data());
+
+    return ck::utils::check_err(y_device, y_host, "Error: Incorrect results!", 0, 0);
+}
+
+// a single index for every element, i.e. one run over several tiles
+std::vector<IndexDataType> MakeSingleRunIndices(int N, IndexDataType index)
+{
+    return std::vector<IndexDataType>(N, index);
+}
+
+// sorted runs of run_length equal indices, which cross the tile boundaries
+std::vector<IndexDataType> MakeSortedRunIndices(int N, int run_length)
+{
+    std::vector<IndexDataType> indices(N);
+
+    for(int i = 0; i < N; ++i)
+        indices[i] = i / run_length;
+
+    return indices;
+}
+
+// few distinct indices in random order, with some negative ones that are skipped
+std::vector<IndexDataType> MakeRandomIndices(int N, int M, bool sorted)
+{
+    std::mt19937 gen(11939);
+    std::uniform_int_distribution<IndexDataType> dis(-1, M - 1);
+
+    std::vector<IndexDataType> indices(N);
+
+    for(auto& index : indices)
+        index = dis(gen);
+
+    if(sorted)
+        std::sort(indices.begin(), indices.end());
+
+    return indices;
+}
+
+} // namespace
+
+template <typename Tuple>
+class TestSortedPutElement : public ::testing::Test
+{
+    protected:
+    static constexpr auto MemOp         = std::tuple_element_t<0, Tuple>::value;
+    static constexpr bool IndicesSorted = std::tuple_element_t<1, Tuple>::value;
+
+    void Run(const std::vector<IndexDataType>& indices, int M)
+    {
+        EXPECT_TRUE((RunSortedPutElement<MemOp, IndicesSorted>(indices, M)));
+    }
+};
+
+template <InMemoryDataOperationEnum MemOp>
+using MemOpConstant = std::integral_constant<InMemoryDataOperationEnum, MemOp>;
+
+using KernelTypes =
+    ::testing::Types<std::tuple<MemOpConstant<InMemoryDataOperationEnum::AtomicAdd>,
+                                std::false_type>,
+                     std::tuple<MemOpConstant<InMemoryDataOperationEnum::AtomicAdd>,
+                                std::true_type>,
+                     std::tuple<MemOpConstant<InMemoryDataOperationEnum::AtomicMax>,
+                                std::false_type>,
+                     std::tuple<MemOpConstant<InMemoryDataOperationEnum::AtomicMax>,
+                                std::true_type>>;
+
+TYPED_TEST_SUITE(TestSortedPutElement, KernelTypes);
+
+TYPED_TEST(TestSortedPutElement, SingleRun)
+{
+    this->Run(MakeSingleRunIndices(4 * TileSize + 3, 5), 16);
+}
+
+TYPED_TEST(TestSortedPutElement, RunsCrossingTiles)
+{
+    this->Run(MakeSortedRunIndices(8 * TileSize, TileSize + 44), 16);
+    this->Run(MakeSortedRunIndices(3 * TileSize + 17, 7), 3 * TileSize);
+}
+
+TYPED_TEST(TestSortedPutElement, RandomDuplicates)
+{
+    this->Run(MakeRandomIndices(5 * TileSize + 9, 8, this->IndicesSorted), 8);
+    this->Run(MakeRandomIndices(16 * TileSize, 1000, this->IndicesSorted), 1000);
+}
+
+TYPED_TEST(TestSortedPutElement, PartialTile)
+{
+    this->Run(MakeRandomIndices(1, 4, this->IndicesSorted), 4);
+    this->Run(MakeRandomIndices(TileSize - 1, 4, this->IndicesSorted), 4);
+}
@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <tuple>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/utility/reduction_enums.hpp"
+#include "ck/tensor_operation/gpu/device/impl/device_segmented_reduce_impl.hpp"
+#include "ck/tensor_operation/gpu/device/reduction_operator_mapping.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_segmented_reduce.hpp"
+
+using ck::index_t;
+
+template <typename Tuple>
+class TestReduceSegmented : public ::testing::Test
+{
+    protected:
+    using InDataType                               = std::tuple_element_t<0, Tuple>;
+    using AccDataType                              = std::tuple_element_t<1, Tuple>;
+    using OutDataType                              = std::tuple_element_t<2, Tuple>;
+    static constexpr ck::ReduceTensorOp ReduceOpId = std::tuple_element_t<3, Tuple>::value;
+
+    using ReduceOperation = typename ck::reduce_binary_operator<ReduceOpId>::opType;
+    using InElementwiseOperation =
+        typename ck::reduce_unary_operator<ReduceOpId, true, true>::InElementwiseOperation;
+    using AccElementwiseOperation =
+        typename ck::reduce_unary_operator<ReduceOpId, true, true>::AccElementwiseOperation;
+
+    // a block tile is 128 inner elements by 32 rows of a segment
+    using DeviceInstance =
+        ck::tensor_operation::device::DeviceSegmentedReduceImpl<InDataType,
+                                                                AccDataType,
+                                                                OutDataType,
+                                                                ReduceOperation,
+                                                                InElementwiseOperation,
+                                                                AccElementwiseOperation,
+                                                                false, // PropagateNan
+                                                                256,   // BlockSize
+                                                                32,    // MThreadClusterSize
+                                                                8,     // KThreadClusterSize
+                                                                4,     // MThreadSliceSize
+                                                                4,     // KThreadSliceSize
+                                                                4,     // InSrcVectorSize
+                                                                4>;    // OutDstVectorSize
+
+    using ReferenceInstance =
+        ck::tensor_operation::host::ReferenceSegmentedReduce<InDataType,
+                                                             AccDataType,
+                                                             OutDataType,
+                                                             ReduceOperation,
+                                                             InElementwiseOperation,
+                                                             AccElementwiseOperation,
+                                                             false>;
+
+    void Run(const std::vector<index_t>& segment_lengths,
+             index_t inner_length,
+             double alpha = 1.0,
+             double beta  = 0.0)
+    {
+        const index_t num_segments = static_cast<index_t>(segment_lengths.size());
+
+        std::vector<index_t> offsets(num_segments + 1, 0);
+        for(index_t i = 0; i < num_segments; ++i)
+            offsets[i + 1] = offsets[i] + segment_lengths[i];
+
+        Tensor<InDataType> in(HostTensorDescriptor{offsets.back(), inner_length});
+        Tensor<OutDataType> out_ref(HostTensorDescriptor{num_segments, inner_length});
+        Tensor<OutDataType> out(HostTensorDescriptor{num_segments, inner_length});
+
+        // integer values, so that the sums do not depend on the order of the additions
+        in.GenerateTensorValue(GeneratorTensor_2<InDataType>{-5, 5});
+        out_ref.GenerateTensorValue(GeneratorTensor_2<OutDataType>{-5, 5});
+        out = out_ref;
+
+        DeviceMem in_dev(sizeof(InDataType) * in.mDesc.GetElementSpaceSize());
+        DeviceMem offsets_dev(sizeof(index_t) * offsets.size());
+        DeviceMem out_dev(sizeof(OutDataType) * out.mDesc.GetElementSpaceSize());
+
+        in_dev.ToDevice(in.mData.data());
+        offsets_dev.ToDevice(offsets.data());
+        out_dev.ToDevice(out.mData.data());
+
+        auto device_instance = DeviceInstance{};
+        auto argument_ptr    = device_instance.MakeArgumentPointer(
+            num_segments,
+            inner_length,
+            static_cast<const index_t*>(offsets_dev.GetDeviceBuffer()),
+            alpha,
+            beta,
+            in_dev.GetDeviceBuffer(),
+            out_dev.GetDeviceBuffer(),
+            InElementwiseOperation{},
+            AccElementwiseOperation{1});
+
+        ASSERT_TRUE(device_instance.IsSupportedArgument(argument_ptr.get()));
+
+        device_instance.MakeInvokerPointer()->Run(argument_ptr.get(), StreamConfig{nullptr, false});
+
+        auto ref_argument = ReferenceInstance::MakeArgument(in,
+                                                            offsets,
+                                                            out_ref,
+                                                            alpha,
+                                                            beta,
+                                                            InElementwiseOperation{},
+                                                            AccElementwiseOperation{1});
+
+        ReferenceInstance::MakeInvoker().Run(ref_argument);
+
+        out_dev.FromDevice(out.mData.data());
+
+        EXPECT_TRUE(ck::utils::check_err(out, out_ref));
+    }
+};
+
+template <ck::ReduceTensorOp ReduceOpId>
+using ReduceOpConstant = std::integral_constant<ck::ReduceTensorOp, ReduceOpId>;
+
+using KernelTypes =
+    ::testing::Types<std::tuple<float, float, float, ReduceOpConstant<ck::ReduceTensorOp::ADD>>,
+                     std::tuple<float, float, float, ReduceOpConstant<ck::ReduceTensorOp::AVG>>,
+                     std::tuple<float, float, float, ReduceOpConstant<ck::ReduceTensorOp::MAX>>,
+                     std::tuple<ck::half_t,
+                                float,
+                                ck::half_t,
+                                ReduceOpConstant<ck::ReduceTensorOp::ADD>>>;
+
+TYPED_TEST_SUITE(TestReduceSegmented, KernelTypes);
+
+TYPED_TEST(TestReduceSegmented, EmptySegments)
+{
+    // the output of an empty segment is the identity value
+    this->Run({0, 5, 0, 0, 17, 0}, 128);
+    this->Run({0, 0, 0}, 64);
+}
+
+TYPED_TEST(TestReduceSegmented, SingleSegment)
+{
+    this->Run({1}, 256);
+    this->Run({29}, 128);
+    this->Run({1000}, 64);
+    this->Run({45}, 64, 2.0, 0.5);
+}
+
+TYPED_TEST(TestReduceSegmented, SegmentsLongerThanOneBlockTile)
+{
+    this->Run({33, 64, 95, 1, 300, 0, 513}, 200);
+    this->Run({257, 31, 32, 129}, 1028, 2.0, 0.5);
+}
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_multiple_d.hpp"
+
+namespace {
+
+using PassThrough  = ck::tensor_operation::element_wise::PassThrough;
+using Relu         = ck::tensor_operation::element_wise::Relu;
+using OutElementOp = ck::tensor_operation::element_wise::Add_Mul2_Add_Activation_Clamp<Relu>;
+
+// bias + per-channel requantization + residual add + relu on an int8 conv, computed by
+// ReferenceConvFwdMultipleD in one pass and by ReferenceConvFwd followed by the epilogue
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename OutDataType>
+void TestConvFwdResidualQuantization(const ck::utils::conv::ConvParam& conv_param)
+{
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    // [G, K] broadcast over N and the output pixels
+    std::vector<std::size_t> g_k_lengths{static_cast<std::size_t>(conv_param.G_),
+                                         static_cast<std::size_t>(conv_param.N_),
+                                         static_cast<std::size_t>(conv_param.K_)};
+    std::vector<std::size_t> g_k_strides{static_cast<std::size_t>(conv_param.K_), 0, 1};
+
+    for(ck::index_t i = 0; i < NDimSpatial; ++i)
+    {
+        g_k_lengths.push_back(conv_param.output_spatial_lengths_[i]);
+        g_k_strides.push_back(0);
+    }
+
+    const auto g_k_desc = HostTensorDescriptor(g_k_lengths, g_k_strides);
+
+    Tensor<int8_t> input(in_g_n_c_wis_desc);
+    Tensor<int8_t> weight(wei_g_k_c_xs_desc);
+    Tensor<int32_t> bias(g_k_desc);
+    Tensor<float> requant_scale(g_k_desc);
+    Tensor<OutDataType> residual(out_g_n_k_wos_desc);
+    Tensor<int32_t> acc(out_g_n_k_wos_desc);
+    Tensor<OutDataType> ref_output(out_g_n_k_wos_desc);
+    Tensor<OutDataType> output(out_g_n_k_wos_desc);
+
+    input.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    weight.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    bias.GenerateTensorValue(GeneratorTensor_2<int32_t>{-1024, 1024});
+    requant_scale.GenerateTensorValue(GeneratorTensor_3<float>{0.f, 0.001f});
+
+    if constexpr(std::is_same_v<OutDataType, int8_t>)
+    {
+        residual.GenerateTensorValue(GeneratorTensor_2<int8_t>{-128, 127});
+    }
+    else
+    {
+        residual.ForEach([](auto& self, auto idx) {
+            self(idx) = ck::type_convert<OutDataType>(static_cast<float>(std::rand() % 64 - 32));
+        });
+    }
+
+    const auto out_element_op = OutElementOp{0.5f, Relu{}};
+
+    auto ref_conv = ck::tensor_operation::host::ReferenceConvFwd<NDimSpatial,
+                                                                 int8_t,
+                                                                 int8_t,
+                                                                 int32_t,
+                                                                 PassThrough,
+                                                                 PassThrough,
+                                                                 PassThrough>{};
+
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weight,
+                                              acc,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{});
+
+    ref_invoker.Run(ref_argument);
+
+    ref_output.ForEach([&](auto& self, auto idx) {
+        out_element_op(self(idx), acc(idx), bias(idx), requant_scale(idx), residual(idx));
+    });
+
+    auto conv = ck::tensor_operation::host::ReferenceConvFwdMultipleD<
+        NDimSpatial,
+        int8_t,
+        int8_t,
+        ck::Tuple<int32_t, float, OutDataType>,
+        OutDataType,
+        int32_t,
+        PassThrough,
+        PassThrough,
+        OutElementOp>{};
+
+    auto invoker  = conv.MakeInvoker();
+    auto argument = conv.MakeArgument(input,
+                                      weight,
+                                      {bias, requant_scale, residual},
+                                      output,
+                                      conv_param.conv_filter_strides_,
+                                      conv_param.conv_filter_dilations_,
+                                      conv_param.input_left_pads_,
+                                      conv_param.input_right_pads_,
+                                      PassThrough{},
+                                      PassThrough{},
+                                      out_element_op);
+
+    invoker.Run(argument);
+
+    EXPECT_EQ(output.mData, ref_output.mData);
+}
+
+} // anonymous namespace
+
+TEST(ReferenceConvFwdMultipleD, ResidualQuantizationInt8)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    TestConvFwdResidualQuantization<1, NWGC, GKXC, NWGK, int8_t>(
+        ck::utils::conv::ConvParam{1, 2, 2, 16, 8, {3}, {17}, {2}, {1}, {1}, {1}});
+    TestConvFwdResidualQuantization<2, NHWGC, GKYXC, NHWGK, int8_t>(ck::utils::conv::ConvParam{
+        2, 2, 2, 16, 8, {3, 3}, {9, 11}, {1, 2}, {2, 1}, {1, 1}, {1, 1}});
+    TestConvFwdResidualQuantization<3, NDHWGC, GKZYXC, NDHWGK, int8_t>(ck::utils::conv::ConvParam{
+        3, 1, 2, 8, 8, {1, 3, 3}, {4, 7, 7}, {1, 1, 1}, {1, 1, 1}, {0, 1, 1}, {0, 1, 1}});
+}
+
+TEST(ReferenceConvFwdMultipleD, ResidualQuantizationFp8)
+{
+    using namespace ck::tensor_layout::convolution;
+
+    TestConvFwdResidualQuantization<1, NWGC, GKXC, NWGK, ck::f8_t>(
+        ck::utils::conv::ConvParam{1, 2, 2, 16, 8, {3}, {17}, {2}, {1}, {1}, {1}});
+    TestConvFwdResidualQuantization<2, NHWGC, GKYXC, NHWGK, ck::f8_t>(ck::utils::conv::ConvParam{
+        2, 2, 2, 16, 8, {3, 3}, {9, 11}, {1, 2}, {2, 1}, {1, 1}, {1, 1}});
+    TestConvFwdResidualQuantization<3, NDHWGC, GKZYXC, NDHWGK, ck::f8_t>(ck::utils::conv::ConvParam{
+        3, 1, 2, 8, 8, {1, 3, 3}, {4, 7, 7}, {1, 1, 1}, {1, 1, 1}, {0, 1, 1}, {0, 1, 1}});
+}
+
+TEST(ReferenceConvFwdMultipleD, ResidualQuantizationEpilogue)
+{
+    const auto op = OutElementOp{0.5f, Relu{}};
+
+    int8_t y;
+
+    // 0.25 * (100 + 20) + 0.5 * (-10) = 25
+    op(y, int32_t{100}, int32_t{20}, 0.25f, int8_t{-10});
+    EXPECT_EQ(y, 25);
+
+    // the residual is added before the activation
+    op(y, int32_t{10}, int32_t{0}, 0.25f, int8_t{-10});
+    EXPECT_EQ(y, 0);
+
+    op(y, int32_t{10000}, int32_t{0}, 1.f, int8_t{0});
+    EXPECT_EQ(y, 127);
+
+    ck::f8_t y_f8;
+
+    op(y_f8, int32_t{10000}, int32_t{0}, 1.f, ck::type_convert<ck::f8_t>(0.f));
+    EXPECT_EQ(ck::type_convert<float>(y_f8), 240.f);
+
+    op(y_f8, int32_t{8}, int32_t{0}, 0.5f, ck::type_convert<ck::f8_t>(4.f));
+    EXPECT_EQ(ck::type_convert<float>(y_f8), 6.f);
+}
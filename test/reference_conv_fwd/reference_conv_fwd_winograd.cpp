@@ -0,0 +1,195 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/thread/threadwise_winograd_transform.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_winograd.hpp"
+
+namespace {
+
+using InElementOp  = ck::tensor_operation::element_wise::PassThrough;
+using WeiElementOp = ck::tensor_operation::element_wise::PassThrough;
+using OutElementOp = ck::tensor_operation::element_wise::PassThrough;
+
+using InLayout  = ck::tensor_layout::convolution::GNHWC;
+using WeiLayout = ck::tensor_layout::convolution::GKYXC;
+using OutLayout = ck::tensor_layout::convolution::GNHWK;
+
+// the transforms of one tile, in double, against the 3x3 correlation of the input tile. The
+// coefficients are floats, 1/6 and 1/24 of F(4x4, 3x3) are not exact
+template <ck::index_t OutputTileSize>
+void TestTileTransform()
+{
+    using Transform = ck::ThreadwiseWinogradTransform_3x3<OutputTileSize>;
+
+    constexpr ck::index_t FilterSize = Transform::FilterSize;
+    constexpr ck::index_t TileSize   = Transform::TileSize;
+
+    std::mt19937 gen(11939);
+    std::uniform_real_distribution<double> dis(-1.0, 1.0);
+
+    for(int iter = 0; iter < 16; ++iter)
+    {
+        double d[TileSize][TileSize];
+        double g[FilterSize][FilterSize];
+
+        for(auto& row : d)
+            for(auto& v : row)
+                v = dis(gen);
+
+        for(auto& row : g)
+            for(auto& v : row)
+                v = dis(gen);
+
+        double u[TileSize][TileSize];
+        double v[TileSize][TileSize];
+        double m[TileSize][TileSize];
+        double y[OutputTileSize][OutputTileSize];
+
+        Transform::FilterTransform(g, u);
+        Transform::InputTransform(d, v);
+
+        for(ck::index_t i = 0; i < TileSize; ++i)
+            for(ck::index_t j = 0; j < TileSize; ++j)
+                m[i][j] = u[i][j] * v[i][j];
+
+        Transform::OutputTransform(m, y);
+
+        for(ck::index_t i = 0; i < OutputTileSize; ++i)
+        {
+            for(ck::index_t j = 0; j < OutputTileSize; ++j)
+            {
+                double ref = 0;
+
+                for(ck::index_t y_ = 0; y_ < FilterSize; ++y_)
+                    for(ck::index_t x_ = 0; x_ < FilterSize; ++x_)
+                        ref += d[i + y_][j + x_] * g[y_][x_];
+
+                EXPECT_NEAR(y[i][j], ref, 1e-5) << "tile " << iter << ", (" << i << ", " << j
+                                                << ")";
+            }
+        }
+    }
+}
+
+// ReferenceConvFwdWinograd with float transforms against ReferenceConvFwd
+template <ck::index_t OutputTileSize>
+bool RunReferenceConvFwdWinograd(const ck::utils::conv::ConvParam& conv_param)
+{
+    using RefConv = ck::tensor_operation::host::
+        ReferenceConvFwd<2, float, float, float, InElementOp, WeiElementOp, OutElementOp>;
+
+    using RefConvWinograd = ck::tensor_operation::host::ReferenceConvFwdWinograd<float,
+                                                                                 float,
+                                                                                 float,
+                                                                                 float,
+                                                                                 InElementOp,
+                                                                                 WeiElementOp,
+                                                                                 OutElementOp,
+                                                                                 OutputTileSize>;
+
+    const auto in_g_n_c_wis_desc =
+        ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
+
+    const auto wei_g_k_c_xs_desc =
+        ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(conv_param);
+
+    const auto out_g_n_k_wos_desc =
+        ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(conv_param);
+
+    Tensor<float> in(in_g_n_c_wis_desc);
+    Tensor<float> wei(wei_g_k_c_xs_desc);
+    Tensor<float> out(out_g_n_k_wos_desc);
+    Tensor<float> out_winograd(out_g_n_k_wos_desc);
+
+    in.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    wei.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    auto ref_argument = RefConv{}.MakeArgument(in,
+                                               wei,
+                                               out,
+                                               conv_param.conv_filter_strides_,
+                                               conv_param.conv_filter_dilations_,
+                                               conv_param.input_left_pads_,
+                                               conv_param.input_right_pads_,
+                                               InElementOp{},
+                                               WeiElementOp{},
+                                               OutElementOp{});
+
+    RefConv{}.MakeInvoker().Run(ref_argument);
+
+    auto winograd_argument = RefConvWinograd::MakeArgument(in,
+                                                           wei,
+                                                           out_winograd,
+                                                           conv_param.conv_filter_strides_,
+                                                           conv_param.conv_filter_dilations_,
+                                                           conv_param.input_left_pads_,
+                                                           conv_param.input_right_pads_,
+                                                           InElementOp{},
+                                                           WeiElementOp{},
+                                                           OutElementOp{});
+
+    RefConvWinograd::MakeInvoker().Run(winograd_argument);
+
+    double max_abs_out = 0;
+
+    for(const auto& v : out.mData)
+        max_abs_out = std::max(max_abs_out, std::abs(static_cast<double>(v)));
+
+    // only the float rounding of the transforms, 1/6 and 1/24 are not exact for F(4x4, 3x3)
+    return ck::utils::check_err(
+        out_winograd, out, "Error: incorrect results!", 1e-5, 1e-5 * max_abs_out);
+}
+
+std::vector<ck::utils::conv::ConvParam> GetConvParams()
+{
+    return {
+        // output lengths multiple of both tile sizes
+        {2, 1, 2, 8, 4, {3, 3}, {10, 10}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+        {2, 2, 1, 4, 8, {3, 3}, {8, 8}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        // output lengths that are no tile multiple, the last tiles are partial
+        {2, 1, 2, 3, 5, {3, 3}, {13, 11}, {1, 1}, {1, 1}, {1, 1}, {1, 1}},
+        {2, 2, 1, 5, 3, {3, 3}, {7, 9}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+        // asymmetric padding
+        {2, 1, 1, 2, 6, {3, 3}, {9, 6}, {1, 1}, {1, 1}, {2, 0}, {1, 2}},
+        // output smaller than one tile
+        {2, 1, 3, 2, 2, {3, 3}, {3, 4}, {1, 1}, {1, 1}, {0, 1}, {0, 0}},
+    };
+}
+
+} // anonymous namespace
+
+TEST(ThreadwiseWinogradTransform, F2x2TileMatchesCorrelation) { TestTileTransform<2>(); }
+
+TEST(ThreadwiseWinogradTransform, F4x4TileMatchesCorrelation) { TestTileTransform<4>(); }
+
+TEST(ReferenceConvolutionFWDWinograd, F2x2MatchesDirect)
+{
+    for(const auto& param : GetConvParams())
+    {
+        EXPECT_TRUE(RunReferenceConvFwdWinograd<2>(param));
+    }
+}
+
+TEST(ReferenceConvolutionFWDWinograd, F4x4MatchesDirect)
+{
+    for(const auto& param : GetConvParams())
+    {
+        EXPECT_TRUE(RunReferenceConvFwdWinograd<4>(param));
+    }
+}
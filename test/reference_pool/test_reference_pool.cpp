@@ -0,0 +1,252 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_pool_fwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_maxpool_bwd.hpp"
+
+namespace {
+
+using ck::index_t;
+
+struct PoolProblem
+{
+    index_t N_;
+    index_t C_;
+    std::vector<index_t> in_spatial_lengths_;
+    std::vector<index_t> window_spatial_lengths_;
+    std::vector<index_t> window_strides_;
+    std::vector<index_t> in_left_pads_;
+    std::vector<index_t> in_right_pads_;
+
+    std::vector<index_t> GetOutSpatialLengths() const
+    {
+        std::vector<index_t> lengths;
+
+        for(std::size_t i = 0; i < in_spatial_lengths_.size(); ++i)
+        {
+            lengths.push_back((in_spatial_lengths_[i] + in_left_pads_[i] + in_right_pads_[i] -
+                               window_spatial_lengths_[i]) /
+                                  window_strides_[i] +
+                              1);
+        }
+
+        return lengths;
+    }
+};
+
+// N, C, spatial lengths with an N, spatial, C layout, as in the pooling profilers
+HostTensorDescriptor MakeNSpatialCDescriptor(index_t N,
+                                             index_t C,
+                                             const std::vector<index_t>& spatial_lengths)
+{
+    std::vector<std::size_t> lengths{static_cast<std::size_t>(N), static_cast<std::size_t>(C)};
+    std::vector<std::size_t> strides(2 + spatial_lengths.size());
+
+    std::size_t stride = C;
+
+    for(std::size_t i = spatial_lengths.size(); i > 0; --i)
+    {
+        strides[1 + i] = stride;
+        stride *= spatial_lengths[i - 1];
+    }
+
+    strides[0] = stride;
+    strides[1] = 1;
+
+    lengths.insert(lengths.end(), spatial_lengths.begin(), spatial_lengths.end());
+
+    return HostTensorDescriptor(lengths, strides);
+}
+
+template <index_t NDimSpatial, ck::ReduceTensorOp ReduceOpId, bool OutputIndex>
+struct PoolFwdRun
+{
+    using RefPool = ck::tensor_operation::host::ReferencePoolingFwd<NDimSpatial + 2,
+                                                                    NDimSpatial,
+                                                                    float,
+                                                                    float,
+                                                                    float,
+                                                                    int32_t,
+                                                                    ReduceOpId,
+                                                                    false,
+                                                                    OutputIndex>;
+
+    explicit PoolFwdRun(const PoolProblem& problem)
+        : problem_(problem),
+          in_(MakeNSpatialCDescriptor(problem.N_, problem.C_, problem.in_spatial_lengths_)),
+          out_(MakeNSpatialCDescriptor(problem.N_, problem.C_, problem.GetOutSpatialLengths())),
+          out_indices_(out_.mDesc)
+    {
+        // a small integer range, so that windows hold ties
+        in_.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    }
+
+    // the path Run() takes, i.e. the separable one
+    void RunSeparable()
+    {
+        auto argument = MakeArgument();
+
+        RefPool::MakeInvoker().Run(argument);
+    }
+
+    // the window loops
+    void RunDirect()
+    {
+        auto argument = MakeArgument();
+
+        if constexpr(NDimSpatial == 3)
+            RefPool::MakeInvoker().RunPooling3dFwd(argument);
+        else
+            RefPool::MakeInvoker().RunPooling2dFwd(argument);
+    }
+
+    typename RefPool::Argument MakeArgument()
+    {
+        return RefPool::MakeArgument(in_,
+                                     out_,
+                                     out_indices_,
+                                     problem_.window_spatial_lengths_,
+                                     problem_.window_strides_,
+                                     problem_.in_left_pads_,
+                                     problem_.in_right_pads_);
+    }
+
+    PoolProblem problem_;
+    Tensor<float> in_;
+    Tensor<float> out_;
+    Tensor<int32_t> out_indices_;
+};
+
+template <index_t NDimSpatial, ck::ReduceTensorOp ReduceOpId, bool OutputIndex>
+void TestSeparableMatchesDirect(const PoolProblem& problem)
+{
+    PoolFwdRun<NDimSpatial, ReduceOpId, OutputIndex> separable(problem);
+    PoolFwdRun<NDimSpatial, ReduceOpId, OutputIndex> direct(problem);
+
+    direct.in_ = separable.in_;
+
+    separable.RunSeparable();
+    direct.RunDirect();
+
+    EXPECT_TRUE(ck::utils::check_err(separable.out_, direct.out_));
+
+    if constexpr(OutputIndex)
+    {
+        EXPECT_TRUE(ck::utils::check_err(separable.out_indices_, direct.out_indices_));
+    }
+}
+
+std::vector<PoolProblem> Get2dProblems()
+{
+    return {
+        {2, 3, {17, 13}, {3, 3}, {2, 2}, {1, 1}, {1, 1}},
+        {1, 4, {9, 16}, {2, 3}, {1, 2}, {0, 1}, {1, 0}},
+        {3, 2, {7, 7}, {7, 7}, {1, 1}, {0, 0}, {0, 0}},
+        {2, 5, {12, 10}, {4, 2}, {3, 1}, {2, 1}, {2, 1}},
+        {1, 1, {1, 1}, {1, 1}, {1, 1}, {0, 0}, {0, 0}},
+    };
+}
+
+std::vector<PoolProblem> Get3dProblems()
+{
+    return {
+        {2, 2, {7, 9, 8}, {3, 2, 3}, {2, 1, 2}, {1, 0, 1}, {1, 0, 1}},
+        {1, 3, {5, 6, 11}, {2, 3, 3}, {1, 2, 3}, {1, 1, 0}, {0, 1, 2}},
+        {2, 1, {4, 4, 4}, {4, 4, 4}, {1, 1, 1}, {0, 0, 0}, {0, 0, 0}},
+    };
+}
+
+template <index_t NDimSpatial>
+void TestMaxPoolBwd(const PoolProblem& problem)
+{
+    using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+    using RefPoolBwd =
+        ck::tensor_operation::host::ReferenceMaxPoolBwd<float, int32_t, float, float, PassThrough>;
+
+    // the indices of the forward pass are offsets into the input tensor
+    PoolFwdRun<NDimSpatial, ck::ReduceTensorOp::MAX, true> fwd(problem);
+
+    fwd.RunSeparable();
+
+    Tensor<float> dout(fwd.out_.mDesc);
+    Tensor<float> din(fwd.in_.mDesc);
+    Tensor<float> din_sequential(fwd.in_.mDesc);
+
+    dout.GenerateTensorValue(GeneratorTensor_3<float>{-1.0, 1.0});
+
+    auto argument = RefPoolBwd::MakeArgument(dout, fwd.out_indices_, din, PassThrough{});
+
+    RefPoolBwd::MakeInvoker().Run(argument);
+
+    // sequential scatter, in the order of dout
+    din_sequential.SetZero();
+
+    for(std::size_t i = 0; i < dout.mData.size(); ++i)
+    {
+        din_sequential.mData[fwd.out_indices_.mData[i]] += dout.mData[i];
+    }
+
+    EXPECT_TRUE(ck::utils::check_err(din, din_sequential, "Error: incorrect results!", 0, 0));
+}
+
+} // namespace
+
+TEST(ReferencePoolFwd, MaxPool2dSeparableMatchesDirect)
+{
+    for(const auto& problem : Get2dProblems())
+    {
+        TestSeparableMatchesDirect<2, ck::ReduceTensorOp::MAX, true>(problem);
+        TestSeparableMatchesDirect<2, ck::ReduceTensorOp::MAX, false>(problem);
+    }
+}
+
+TEST(ReferencePoolFwd, MaxPool3dSeparableMatchesDirect)
+{
+    for(const auto& problem : Get3dProblems())
+    {
+        TestSeparableMatchesDirect<3, ck::ReduceTensorOp::MAX, true>(problem);
+        TestSeparableMatchesDirect<3, ck::ReduceTensorOp::MAX, false>(problem);
+    }
+}
+
+TEST(ReferencePoolFwd, AvgPool2dSeparableMatchesDirect)
+{
+    for(const auto& problem : Get2dProblems())
+    {
+        TestSeparableMatchesDirect<2, ck::ReduceTensorOp::AVG, false>(problem);
+    }
+}
+
+TEST(ReferencePoolFwd, AvgPool3dSeparableMatchesDirect)
+{
+    for(const auto& problem : Get3dProblems())
+    {
+        TestSeparableMatchesDirect<3, ck::ReduceTensorOp::AVG, false>(problem);
+    }
+}
+
+TEST(ReferenceMaxPoolBwd, MaxPool2dIndicesMatchSequentialScatter)
+{
+    for(const auto& problem : Get2dProblems())
+    {
+        TestMaxPoolBwd<2>(problem);
+    }
+}
+
+TEST(ReferenceMaxPoolBwd, MaxPool3dIndicesMatchSequentialScatter)
+{
+    for(const auto& problem : Get3dProblems())
+    {
+        TestMaxPoolBwd<3>(problem);
+    }
+}
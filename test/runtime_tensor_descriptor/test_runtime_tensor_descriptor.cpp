@@ -0,0 +1,191 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <array>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_description/tensor_descriptor.hpp"
+#include "ck/tensor_description/tensor_descriptor_helper.hpp"
+#include "ck/tensor_description/runtime_tensor_descriptor.hpp"
+#include "ck/tensor_operation/gpu/device/convolution_forward_specialization.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm.hpp"
+#include "ck/tensor_operation/operator_transform/transform_conv_fwd_to_gemm_runtime.hpp"
+
+#include "test/conv_util/conv_fwd_test_util.hpp"
+
+using namespace ck;
+using conv_fwd_test_util::ConvFwdProblem;
+
+using Desc = RuntimeTensorDescriptor<>;
+
+// same lengths, offsets and valid indices as the 2D compile-time descriptor
+template <typename ExpectedDesc>
+void ExpectSameMapping2d(const ExpectedDesc& expected, const Desc& desc)
+{
+    ASSERT_EQ(desc.GetNumOfDimension(), 2);
+    ASSERT_EQ(desc.GetLength(0), expected.GetLength(Number<0>{}));
+    ASSERT_EQ(desc.GetLength(1), expected.GetLength(Number<1>{}));
+
+    for(index_t i = 0; i < desc.GetLength(0); ++i)
+    {
+        for(index_t j = 0; j < desc.GetLength(1); ++j)
+        {
+            const auto idx   = make_multi_index(i, j);
+            const auto coord = make_tensor_coordinate(expected, idx);
+            const bool valid = coordinate_has_valid_offset(expected, coord);
+
+            ASSERT_EQ(desc.IsValidIndex(idx), valid) << i << ", " << j;
+
+            if(valid)
+            {
+                ASSERT_EQ(desc.CalculateOffset(idx), coord.GetOffset()) << i << ", " << j;
+            }
+        }
+    }
+}
+
+TEST(RuntimeTensorDescriptor, Naive)
+{
+    const auto expected = make_naive_tensor_descriptor(make_tuple(3, 4, 5), make_tuple(40, 10, 2));
+    const auto desc     = Desc::MakeNaive({3, 4, 5}, {40, 10, 2});
+
+    EXPECT_EQ(desc.GetNumOfDimension(), 3);
+    EXPECT_EQ(desc.GetElementSize(), 60);
+    EXPECT_EQ(desc.GetElementSpaceSize(), expected.GetElementSpaceSize());
+
+    for(index_t i = 0; i < 3; ++i)
+    {
+        for(index_t j = 0; j < 4; ++j)
+        {
+            for(index_t k = 0; k < 5; ++k)
+            {
+                const auto idx = make_multi_index(i, j, k);
+
+                EXPECT_EQ(desc.CalculateOffset(idx), expected.CalculateOffset(idx));
+            }
+        }
+    }
+}
+
+TEST(RuntimeTensorDescriptor, UnMergeMergePad)
+{
+    const auto expected_6_35 = make_naive_tensor_descriptor_packed(make_tuple(6, 35));
+
+    const auto expected_6_5_7 = transform_tensor_descriptor(
+        expected_6_35,
+        make_tuple(make_pass_through_transform(6), make_unmerge_transform(make_tuple(5, 7))),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1, 2>{}));
+
+    const auto expected_42_5 = transform_tensor_descriptor(
+        expected_6_5_7,
+        make_tuple(make_merge_transform(make_tuple(6, 7)), make_pass_through_transform(5)),
+        make_tuple(Sequence<0, 2>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    const auto expected = transform_tensor_descriptor(
+        expected_42_5,
+        make_tuple(make_pad_transform(42, 3, 1), make_pad_transform(5, 0, 2)),
+        make_tuple(Sequence<0>{}, Sequence<1>{}),
+        make_tuple(Sequence<0>{}, Sequence<1>{}));
+
+    auto desc = Desc::MakePacked({6, 35});
+
+    desc.UnMerge(1, {5, 7});
+    desc.Merge({0, 2});
+    desc.Pad(0, 3, 1);
+    desc.Pad(1, 0, 2);
+
+    ExpectSameMapping2d(expected, desc);
+}
+
+template <index_t NDimSpatial, typename ALayout, typename BLayout, typename CLayout>
+void TestConvFwd(const std::array<index_t, NDimSpatial>& input_spatial_lengths,
+                 const std::array<index_t, NDimSpatial>& filter_spatial_lengths,
+                 const std::array<index_t, NDimSpatial>& conv_filter_strides,
+                 const std::array<index_t, NDimSpatial>& conv_filter_dilations,
+                 const std::array<index_t, NDimSpatial>& input_left_pads,
+                 const std::array<index_t, NDimSpatial>& input_right_pads)
+{
+    constexpr index_t G = 2;
+    constexpr index_t N = 2;
+    constexpr index_t C = 3;
+    constexpr index_t K = 4;
+
+    const ConvFwdProblem<NDimSpatial> problem(G,
+                                              N,
+                                              C,
+                                              K,
+                                              input_spatial_lengths,
+                                              filter_spatial_lengths,
+                                              conv_filter_strides,
+                                              conv_filter_dilations,
+                                              input_left_pads,
+                                              input_right_pads);
+
+    const auto& a_g_n_c_wis_lengths = problem.a_g_n_c_wis_lengths_;
+    const auto& b_g_k_c_xs_lengths  = problem.b_g_k_c_xs_lengths_;
+    const auto& c_g_n_k_wos_lengths = problem.c_g_n_k_wos_lengths_;
+    const auto& a_g_n_c_wis_strides = problem.a_g_n_c_wis_strides_;
+    const auto& b_g_k_c_xs_strides  = problem.b_g_k_c_xs_strides_;
+    const auto& c_g_n_k_wos_strides = problem.c_g_n_k_wos_strides_;
+
+    using Transform = tensor_operation::
+        TransformConvFwdToGemm<NDimSpatial,
+                               tensor_operation::device::ConvolutionForwardSpecialization::Default>;
+    using RuntimeTransform = tensor_operation::TransformConvFwdToGemmRuntime<Desc>;
+
+    ExpectSameMapping2d(
+        Transform::template MakeADescriptor_M_K<ALayout>(a_g_n_c_wis_lengths,
+                                                         a_g_n_c_wis_strides,
+                                                         b_g_k_c_xs_lengths,
+                                                         b_g_k_c_xs_strides,
+                                                         c_g_n_k_wos_lengths,
+                                                         c_g_n_k_wos_strides,
+                                                         conv_filter_strides,
+                                                         conv_filter_dilations,
+                                                         input_left_pads,
+                                                         input_right_pads),
+        RuntimeTransform::template MakeADescriptor_M_K<NDimSpatial>(a_g_n_c_wis_lengths,
+                                                                    a_g_n_c_wis_strides,
+                                                                    b_g_k_c_xs_lengths,
+                                                                    c_g_n_k_wos_lengths,
+                                                                    conv_filter_strides,
+                                                                    conv_filter_dilations,
+                                                                    input_left_pads,
+                                                                    input_right_pads));
+
+    ExpectSameMapping2d(
+        Transform::template MakeBDescriptor_N_K<BLayout>(b_g_k_c_xs_lengths, b_g_k_c_xs_strides),
+        RuntimeTransform::template MakeBDescriptor_N_K<NDimSpatial>(b_g_k_c_xs_lengths,
+                                                                    b_g_k_c_xs_strides));
+
+    ExpectSameMapping2d(
+        Transform::template MakeCDescriptor_M_N<CLayout>(c_g_n_k_wos_lengths, c_g_n_k_wos_strides),
+        RuntimeTransform::template MakeCDescriptor_M_N<NDimSpatial>(c_g_n_k_wos_lengths,
+                                                                    c_g_n_k_wos_strides));
+}
+
+TEST(RuntimeTensorDescriptor, ConvFwd1d)
+{
+    using namespace tensor_layout::convolution;
+
+    TestConvFwd<1, NWGC, KXGC, NWGK>({9}, {3}, {2}, {1}, {1}, {1});
+}
+
+TEST(RuntimeTensorDescriptor, ConvFwd2d)
+{
+    using namespace tensor_layout::convolution;
+
+    TestConvFwd<2, NHWGC, KYXGC, NHWGK>({7, 6}, {3, 2}, {2, 1}, {1, 2}, {1, 0}, {2, 1});
+}
+
+TEST(RuntimeTensorDescriptor, ConvFwd3d)
+{
+    using namespace tensor_layout::convolution;
+
+    TestConvFwd<3, NDHWGC, KZYXGC, NDHWGK>(
+        {5, 4, 6}, {3, 1, 2}, {1, 2, 2}, {2, 1, 1}, {1, 0, 1}, {1, 1, 0});
+}